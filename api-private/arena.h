@@ -0,0 +1,115 @@
+/* > Description *******************************************************************/
+/**
+ * @file arena.h
+ * @brief
+ *   This header file defines the public interface for the Arena, a bump
+ *   allocator over a single reservation. Everything carved from an arena is
+ *   released at once by rewinding or destroying it, never one by one, so a
+ *   search reserves its scratch memory once and reuses it for every attempt.
+ *
+ *****************************************************************************/
+
+/* > Multiple Inclusion Protection ****************************************/
+#ifndef ARENA_H
+#define ARENA_H
+
+/* > Includes *************************************************************/
+#include <stdbool.h>
+#include <stddef.h>
+
+/* > Defines **************************************************************/
+
+/**
+ * @brief Alignment of every block carved from an arena, one cache line, so
+ *        blocks written by different threads never share a line.
+ */
+#define ARENA_CACHE_LINE_SIZE 64U
+
+/* > Type Declarations ****************************************************/
+
+/**
+ * @brief Opaque pointer to the internal Arena structure.
+ */
+typedef struct Arena Arena;
+
+/* > Constant Declarations ************************************************/
+
+/* > Variable Declarations ************************************************/
+
+/* > Function Declarations ************************************************/
+
+/**
+ * @brief Reserves a new arena.
+ *
+ * The reservation is only address space, its pages are backed on first
+ * touch. With hugepages requested, explicit hugepages are tried first, then
+ * transparent hugepages, and the arena silently falls back to normal pages.
+ *
+ * @param[in] capacity     The number of bytes the arena can hand out.
+ * @param[in] useHugePages Back the arena with hugepages when the system allows it.
+ * @return A pointer to the newly created Arena.
+ */
+[[nodiscard]] Arena *ARENA_createArena(size_t capacity, bool useHugePages);
+
+/**
+ * @brief Releases the whole reservation of an arena.
+ *
+ * @param[in,out] arena_pp A pointer to the pointer of the arena to be
+ *                         destroyed. The pointer is set to NULL after destruction.
+ */
+void ARENA_destroyArena(Arena **const arena_pp);
+
+/**
+ * @brief Carves a block from an arena.
+ *
+ * The block is aligned to ARENA_CACHE_LINE_SIZE. Its content is zero the
+ * first time its memory is handed out, and left over from the previous
+ * blocks after a rewind. Running out of the reservation is fatal.
+ *
+ * @param[in,out] arena_p A pointer to the arena.
+ * @param[in]     size    The size of the block in bytes.
+ * @return A pointer to the block.
+ */
+[[nodiscard]] void *ARENA_allocate(Arena *const arena_p, size_t size);
+
+/**
+ * @brief Gets the number of bytes handed out so far, a mark for ARENA_rewind.
+ *
+ * @param[in] arena_p A pointer to the arena.
+ * @return The number of bytes in use, alignment included.
+ */
+[[nodiscard]] size_t ARENA_getUsedBytes(const Arena *const arena_p);
+
+/**
+ * @brief Gets the number of bytes an arena can hand out.
+ *
+ * @param[in] arena_p A pointer to the arena.
+ * @return The capacity of the arena.
+ */
+[[nodiscard]] size_t ARENA_getCapacity(const Arena *const arena_p);
+
+/**
+ * @brief Checks whether an arena is backed by explicit or transparent hugepages.
+ *
+ * @param[in] arena_p A pointer to the arena.
+ * @return `true` if hugepages were granted for the reservation.
+ */
+[[nodiscard]] bool ARENA_usesHugePages(const Arena *const arena_p);
+
+/**
+ * @brief Releases every block carved after a mark, the blocks before it stay valid.
+ *
+ * @param[in,out] arena_p A pointer to the arena.
+ * @param[in]     mark    A value returned by ARENA_getUsedBytes.
+ */
+void ARENA_rewind(Arena *const arena_p, size_t mark);
+
+/**
+ * @brief Releases every block of an arena, the reservation is kept.
+ *
+ * @param[in,out] arena_p A pointer to the arena.
+ */
+void ARENA_reset(Arena *const arena_p);
+
+/* > End of Multiple Inclusion Protection *********************************/
+#endif // ARENA_H
@@ -0,0 +1,60 @@
+/* > Description *******************************************************************/
+/**
+ * @file batchQueries.h
+ * @brief
+ *   This header file defines the public interface for the batch mode. A stream
+ *   of queries runs against a single loaded WorldMatrix and one
+ *   DFS_SearchContext, so the matrix, the worker threads and their buffers
+ *   are set up once for the whole workload.
+ *
+ *   Every line of the stream holds one query:
+ *     - `find N`      searches a path of N cells and answers with one line,
+ *                     `path N r,c r,c ...` or `none N`, or `timeout N`
+ *                     when the timeout or the node budget of the options
+ *                     stopped the search first,
+ *     - `block R C`   blocks a cell for the following searches,
+ *     - `unblock R C` unblocks a cell for the following searches.
+ *   Empty lines and lines starting with # are skipped. Rejected lines are
+ *   reported on stderr, unless OUTPUT_setQuiet silenced the diagnostics, and
+ *   do not stop the stream.
+ *
+ *****************************************************************************/
+
+/* > Multiple Inclusion Protection ****************************************/
+#ifndef BATCH_QUERIES_H
+#define BATCH_QUERIES_H
+
+/* > Includes *************************************************************/
+#include "dfsPathFinding.h"
+#include "matrixWorld.h"
+#include <stdint.h>
+#include <stdio.h>
+
+/* > Defines **************************************************************/
+
+/* > Type Declarations ****************************************************/
+
+/* > Constant Declarations ************************************************/
+
+/* > Variable Declarations ************************************************/
+
+/* > Function Declarations ************************************************/
+
+/**
+ * @brief Runs every query of a stream against a matrix.
+ *
+ * @param[in,out] matrix_p  A pointer to the WorldMatrix, edited by the
+ *                          block and unblock queries.
+ * @param[in]     options_p A pointer to the options of every search, NULL
+ *                          for the defaults.
+ * @param[in]     input_p   The stream of queries, read until its end.
+ * @param[out]    output_p  The stream the answers of the find queries are
+ *                          written to.
+ * @return The number of rejected query lines.
+ */
+[[nodiscard]] uint32_t BATCH_runQueries(WorldMatrix *const matrix_p,
+                                        const DFS_SearchOptions *const options_p,
+                                        FILE *input_p, FILE *output_p);
+
+/* > End of Multiple Inclusion Protection *********************************/
+#endif // BATCH_QUERIES_H
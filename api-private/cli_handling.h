@@ -9,6 +9,9 @@
 #ifndef CLI_HANDLING_H
 #define CLI_HANDLING_H
 
+#include "dfsPathFinding.h"
+#include "gridLoader.h"
+#include "pathOutput.h"
 #include "utilities.h"
 #include <stdbool.h>
 #include <stdint.h>
@@ -23,9 +26,30 @@ typedef struct {
   uint16_t cols;              /**< Number of columns in the matrix. */
   uint32_t pathLength;        /**< The target length of the path to find. */
   bool isMultithreading;      /**< Flag to enable the multithreaded algorithm. */
+  uint16_t noOfThreads;       /**< Worker threads, 0 to auto-detect. */
+  bool pinThreads;            /**< Flag to pin every worker thread to its own CPU. */
+  bool useHugePages;          /**< Flag to back the search buffers with hugepages. */
+  uint64_t seed;              /**< Seed of the search, RANDOM_GEN_SEED by default. */
+  DFS_Ordering ordering;      /**< Neighbor ordering strategy of the search. */
+  DFS_Engine engine;          /**< Search engine, DFS_ENGINE_ITERATIVE by default. */
   Cords *blockedCells;        /**< Dynamic array of coordinates for blocked cells. */
   uint32_t blockedCellsCount; /**< Number of elements in the blockedCells array. */
-  const char *blockedCellsFile; /**< Path to a file containing blocked cell coordinates. */
+  uint32_t blockedCellsCapacity; /**< Allocated elements of the blockedCells array. */
+  const char *blockedCellsFile; /**< Path to a file containing blocked cell coordinates,
+                                     loaded into the matrix by LOADER_loadBlockedCellsFile. */
+  const char *gridFile;       /**< Path to a binary grid file, which also sets rows and cols. */
+  const char *saveGridFile;   /**< Path the final matrix is written to as a binary grid file. */
+  LOADER_GridEncoding gridEncoding; /**< Payload encoding used for saveGridFile. */
+  const char *batchFile;      /**< Query stream of the batch mode, "-" for stdin. */
+  const char *outputFile;     /**< File only the found path is written to, "-" for stdout. */
+  OUTPUT_Format outputFormat; /**< Format of the path written to outputFile. */
+  bool isQuiet;               /**< Flag to silence the banners and the diagnostics. */
+  bool printStats;            /**< Flag to print the per-thread statistics of the search. */
+  uint32_t timeoutMs;         /**< Time limit of the search in milliseconds, 0 for none. */
+  uint64_t nodeBudget;        /**< Limit of the cells the search expands, 0 for none. */
+  bool isComplete;            /**< Flag to search the whole tree of every start. */
+  bool usePortfolio;          /**< Flag to give the worker threads different strategies. */
+  uint16_t noOfTiles;         /**< Tiles per side of the tiled search, 0 for one search. */
 } Parameters;
 
 /* > Function Declarations ************************************************************************/
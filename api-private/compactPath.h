@@ -0,0 +1,121 @@
+/* > Description *******************************************************************/
+/**
+ * @file compactPath.h
+ * @brief
+ *   This header file defines the public interface for the compact storage of
+ *   a contiguous path. Every cell after the first one is one 2-bit step from
+ *   the previous one, an index into directions[], so a cell costs a quarter of
+ *   a byte instead of the 4 bytes of a Cords. Paths that are kept around, such
+ *   as cached ones, take about 16 times less memory this way.
+ *
+ *   The steps are decoded in order by an iterator. Random access starts from
+ *   the closest of the checkpoint cells stored every
+ *   COMPACTPATH_CHECKPOINT_INTERVAL steps and sums up the steps in between 32
+ *   at a time, so it never walks the whole path.
+ *
+ *****************************************************************************/
+
+/* > Multiple Inclusion Protection ****************************************/
+#ifndef COMPACT_PATH_H
+#define COMPACT_PATH_H
+
+/* > Includes *************************************************************/
+#include "path.h"
+#include "utilities.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* > Defines **************************************************************/
+
+/**
+ * @brief Number of steps between two checkpoint cells, a multiple of the 32
+ *        steps of a word.
+ */
+#define COMPACTPATH_CHECKPOINT_INTERVAL 1024U
+
+/* > Type Declarations ****************************************************/
+
+/**
+ * @brief Opaque pointer to the internal CompactPath structure.
+ */
+typedef struct CompactPath CompactPath;
+
+/**
+ * @brief Decodes the cells of a CompactPath in order, see COMPACTPATH_initIterator.
+ */
+typedef struct {
+  const CompactPath *path_p; /**< The path being decoded. */
+  size_t nextIndex;          /**< The index of the cell returned next. */
+  Cords cell;                /**< The cell at nextIndex, once it is in range. */
+} CompactPathIterator;
+
+/* > Constant Declarations ************************************************/
+
+/* > Variable Declarations ************************************************/
+
+/* > Function Declarations ************************************************/
+
+/**
+ * @brief Encodes a contiguous path.
+ * @param path_p[in] A pointer to the Path.
+ * @return A pointer to the new CompactPath, or NULL if the path is not
+ *         contiguous. The caller frees it using COMPACTPATH_freePath().
+ */
+[[nodiscard]] CompactPath *COMPACTPATH_encodePath(const Path *const path_p);
+
+/**
+ * @brief Frees a compact path.
+ * @param path_pp[in,out] Pointer to the pointer of the CompactPath, set to NULL.
+ */
+void COMPACTPATH_freePath(CompactPath **const path_pp);
+
+/**
+ * @brief Decodes a compact path into a Path.
+ * @param compact_p[in] A pointer to the CompactPath.
+ * @param path_p[out]   The path, cleared first.
+ * @return false if the path can not hold every cell, it is left empty then.
+ */
+[[nodiscard]] bool COMPACTPATH_decodePath(const CompactPath *const compact_p, Path *const path_p);
+
+/**
+ * @brief Gets the number of cells of a compact path.
+ * @param compact_p[in] A pointer to the CompactPath.
+ * @return The number of cells.
+ */
+[[nodiscard]] size_t COMPACTPATH_getLength(const CompactPath *const compact_p);
+
+/**
+ * @brief Decodes a single cell, starting from the checkpoint in front of it.
+ * @param compact_p[in] A pointer to the CompactPath.
+ * @param index[in]     The index of the cell in the path.
+ * @return The cell, or Cords with UINT16_MAX if the index is out of range.
+ */
+[[nodiscard]] Cords COMPACTPATH_getCell(const CompactPath *const compact_p, size_t index);
+
+/**
+ * @brief Gets the total byte size of a compact path, steps and checkpoints included.
+ * @param compact_p[in] A pointer to the CompactPath.
+ * @return The size of the CompactPath in bytes.
+ */
+[[nodiscard]] size_t COMPACTPATH_getByteSize(const CompactPath *const compact_p);
+
+/**
+ * @brief Sets up an iterator over the cells of a compact path.
+ * @param iterator_p[out] The iterator.
+ * @param compact_p[in]   A pointer to the CompactPath.
+ * @param startIndex[in]  The index of the first cell the iterator returns.
+ */
+void COMPACTPATH_initIterator(CompactPathIterator *const iterator_p,
+                              const CompactPath *const compact_p, size_t startIndex);
+
+/**
+ * @brief Decodes the next cell of an iterator.
+ * @param iterator_p[in,out] The iterator.
+ * @param cell_p[out]        The cell.
+ * @return false once every cell has been returned.
+ */
+[[nodiscard]] bool COMPACTPATH_nextCell(CompactPathIterator *const iterator_p, Cords *const cell_p);
+
+/* > End of Multiple Inclusion Protection *********************************/
+#endif // COMPACT_PATH_H
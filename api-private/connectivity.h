@@ -0,0 +1,140 @@
+/* > Description *******************************************************************/
+/**
+ * @file connectivity.h
+ * @brief
+ *   This header file defines the public interface for the ComponentMap data
+ *   structure. It labels the 4-connected components of unblocked cells of a
+ *   WorldMatrix and records their sizes, so searches can discard starting
+ *   points whose component cannot hold the requested path.
+ *
+ *****************************************************************************/
+
+/* > Multiple Inclusion Protection ****************************************/
+#ifndef CONNECTIVITY_H
+#define CONNECTIVITY_H
+
+/* > Includes *************************************************************/
+#include "matrixWorld.h"
+#include "utilities.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* > Defines **************************************************************/
+
+/**
+ * @brief Label reported for blocked cells, which belong to no component.
+ */
+#define CONNECTIVITY_NO_COMPONENT UINT32_MAX
+
+/* > Type Declarations ****************************************************/
+
+/**
+ * @brief Opaque pointer to the internal ComponentMap structure.
+ */
+typedef struct ComponentMap ComponentMap;
+
+/* > Constant Declarations ************************************************/
+
+/* > Variable Declarations ************************************************/
+
+/* > Function Declarations ************************************************/
+
+/**
+ * @brief Labels the connected components of unblocked cells of a matrix.
+ *
+ * The matrix is split into horizontal stripes labelled in parallel with a
+ * union-find, the stripes are then merged along their shared borders.
+ *
+ * @param[in] matrix_p     A pointer to an initialized WorldMatrix.
+ * @param[in] noOfThreads  Number of threads used for labelling, 0 or 1 runs
+ *                         on the calling thread only.
+ * @return A pointer to the newly created ComponentMap.
+ */
+[[nodiscard]] ComponentMap *CONNECTIVITY_labelComponents(const WorldMatrix *const matrix_p,
+                                                         uint16_t noOfThreads);
+
+/**
+ * @brief Creates an unlabelled ComponentMap sized for a matrix.
+ *
+ * The map can be labelled again and again without allocating, with
+ * CONNECTIVITY_labelStripe and CONNECTIVITY_finishLabelling for any matrix
+ * of the same size.
+ *
+ * @param[in] matrix_p A pointer to an initialized WorldMatrix.
+ * @return A pointer to the newly created ComponentMap.
+ */
+[[nodiscard]] ComponentMap *CONNECTIVITY_createComponentMap(const WorldMatrix *const matrix_p);
+
+/**
+ * @brief First labelling phase, runs the union-find over one stripe of rows.
+ *
+ * The stripes are [rows * stripe / noOfStripes, rows * (stripe + 1) / noOfStripes),
+ * distinct stripes may be labelled concurrently.
+ *
+ * @param[in,out] map_p       A pointer to the map to label.
+ * @param[in]     matrix_p    A pointer to a WorldMatrix of the map's size.
+ * @param[in]     stripe      Index of the stripe, below noOfStripes.
+ * @param[in]     noOfStripes Number of stripes, at most the number of rows.
+ */
+void CONNECTIVITY_labelStripe(ComponentMap *const map_p, const WorldMatrix *const matrix_p,
+                              uint16_t stripe, uint16_t noOfStripes);
+
+/**
+ * @brief Second labelling phase, merges the labelled stripes and computes the
+ *        dense labels and the component sizes.
+ *
+ * @param[in,out] map_p       A pointer to the map whose every stripe is labelled.
+ * @param[in]     noOfStripes Number of stripes passed to CONNECTIVITY_labelStripe.
+ */
+void CONNECTIVITY_finishLabelling(ComponentMap *const map_p, uint16_t noOfStripes);
+
+/**
+ * @brief Frees all memory associated with the ComponentMap.
+ *
+ * @param[in,out] map_pp A pointer to the pointer of the map to be destroyed.
+ *                       The pointer is set to NULL after destruction.
+ */
+void CONNECTIVITY_freeComponentMap(ComponentMap **const map_pp);
+
+/**
+ * @brief Gets the component label of a cell.
+ *
+ * @param[in] map_p A pointer to the map.
+ * @param[in] row   The row of the cell.
+ * @param[in] col   The column of the cell.
+ * @return A label in [0, number of components), or CONNECTIVITY_NO_COMPONENT
+ *         for a blocked cell.
+ */
+[[nodiscard]] uint32_t CONNECTIVITY_getComponentLabel(const ComponentMap *const map_p,
+                                                      uint16_t row, uint16_t col);
+
+/**
+ * @brief Gets the size of the component containing a cell.
+ *
+ * @param[in] map_p A pointer to the map.
+ * @param[in] row   The row of the cell.
+ * @param[in] col   The column of the cell.
+ * @return The number of cells of the component, 0 for a blocked cell.
+ */
+[[nodiscard]] uint32_t CONNECTIVITY_getComponentSize(const ComponentMap *const map_p,
+                                                     uint16_t row, uint16_t col);
+
+/**
+ * @brief Gets the size of the largest component.
+ *
+ * @param[in] map_p A pointer to the map.
+ * @return The number of cells of the largest component, 0 if every cell is blocked.
+ */
+[[nodiscard]] uint32_t CONNECTIVITY_getLargestComponentSize(const ComponentMap *const map_p);
+
+/**
+ * @brief Gets the number of components.
+ *
+ * @param[in] map_p A pointer to the map.
+ * @return The number of connected components of unblocked cells.
+ */
+[[nodiscard]] uint32_t CONNECTIVITY_getNoOfComponents(const ComponentMap *const map_p);
+
+/* > End of Multiple Inclusion Protection *********************************/
+#endif // CONNECTIVITY_H
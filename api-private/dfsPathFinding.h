@@ -13,12 +13,146 @@
 /* > Includes *************************************************************/
 #include "matrixWorld.h"
 #include "path.h"
+#include "startScheduler.h"
+#include <stdbool.h>
 #include <stdint.h>
 
 /* > Defines **************************************************************/
 
 /* > Type Declarations ****************************************************/
 
+/**
+ * @brief Selects the backtracking engine used for every search attempt.
+ */
+typedef enum {
+  DFS_ENGINE_ITERATIVE = 0, /**< Explicit, preallocated frame stack (default). */
+  DFS_ENGINE_RECURSIVE,     /**< One recursion level per path cell, kept for comparison. */
+  DFS_ENGINE_BIDIRECTIONAL  /**< Explicit frame stack, the path grows at whichever of
+                                 its two ends has more free neighbors. */
+} DFS_Engine;
+
+/**
+ * @brief Selects the order in which the iterative engine expands neighbors.
+ */
+typedef enum {
+  DFS_ORDERING_RANDOM = 0, /**< Pseudo-random order per cell and attempt (default). */
+  DFS_ORDERING_FIXED,      /**< The order of the directions[] table. */
+  DFS_ORDERING_WARNSDORFF  /**< Fewest onward unvisited neighbors first. */
+} DFS_Ordering;
+
+/**
+ * @brief Selects the steps a path may take from one cell to the next.
+ */
+typedef enum {
+  DFS_NEIGHBORHOOD_FOUR = 0, /**< Right, left, down and up, as in directions[] (default). */
+  DFS_NEIGHBORHOOD_EIGHT     /**< The four diagonal steps as well, a step may then change
+                                  both the row and the column by one. Its kernels index
+                                  the cells with a border around the matrix and the rows
+                                  padded to 64 cells in 32 bits, which holds any matrix
+                                  of at most 65470 rows. A search on a larger one returns
+                                  DFS_STATUS_UNSUPPORTED. */
+} DFS_Neighborhood;
+
+/**
+ * @brief Outcome of a search.
+ */
+typedef enum {
+  DFS_STATUS_FOUND = 0,        /**< A path of the requested length was found. */
+  DFS_STATUS_NOT_FOUND,        /**< No path was found from any tried start. Only with
+                                    `isComplete` is that a proof that none exists. */
+  DFS_STATUS_TIMED_OUT,        /**< The timeout expired before a path was found. */
+  DFS_STATUS_BUDGET_EXHAUSTED, /**< The node budget ran out before a path was found. */
+  DFS_STATUS_UNSUPPORTED       /**< The options can not search the matrix, nothing was
+                                    searched, see DFS_Neighborhood. */
+} DFS_SearchStatus;
+
+/**
+ * @brief Options controlling a DFS_findPathWithOptions search.
+ *
+ * Obtain the defaults with DFS_getDefaultOptions() and override fields as needed.
+ */
+typedef struct {
+  bool isMultithreading;       /**< Run the search on parallel worker threads. */
+  DFS_Engine engine;           /**< Backtracking engine used by every attempt. */
+  DFS_Ordering ordering;       /**< Neighbor ordering, the recursive engine is always fixed. */
+  bool useComponentPruning;    /**< Skip components smaller than the path (default on). */
+  bool useReachabilityPruning; /**< Prune branches whose reachable free cells cannot
+                                    hold the rest of the path (iterative engine only). */
+  SchedulerOrder startOrder;   /**< Order in which the starting points are tried. */
+  uint64_t seed;               /**< Seed of the start shuffle and of every thread's stream. */
+  uint16_t noOfThreads;        /**< Worker threads when multithreading, 0 to auto-detect. */
+  bool pinThreads;             /**< Pin every worker thread to its own CPU. */
+  bool useHugePages;           /**< Back the scratch arena of every worker with hugepages. */
+  uint32_t timeoutMs;          /**< Wall time limit of a search in milliseconds, 0 for none. */
+  uint64_t nodeBudget;         /**< Limit of the cells expanded by all threads, 0 for none. */
+  bool isComplete;             /**< Free the cells of every failed branch, so the whole
+                                    tree of every start is searched. Otherwise an attempt
+                                    stops freeing them after 16 expansions per path cell,
+                                    and finishes in time linear in the free cells. */
+  bool useConstruction;        /**< Build the path without searching on empty and
+                                    sparse matrices when possible (default on). */
+  bool usePortfolio;           /**< Give every worker thread after the first its own
+                                    strategy when multithreading. The first keeps these
+                                    options, the others cycle through Warnsdorff ordering,
+                                    random starts with Luby restarts in random and in
+                                    Warnsdorff ordering, and fixed ordering. */
+  DFS_Neighborhood neighborhood; /**< Steps of the path. The eight neighborhood always
+                                      runs the iterative engine on a kernel, and the
+                                      component pruning, which labels the four
+                                      neighborhood, is skipped for it. */
+  bool useKernels;             /**< Run the attempts of the iterative engine on a kernel
+                                    specialized for the neighborhood and the width of the
+                                    matrix (default on). It finds the same paths as the
+                                    generic loop. */
+} DFS_SearchOptions;
+
+/**
+ * @brief Work done by a search, summed over every thread.
+ */
+typedef struct {
+  uint64_t nodesExpanded;   /**< Cells added to a path by every attempt. */
+  uint32_t startsAttempted; /**< Starting points a search attempt ran from. */
+  DFS_SearchStatus status;  /**< Outcome of the search. */
+} DFS_SearchReport;
+
+/**
+ * @brief Work done by one thread of a search.
+ *
+ * The starts and the expanded cells are always counted. The other fields
+ * are only filled when the library is built with DFS_ENABLE_STATS, and are
+ * 0 otherwise.
+ */
+typedef struct {
+  uint32_t startsAttempted; /**< Starting points the thread ran an attempt from. */
+  uint64_t nodesExpanded;   /**< Cells the thread added to a path. */
+  uint64_t backtracks;      /**< Cells the thread removed again from a path. */
+  uint32_t maxDepth;        /**< Longest path the thread built. */
+  uint64_t lockWaitNs;      /**< Nanoseconds the thread waited to acquire a mutex. */
+} DFS_ThreadStats;
+
+/**
+ * @brief Per-thread statistics of a search, filled by DFS_getSearchStats
+ *        and freed with DFS_freeSearchStats.
+ */
+typedef struct {
+  bool isDetailed;            /**< The library is built with DFS_ENABLE_STATS. */
+  int32_t finderThread;       /**< Index of the thread that found the path, -1 if none. */
+  DFS_SearchStatus status;    /**< Outcome of the search. */
+  uint16_t noOfThreads;       /**< Number of entries of threads_p. */
+  DFS_ThreadStats *threads_p; /**< The statistics of every thread. */
+} DFS_SearchStats;
+
+/**
+ * @brief Opaque pointer to a reusable search context.
+ *
+ * A context is bound to one WorldMatrix. It owns a pool of parked worker
+ * threads and every buffer of a search, so repeated searches pay neither the
+ * thread startup nor any allocation again. The cells of the matrix may be
+ * changed between searches, its size may not, and the context can be
+ * rebound to another matrix of the same size.
+ */
+typedef struct DFS_SearchContext DFS_SearchContext;
+
 /* > Constant Declarations ************************************************/
 
 /* > Variable Declarations ************************************************/
@@ -30,7 +164,8 @@
  *
  * This function uses a randomized DFS with backtracking to find a path of
  * `pathLength` cells. It can run in either a single-threaded or a
- * multithreaded mode.
+ * multithreaded mode. The search kernel is picked from the width of the
+ * matrix, see DFS_SearchOptions.useKernels.
  *
  * @param[in] matrix_p         A pointer to the WorldMatrix to search within.
  * @param[in] pathLength       The desired length of the path.
@@ -41,4 +176,319 @@
  */
 [[nodiscard]] Path* DFS_findPath(WorldMatrix* matrix_p, uint32_t pathLength, bool isMultithreading);
 
+/**
+ * @brief Gets the default search options.
+ *
+ * @return Options for a single-threaded search with the iterative engine,
+ *         random neighbor ordering, component pruning and shuffled starts
+ *         seeded with RANDOM_GEN_SEED. Multithreading, once enabled, uses
+ *         an auto-detected number of unpinned threads.
+ */
+[[nodiscard]] DFS_SearchOptions DFS_getDefaultOptions(void);
+
+/**
+ * @brief Detects the number of CPUs available to the process.
+ *
+ * Takes the minimum of the online CPUs, the CPU affinity mask and the
+ * cgroup (v2) CPU quota.
+ *
+ * @return The number of worker threads to use, at least 1.
+ */
+[[nodiscard]] uint16_t DFS_detectNoOfThreads(void);
+
+/**
+ * @brief Attempts to find a contiguous path of a specified length in a matrix.
+ *
+ * Same as DFS_findPath, with every tunable of the search passed in options_p.
+ *
+ * @param[in] matrix_p   A pointer to the WorldMatrix to search within.
+ * @param[in] pathLength The desired length of the path.
+ * @param[in] options_p  A pointer to the search options, NULL for the defaults.
+ * @return A pointer to a Path object if a path is found, otherwise NULL.
+ *         The caller is responsible for freeing the returned Path object
+ *         using PATH_freePath().
+ */
+[[nodiscard]] Path* DFS_findPathWithOptions(WorldMatrix* matrix_p, uint32_t pathLength,
+                                            const DFS_SearchOptions* options_p);
+
+/**
+ * @brief Attempts to find a contiguous path of a specified length in a matrix,
+ *        and reports the work the search did.
+ *
+ * Same as DFS_findPathWithOptions.
+ *
+ * @param[in]  matrix_p   A pointer to the WorldMatrix to search within.
+ * @param[in]  pathLength The desired length of the path.
+ * @param[in]  options_p  A pointer to the search options, NULL for the defaults.
+ * @param[out] report_p   A pointer to the report to fill, also when no path is found.
+ * @return A pointer to a Path object if a path is found, otherwise NULL.
+ *         The caller is responsible for freeing the returned Path object
+ *         using PATH_freePath().
+ */
+[[nodiscard]] Path* DFS_findPathWithReport(WorldMatrix* matrix_p, uint32_t pathLength,
+                                           const DFS_SearchOptions* options_p,
+                                           DFS_SearchReport* report_p);
+
+/**
+ * @brief Attempts to find a contiguous path of a specified length in a matrix,
+ *        and fills the per-thread statistics of the search.
+ *
+ * Same as DFS_findPathWithOptions, the status of the statistics tells a
+ * search stopped by a limit of the options apart.
+ *
+ * @param[in]  matrix_p   A pointer to the WorldMatrix to search within.
+ * @param[in]  pathLength The desired length of the path.
+ * @param[in]  options_p  A pointer to the search options, NULL for the defaults.
+ * @param[out] stats_p    A pointer to the statistics to fill, also when no
+ *                        path is found. To be freed with DFS_freeSearchStats.
+ * @return A pointer to a Path object if a path is found, otherwise NULL.
+ *         The caller is responsible for freeing the returned Path object
+ *         using PATH_freePath().
+ */
+[[nodiscard]] Path* DFS_findPathWithStats(WorldMatrix* matrix_p, uint32_t pathLength,
+                                          const DFS_SearchOptions* options_p,
+                                          DFS_SearchStats* stats_p);
+
+/**
+ * @brief Attempts to find a contiguous path of a specified length in a matrix
+ *        within the time and node limits of the options.
+ *
+ * The limits are checked every few hundred expansions, so a search may run
+ * slightly past them.
+ *
+ * @param[in]  matrix_p   A pointer to the WorldMatrix to search within.
+ * @param[in]  pathLength The desired length of the path.
+ * @param[in]  options_p  A pointer to the search options, NULL for the defaults.
+ * @param[out] path_pp    Set to the found path, to the longest partial path
+ *                        built before a limit was hit, or to NULL if there
+ *                        is none. The caller is responsible for freeing it
+ *                        using PATH_freePath().
+ * @return The outcome of the search.
+ */
+[[nodiscard]] DFS_SearchStatus DFS_findPathBounded(WorldMatrix* matrix_p, uint32_t pathLength,
+                                                   const DFS_SearchOptions* options_p,
+                                                   Path** path_pp);
+
+/**
+ * @brief Attempts to find a contiguous path of a specified length within the
+ *        limits of the options and reports statistics about the search, see
+ *        DFS_findPathBounded and DFS_findPathWithStats.
+ *
+ * @param[in]  matrix_p   A pointer to the WorldMatrix to search within.
+ * @param[in]  pathLength The desired length of the path.
+ * @param[in]  options_p  A pointer to the search options, NULL for the defaults.
+ * @param[out] path_pp    Set to the found path, to the longest partial path
+ *                        built before a limit was hit, or to NULL if there
+ *                        is none. The caller is responsible for freeing it
+ *                        using PATH_freePath().
+ * @param[out] stats_p    Filled with the statistics of the search, to be
+ *                        released with DFS_freeSearchStats.
+ * @return The outcome of the search.
+ */
+[[nodiscard]] DFS_SearchStatus DFS_findPathBoundedWithStats(WorldMatrix* matrix_p,
+                                                            uint32_t pathLength,
+                                                            const DFS_SearchOptions* options_p,
+                                                            Path** path_pp,
+                                                            DFS_SearchStats* stats_p);
+
+/**
+ * @brief Attempts to find a contiguous path of a specified length that
+ *        starts at a given cell.
+ *
+ * The search runs on a single thread in the completeness mode, so it finds a
+ * path whenever one starts at the cell, unless a limit of the options stops
+ * it first. The multithreading and completeness options are ignored.
+ *
+ * @param[in] matrix_p   A pointer to the WorldMatrix to search within.
+ * @param[in] pathLength The desired length of the path.
+ * @param[in] start      The first cell of the path.
+ * @param[in] options_p  A pointer to the search options, NULL for the defaults.
+ * @return A pointer to a Path object starting at start if one is found,
+ *         otherwise NULL, also for a blocked or out of bounds start and
+ *         for options the matrix does not support, see DFS_Neighborhood. The
+ *         caller is responsible for freeing the returned Path object using
+ *         PATH_freePath().
+ */
+[[nodiscard]] Path* DFS_findPathFromStart(WorldMatrix* matrix_p, uint32_t pathLength, Cords start,
+                                          const DFS_SearchOptions* options_p);
+
+/**
+ * @brief Attempts to find a contiguous path of a specified length that starts
+ *        with the cells of a given path, see DFS_extendBounded.
+ *
+ * @param[in] matrix_p   A pointer to the WorldMatrix to search within.
+ * @param[in] pathLength The desired length of the path.
+ * @param[in] prefix_p   A pointer to the first cells of the path.
+ * @param[in] options_p  A pointer to the search options, NULL for the
+ *                       defaults. The multithreading option is ignored.
+ * @return A pointer to a Path object starting with the prefix if one is
+ *         found, otherwise NULL, also for an empty or invalid prefix. The
+ *         caller is responsible for freeing the returned Path object using
+ *         PATH_freePath().
+ */
+[[nodiscard]] Path* DFS_extendPath(WorldMatrix* matrix_p, uint32_t pathLength,
+                                   const Path* prefix_p, const DFS_SearchOptions* options_p);
+
+/**
+ * @brief Creates a search context for a matrix.
+ *
+ * With multithreading enabled in the options the worker threads are started
+ * here and stay parked until DFS_searchWithContext posts a search.
+ *
+ * @param[in] matrix_p  A pointer to the WorldMatrix every search runs on.
+ * @param[in] options_p A pointer to the search options, NULL for the defaults.
+ *                      They are copied into the context.
+ * @return A pointer to the new DFS_SearchContext.
+ */
+[[nodiscard]] DFS_SearchContext* DFS_createSearchContext(WorldMatrix* matrix_p,
+                                                         const DFS_SearchOptions* options_p);
+
+/**
+ * @brief Attempts to find a contiguous path of a specified length with a context.
+ *
+ * Equivalent to DFS_findPathWithOptions on the context's matrix and options.
+ * Must not be called concurrently on the same context.
+ *
+ * @param[in,out] context_p  A pointer to the search context.
+ * @param[in]     pathLength The desired length of the path.
+ * @return A pointer to a Path object if a path is found, otherwise NULL.
+ *         The caller is responsible for freeing the returned Path object
+ *         using PATH_freePath().
+ */
+[[nodiscard]] Path* DFS_searchWithContext(DFS_SearchContext* const context_p, uint32_t pathLength);
+
+/**
+ * @brief Attempts to find a contiguous path of a specified length with a
+ *        context, into a path owned by the caller.
+ *
+ * Once the context has searched a path at least this long before, the search
+ * does not allocate any memory. Must not be called concurrently on the same
+ * context.
+ *
+ * @param[in,out] context_p  A pointer to the search context.
+ * @param[in]     pathLength The desired length of the path.
+ * @param[out]    result_p   A pointer to a Path holding at least pathLength
+ *                           cells. It is cleared and, on success, holds the
+ *                           found path.
+ * @return `true` if a path is found, `false` otherwise, also when a limit of
+ *         the options stopped the search.
+ */
+[[nodiscard]] bool DFS_searchIntoPath(DFS_SearchContext* const context_p, uint32_t pathLength,
+                                      Path* const result_p);
+
+/**
+ * @brief Attempts to find a contiguous path of a specified length with a
+ *        context, within the time and node limits of its options.
+ *
+ * Allocation-free like DFS_searchIntoPath, which it backs.
+ *
+ * @param[in,out] context_p  A pointer to the search context.
+ * @param[in]     pathLength The desired length of the path.
+ * @param[out]    result_p   A pointer to a Path holding at least pathLength
+ *                           cells. It is cleared and holds the found path,
+ *                           or the longest partial path built before a limit
+ *                           was hit.
+ * @return The outcome of the search.
+ */
+[[nodiscard]] DFS_SearchStatus DFS_searchBounded(DFS_SearchContext* const context_p,
+                                                 uint32_t pathLength, Path* const result_p);
+
+/**
+ * @brief Attempts to find a contiguous path of a specified length that starts
+ *        with the cells of a given path, with a context.
+ *
+ * The first thread of the context grows the last cell of the prefix, within
+ * the limits and the completeness mode of the options, the bidirectional
+ * engine grows it with the iterative one. A prefix at least as long as the
+ * requested path is cut instead. Allocation-free like DFS_searchBounded.
+ *
+ * @param[in,out] context_p  A pointer to the search context.
+ * @param[in]     prefix_p   A pointer to the first cells of the path, not empty.
+ * @param[in]     pathLength The desired length of the path.
+ * @param[out]    result_p   A pointer to a Path holding at least pathLength
+ *                           cells. It is cleared and holds the found path, or
+ *                           the prefix and the longest partial extension built
+ *                           before a limit was hit.
+ * @return The outcome of the search, DFS_STATUS_NOT_FOUND also for a prefix
+ *         that is not a valid path of the matrix.
+ */
+[[nodiscard]] DFS_SearchStatus DFS_extendBounded(DFS_SearchContext* const context_p,
+                                                 const Path* const prefix_p, uint32_t pathLength,
+                                                 Path* const result_p);
+
+/**
+ * @brief Starts a query made of several bounded searches with a context.
+ *
+ * Every DFS_searchBounded and DFS_extendBounded call arms the time and node
+ * limits of the options anew. Until DFS_endQuery they keep the deadline and
+ * the node budget armed here instead, so all searches of the query together
+ * stay within the limits of one search.
+ *
+ * @param[in,out] context_p A pointer to the search context.
+ */
+void DFS_beginQuery(DFS_SearchContext* const context_p);
+
+/**
+ * @brief Ends the query started with DFS_beginQuery, later searches arm
+ *        their own limits again.
+ *
+ * @param[in,out] context_p A pointer to the search context.
+ */
+void DFS_endQuery(DFS_SearchContext* const context_p);
+
+/**
+ * @brief Binds a search context to another matrix of the same size.
+ *
+ * The threads and buffers of the context are kept, later searches run on the
+ * new matrix. Must not be called concurrently with a search on the context.
+ *
+ * @param[in,out] context_p A pointer to the search context.
+ * @param[in]     matrix_p  A pointer to a WorldMatrix with the rows and
+ *                          columns of the bound one.
+ */
+void DFS_setSearchContextMatrix(DFS_SearchContext* const context_p, WorldMatrix* matrix_p);
+
+/**
+ * @brief Gets the options a search context was created with.
+ *
+ * @param[in] context_p A pointer to the search context.
+ * @return A pointer to the options, valid as long as the context.
+ */
+[[nodiscard]] const DFS_SearchOptions* DFS_getSearchContextOptions(
+    const DFS_SearchContext* const context_p);
+
+/**
+ * @brief Gets the report of the last search run with a context.
+ *
+ * @param[in]  context_p A pointer to the search context.
+ * @param[out] report_p  A pointer to the report to fill, all zeros before the
+ *                       first search.
+ */
+void DFS_getSearchReport(const DFS_SearchContext* const context_p, DFS_SearchReport* report_p);
+
+/**
+ * @brief Gets the per-thread statistics of the last search run with a context.
+ *
+ * @param[in]  context_p A pointer to the search context.
+ * @param[out] stats_p   A pointer to the statistics to fill, its previous
+ *                       content is overwritten. To be freed with
+ *                       DFS_freeSearchStats.
+ */
+void DFS_getSearchStats(const DFS_SearchContext* const context_p, DFS_SearchStats* stats_p);
+
+/**
+ * @brief Frees the per-thread entries of search statistics.
+ *
+ * @param[in,out] stats_p A pointer to the statistics, left without entries.
+ */
+void DFS_freeSearchStats(DFS_SearchStats* stats_p);
+
+/**
+ * @brief Stops the worker threads and frees all memory of a search context.
+ *
+ * @param[in,out] context_pp A pointer to the pointer of the context to be
+ *                           destroyed. The pointer is set to NULL after destruction.
+ */
+void DFS_destroySearchContext(DFS_SearchContext** const context_pp);
+
 #endif // DFS_PATH_FINDING_H
\ No newline at end of file
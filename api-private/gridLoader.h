@@ -0,0 +1,97 @@
+/* > Description *******************************************************************/
+/**
+ * @file gridLoader.h
+ * @brief
+ *   This header file defines the public interface for loading obstacle maps
+ *   into a WorldMatrix. Files are memory-mapped and parsed in parallel, the
+ *   blocked cells are written straight into the bit-packed matrix without an
+ *   intermediate coordinate array.
+ *
+ *   Besides the textual `row,col` list there is a binary grid file. All of its
+ *   fields are little-endian:
+ *     - a 16 byte header: the magic "PFGR", a version byte (1), an encoding
+ *       byte, two reserved bytes, rows and cols as uint16 and four reserved bytes,
+ *     - LOADER_ENCODING_BITMAP: rows * ceil(cols / 64) uint64 words laid out
+ *       exactly like the WorldMatrix storage, bit set meaning blocked,
+ *     - LOADER_ENCODING_RLE: for every row a uint16 number of runs followed by
+ *       that many (uint16 startCol, uint16 length) runs of blocked cells.
+ *
+ *****************************************************************************/
+
+/* > Multiple Inclusion Protection ****************************************/
+#ifndef GRID_LOADER_H
+#define GRID_LOADER_H
+
+/* > Includes *************************************************************/
+#include "matrixWorld.h"
+#include "utilities.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/* > Defines **************************************************************/
+
+/**
+ * @brief Size in bytes of the binary grid file header.
+ */
+#define LOADER_GRID_HEADER_SIZE 16U
+
+/* > Type Declarations ****************************************************/
+
+/**
+ * @brief Payload encoding of a binary grid file.
+ */
+typedef enum {
+  LOADER_ENCODING_BITMAP = 0, /**< Raw padded bitmap, one bit per cell. */
+  LOADER_ENCODING_RLE = 1,    /**< Runs of blocked cells per row, for sparse maps. */
+  LOADER_ENCODING_AUTO        /**< Saving only: whichever of the two is smaller. */
+} LOADER_GridEncoding;
+
+/* > Constant Declarations ************************************************/
+
+/* > Variable Declarations ************************************************/
+
+/* > Function Declarations ************************************************/
+
+/**
+ * @brief Blocks the cells listed in a text file of blocked cell coordinates.
+ *
+ * Every line holds `row,col`. Lines starting with # and empty lines are
+ * skipped, malformed lines are reported and skipped. The file is split into
+ * newline-aligned chunks parsed by separate threads.
+ *
+ * @param[in,out] matrix_p    A pointer to an initialized WorldMatrix.
+ * @param[in]     filePath    Path to the file to load.
+ * @param[in]     noOfThreads Number of parsing threads, 0 or 1 parses on the
+ *                            calling thread only.
+ * @return `true` on success, `false` if the file can not be read or holds a
+ *         cell outside the matrix.
+ */
+[[nodiscard]] bool LOADER_loadBlockedCellsFile(WorldMatrix *const matrix_p,
+                                               const char *filePath, uint16_t noOfThreads);
+
+/**
+ * @brief Creates a WorldMatrix from a binary grid file.
+ *
+ * The size of the matrix is taken from the file header. A bitmap payload is
+ * copied from the mapped file into the matrix in one pass.
+ *
+ * @param[in] filePath Path to the grid file.
+ * @return A pointer to the new WorldMatrix, or NULL if the file can not be
+ *         read or is malformed.
+ */
+[[nodiscard]] WorldMatrix *LOADER_loadGridFile(const char *filePath);
+
+/**
+ * @brief Writes a WorldMatrix to a binary grid file.
+ *
+ * @param[in] matrix_p A pointer to an initialized WorldMatrix.
+ * @param[in] filePath Path of the file to write, an existing file is replaced.
+ * @param[in] encoding The payload encoding, LOADER_ENCODING_AUTO picks the
+ *                     smaller one.
+ * @return `true` on success, `false` if the file can not be written.
+ */
+[[nodiscard]] bool LOADER_saveGridFile(const WorldMatrix *const matrix_p, const char *filePath,
+                                       LOADER_GridEncoding encoding);
+
+/* > End of Multiple Inclusion Protection *********************************/
+#endif // GRID_LOADER_H
@@ -44,6 +44,7 @@ typedef struct WorldMatrix WorldMatrix;
 /**
  * @brief Frees the memory allocated for a WorldMatrix.
  * @param matrix_pp[in,out] Pointer to the pointer of the WorldMatrix to be freed.
+ *                          The pointer is set to NULL after freeing.
  */
 void MATRIXWORLD_matrixFree(WorldMatrix **const matrix_pp);
 
@@ -58,12 +59,17 @@ void MATRIXWORLD_matrixFree(WorldMatrix **const matrix_pp);
 
 /**
  * @brief Sets a specified number of cells to a "blocked" state.
+ *
+ * Every coordinate is checked against the bounds of the matrix and its cell
+ * set in the same pass, and the cell counters are updated once at the end.
+ * Duplicated and already blocked cells are counted only once.
+ *
  * @param matrix_p[in,out] Pointer to the WorldMatrix.
  * @param coordinates_p[in] Pointer to an array of Cords to be blocked.
  * @param noOfElementsToBlock[in] The number of elements in the coordinates array.
  * @return true if the operation was successful, false otherwise.
  */
-bool MATRIXWORLD_matrixBlanking(WorldMatrix *const matrix_p, const Cords *const coordinates_p, uint16_t noOfElementsToBlock);
+bool MATRIXWORLD_matrixBlanking(WorldMatrix *const matrix_p, const Cords *const coordinates_p, size_t noOfElementsToBlock);
 
 /**
  * @brief Checks if the matrix has any blocked cells.
@@ -87,6 +93,14 @@ void MATRIXWORLD_setCell(WorldMatrix *const matrix_p, uint16_t row, uint16_t col
  */
 void MATRIXWORLD_clearMatrix(WorldMatrix *const matrix_p);
 
+/**
+ * @brief Recomputes the blocked and unblocked cell counts from the cell bits.
+ *
+ * Needed after the bits were written directly, e.g. by a bulk loader.
+ * @param matrix_p[in,out] Pointer to the WorldMatrix.
+ */
+void MATRIXWORLD_recountCells(WorldMatrix *const matrix_p);
+
 /**
  * @brief Gets the number of rows in the matrix.
  * @param matrix_p[in] Pointer to the WorldMatrix.
@@ -110,6 +124,39 @@ void MATRIXWORLD_clearMatrix(WorldMatrix *const matrix_p);
  */
 [[nodiscard]] uint16_t MATRIXWORLD_countUnblockedNeighbors(WorldMatrix *const matrix_p, uint16_t row, uint16_t col);
 
+/**
+ * @brief Gets the mask of unblocked neighbors in 4 cardinal directions.
+ *
+ * Bit i of the mask is set when the neighbor reached with directions[i] is
+ * inside the matrix and unblocked.
+ *
+ * @param matrix_p[in] Pointer to WorldMatrix structure.
+ * @param row[in] Row coordinate of center cell.
+ * @param col[in] Column coordinate of center cell.
+ * @return Mask of unblocked neighbors (bits 0-3).
+ */
+[[nodiscard]] uint8_t MATRIXWORLD_getUnblockedNeighborMask(const WorldMatrix *const matrix_p, uint16_t row, uint16_t col);
+
+/**
+ * @brief Gets 64 packed cells of a row.
+ *
+ * Bit b of the word is the cell at column (wordIndex * 64 + b), set when the
+ * cell is blocked. Padding bits past the last column are always set.
+ *
+ * @param matrix_p[in] Pointer to the WorldMatrix.
+ * @param row[in] The row to read.
+ * @param wordIndex[in] Index of the word within the row.
+ * @return The packed row word.
+ */
+[[nodiscard]] uint64_t MATRIXWORLD_getRowWord(const WorldMatrix *const matrix_p, uint16_t row, uint16_t wordIndex);
+
+/**
+ * @brief Gets the number of 64-bit words used to store one row.
+ * @param matrix_p[in] Pointer to the WorldMatrix.
+ * @return The number of words per row.
+ */
+[[nodiscard]] uint16_t MATRIXWORLD_getWordsPerRow(const WorldMatrix *const matrix_p);
+
 /**
  * @brief Checks if a specific cell is blocked.
  * @param matrix_p[in] Pointer to the WorldMatrix.
@@ -124,14 +171,14 @@ void MATRIXWORLD_clearMatrix(WorldMatrix *const matrix_p);
  * @param matrix_p[in] Pointer to the WorldMatrix.
  * @return The total number of unblocked cells.
  */
-[[nodiscard]] uint16_t MATRIXWORLD_getNoOfUnblockedCells(const WorldMatrix *const matrix_p);
+[[nodiscard]] uint32_t MATRIXWORLD_getNoOfUnblockedCells(const WorldMatrix *const matrix_p);
 
 /**
  * @brief Gets the number of blocked cells in the matrix.
  * @param matrix_p[in] Pointer to the WorldMatrix.
  * @return The total number of blocked cells.
  */
-[[nodiscard]] uint16_t MATRIXWORLD_getNoOfBlockedCells(WorldMatrix *const matrix_p);
+[[nodiscard]] uint32_t MATRIXWORLD_getNoOfBlockedCells(WorldMatrix *const matrix_p);
 
 /**
  * @brief Calculates the ratio of blocked to unblocked cells.
@@ -147,5 +194,263 @@ void MATRIXWORLD_clearMatrix(WorldMatrix *const matrix_p);
  */
 [[nodiscard]] size_t MATRIXWORLD_getSize(const WorldMatrix *const matrix_p);
 
+/**
+ * @brief Computes a 64-bit fingerprint of the dimensions and the blocked
+ *        cells of the matrix.
+ *
+ * The fingerprint combines one hash per matrix word, so changing a cell only
+ * changes that word's share, see MATRIXWORLD_updateFingerprint.
+ *
+ * @param matrix_p[in] Pointer to the WorldMatrix.
+ * @return The fingerprint, equal for matrices of equal size and cells.
+ */
+[[nodiscard]] uint64_t MATRIXWORLD_getFingerprint(const WorldMatrix *const matrix_p);
+
+/**
+ * @brief Updates a fingerprint for a single changed cell in constant time.
+ *
+ * Flipping a cell twice gives the original fingerprint back, so the update
+ * can be applied before or after the cell is changed.
+ *
+ * @param fingerprint[in] The fingerprint of the matrix before the change.
+ * @param matrix_p[in] Pointer to the WorldMatrix.
+ * @param row[in] The row of the changed cell.
+ * @param col[in] The column of the changed cell.
+ * @return The fingerprint of the matrix with the cell flipped.
+ */
+[[nodiscard]] uint64_t MATRIXWORLD_updateFingerprint(uint64_t fingerprint,
+                                                     const WorldMatrix *const matrix_p,
+                                                     uint16_t row, uint16_t col);
+
+/* > Unchecked Fast-Path API *********************************************/
+#if defined(MATRIXWORLD_UNCHECKED_API)
+/*
+ * Defining MATRIXWORLD_UNCHECKED_API before including this header exposes the
+ * internal layout of the WorldMatrix together with header-inline accessors
+ * that skip the null and bounds checks. They are meant for hot loops which
+ * have already validated the matrix and the coordinates at entry.
+ */
+
+#define MATRIXWORLD_CELLS_PER_WORD 64U
+
+#if defined(MATRIXWORLD_TILED_LAYOUT)
+/**
+ * @brief Number of rows and columns of the square tile held by one word.
+ */
+#define MATRIXWORLD_TILE_SIZE 8U
+#endif
+
+/**
+ * @brief Internal structure of the WorldMatrix.
+ * @details Cells are bit-packed, 64 cells per word, bit set meaning blocked.
+ *          By default every row starts on a word boundary and the padding
+ *          bits past the last column are kept set, so they read as blocked
+ *          cells. A build with MATRIXWORLD_TILED_LAYOUT stores a tile of 8x8
+ *          cells per word instead, the rows of a tile in its bytes and the
+ *          tiles row by row, so a step up or down mostly stays in the same
+ *          word as a step left or right. The padding cells past the last row
+ *          and column are kept set the same way.
+ */
+struct WorldMatrix {
+  uint16_t rows;
+  uint16_t cols;
+  uint32_t noOfUnblockedCells;
+  uint32_t noOfBlockedCells;
+  uint16_t wordsPerRow; ///< Words of a packed row, see MATRIXWORLD_getRowWord.
+#if defined(MATRIXWORLD_TILED_LAYOUT)
+  uint16_t tilesPerRow;
+#endif
+  size_t worldSize;
+  size_t noOfWords;
+  uint64_t worldMatrix[];
+};
+
+/**
+ * @brief Unchecked version of MATRIXWORLD_getRowSize.
+ * @param matrix_p[in] Pointer to a valid WorldMatrix.
+ * @return The number of rows.
+ */
+static inline uint16_t MATRIXWORLD_unchecked_getRowSize(const WorldMatrix *const matrix_p) {
+  return matrix_p->rows;
+}
+
+/**
+ * @brief Unchecked version of MATRIXWORLD_getColSize.
+ * @param matrix_p[in] Pointer to a valid WorldMatrix.
+ * @return The number of columns.
+ */
+static inline uint16_t MATRIXWORLD_unchecked_getColSize(const WorldMatrix *const matrix_p) {
+  return matrix_p->cols;
+}
+
+/**
+ * @brief Unchecked version of MATRIXWORLD_getNoOfUnblockedCells.
+ * @param matrix_p[in] Pointer to a valid WorldMatrix.
+ * @return The total number of unblocked cells.
+ */
+static inline uint32_t MATRIXWORLD_unchecked_getNoOfUnblockedCells(const WorldMatrix *const matrix_p) {
+  return matrix_p->noOfUnblockedCells;
+}
+
+/**
+ * @brief Returns the word holding a cell.
+ * @param matrix_p[in] Pointer to a valid WorldMatrix.
+ * @param row[in] The row of the cell, must be in bounds.
+ * @param col[in] The column of the cell, must be in bounds.
+ * @return Pointer to the word, see MATRIXWORLD_unchecked_cellBit for the bit.
+ */
+static inline uint64_t *MATRIXWORLD_unchecked_cellWord(const WorldMatrix *const matrix_p,
+                                                       uint16_t row, uint16_t col) {
+#if defined(MATRIXWORLD_TILED_LAYOUT)
+  return (uint64_t *)&matrix_p->worldMatrix[((size_t)(row / MATRIXWORLD_TILE_SIZE) *
+                                             matrix_p->tilesPerRow) +
+                                            (col / MATRIXWORLD_TILE_SIZE)];
+#else
+  return (uint64_t *)&matrix_p->worldMatrix[((size_t)row * matrix_p->wordsPerRow) +
+                                            (col / MATRIXWORLD_CELLS_PER_WORD)];
+#endif
+}
+
+/**
+ * @brief Returns the bit of a cell within its word.
+ * @param row[in] The row of the cell.
+ * @param col[in] The column of the cell.
+ * @return The index of the bit, see MATRIXWORLD_unchecked_cellWord for the word.
+ */
+static inline uint32_t MATRIXWORLD_unchecked_cellBit(uint16_t row, uint16_t col) {
+#if defined(MATRIXWORLD_TILED_LAYOUT)
+  return ((row % MATRIXWORLD_TILE_SIZE) * MATRIXWORLD_TILE_SIZE) + (col % MATRIXWORLD_TILE_SIZE);
+#else
+  (void)row;
+  return col % MATRIXWORLD_CELLS_PER_WORD;
+#endif
+}
+
+/**
+ * @brief Unchecked version of MATRIXWORLD_isBlocked.
+ * @param matrix_p[in] Pointer to a valid WorldMatrix.
+ * @param row[in] The row of the cell, must be in bounds.
+ * @param col[in] The column of the cell, must be in bounds.
+ * @return true if blocked.
+ */
+static inline bool MATRIXWORLD_unchecked_isBlocked(const WorldMatrix *const matrix_p,
+                                                   uint16_t row, uint16_t col) {
+  return (*MATRIXWORLD_unchecked_cellWord(matrix_p, row, col) >>
+          MATRIXWORLD_unchecked_cellBit(row, col)) &
+         UINT64_C(1);
+}
+
+/**
+ * @brief Unchecked version of MATRIXWORLD_getRowWord.
+ * @param matrix_p[in] Pointer to a valid WorldMatrix.
+ * @param row[in] The row to read, must be in bounds.
+ * @param wordIndex[in] Index of the word within the row, must be in bounds.
+ * @return The packed row word.
+ */
+static inline uint64_t MATRIXWORLD_unchecked_getRowWord(const WorldMatrix *const matrix_p,
+                                                        uint16_t row, uint16_t wordIndex) {
+#if defined(MATRIXWORLD_TILED_LAYOUT)
+  // Every tile adds the byte of the row, the missing tiles read as padding.
+  const uint64_t *tile_p = MATRIXWORLD_unchecked_cellWord(
+      matrix_p, row, (uint16_t)(wordIndex * MATRIXWORLD_CELLS_PER_WORD));
+  const uint32_t shift = (row % MATRIXWORLD_TILE_SIZE) * MATRIXWORLD_TILE_SIZE;
+  const uint32_t firstTile = (uint32_t)wordIndex * MATRIXWORLD_TILE_SIZE;
+  uint64_t word = 0;
+  for (uint32_t tile = 0; tile < MATRIXWORLD_TILE_SIZE; tile++) {
+    const uint64_t bits =
+        (firstTile + tile < matrix_p->tilesPerRow) ? (tile_p[tile] >> shift) & 0xFFU : 0xFFU;
+    word |= bits << (tile * MATRIXWORLD_TILE_SIZE);
+  }
+  return word;
+#else
+  return matrix_p->worldMatrix[((size_t)row * matrix_p->wordsPerRow) + wordIndex];
+#endif
+}
+
+/**
+ * @brief Blocks the cells of a packed row word, the counters are not updated.
+ * @param matrix_p[in,out] Pointer to a valid WorldMatrix.
+ * @param row[in] The row to write, must be in bounds.
+ * @param wordIndex[in] Index of the word within the row, must be in bounds.
+ * @param bits[in] The cells to block, laid out as in MATRIXWORLD_getRowWord.
+ */
+static inline void MATRIXWORLD_unchecked_blockRowWord(WorldMatrix *const matrix_p, uint16_t row,
+                                                      uint16_t wordIndex, uint64_t bits) {
+#if defined(MATRIXWORLD_TILED_LAYOUT)
+  uint64_t *tile_p = MATRIXWORLD_unchecked_cellWord(
+      matrix_p, row, (uint16_t)(wordIndex * MATRIXWORLD_CELLS_PER_WORD));
+  const uint32_t shift = (row % MATRIXWORLD_TILE_SIZE) * MATRIXWORLD_TILE_SIZE;
+  const uint32_t firstTile = (uint32_t)wordIndex * MATRIXWORLD_TILE_SIZE;
+  for (uint32_t tile = 0; tile < MATRIXWORLD_TILE_SIZE && firstTile + tile < matrix_p->tilesPerRow;
+       tile++) {
+    tile_p[tile] |= ((bits >> (tile * MATRIXWORLD_TILE_SIZE)) & 0xFFU) << shift;
+  }
+#else
+  matrix_p->worldMatrix[((size_t)row * matrix_p->wordsPerRow) + wordIndex] |= bits;
+#endif
+}
+
+/**
+ * @brief Unchecked version of MATRIXWORLD_getUnblockedNeighborMask.
+ * @param matrix_p[in] Pointer to a valid WorldMatrix.
+ * @param row[in] Row coordinate of center cell, must be in bounds.
+ * @param col[in] Column coordinate of center cell, must be in bounds.
+ * @return Mask of unblocked neighbors, bit i matching directions[i].
+ */
+static inline uint8_t MATRIXWORLD_unchecked_getUnblockedNeighborMask(
+    const WorldMatrix *const matrix_p, uint16_t row, uint16_t col) {
+  const uint64_t *cellWord_p = MATRIXWORLD_unchecked_cellWord(matrix_p, row, col);
+  uint64_t freeCells = ~(*cellWord_p);
+#if defined(MATRIXWORLD_TILED_LAYOUT)
+  const uint64_t lastBit = MATRIXWORLD_TILE_SIZE - 1;
+  const uint16_t rowInTile = row % MATRIXWORLD_TILE_SIZE;
+  const uint16_t colInTile = col % MATRIXWORLD_TILE_SIZE;
+  const uint32_t bitIndex = MATRIXWORLD_unchecked_cellBit(row, col);
+  const ptrdiff_t tilesPerRow = matrix_p->tilesPerRow;
+
+  // Padding cells read as blocked, so only the tile edges need a bounds check.
+  uint64_t rightFree =
+      (colInTile < lastBit)
+          ? (freeCells >> (bitIndex + 1))
+          : ((col + 1 < matrix_p->cols) ? (~cellWord_p[1] >> (bitIndex - lastBit)) : 0);
+  uint64_t leftFree =
+      (colInTile > 0) ? (freeCells >> (bitIndex - 1))
+                      : ((col > 0) ? (~cellWord_p[-1] >> (bitIndex + lastBit)) : 0);
+  uint64_t downFree =
+      (rowInTile < lastBit)
+          ? (freeCells >> (bitIndex + MATRIXWORLD_TILE_SIZE))
+          : ((row + 1 < matrix_p->rows) ? (~cellWord_p[tilesPerRow] >> colInTile) : 0);
+  uint64_t upFree =
+      (rowInTile > 0)
+          ? (freeCells >> (bitIndex - MATRIXWORLD_TILE_SIZE))
+          : ((row > 0) ? (~cellWord_p[-tilesPerRow] >> (lastBit * MATRIXWORLD_TILE_SIZE + colInTile))
+                       : 0);
+#else
+  const uint64_t lastBit = MATRIXWORLD_CELLS_PER_WORD - 1;
+  uint16_t wordIndex = col / MATRIXWORLD_CELLS_PER_WORD;
+  uint16_t bitIndex = col % MATRIXWORLD_CELLS_PER_WORD;
+
+  // Padding bits read as blocked, so only the word edges need a bounds check.
+  uint64_t rightFree =
+      (bitIndex < lastBit)
+          ? (freeCells >> (bitIndex + 1))
+          : ((wordIndex + 1 < matrix_p->wordsPerRow) ? ~cellWord_p[1] : 0);
+  uint64_t leftFree = (bitIndex > 0)
+                          ? (freeCells >> (bitIndex - 1))
+                          : ((wordIndex > 0) ? (~cellWord_p[-1] >> lastBit) : 0);
+  uint64_t downFree = (row + 1 < matrix_p->rows)
+                          ? (~cellWord_p[matrix_p->wordsPerRow] >> bitIndex)
+                          : 0;
+  uint64_t upFree =
+      (row > 0) ? (~cellWord_p[-(ptrdiff_t)matrix_p->wordsPerRow] >> bitIndex) : 0;
+#endif
+
+  // Bit order follows the directions[] table: right, left, down, up.
+  return (uint8_t)((rightFree & 1U) | ((leftFree & 1U) << 1) |
+                   ((downFree & 1U) << 2) | ((upFree & 1U) << 3));
+}
+
+#endif /* MATRIXWORLD_UNCHECKED_API */
+
 /* > End of Multiple Inclusion Protection *********************************/
 #endif /* MATRIX_WORLD_H */
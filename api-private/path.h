@@ -13,6 +13,7 @@
 #define PATH_H
 
 /* > Includes *************************************************************/
+#include "arena.h"
 #include "matrixWorld.h"
 #include "utilities.h"
 #include <stdbool.h>
@@ -42,9 +43,23 @@ typedef struct Path Path;
  */
 [[nodiscard]] Path *PATH_initializePath(const size_t pathSize, const WorldMatrix *const matrix_p);
 
+/**
+ * @brief Initializes a new Path instance carved from an arena.
+ *
+ * The path is released with the arena, it must not be passed to PATH_freePath.
+ *
+ * @param pathSize[in]    The maximum number of coordinates the path can hold.
+ * @param matrix_p[in]    A pointer to the WorldMatrix for size validation.
+ * @param arena_p[in,out] The arena the path is carved from.
+ * @return A pointer to the newly carved Path.
+ */
+[[nodiscard]] Path *PATH_initializePathInArena(const size_t pathSize,
+                                               const WorldMatrix *const matrix_p,
+                                               Arena *const arena_p);
+
 /**
  * @brief Frees the memory allocated for a Path instance.
- * @param path_pp[in,out] Pointer to the pointer of the Path to be freed.
+ * @param path_pp[in,out] Pointer to the pointer of the Path to be freed, set to NULL.
  */
 void PATH_freePath(Path** const path_pp);
 
@@ -121,5 +136,63 @@ void PATH_printPath(const Path* const path_p);
  */
 [[nodiscard]] size_t PATH_getByteSize(const Path* const path_p);
 
+/* > Unchecked Fast-Path API *********************************************/
+#if defined(PATH_UNCHECKED_API)
+/*
+ * Defining PATH_UNCHECKED_API before including this header exposes the
+ * internal layout of the Path together with header-inline accessors that skip
+ * the null, capacity and emptiness checks. They are meant for hot loops which
+ * have already validated the path at entry.
+ */
+
+/**
+ * @brief Defines the internal structure of the Path.
+ */
+struct Path {
+  size_t pathSize; ///< The total capacity of the path.
+  size_t currentNoOfCordsInPath; ///< The current number of coordinates stored.
+  Cords pathArray[]; ///< A flexible array member to hold the coordinates.
+};
+
+/**
+ * @brief Unchecked version of PATH_getLength.
+ * @param path_p[in] A pointer to a valid Path.
+ * @return The number of coordinates currently stored in the path.
+ */
+static inline size_t PATH_unchecked_getLength(const Path *const path_p) {
+  return path_p->currentNoOfCordsInPath;
+}
+
+/**
+ * @brief Unchecked version of PATH_addCoordinates, the path must not be full.
+ * @param path_p[in,out] A pointer to a valid Path.
+ * @param row[in] The row of the coordinate to add.
+ * @param col[in] The column of the coordinate to add.
+ */
+static inline void PATH_unchecked_addCoordinates(Path *const path_p, uint16_t row,
+                                                 uint16_t col) {
+  path_p->pathArray[path_p->currentNoOfCordsInPath++] = (Cords){.row = row, .col = col};
+}
+
+/**
+ * @brief Unchecked version of PATH_getLastCoordinates, the path must not be empty.
+ * @param path_p[in] A pointer to a valid Path.
+ * @return The last Cords in the path.
+ */
+static inline Cords PATH_unchecked_getLastCoordinates(const Path *const path_p) {
+  return path_p->pathArray[path_p->currentNoOfCordsInPath - 1];
+}
+
+/**
+ * @brief Unchecked version of PATH_popCoordinates, the path must not be empty.
+ * @param path_p[in,out] A pointer to a valid Path.
+ * @return The removed last Cords of the path.
+ */
+static inline Cords PATH_unchecked_popCoordinates(Path *const path_p) {
+  return path_p->pathArray[--path_p->currentNoOfCordsInPath];
+}
+
+#endif /* PATH_UNCHECKED_API */
+
 /* > End of Multiple Inclusion Protection *********************************/
 #endif /* PATH_H */
@@ -0,0 +1,154 @@
+/* > Description *******************************************************************/
+/**
+ * @file pathCache.h
+ * @brief
+ *   This header file defines the public interface for the path cache. Every
+ *   prefix of a contiguous path is a contiguous path as well, so the cache
+ *   keeps the longest path found for every world, keyed by the fingerprint of
+ *   the WorldMatrix and the neighborhood of the path. A path of the four
+ *   neighborhood also serves a query of the eight neighborhood, a diagonal
+ *   path never serves a four-neighborhood query. A shorter query is answered
+ *   by a prefix of that path, a longer one first tries to grow it at either
+ *   end and only searches from scratch when both fail.
+ *
+ *   The cached paths follow the edits of a matrix: a blocked cell only costs
+ *   the cached path of that world the part behind or in front of the cell,
+ *   the other edits keep it whole.
+ *
+ *****************************************************************************/
+
+/* > Multiple Inclusion Protection ****************************************/
+#ifndef PATH_CACHE_H
+#define PATH_CACHE_H
+
+/* > Includes *************************************************************/
+#include "dfsPathFinding.h"
+#include "matrixWorld.h"
+#include "path.h"
+#include <stdint.h>
+
+/* > Defines **************************************************************/
+
+/**
+ * @brief Number of worlds the cache holds a path for, the least recently
+ *        used one makes room for a new world.
+ */
+#define PATHCACHE_NO_OF_ENTRIES 8U
+
+/* > Type Declarations ****************************************************/
+
+/**
+ * @brief Opaque pointer to the internal PathCache structure.
+ */
+typedef struct PathCache PathCache;
+
+/* > Constant Declarations ************************************************/
+
+/* > Variable Declarations ************************************************/
+
+/* > Function Declarations ************************************************/
+
+/**
+ * @brief Creates an empty path cache.
+ * @return A pointer to the new PathCache.
+ */
+[[nodiscard]] PathCache *PATHCACHE_createCache(void);
+
+/**
+ * @brief Frees a path cache and every path it holds.
+ * @param cache_pp[in,out] Pointer to the pointer of the PathCache, set to NULL.
+ */
+void PATHCACHE_destroyCache(PathCache **const cache_pp);
+
+/**
+ * @brief Attempts to find a contiguous path of a specified length through the
+ *        cache, a drop-in replacement for DFS_findPathWithOptions.
+ *
+ * @param[in,out] cache_p    A pointer to the PathCache.
+ * @param[in]     matrix_p   A pointer to the WorldMatrix to search within.
+ * @param[in]     pathLength The desired length of the path.
+ * @param[in]     options_p  A pointer to the search options, NULL for the defaults.
+ * @return A pointer to a Path object if a path is found, otherwise NULL. The
+ *         caller is responsible for freeing it using PATH_freePath().
+ */
+[[nodiscard]] Path *PATHCACHE_findPath(PathCache *const cache_p, WorldMatrix *matrix_p,
+                                       uint32_t pathLength, const DFS_SearchOptions *options_p);
+
+/**
+ * @brief Attempts to find a contiguous path of a specified length through the
+ *        cache with a search context, like DFS_searchBounded.
+ *
+ * A cached path of the world long enough is cut without any search. A shorter
+ * one is grown with DFS_extendBounded, from its last cell and then from its
+ * first one, before the context searches the matrix from scratch. The time
+ * and node limits of the context cover these searches together, see
+ * DFS_beginQuery. Every path the searches return, the partial paths of a
+ * stopped search included, is kept when it is the longest one of the world.
+ *
+ * @param[in,out] cache_p     A pointer to the PathCache.
+ * @param[in,out] context_p   A pointer to a search context bound to matrix_p.
+ * @param[in]     matrix_p    A pointer to the WorldMatrix of the context.
+ * @param[in]     fingerprint The fingerprint of the matrix.
+ * @param[in]     pathLength  The desired length of the path.
+ * @param[out]    result_p    A pointer to a Path holding at least pathLength
+ *                            cells, see DFS_searchBounded.
+ * @return The outcome of the search.
+ */
+[[nodiscard]] DFS_SearchStatus PATHCACHE_searchBounded(PathCache *const cache_p,
+                                                       DFS_SearchContext *const context_p,
+                                                       const WorldMatrix *const matrix_p,
+                                                       uint64_t fingerprint, uint32_t pathLength,
+                                                       Path *const result_p);
+
+/**
+ * @brief Gets the first cells of the cached path of a world in constant time.
+ *
+ * @param[in,out] cache_p      A pointer to the PathCache.
+ * @param[in]     matrix_p     A pointer to the WorldMatrix.
+ * @param[in]     fingerprint  The fingerprint of the matrix.
+ * @param[in]     neighborhood The steps the path may take, a four-neighborhood
+ *                             path serves the eight neighborhood as well.
+ * @param[in]     pathLength   The number of cells needed.
+ * @return A pointer to the first of pathLength cells forming a path, valid
+ *         until the cache is changed, or NULL if no such path is cached.
+ */
+[[nodiscard]] const Cords *PATHCACHE_getPrefix(PathCache *const cache_p,
+                                               const WorldMatrix *const matrix_p,
+                                               uint64_t fingerprint,
+                                               DFS_Neighborhood neighborhood,
+                                               uint32_t pathLength);
+
+/**
+ * @brief Keeps a path as the cached path of its world and neighborhood if it
+ *        is longer than the cached one.
+ *
+ * @param[in,out] cache_p      A pointer to the PathCache.
+ * @param[in]     matrix_p     A pointer to the WorldMatrix the path lies in.
+ * @param[in]     fingerprint  The fingerprint of the matrix.
+ * @param[in]     neighborhood The steps of the path.
+ * @param[in]     path_p       A pointer to a valid path of the matrix.
+ */
+void PATHCACHE_storePath(PathCache *const cache_p, const WorldMatrix *const matrix_p,
+                         uint64_t fingerprint, DFS_Neighborhood neighborhood,
+                         const Path *const path_p);
+
+/**
+ * @brief Moves the cached path of a world over a cell that has just changed.
+ *
+ * Call it after every MATRIXWORLD_setCell that changed a cell. The cached
+ * path stays whole unless the cell got blocked on it, it then keeps the
+ * longer of its parts in front of and behind the cell.
+ *
+ * @param[in,out] cache_p     A pointer to the PathCache.
+ * @param[in]     matrix_p    A pointer to the WorldMatrix, after the change.
+ * @param[in]     fingerprint The fingerprint of the matrix before the change.
+ * @param[in]     row         The row of the changed cell.
+ * @param[in]     col         The column of the changed cell.
+ * @return The fingerprint of the matrix after the change.
+ */
+[[nodiscard]] uint64_t PATHCACHE_noteCellChange(PathCache *const cache_p,
+                                                const WorldMatrix *const matrix_p,
+                                                uint64_t fingerprint, uint16_t row, uint16_t col);
+
+/* > End of Multiple Inclusion Protection *********************************/
+#endif // PATH_CACHE_H
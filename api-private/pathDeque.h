@@ -0,0 +1,270 @@
+/* > Description *******************************************************************/
+/**
+ * @file pathDeque.h
+ * @brief
+ *   This header file defines the public interface for the PathDeque, a Path
+ *   that can grow and shrink at both of its ends in constant time. The cells
+ *   are kept in a ring buffer, the front of the deque is the first cell of
+ *   the path.
+ *
+ *****************************************************************************/
+
+/* > Multiple Inclusion Protection ****************************************/
+#ifndef PATH_DEQUE_H
+#define PATH_DEQUE_H
+
+/* > Includes *************************************************************/
+#include "arena.h"
+#include "matrixWorld.h"
+#include "path.h"
+#include "utilities.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* > Defines **************************************************************/
+
+/* > Type Declarations ****************************************************/
+
+/**
+ * @brief Opaque pointer to the internal PathDeque structure.
+ */
+typedef struct PathDeque PathDeque;
+
+/* > Constant Declarations ************************************************/
+
+/* > Variable Declarations ************************************************/
+
+/* > Function Declarations ************************************************/
+
+/**
+ * @brief Initializes a new PathDeque instance with a specified capacity.
+ * @param capacity[in] The maximum number of coordinates the deque can hold.
+ * @param matrix_p[in] A pointer to the WorldMatrix for size validation.
+ * @return A pointer to the newly allocated PathDeque.
+ */
+[[nodiscard]] PathDeque *PATHDEQUE_initializeDeque(const size_t capacity,
+                                                   const WorldMatrix *const matrix_p);
+
+/**
+ * @brief Initializes a new PathDeque instance carved from an arena.
+ *
+ * The deque is released with the arena, it must not be passed to
+ * PATHDEQUE_freeDeque.
+ *
+ * @param capacity[in]    The maximum number of coordinates the deque can hold.
+ * @param matrix_p[in]    A pointer to the WorldMatrix for size validation.
+ * @param arena_p[in,out] The arena the deque is carved from.
+ * @return A pointer to the newly carved PathDeque.
+ */
+[[nodiscard]] PathDeque *PATHDEQUE_initializeDequeInArena(const size_t capacity,
+                                                          const WorldMatrix *const matrix_p,
+                                                          Arena *const arena_p);
+
+/**
+ * @brief Frees the memory allocated for a PathDeque instance.
+ * @param deque_pp[in,out] Pointer to the pointer of the PathDeque to be freed,
+ *                         set to NULL.
+ */
+void PATHDEQUE_freeDeque(PathDeque **const deque_pp);
+
+/**
+ * @brief Adds a new coordinate in front of the first one.
+ * @param deque_p[in,out] A pointer to the PathDeque instance.
+ * @param row[in] The row of the coordinate to add.
+ * @param col[in] The column of the coordinate to add.
+ */
+void PATHDEQUE_pushFront(PathDeque *const deque_p, uint16_t row, uint16_t col);
+
+/**
+ * @brief Adds a new coordinate behind the last one.
+ * @param deque_p[in,out] A pointer to the PathDeque instance.
+ * @param row[in] The row of the coordinate to add.
+ * @param col[in] The column of the coordinate to add.
+ */
+void PATHDEQUE_pushBack(PathDeque *const deque_p, uint16_t row, uint16_t col);
+
+/**
+ * @brief Removes and returns the first coordinate.
+ * @param deque_p[in,out] A pointer to the PathDeque instance.
+ * @return The first Cords, or Cords with UINT16_MAX if empty.
+ */
+[[nodiscard]] Cords PATHDEQUE_popFront(PathDeque *const deque_p);
+
+/**
+ * @brief Removes and returns the last coordinate.
+ * @param deque_p[in,out] A pointer to the PathDeque instance.
+ * @return The last Cords, or Cords with UINT16_MAX if empty.
+ */
+[[nodiscard]] Cords PATHDEQUE_popBack(PathDeque *const deque_p);
+
+/**
+ * @brief Retrieves the first coordinate without removing it.
+ * @param deque_p[in] A pointer to the PathDeque instance.
+ * @return The first Cords, or Cords with UINT16_MAX if empty.
+ */
+[[nodiscard]] Cords PATHDEQUE_getFront(const PathDeque *const deque_p);
+
+/**
+ * @brief Retrieves the last coordinate without removing it.
+ * @param deque_p[in] A pointer to the PathDeque instance.
+ * @return The last Cords, or Cords with UINT16_MAX if empty.
+ */
+[[nodiscard]] Cords PATHDEQUE_getBack(const PathDeque *const deque_p);
+
+/**
+ * @brief Retrieves a coordinate by its position from the front.
+ * @param deque_p[in] A pointer to the PathDeque instance.
+ * @param index[in]   The position, 0 for the first coordinate.
+ * @return The Cords at the position, or Cords with UINT16_MAX if out of range.
+ */
+[[nodiscard]] Cords PATHDEQUE_getAt(const PathDeque *const deque_p, size_t index);
+
+/**
+ * @brief Gets the current number of coordinates in the deque.
+ * @param deque_p[in] A pointer to the PathDeque instance.
+ * @return The number of coordinates currently stored.
+ */
+[[nodiscard]] size_t PATHDEQUE_getLength(const PathDeque *const deque_p);
+
+/**
+ * @brief Checks if the deque is empty.
+ * @param deque_p[in] A pointer to the PathDeque instance.
+ * @return true if the deque contains no coordinates, false otherwise.
+ */
+[[nodiscard]] bool PATHDEQUE_isEmpty(const PathDeque *const deque_p);
+
+/**
+ * @brief Clears all coordinates from the deque.
+ * @param deque_p[in,out] A pointer to the PathDeque instance.
+ */
+void PATHDEQUE_clearDeque(PathDeque *const deque_p);
+
+/**
+ * @brief Replaces the content of a Path with the coordinates of the deque,
+ *        from the front to the back.
+ * @param deque_p[in]  A pointer to the PathDeque instance.
+ * @param path_p[out]  A pointer to a Path holding at least the length of the deque.
+ */
+void PATHDEQUE_copyToPath(const PathDeque *const deque_p, Path *const path_p);
+
+/* > Unchecked Fast-Path API *********************************************/
+#if defined(PATHDEQUE_UNCHECKED_API)
+/*
+ * Defining PATHDEQUE_UNCHECKED_API before including this header exposes the
+ * internal layout of the PathDeque together with header-inline accessors that
+ * skip the null, capacity and emptiness checks. They are meant for hot loops
+ * which have already validated the deque at entry.
+ */
+
+/**
+ * @brief Defines the internal structure of the PathDeque.
+ */
+struct PathDeque {
+  size_t capacity;   ///< The total capacity of the deque.
+  size_t first;      ///< Ring buffer index of the first coordinate.
+  size_t length;     ///< The current number of coordinates stored.
+  Cords cellArray[]; ///< A flexible array member, the ring buffer.
+};
+
+/**
+ * @brief Unchecked version of PATHDEQUE_getLength.
+ * @param deque_p[in] A pointer to a valid PathDeque.
+ * @return The number of coordinates currently stored.
+ */
+static inline size_t PATHDEQUE_unchecked_getLength(const PathDeque *const deque_p) {
+  return deque_p->length;
+}
+
+/**
+ * @brief Unchecked version of PATHDEQUE_getAt, the index must be in range.
+ * @param deque_p[in] A pointer to a valid PathDeque.
+ * @param index[in]   The position, 0 for the first coordinate.
+ * @return The Cords at the position.
+ */
+static inline Cords PATHDEQUE_unchecked_getAt(const PathDeque *const deque_p, size_t index) {
+  size_t slot = deque_p->first + index;
+  return deque_p->cellArray[(slot >= deque_p->capacity) ? slot - deque_p->capacity : slot];
+}
+
+/**
+ * @brief Unchecked version of PATHDEQUE_getFront, the deque must not be empty.
+ * @param deque_p[in] A pointer to a valid PathDeque.
+ * @return The first Cords.
+ */
+static inline Cords PATHDEQUE_unchecked_getFront(const PathDeque *const deque_p) {
+  return deque_p->cellArray[deque_p->first];
+}
+
+/**
+ * @brief Unchecked version of PATHDEQUE_getBack, the deque must not be empty.
+ * @param deque_p[in] A pointer to a valid PathDeque.
+ * @return The last Cords.
+ */
+static inline Cords PATHDEQUE_unchecked_getBack(const PathDeque *const deque_p) {
+  return PATHDEQUE_unchecked_getAt(deque_p, deque_p->length - 1);
+}
+
+/**
+ * @brief Unchecked version of PATHDEQUE_pushFront, the deque must not be full.
+ * @param deque_p[in,out] A pointer to a valid PathDeque.
+ * @param row[in] The row of the coordinate to add.
+ * @param col[in] The column of the coordinate to add.
+ */
+static inline void PATHDEQUE_unchecked_pushFront(PathDeque *const deque_p, uint16_t row,
+                                                 uint16_t col) {
+  deque_p->first = (deque_p->first == 0) ? deque_p->capacity - 1 : deque_p->first - 1;
+  deque_p->cellArray[deque_p->first] = (Cords){.row = row, .col = col};
+  deque_p->length++;
+}
+
+/**
+ * @brief Unchecked version of PATHDEQUE_pushBack, the deque must not be full.
+ * @param deque_p[in,out] A pointer to a valid PathDeque.
+ * @param row[in] The row of the coordinate to add.
+ * @param col[in] The column of the coordinate to add.
+ */
+static inline void PATHDEQUE_unchecked_pushBack(PathDeque *const deque_p, uint16_t row,
+                                                uint16_t col) {
+  size_t slot = deque_p->first + deque_p->length;
+  deque_p->cellArray[(slot >= deque_p->capacity) ? slot - deque_p->capacity : slot] =
+      (Cords){.row = row, .col = col};
+  deque_p->length++;
+}
+
+/**
+ * @brief Unchecked version of PATHDEQUE_popFront, the deque must not be empty.
+ * @param deque_p[in,out] A pointer to a valid PathDeque.
+ * @return The removed first Cords.
+ */
+static inline Cords PATHDEQUE_unchecked_popFront(PathDeque *const deque_p) {
+  Cords front = deque_p->cellArray[deque_p->first];
+  deque_p->first = (deque_p->first + 1 == deque_p->capacity) ? 0 : deque_p->first + 1;
+  deque_p->length--;
+  return front;
+}
+
+/**
+ * @brief Unchecked version of PATHDEQUE_popBack, the deque must not be empty.
+ * @param deque_p[in,out] A pointer to a valid PathDeque.
+ * @return The removed last Cords.
+ */
+static inline Cords PATHDEQUE_unchecked_popBack(PathDeque *const deque_p) {
+  Cords back = PATHDEQUE_unchecked_getBack(deque_p);
+  deque_p->length--;
+  return back;
+}
+
+/**
+ * @brief Unchecked version of PATHDEQUE_clearDeque.
+ * @param deque_p[in,out] A pointer to a valid PathDeque.
+ */
+static inline void PATHDEQUE_unchecked_clearDeque(PathDeque *const deque_p) {
+  deque_p->first = 0;
+  deque_p->length = 0;
+}
+
+#endif /* PATHDEQUE_UNCHECKED_API */
+
+/* > End of Multiple Inclusion Protection *********************************/
+#endif /* PATH_DEQUE_H */
@@ -0,0 +1,122 @@
+/* > Description *******************************************************************/
+/**
+ * @file pathIndex.h
+ * @brief
+ *   This header file defines the public interface for the position index of a
+ *   path. PATH_containsCoordinates scans the whole path, the index maps every
+ *   cell of the path to its step in a hash table instead, so both "is the cell
+ *   on the path" and "where on the path is it" take constant time. The table
+ *   grows with the capacity of the path, not with the size of the matrix.
+ *
+ *   The index is optional: a path that is only built and printed does not
+ *   need one. A path that is queried keeps its index in sync by being grown
+ *   and shrunk through PATHINDEX_addCoordinates and PATHINDEX_popCoordinates.
+ *
+ *****************************************************************************/
+
+/* > Multiple Inclusion Protection ****************************************/
+#ifndef PATH_INDEX_H
+#define PATH_INDEX_H
+
+/* > Includes *************************************************************/
+#include "matrixWorld.h"
+#include "path.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* > Defines **************************************************************/
+
+/**
+ * @brief Step returned for a cell that is not on the path.
+ */
+#define PATHINDEX_NOT_ON_PATH SIZE_MAX
+
+/* > Type Declarations ****************************************************/
+
+/**
+ * @brief Opaque pointer to the internal PathIndex structure.
+ */
+typedef struct PathIndex PathIndex;
+
+/* > Constant Declarations ************************************************/
+
+/* > Variable Declarations ************************************************/
+
+/* > Function Declarations ************************************************/
+
+/**
+ * @brief Creates the index of a path and indexes the cells it already holds.
+ *
+ * The index has room for every cell the path can hold. A cell that repeats on
+ * the path keeps the step of its first occurrence.
+ *
+ * @param path_p[in]   A pointer to the Path.
+ * @param matrix_p[in] A pointer to the WorldMatrix of the path.
+ * @return A pointer to the new PathIndex.
+ */
+[[nodiscard]] PathIndex *PATHINDEX_createIndex(const Path *const path_p,
+                                               const WorldMatrix *const matrix_p);
+
+/**
+ * @brief Frees a path index, the path itself is left untouched.
+ * @param index_pp[in,out] Pointer to the pointer of the PathIndex, set to NULL.
+ */
+void PATHINDEX_destroyIndex(PathIndex **const index_pp);
+
+/**
+ * @brief Indexes the cells of a path again, after it was changed behind the
+ *        back of the index.
+ * @param index_p[in,out] A pointer to the PathIndex of the path.
+ * @param path_p[in]      A pointer to the Path, its capacity must not exceed
+ *                        the one the index was created for.
+ */
+void PATHINDEX_rebuildIndex(PathIndex *const index_p, const Path *const path_p);
+
+/**
+ * @brief Adds a new coordinate to the end of the path and to its index.
+ * @param index_p[in,out] A pointer to the PathIndex of the path.
+ * @param path_p[in,out]  A pointer to the Path.
+ * @param row[in]         The row of the coordinate to add.
+ * @param col[in]         The column of the coordinate to add.
+ */
+void PATHINDEX_addCoordinates(PathIndex *const index_p, Path *const path_p, uint16_t row,
+                              uint16_t col);
+
+/**
+ * @brief Removes the last coordinate from the path and from its index.
+ * @param index_p[in,out] A pointer to the PathIndex of the path.
+ * @param path_p[in,out]  A pointer to the Path.
+ * @return The last Cords in the path, or Cords with UINT16_MAX if empty.
+ */
+[[nodiscard]] Cords PATHINDEX_popCoordinates(PathIndex *const index_p, Path *const path_p);
+
+/**
+ * @brief Checks in constant time if the path contains a cell.
+ * @param index_p[in] A pointer to the PathIndex of the path.
+ * @param row[in]     The row of the cell.
+ * @param col[in]     The column of the cell.
+ * @return true if the cell is on the path, false otherwise.
+ */
+[[nodiscard]] bool PATHINDEX_containsCoordinates(const PathIndex *const index_p, uint16_t row,
+                                                 uint16_t col);
+
+/**
+ * @brief Gets in constant time the step at which the path visits a cell.
+ * @param index_p[in] A pointer to the PathIndex of the path.
+ * @param row[in]     The row of the cell.
+ * @param col[in]     The column of the cell.
+ * @return The index of the cell in the path, or PATHINDEX_NOT_ON_PATH.
+ */
+[[nodiscard]] size_t PATHINDEX_getStep(const PathIndex *const index_p, uint16_t row,
+                                       uint16_t col);
+
+/**
+ * @brief Gets the number of cells the index holds.
+ * @param index_p[in] A pointer to the PathIndex.
+ * @return The number of indexed steps, the length of the path when in sync.
+ */
+[[nodiscard]] size_t PATHINDEX_getNoOfSteps(const PathIndex *const index_p);
+
+/* > End of Multiple Inclusion Protection *********************************/
+#endif // PATH_INDEX_H
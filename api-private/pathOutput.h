@@ -0,0 +1,178 @@
+/* > Description *******************************************************************/
+/**
+ * @file pathOutput.h
+ * @brief
+ *   This header file defines the public interface for the output of the
+ *   program. The OutputWriter formats into one large buffer and hands it to
+ *   the stream in bulk, found paths are written either as text or in a
+ *   compact binary encoding, and the diagnostics of the library can be
+ *   silenced for quiet runs.
+ *
+ *   The binary path encoding starts with a 16 byte little endian header:
+ *     - bytes 0..3   the magic "PFPT",
+ *     - byte  4      the version, OUTPUT_PATH_VERSION,
+ *     - bytes 5..7   reserved, zero,
+ *     - bytes 8..11  the number of cells of the path,
+ *     - bytes 12..13 the row of the first cell,
+ *     - bytes 14..15 the column of the first cell.
+ *   Every later cell is one 2-bit step from the previous one, an index into
+ *   directions[], four steps per byte with the first one in the lowest bits.
+ *
+ *****************************************************************************/
+
+/* > Multiple Inclusion Protection ****************************************/
+#ifndef PATH_OUTPUT_H
+#define PATH_OUTPUT_H
+
+/* > Includes *************************************************************/
+#include "path.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/* > Defines **************************************************************/
+
+/**
+ * @brief Size of the buffer of an OutputWriter.
+ */
+#define OUTPUT_BUFFER_SIZE (64U * 1024U)
+
+/**
+ * @brief Size of the header of the binary path encoding.
+ */
+#define OUTPUT_PATH_HEADER_SIZE 16U
+
+/**
+ * @brief Version of the binary path encoding written by this build.
+ */
+#define OUTPUT_PATH_VERSION 1U
+
+/* > Type Declarations ****************************************************/
+
+/**
+ * @brief Formats a found path can be written in.
+ */
+typedef enum {
+  OUTPUT_FORMAT_TEXT = 0, /**< One `row,col` line per cell (default). */
+  OUTPUT_FORMAT_BINARY    /**< The start cell followed by 2-bit steps. */
+} OUTPUT_Format;
+
+/**
+ * @brief Buffered writer, flushed to its stream when full and by OUTPUT_flushWriter.
+ *
+ * Kept public so writers can live on the stack, the fields are private to
+ * the OUTPUT_ functions.
+ */
+typedef struct {
+  FILE *stream_p;                    /**< The stream the buffer is flushed to. */
+  size_t usedBytes;                  /**< Bytes of `buffer` waiting to be flushed. */
+  bool hasFailed;                    /**< Whether a flush has failed. */
+  char buffer[OUTPUT_BUFFER_SIZE];   /**< The formatted bytes. */
+} OutputWriter;
+
+/* > Constant Declarations ************************************************/
+
+/* > Variable Declarations ************************************************/
+
+/* > Function Declarations ************************************************/
+
+/**
+ * @brief Readies a writer for a stream.
+ *
+ * @param[out] writer_p A pointer to the writer.
+ * @param[in]  stream_p The stream the writer is flushed to.
+ */
+void OUTPUT_initWriter(OutputWriter *const writer_p, FILE *stream_p);
+
+/**
+ * @brief Appends bytes to a writer.
+ *
+ * @param[in,out] writer_p A pointer to the writer.
+ * @param[in]     data_p   The bytes to append.
+ * @param[in]     size     The number of bytes.
+ */
+void OUTPUT_writeBytes(OutputWriter *const writer_p, const void *data_p, size_t size);
+
+/**
+ * @brief Appends a NUL terminated string to a writer.
+ *
+ * @param[in,out] writer_p A pointer to the writer.
+ * @param[in]     string_p The string to append, without its terminator.
+ */
+void OUTPUT_writeString(OutputWriter *const writer_p, const char *string_p);
+
+/**
+ * @brief Appends a single character to a writer.
+ *
+ * @param[in,out] writer_p  A pointer to the writer.
+ * @param[in]     character The character to append.
+ */
+void OUTPUT_writeChar(OutputWriter *const writer_p, char character);
+
+/**
+ * @brief Appends the decimal digits of an unsigned integer to a writer.
+ *
+ * @param[in,out] writer_p A pointer to the writer.
+ * @param[in]     value    The value to format.
+ */
+void OUTPUT_writeUint(OutputWriter *const writer_p, uint64_t value);
+
+/**
+ * @brief Hands the buffered bytes to the stream and flushes it.
+ *
+ * @param[in,out] writer_p A pointer to the writer.
+ * @return `true` if every byte appended so far reached the stream.
+ */
+[[nodiscard]] bool OUTPUT_flushWriter(OutputWriter *const writer_p);
+
+/**
+ * @brief Writes a path to a stream in one of the output formats.
+ *
+ * @param[in] path_p   A pointer to the path, contiguous for the binary format.
+ * @param[in] stream_p The stream to write to.
+ * @param[in] format   The format of the output.
+ * @return `true` on success, `false` if the stream failed or a binary
+ *         path is not contiguous.
+ */
+[[nodiscard]] bool OUTPUT_writePath(const Path *const path_p, FILE *stream_p,
+                                    OUTPUT_Format format);
+
+/**
+ * @brief Decodes a path written in the binary format.
+ *
+ * @param[in]  data_p  The encoded bytes.
+ * @param[in]  size    The number of bytes.
+ * @param[out] path_p  A pointer to a path holding enough cells, it is
+ *                     cleared and filled with the decoded cells.
+ * @return `true` on success, `false` if the bytes are not a valid encoding,
+ *         or the path is too small or leaves the 16-bit coordinates.
+ */
+[[nodiscard]] bool OUTPUT_decodeBinaryPath(const uint8_t *data_p, size_t size,
+                                           Path *const path_p);
+
+/**
+ * @brief Silences or restores the diagnostics of the library.
+ *
+ * Fatal errors are always reported.
+ *
+ * @param[in] isQuiet `true` to silence the diagnostics.
+ */
+void OUTPUT_setQuiet(bool isQuiet);
+
+/**
+ * @brief Checks whether the diagnostics are silenced.
+ *
+ * @return `true` if OUTPUT_setQuiet silenced them.
+ */
+[[nodiscard]] bool OUTPUT_isQuiet(void);
+
+/**
+ * @brief Reports a non-fatal diagnostic on stderr, unless silenced.
+ *
+ * @param[in] format_p A printf format, followed by its arguments.
+ */
+[[gnu::format(printf, 1, 2)]] void OUTPUT_logDiagnostic(const char *format_p, ...);
+
+/* > End of Multiple Inclusion Protection *********************************/
+#endif // PATH_OUTPUT_H
@@ -0,0 +1,99 @@
+/* > Description *******************************************************************/
+/**
+ * @file pathRepair.h
+ * @brief
+ *   This header file defines the public interface for the repair of a path
+ *   after a cell of its matrix changed. Only a blocked cell on the path breaks
+ *   it, and then only at that cell: the repair first routes the path around
+ *   the cell through the cells close to it, then grows one of the two broken
+ *   parts back to the length of the path, and only searches the matrix from
+ *   scratch when both fail. The cost of an update follows the damaged region
+ *   instead of the size of the matrix.
+ *
+ *****************************************************************************/
+
+/* > Multiple Inclusion Protection ****************************************/
+#ifndef PATH_REPAIR_H
+#define PATH_REPAIR_H
+
+/* > Includes *************************************************************/
+#include "dfsPathFinding.h"
+#include "matrixWorld.h"
+#include "path.h"
+#include <stdint.h>
+
+/* > Defines **************************************************************/
+
+/**
+ * @brief Number of rows and columns a detour may move away from the blocked
+ *        cell, the detour search never looks outside of that window.
+ */
+#define PATHREPAIR_DETOUR_RADIUS 3U
+
+/* > Type Declarations ****************************************************/
+
+/**
+ * @brief The way a path was repaired.
+ */
+typedef enum {
+    PATHREPAIR_INTACT,     ///< The change did not break the path.
+    PATHREPAIR_DETOUR,     ///< A detour around the blocked cell was spliced in.
+    PATHREPAIR_EXTENDED,   ///< A part of the path was grown back to its length.
+    PATHREPAIR_RESEARCHED, ///< The path was searched from scratch.
+    PATHREPAIR_FAILED      ///< No path of the length was found.
+} PATHREPAIR_Outcome;
+
+/* > Constant Declarations ************************************************/
+
+/* > Variable Declarations ************************************************/
+
+/* > Function Declarations ************************************************/
+
+/**
+ * @brief Repairs a path after a cell of its matrix changed.
+ *
+ * A detour is searched first, within PATHREPAIR_DETOUR_RADIUS of the cell,
+ * from the cell in front of it to the one behind it, with the steps of the
+ * neighborhood of the options. It holds at least one cell, also when a
+ * diagonal step joins the two. The path keeps its first cells and is cut
+ * back to its length behind the detour. Without a detour, or at an end of the
+ * path, the part in front of the cell is grown from its last cell and the
+ * part behind it from its first cell, with DFS_extendBounded, and then the
+ * matrix is searched from scratch. A search context is only created for the
+ * last two steps.
+ *
+ * @param[in]     matrix_p  A pointer to the WorldMatrix, after the change.
+ * @param[in,out] path_p    A pointer to a valid path of the matrix before the
+ *                          change. It holds a path of the same length after
+ *                          the repair, and is cleared when it fails.
+ * @param[in]     row       The row of the changed cell.
+ * @param[in]     col       The column of the changed cell.
+ * @param[in]     options_p A pointer to the search options, NULL for the defaults.
+ * @return The way the path was repaired.
+ */
+[[nodiscard]] PATHREPAIR_Outcome PATHREPAIR_repairPath(WorldMatrix *matrix_p, Path *const path_p,
+                                                       uint16_t row, uint16_t col,
+                                                       const DFS_SearchOptions *options_p);
+
+/**
+ * @brief Repairs a path after a cell of its matrix changed, with a search
+ *        context, see PATHREPAIR_repairPath.
+ *
+ * @param[in,out] context_p A pointer to a search context bound to matrix_p.
+ * @param[in]     matrix_p  A pointer to the WorldMatrix of the context, after
+ *                          the change.
+ * @param[in,out] path_p    A pointer to a valid path of the matrix before the
+ *                          change. It holds a path of the same length after
+ *                          the repair, and the longest partial path of the
+ *                          last search when it fails.
+ * @param[in]     row       The row of the changed cell.
+ * @param[in]     col       The column of the changed cell.
+ * @return The way the path was repaired.
+ */
+[[nodiscard]] PATHREPAIR_Outcome PATHREPAIR_repairBounded(DFS_SearchContext *const context_p,
+                                                          const WorldMatrix *const matrix_p,
+                                                          Path *const path_p, uint16_t row,
+                                                          uint16_t col);
+
+/* > End of Multiple Inclusion Protection *********************************/
+#endif // PATH_REPAIR_H
@@ -0,0 +1,62 @@
+/* > Description *******************************************************************/
+/**
+ * @file snakePath.h
+ * @brief
+ *   This header file defines the public interface for the constructive path
+ *   builder. On an empty WorldMatrix it lays a serpentine (boustrophedon)
+ *   path over the rows directly. On a sparsely blocked matrix it walks a
+ *   serpentine over bands of two rows, column by column, and stitches the
+ *   walk around the blocked cells with a small local search. Both take time
+ *   linear in the path length, no backtracking is involved.
+ *
+ *****************************************************************************/
+
+/* > Multiple Inclusion Protection ****************************************/
+#ifndef SNAKE_PATH_H
+#define SNAKE_PATH_H
+
+/* > Includes *************************************************************/
+#include "matrixWorld.h"
+#include "path.h"
+#include "visitedSet.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/* > Defines **************************************************************/
+
+/**
+ * @brief Largest share of blocked cells, in percent, the builder tries to
+ *        walk around. Denser matrices are left to the search.
+ */
+#define SNAKE_MAX_BLOCKED_PERCENT 10U
+
+/* > Type Declarations ****************************************************/
+
+/* > Constant Declarations ************************************************/
+
+/* > Variable Declarations ************************************************/
+
+/* > Function Declarations ************************************************/
+
+/**
+ * @brief Builds a contiguous path of a specified length without searching.
+ *
+ * The builder does not allocate. It fails on matrices with more than
+ * SNAKE_MAX_BLOCKED_PERCENT blocked cells, and whenever the local search
+ * cannot get the walk past a blocked cell, so a failure does not mean there
+ * is no such path.
+ *
+ * @param[in]     matrix_p   A pointer to the WorldMatrix to build the path in.
+ * @param[in]     pathLength The desired length of the path.
+ * @param[in,out] visited_p  A visited set of the matrix used as scratch space,
+ *                           its content is overwritten.
+ * @param[out]    result_p   A pointer to a Path holding at least pathLength
+ *                           cells. It is cleared and, on success, holds the
+ *                           built path.
+ * @return `true` if the path was built, `false` otherwise.
+ */
+[[nodiscard]] bool SNAKE_buildPath(const WorldMatrix *const matrix_p, uint32_t pathLength,
+                                   VisitedSet *const visited_p, Path *const result_p);
+
+/* > End of Multiple Inclusion Protection *********************************/
+#endif // SNAKE_PATH_H
@@ -0,0 +1,145 @@
+/* > Description *******************************************************************/
+/**
+ * @file startScheduler.h
+ * @brief
+ *   This header file defines the public interface for the StartScheduler data
+ *   structure. It enumerates the unblocked cells of a WorldMatrix once, in a
+ *   seeded shuffled or heuristic order, and hands every cell out exactly once
+ *   as a starting point of the search.
+ *
+ *****************************************************************************/
+
+/* > Multiple Inclusion Protection ****************************************/
+#ifndef START_SCHEDULER_H
+#define START_SCHEDULER_H
+
+/* > Includes *************************************************************/
+#include "connectivity.h"
+#include "matrixWorld.h"
+#include "utilities.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/* > Defines **************************************************************/
+
+/**
+ * @brief Value returned by SCHEDULER_claimNext once every start was handed out.
+ */
+#define SCHEDULER_EXHAUSTED UINT32_MAX
+
+/* > Type Declarations ****************************************************/
+
+/**
+ * @brief Order in which the starting points are handed out.
+ */
+typedef enum {
+  SCHEDULER_ORDER_SHUFFLED = 0,  /**< Uniformly shuffled with the seed (default). */
+  SCHEDULER_ORDER_LOW_DEGREE     /**< Fewest unblocked neighbors first, shuffled within a degree. */
+} SchedulerOrder;
+
+/**
+ * @brief Opaque pointer to the internal StartScheduler structure.
+ */
+typedef struct StartScheduler StartScheduler;
+
+/* > Constant Declarations ************************************************/
+
+/* > Variable Declarations ************************************************/
+
+/* > Function Declarations ************************************************/
+
+/**
+ * @brief Creates a scheduler holding every eligible starting point of a matrix.
+ *
+ * A cell is eligible when it is unblocked and, if a component map is given,
+ * its component holds at least minComponentSize cells.
+ *
+ * @param[in] matrix_p         A pointer to an initialized WorldMatrix.
+ * @param[in] componentMap_p   The component map of the matrix, or NULL.
+ * @param[in] minComponentSize Smallest component size accepted with a map.
+ * @param[in] order            The order in which the starts are handed out.
+ * @param[in] seed             Seed of the shuffle.
+ * @return A pointer to the newly created StartScheduler.
+ */
+[[nodiscard]] StartScheduler *SCHEDULER_createScheduler(const WorldMatrix *const matrix_p,
+                                                        const ComponentMap *const componentMap_p,
+                                                        uint32_t minComponentSize,
+                                                        SchedulerOrder order, uint64_t seed);
+
+/**
+ * @brief Creates a scheduler without starting points, to be filled with
+ *        SCHEDULER_refillScheduler.
+ *
+ * @param[in] capacity The most starting points the scheduler can hold, at
+ *                     least the number of unblocked cells of the matrices it
+ *                     will be filled from.
+ * @return A pointer to the newly created StartScheduler.
+ */
+[[nodiscard]] StartScheduler *SCHEDULER_createEmptyScheduler(uint32_t capacity);
+
+/**
+ * @brief Replaces the starting points of a scheduler without allocating.
+ *
+ * Selects and orders the starts exactly like SCHEDULER_createScheduler and
+ * rewinds the scheduler. Must not run concurrently with SCHEDULER_claimNext.
+ *
+ * @param[in,out] scheduler_p      A pointer to the scheduler.
+ * @param[in]     matrix_p         A pointer to an initialized WorldMatrix.
+ * @param[in]     componentMap_p   The component map of the matrix, or NULL.
+ * @param[in]     minComponentSize Smallest component size accepted with a map.
+ * @param[in]     order            The order in which the starts are handed out.
+ * @param[in]     seed             Seed of the shuffle.
+ */
+void SCHEDULER_refillScheduler(StartScheduler *const scheduler_p,
+                               const WorldMatrix *const matrix_p,
+                               const ComponentMap *const componentMap_p,
+                               uint32_t minComponentSize, SchedulerOrder order, uint64_t seed);
+
+/**
+ * @brief Frees all memory associated with the StartScheduler.
+ *
+ * @param[in,out] scheduler_pp A pointer to the pointer of the scheduler to be
+ *                             destroyed. The pointer is set to NULL after destruction.
+ */
+void SCHEDULER_destroyScheduler(StartScheduler **const scheduler_pp);
+
+/**
+ * @brief Claims the next starting point.
+ *
+ * Lock-free and safe to call from several threads at once, every index is
+ * handed out to a single caller.
+ *
+ * @param[in,out] scheduler_p A pointer to the scheduler.
+ * @return The index of the claimed start, to be read with SCHEDULER_getStart,
+ *         or SCHEDULER_EXHAUSTED when every start was handed out.
+ */
+[[nodiscard]] uint32_t SCHEDULER_claimNext(StartScheduler *const scheduler_p);
+
+/**
+ * @brief Gets a starting point by its index.
+ *
+ * @param[in] scheduler_p A pointer to the scheduler.
+ * @param[in] index       An index below SCHEDULER_getNoOfStarts.
+ * @return The coordinates of the starting point.
+ */
+[[nodiscard]] Cords SCHEDULER_getStart(const StartScheduler *const scheduler_p, uint32_t index);
+
+/**
+ * @brief Gets the number of starting points held by the scheduler.
+ *
+ * @param[in] scheduler_p A pointer to the scheduler.
+ * @return The number of eligible starting points.
+ */
+[[nodiscard]] uint32_t SCHEDULER_getNoOfStarts(const StartScheduler *const scheduler_p);
+
+/**
+ * @brief Rewinds the scheduler, so every start can be claimed again in the same order.
+ *
+ * Must not run concurrently with SCHEDULER_claimNext.
+ *
+ * @param[in,out] scheduler_p A pointer to the scheduler.
+ */
+void SCHEDULER_reset(StartScheduler *const scheduler_p);
+
+/* > End of Multiple Inclusion Protection *********************************/
+#endif // START_SCHEDULER_H
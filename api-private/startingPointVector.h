@@ -13,6 +13,7 @@
 #define STARTING_POINT_VECTOR_H
 
 /* > Includes *************************************************************/
+#include "arena.h"
 #include "matrixWorld.h"
 #include "utilities.h"
 #include <stdbool.h>
@@ -37,6 +38,19 @@ typedef struct StartingPointVector StartingPointVector;
  */
 [[nodiscard]] StartingPointVector *STPOINT_createVector(const WorldMatrix *const matrix_p);
 
+/**
+ * @brief Creates a new vector for storing exhausted points, carved from an arena.
+ *
+ * The vector is released with the arena, it must not be passed to
+ * STPOINT_destroyVector.
+ *
+ * @param[in]     matrix_p A pointer to an initialized WorldMatrix.
+ * @param[in,out] arena_p  The arena the vector is carved from.
+ * @return A pointer to the newly created StartingPointVector.
+ */
+[[nodiscard]] StartingPointVector *STPOINT_createVectorInArena(const WorldMatrix *const matrix_p,
+                                                               Arena *const arena_p);
+
 /**
  * @brief Frees all memory associated with the StartingPointVector.
  *
@@ -0,0 +1,115 @@
+/* > Description *******************************************************************/
+/**
+ * @file tiledSearch.h
+ * @brief
+ *   This header file defines the public interface for the tiled search of a
+ *   path in worlds too large for a single search. The matrix is split into a
+ *   grid of rectangular tiles visited in serpentine order, row after row of
+ *   tiles. On every border two consecutive tiles share, a pair of neighboring
+ *   free cells is picked as the portal: the exit of the first tile and the
+ *   entry of the second one. With both ends fixed the tiles are independent,
+ *   every worker builds a segment from the entry to the exit of its tile
+ *   using only the cells of that tile, and the segments join into one
+ *   contiguous path.
+ *
+ *   Every worker runs in its own process and talks to the caller over a
+ *   socket: it reads a task naming its tile and portals and answers with its
+ *   segment in the binary path format of OUTPUT_writePath. TILEDSEARCH_serveTile
+ *   is the worker side of that exchange, so a worker on another host holding
+ *   the same world can answer a task as well. Such an answer is not trusted,
+ *   a segment leaving its tile, crossing a blocked cell or repeating a cell
+ *   fails the search.
+ *
+ *****************************************************************************/
+
+/* > Multiple Inclusion Protection ****************************************/
+#ifndef TILED_SEARCH_H
+#define TILED_SEARCH_H
+
+/* > Includes *************************************************************/
+#include "matrixWorld.h"
+#include "path.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/* > Defines **************************************************************/
+
+/**
+ * @brief Largest number of tiles of a search, one worker process each.
+ */
+#define TILEDSEARCH_MAX_NO_OF_TILES 1024U
+
+/**
+ * @brief Size in bytes of the task a worker reads from its socket: the first
+ *        row and column of the tile, its rows and columns, the entry and the
+ *        exit cell, as 16-bit values, and the number of cells wanted as a
+ *        32-bit value, all little endian. A missing portal is UINT16_MAX.
+ */
+#define TILEDSEARCH_TASK_SIZE 20U
+
+/* > Type Declarations ****************************************************/
+
+/**
+ * @brief Options controlling a TILEDSEARCH_findPath search.
+ *
+ * Obtain the defaults with TILEDSEARCH_getDefaultOptions() and override
+ * fields as needed.
+ */
+typedef struct {
+  uint16_t noOfTileRows; /**< Number of tiles stacked from top to bottom. */
+  uint16_t noOfTileCols; /**< Number of tiles side by side. */
+  bool useProcesses;     /**< Fork one worker process per tile, otherwise the
+                              segments are built one after the other in the
+                              calling process. */
+} TILEDSEARCH_Options;
+
+/* > Constant Declarations ************************************************/
+
+/* > Variable Declarations ************************************************/
+
+/* > Function Declarations ************************************************/
+
+/**
+ * @brief Gets the default tiled search options, 2x2 tiles in worker processes.
+ * @return The default options.
+ */
+[[nodiscard]] TILEDSEARCH_Options TILEDSEARCH_getDefaultOptions(void);
+
+/**
+ * @brief Attempts to find a contiguous path of a specified length by joining
+ *        the segments of the tiles of the matrix.
+ *
+ * A segment starts as the shortest route between the portals of its tile and
+ * is lengthened by detours through pairs of free cells next to it, until it
+ * holds pathLength cells or no detour is left. The path is made of the
+ * segments in tile order, cut to pathLength cells. The search gives up when
+ * a shared border has no pair of free cells, when the portals of a tile are
+ * not connected inside it, or when the segments together are too short.
+ *
+ * The worker processes are forked, so the caller should not run other
+ * threads at the same time.
+ *
+ * @param[in] matrix_p   A pointer to the WorldMatrix to search within.
+ * @param[in] pathLength The desired length of the path.
+ * @param[in] options_p  A pointer to the options, NULL for the defaults.
+ * @return A pointer to a Path object if a path is found, otherwise NULL. The
+ *         caller is responsible for freeing it using PATH_freePath().
+ */
+[[nodiscard]] Path *TILEDSEARCH_findPath(const WorldMatrix *const matrix_p, uint32_t pathLength,
+                                         const TILEDSEARCH_Options *options_p);
+
+/**
+ * @brief Answers one task read from a socket, the worker side of a tiled search.
+ *
+ * Reads a task of TILEDSEARCH_TASK_SIZE bytes, builds the segment of the tile
+ * and writes it in the binary path format. Nothing is written when the
+ * portals of the tile are not connected. The socket is closed in any case.
+ *
+ * @param[in] socketFd The connected socket.
+ * @param[in] matrix_p A pointer to the WorldMatrix the task refers to.
+ * @return false if the task is malformed or the segment could not be sent.
+ */
+bool TILEDSEARCH_serveTile(int socketFd, const WorldMatrix *const matrix_p);
+
+/* > End of Multiple Inclusion Protection *********************************/
+#endif // TILED_SEARCH_H
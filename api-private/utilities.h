@@ -4,7 +4,7 @@
 #include <stdlib.h>
 #define UNUSED(x) ((void)(x))
 #define FOUR_DIRECTIONS 4
-#define RANDOM_GEN_SEED 42 //some fairly ordinary number
+#define RANDOM_GEN_SEED 42 //some fairly ordinary number, default seed of the search
 
 #include <stdint.h>
 
@@ -29,28 +29,62 @@ static const fourWayDirections directions[FOUR_DIRECTIONS] =
   {-1, 0}
 };
 
-static inline uint16_t UTILITY_generateRandomNumber(uint16_t upperBound)
+/**
+ * @brief Scrambles the bits of a 32-bit value (murmur3 finalizer).
+ *
+ * Cheap, stateless and thread-safe source of pseudo-random looking values.
+ */
+static inline uint32_t UTILITY_mixBits(uint32_t value)
 {
-  if (upperBound == 0) {
-    return UINT16_MAX; //This should fail further during execution
-  }
+  value ^= value >> 16;
+  value *= 0x85EBCA6BU;
+  value ^= value >> 13;
+  value *= 0xC2B2AE35U;
+  value ^= value >> 16;
+  return value;
+}
 
-  // Addressing modulo bias
-  // Discard from the max rand range the uneven max deviser of upperBound
-  uint16_t validRange = RAND_MAX - (RAND_MAX % upperBound);
-  // lower bound for the random generation is 0 as in WorldMatrix first index
-  uint32_t returnValue;
+/**
+ * @brief State of a small seedable pseudo-random generator (splitmix64).
+ *
+ * Every owner keeps its own state, so no lock is shared between threads.
+ */
+typedef struct {
+  uint64_t state;
+} RandomGenerator;
 
-  // The loop should have very small failure rate. Usually first pick is enough
-  do{
-    returnValue = rand();
-  }while(returnValue >= validRange);
+static inline void UTILITY_seedGenerator(RandomGenerator *generator_p, uint64_t seed)
+{
+  generator_p->state = seed;
+}
 
-  return returnValue % upperBound;
+static inline uint64_t UTILITY_nextRandom(RandomGenerator *generator_p)
+{
+  uint64_t value = (generator_p->state += 0x9E3779B97F4A7C15ULL);
+  value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+  return value ^ (value >> 31);
 }
 
-static inline void UTILITY_seedRandomNumberGen(void)
+/**
+ * @brief Draws a value in [0, upperBound) without modulo bias.
+ *
+ * Uses the multiply-shift reduction and only rejects the few draws that
+ * would make the result uneven.
+ */
+static inline uint32_t UTILITY_nextBoundedRandom(RandomGenerator *generator_p, uint32_t upperBound)
 {
-  srand(RANDOM_GEN_SEED);
+  if (upperBound == 0) {
+    return 0;
+  }
+  uint64_t product = (UTILITY_nextRandom(generator_p) >> 32) * upperBound;
+  if ((uint32_t)product < upperBound) {
+    uint32_t threshold = (uint32_t)(-upperBound) % upperBound;
+    while ((uint32_t)product < threshold) {
+      product = (UTILITY_nextRandom(generator_p) >> 32) * upperBound;
+    }
+  }
+  return (uint32_t)(product >> 32);
 }
+
 #endif
\ No newline at end of file
@@ -0,0 +1,228 @@
+/* > Description *******************************************************************/
+/**
+ * @file visitedSet.h
+ * @brief
+ *   This header file defines the public interface for the VisitedSet data
+ *   structure. It is a dense bitset with one bit per WorldMatrix cell, used to
+ *   track the cells visited by a single search attempt in constant time.
+ *
+ *****************************************************************************/
+
+/* > Multiple Inclusion Protection ****************************************/
+#ifndef VISITED_SET_H
+#define VISITED_SET_H
+
+/* > Includes *************************************************************/
+#include "arena.h"
+#include "matrixWorld.h"
+#include "utilities.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* > Defines **************************************************************/
+
+/* > Type Declarations ****************************************************/
+
+/**
+ * @brief Opaque pointer to the internal VisitedSet structure.
+ */
+typedef struct VisitedSet VisitedSet;
+
+/* > Constant Declarations ************************************************/
+
+/* > Variable Declarations ************************************************/
+
+/* > Function Declarations ************************************************/
+
+/**
+ * @brief Creates a new, empty visited set matching the dimensions of a matrix.
+ *
+ * Cells are indexed with the same row * cols + col mapping as the WorldMatrix.
+ *
+ * @param[in] matrix_p A pointer to an initialized WorldMatrix.
+ * @return A pointer to the newly created VisitedSet.
+ */
+[[nodiscard]] VisitedSet *VISITED_createSet(const WorldMatrix *const matrix_p);
+
+/**
+ * @brief Creates a new, empty visited set carved from an arena.
+ *
+ * The set is released with the arena, it must not be passed to VISITED_destroySet.
+ *
+ * @param[in]     matrix_p A pointer to an initialized WorldMatrix.
+ * @param[in,out] arena_p  The arena the set is carved from.
+ * @return A pointer to the newly created VisitedSet.
+ */
+[[nodiscard]] VisitedSet *VISITED_createSetInArena(const WorldMatrix *const matrix_p,
+                                                   Arena *const arena_p);
+
+/**
+ * @brief Frees all memory associated with the VisitedSet.
+ *
+ * @param[in,out] set_pp A pointer to the pointer of the set to be destroyed.
+ *                       The pointer is set to NULL after destruction.
+ */
+void VISITED_destroySet(VisitedSet **const set_pp);
+
+/**
+ * @brief Unmarks every cell of the set.
+ *
+ * The cost is proportional to the number of 64-bit words, not to the number
+ * of cells.
+ *
+ * @param[in,out] set_p A pointer to the set to be cleared.
+ */
+void VISITED_clearSet(VisitedSet *const set_p);
+
+/**
+ * @brief Marks a cell as visited.
+ *
+ * @param[in,out] set_p A pointer to the set.
+ * @param[in]     row   The row of the cell.
+ * @param[in]     col   The column of the cell.
+ */
+void VISITED_markCell(VisitedSet *const set_p, uint16_t row, uint16_t col);
+
+/**
+ * @brief Marks a cell as not visited.
+ *
+ * @param[in,out] set_p A pointer to the set.
+ * @param[in]     row   The row of the cell.
+ * @param[in]     col   The column of the cell.
+ */
+void VISITED_unmarkCell(VisitedSet *const set_p, uint16_t row, uint16_t col);
+
+/**
+ * @brief Checks if a cell is marked as visited.
+ *
+ * @param[in] set_p A pointer to the set.
+ * @param[in] row   The row of the cell.
+ * @param[in] col   The column of the cell.
+ * @return `true` if the cell is marked, `false` otherwise.
+ */
+[[nodiscard]] bool VISITED_isMarked(const VisitedSet *const set_p, uint16_t row, uint16_t col);
+
+/**
+ * @brief Gets the number of cells the set can track.
+ *
+ * @param[in] set_p A pointer to the set.
+ * @return The number of cells (rows * cols of the source matrix).
+ */
+[[nodiscard]] size_t VISITED_getCapacity(const VisitedSet *const set_p);
+
+/* > Unchecked Fast-Path API *********************************************/
+#if defined(VISITED_UNCHECKED_API)
+/*
+ * Defining VISITED_UNCHECKED_API before including this header exposes the
+ * internal layout of the VisitedSet together with header-inline accessors
+ * that skip the null and bounds checks.
+ */
+
+#define VISITED_BITS_PER_WORD 64U
+
+#if defined(MATRIXWORLD_TILED_LAYOUT)
+/**
+ * @brief Number of rows and columns of the square tile held by one word, the
+ *        same tiles as the ones of the WorldMatrix.
+ */
+#define VISITED_TILE_SIZE 8U
+#endif
+
+/**
+ * @brief Internal structure for the VisitedSet.
+ * @details This struct uses a flexible array member `words` so the header and
+ *          the bits live within a single contiguous block of memory. The bits
+ *          follow the row-major order of the cells, or the 8x8 tiles of the
+ *          WorldMatrix in a build with MATRIXWORLD_TILED_LAYOUT.
+ */
+struct VisitedSet {
+    uint16_t rows;     ///< Number of rows of the source matrix.
+    uint16_t cols;     ///< Number of columns of the source matrix.
+#if defined(MATRIXWORLD_TILED_LAYOUT)
+    uint16_t tilesPerRow; ///< Number of tiles in a row of tiles.
+#endif
+    size_t noOfCells;  ///< Number of cells tracked by the set.
+    size_t noOfWords;  ///< Number of 64-bit words in `words`.
+    uint64_t words[];  ///< Flexible array member holding one bit per cell.
+};
+
+/**
+ * @brief Gets the number of words a set of a matrix needs.
+ * @param[in] rows The number of rows of the matrix.
+ * @param[in] cols The number of columns of the matrix.
+ * @return The number of 64-bit words holding one bit per cell.
+ */
+static inline size_t VISITED_unchecked_getNoOfWords(uint16_t rows, uint16_t cols) {
+#if defined(MATRIXWORLD_TILED_LAYOUT)
+    return ((size_t)(rows + VISITED_TILE_SIZE - 1) / VISITED_TILE_SIZE) *
+           ((cols + VISITED_TILE_SIZE - 1) / VISITED_TILE_SIZE);
+#else
+    return (((size_t)rows * cols) + VISITED_BITS_PER_WORD - 1) / VISITED_BITS_PER_WORD;
+#endif
+}
+
+/**
+ * @brief Returns the word holding the bit of a cell.
+ * @param[in] set_p A pointer to a valid set.
+ * @param[in] row   The row of the cell, must be in bounds.
+ * @param[in] col   The column of the cell, must be in bounds.
+ * @param[out] bit_p The index of the bit within the word.
+ * @return The index of the word.
+ */
+static inline size_t VISITED_unchecked_locateCell(const VisitedSet *const set_p, uint16_t row,
+                                                  uint16_t col, uint32_t *const bit_p) {
+#if defined(MATRIXWORLD_TILED_LAYOUT)
+    *bit_p = ((row % VISITED_TILE_SIZE) * VISITED_TILE_SIZE) + (col % VISITED_TILE_SIZE);
+    return ((size_t)(row / VISITED_TILE_SIZE) * set_p->tilesPerRow) + (col / VISITED_TILE_SIZE);
+#else
+    size_t index = ((size_t)row * set_p->cols) + col;
+    *bit_p = (uint32_t)(index % VISITED_BITS_PER_WORD);
+    return index / VISITED_BITS_PER_WORD;
+#endif
+}
+
+/**
+ * @brief Unchecked version of VISITED_isMarked.
+ * @param[in] set_p A pointer to a valid set.
+ * @param[in] row   The row of the cell, must be in bounds.
+ * @param[in] col   The column of the cell, must be in bounds.
+ * @return `true` if the cell is marked, `false` otherwise.
+ */
+static inline bool VISITED_unchecked_isMarked(const VisitedSet *const set_p, uint16_t row,
+                                              uint16_t col) {
+    uint32_t bit;
+    size_t word = VISITED_unchecked_locateCell(set_p, row, col, &bit);
+    return (set_p->words[word] >> bit) & UINT64_C(1);
+}
+
+/**
+ * @brief Unchecked version of VISITED_markCell.
+ * @param[in,out] set_p A pointer to a valid set.
+ * @param[in]     row   The row of the cell, must be in bounds.
+ * @param[in]     col   The column of the cell, must be in bounds.
+ */
+static inline void VISITED_unchecked_markCell(VisitedSet *const set_p, uint16_t row,
+                                              uint16_t col) {
+    uint32_t bit;
+    size_t word = VISITED_unchecked_locateCell(set_p, row, col, &bit);
+    set_p->words[word] |= UINT64_C(1) << bit;
+}
+
+/**
+ * @brief Unchecked version of VISITED_unmarkCell.
+ * @param[in,out] set_p A pointer to a valid set.
+ * @param[in]     row   The row of the cell, must be in bounds.
+ * @param[in]     col   The column of the cell, must be in bounds.
+ */
+static inline void VISITED_unchecked_unmarkCell(VisitedSet *const set_p, uint16_t row,
+                                                uint16_t col) {
+    uint32_t bit;
+    size_t word = VISITED_unchecked_locateCell(set_p, row, col, &bit);
+    set_p->words[word] &= ~(UINT64_C(1) << bit);
+}
+
+#endif /* VISITED_UNCHECKED_API */
+
+/* > End of Multiple Inclusion Protection *********************************/
+#endif // VISITED_SET_H
@@ -0,0 +1,398 @@
+/* > Description ****************************************************************/
+/**
+ * @file pathFinderBench.c
+ * @brief Benchmark harness of the path search. Runs a fixed suite of seeded
+ *        scenarios through DFS_findPathWithReport, single-threaded and
+ *        threaded, and reports the median and p95 time-to-path, the work of
+ *        the search and the allocations it made, as CSV or JSON.
+ */
+
+/* > Includes ****************************************************************/
+#include "dfsPathFinding.h"
+#include "matrixWorld.h"
+#include "path.h"
+#include "utilities.h"
+#include <errno.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* > Defines *****************************************************************/
+#define BENCH_DEFAULT_REPETITIONS 5U
+#define BENCH_MATRIX_SEED UINT64_C(0x5EED)
+#define BENCH_PERCENT 100U
+#define BENCH_PER_MILLE 1000U
+#define BENCH_NS_PER_MS 1e6
+
+/* > Type Declarations *******************************************************/
+
+/*
+ * @brief One matrix and path length of the suite.
+ */
+typedef struct {
+  const char *name;
+  uint16_t rows;
+  uint16_t cols;
+  uint8_t blockedPercent; // Share of the cells blocked at random
+  uint16_t pathPerMille;  // Path length as a share of all cells
+} BENCH_Scenario_t;
+
+/*
+ * @brief Output format of the results.
+ */
+typedef enum { BENCH_FORMAT_CSV = 0, BENCH_FORMAT_JSON } BENCH_Format_t;
+
+/*
+ * @brief The settings of a benchmark run.
+ */
+typedef struct {
+  BENCH_Format_t format;
+  uint32_t repetitions;
+  const char *filter; // Only scenarios whose name holds it, NULL for all
+  uint16_t noOfThreads;
+  bool useKernels; // The specialized search kernels, otherwise the generic loop
+} BENCH_Settings_t;
+
+/*
+ * @brief The measurements of one scenario in one threading mode.
+ */
+typedef struct {
+  uint16_t noOfThreads;
+  uint32_t pathLength;
+  bool isFound;
+  double medianMs;
+  double p95Ms;
+  uint64_t nodesExpanded;   // Median over the repetitions
+  uint32_t startsAttempted; // Median over the repetitions
+  uint32_t allocations;     // Largest count of a single search
+} BENCH_Result_t;
+
+/* > Local Constant Definitions **********************************************/
+
+/*
+ * @brief The suite: the small, medium and large maps of the Python harness
+ *        (45% blocked), open and sparse maps, a range of path lengths and a
+ *        4000x4000 map that does not fit into any cache.
+ */
+static const BENCH_Scenario_t scenarios[] = {
+    {"small-open", 100, 100, 0, 8},
+    {"small-sparse", 100, 100, 10, 8},
+    {"small", 100, 100, 45, 8},
+    {"small-long", 100, 100, 0, 200},
+    {"medium-open", 200, 200, 0, 8},
+    {"medium-sparse", 200, 200, 10, 8},
+    {"medium", 200, 200, 45, 8},
+    {"medium-long", 200, 200, 10, 200},
+    {"large-open", 500, 500, 0, 8},
+    {"large-sparse", 500, 500, 10, 8},
+    {"large", 500, 500, 45, 8},
+    {"large-long", 500, 500, 0, 200},
+    {"huge-open", 1000, 1000, 0, 8},
+    {"huge-sparse", 1000, 1000, 10, 8},
+    {"huge", 1000, 1000, 45, 8},
+    {"huge-long", 1000, 1000, 0, 100},
+    {"giant-sparse", 4000, 4000, 10, 8},
+    {"giant", 4000, 4000, 30, 8},
+};
+
+/* > Local Variable Definitions **********************************************/
+
+static atomic_bool isCounting = false;
+static atomic_uint noOfAllocations = 0;
+
+/* > Local Function Declarations *********************************************/
+
+/**
+ * @brief Parses the command line of the benchmark.
+ * @param argc[in]      The argument count.
+ * @param argv[in]      The argument vector.
+ * @param settings_p[out] The parsed settings.
+ * @return false on an invalid argument.
+ */
+static bool BENCH_internal_parseArguments(int argc, char *argv[], BENCH_Settings_t *settings_p);
+
+/**
+ * @brief Builds the seeded matrix of a scenario.
+ * @param scenario_p[in] The scenario.
+ * @return The new WorldMatrix.
+ */
+static WorldMatrix *BENCH_internal_buildMatrix(const BENCH_Scenario_t *scenario_p);
+
+/**
+ * @brief Measures the searches of a scenario in one threading mode.
+ * @param matrix_p[in]    The matrix of the scenario.
+ * @param pathLength[in]  The length searched.
+ * @param noOfThreads[in] 1 for the single-threaded search.
+ * @param settings_p[in]  The settings of the run.
+ * @return The measurements.
+ */
+static BENCH_Result_t BENCH_internal_runScenario(WorldMatrix *matrix_p, uint32_t pathLength,
+                                                 uint16_t noOfThreads,
+                                                 const BENCH_Settings_t *settings_p);
+
+/**
+ * @brief Writes one result line.
+ * @param settings_p[in] The settings of the run.
+ * @param scenario_p[in] The scenario.
+ * @param result_p[in]   Its measurements.
+ * @param isFirst[in]    Whether it is the first result written.
+ */
+static void BENCH_internal_printResult(const BENCH_Settings_t *settings_p,
+                                       const BENCH_Scenario_t *scenario_p,
+                                       const BENCH_Result_t *result_p, bool isFirst);
+
+/**
+ * @brief Sorts values in ascending order.
+ * @param values_p[in,out] The values.
+ * @param noOfValues[in]   Their number.
+ */
+static void BENCH_internal_sort(uint64_t *values_p, uint32_t noOfValues);
+
+static void BENCH_internal_startCounting(void);
+static uint32_t BENCH_internal_stopCounting(void);
+
+/* > Allocator Wrappers ******************************************************/
+
+// The benchmark is linked with --wrap for the allocator, so every allocation
+// of a timed search is counted here, whichever allocator serves it.
+extern void *__real_malloc(size_t size);
+extern void *__real_calloc(size_t count, size_t size);
+extern void *__real_realloc(void *pointer, size_t size);
+extern void *__real_aligned_alloc(size_t alignment, size_t size);
+
+void *__wrap_malloc(size_t size) {
+  if (atomic_load_explicit(&isCounting, memory_order_relaxed)) {
+    atomic_fetch_add_explicit(&noOfAllocations, 1, memory_order_relaxed);
+  }
+  return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t count, size_t size) {
+  if (atomic_load_explicit(&isCounting, memory_order_relaxed)) {
+    atomic_fetch_add_explicit(&noOfAllocations, 1, memory_order_relaxed);
+  }
+  return __real_calloc(count, size);
+}
+
+void *__wrap_realloc(void *pointer, size_t size) {
+  if (atomic_load_explicit(&isCounting, memory_order_relaxed)) {
+    atomic_fetch_add_explicit(&noOfAllocations, 1, memory_order_relaxed);
+  }
+  return __real_realloc(pointer, size);
+}
+
+void *__wrap_aligned_alloc(size_t alignment, size_t size) {
+  if (atomic_load_explicit(&isCounting, memory_order_relaxed)) {
+    atomic_fetch_add_explicit(&noOfAllocations, 1, memory_order_relaxed);
+  }
+  return __real_aligned_alloc(alignment, size);
+}
+
+/* > Main ********************************************************************/
+
+int main(int argc, char *argv[]) {
+  BENCH_Settings_t settings;
+  if (!BENCH_internal_parseArguments(argc, argv, &settings)) {
+    fprintf(stderr, "Usage: %s [--format csv|json] [--repetitions N] [--filter NAME] "
+                    "[--threads N] [--kernels on|off]\n",
+            argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  if (settings.format == BENCH_FORMAT_CSV) {
+    printf("scenario,rows,cols,blocked_percent,path_length,threads,repetitions,found,"
+           "median_ms,p95_ms,nodes_expanded,starts_attempted,allocations\n");
+  } else {
+    printf("[");
+  }
+  bool isFirst = true;
+  for (size_t index = 0; index < sizeof(scenarios) / sizeof(scenarios[0]); index++) {
+    const BENCH_Scenario_t *scenario_p = &scenarios[index];
+    if (settings.filter != NULL && strstr(scenario_p->name, settings.filter) == NULL) {
+      continue;
+    }
+    WorldMatrix *matrix_p = BENCH_internal_buildMatrix(scenario_p);
+    uint32_t pathLength = (uint32_t)((uint64_t)scenario_p->rows * scenario_p->cols *
+                                     scenario_p->pathPerMille / BENCH_PER_MILLE);
+    const uint16_t modes[] = {1, settings.noOfThreads};
+    for (size_t mode = 0; mode < sizeof(modes) / sizeof(modes[0]); mode++) {
+      BENCH_Result_t result =
+          BENCH_internal_runScenario(matrix_p, pathLength, modes[mode], &settings);
+      BENCH_internal_printResult(&settings, scenario_p, &result, isFirst);
+      isFirst = false;
+      fflush(stdout);
+    }
+    MATRIXWORLD_matrixFree(&matrix_p);
+  }
+  if (settings.format == BENCH_FORMAT_JSON) {
+    printf("\n]\n");
+  }
+  return EXIT_SUCCESS;
+}
+
+/* > Local Function Definitions **********************************************/
+
+static bool BENCH_internal_parseArguments(int argc, char *argv[], BENCH_Settings_t *settings_p) {
+  *settings_p = (BENCH_Settings_t){.format = BENCH_FORMAT_CSV,
+                                   .repetitions = BENCH_DEFAULT_REPETITIONS,
+                                   .filter = NULL,
+                                   .noOfThreads = DFS_detectNoOfThreads(),
+                                   .useKernels = true};
+  for (int i = 1; i < argc; ++i) {
+    const char *arg = argv[i];
+    if (i + 1 >= argc) {
+      return false;
+    }
+    const char *value = argv[++i];
+    char *end;
+    errno = 0;
+    if (strcmp(arg, "--format") == 0) {
+      if (strcmp(value, "csv") == 0) {
+        settings_p->format = BENCH_FORMAT_CSV;
+      } else if (strcmp(value, "json") == 0) {
+        settings_p->format = BENCH_FORMAT_JSON;
+      } else {
+        return false;
+      }
+    } else if (strcmp(arg, "--repetitions") == 0) {
+      unsigned long repetitions = strtoul(value, &end, 10);
+      if (errno || *end != '\0' || value[0] == '-' || repetitions == 0 || repetitions > UINT32_MAX) {
+        return false;
+      }
+      settings_p->repetitions = (uint32_t)repetitions;
+    } else if (strcmp(arg, "--filter") == 0) {
+      settings_p->filter = value;
+    } else if (strcmp(arg, "--threads") == 0) {
+      unsigned long noOfThreads = strtoul(value, &end, 10);
+      if (errno || *end != '\0' || value[0] == '-' || noOfThreads == 0 || noOfThreads > UINT16_MAX) {
+        return false;
+      }
+      settings_p->noOfThreads = (uint16_t)noOfThreads;
+    } else if (strcmp(arg, "--kernels") == 0) {
+      if (strcmp(value, "on") == 0) {
+        settings_p->useKernels = true;
+      } else if (strcmp(value, "off") == 0) {
+        settings_p->useKernels = false;
+      } else {
+        return false;
+      }
+    } else {
+      return false;
+    }
+  }
+  return true;
+}
+
+static WorldMatrix *BENCH_internal_buildMatrix(const BENCH_Scenario_t *scenario_p) {
+  WorldMatrix *matrix_p = MATRIXWORLD_matrixInitialization(scenario_p->rows, scenario_p->cols);
+  RandomGenerator generator;
+  UTILITY_seedGenerator(&generator, BENCH_MATRIX_SEED);
+  for (uint16_t row = 0; row < scenario_p->rows; row++) {
+    for (uint16_t col = 0; col < scenario_p->cols; col++) {
+      if (UTILITY_nextBoundedRandom(&generator, BENCH_PERCENT) < scenario_p->blockedPercent) {
+        MATRIXWORLD_setCell(matrix_p, row, col, true);
+      }
+    }
+  }
+  return matrix_p;
+}
+
+static BENCH_Result_t BENCH_internal_runScenario(WorldMatrix *matrix_p, uint32_t pathLength,
+                                                 uint16_t noOfThreads,
+                                                 const BENCH_Settings_t *settings_p) {
+  const uint32_t repetitions = settings_p->repetitions;
+  DFS_SearchOptions options = DFS_getDefaultOptions();
+  options.isMultithreading = noOfThreads > 1;
+  options.noOfThreads = noOfThreads;
+  options.useKernels = settings_p->useKernels;
+  BENCH_Result_t result = {.noOfThreads = noOfThreads, .pathLength = pathLength};
+
+  uint64_t *times_p = malloc(3 * sizeof(uint64_t) * repetitions);
+  if (times_p == NULL) {
+    fprintf(stderr, "FATAL ERROR: Could not allocate memory for the measurements!\n");
+    exit(EXIT_FAILURE);
+  }
+  uint64_t *nodes_p = times_p + repetitions;
+  uint64_t *starts_p = nodes_p + repetitions;
+  for (uint32_t repetition = 0; repetition < repetitions; repetition++) {
+    DFS_SearchReport report;
+    struct timespec start;
+    struct timespec end;
+    BENCH_internal_startCounting();
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    Path *path_p = DFS_findPathWithReport(matrix_p, pathLength, &options, &report);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    uint32_t allocations = BENCH_internal_stopCounting();
+
+    if (path_p != NULL && (PATH_getLength(path_p) != pathLength || !PATH_isContiguous(path_p))) {
+      fprintf(stderr, "FATAL ERROR: The search returned an invalid path!\n");
+      exit(EXIT_FAILURE);
+    }
+    result.isFound = path_p != NULL;
+    PATH_freePath(&path_p);
+    times_p[repetition] = (uint64_t)(end.tv_sec - start.tv_sec) * 1000000000U +
+                          (uint64_t)end.tv_nsec - (uint64_t)start.tv_nsec;
+    nodes_p[repetition] = report.nodesExpanded;
+    starts_p[repetition] = report.startsAttempted;
+    result.allocations = (allocations > result.allocations) ? allocations : result.allocations;
+  }
+
+  BENCH_internal_sort(times_p, repetitions);
+  BENCH_internal_sort(nodes_p, repetitions);
+  BENCH_internal_sort(starts_p, repetitions);
+  // Nearest rank percentiles.
+  result.medianMs = (double)times_p[(repetitions - 1) / 2] / BENCH_NS_PER_MS;
+  result.p95Ms = (double)times_p[((repetitions * 95U) + 99U) / 100U - 1U] / BENCH_NS_PER_MS;
+  result.nodesExpanded = nodes_p[(repetitions - 1) / 2];
+  result.startsAttempted = (uint32_t)starts_p[(repetitions - 1) / 2];
+  free(times_p);
+  return result;
+}
+
+static void BENCH_internal_printResult(const BENCH_Settings_t *settings_p,
+                                       const BENCH_Scenario_t *scenario_p,
+                                       const BENCH_Result_t *result_p, bool isFirst) {
+  if (settings_p->format == BENCH_FORMAT_CSV) {
+    printf("%s,%u,%u,%u,%u,%u,%u,%s,%.3f,%.3f,%llu,%u,%u\n", scenario_p->name, scenario_p->rows,
+           scenario_p->cols, scenario_p->blockedPercent, result_p->pathLength,
+           result_p->noOfThreads, settings_p->repetitions, result_p->isFound ? "true" : "false",
+           result_p->medianMs, result_p->p95Ms, (unsigned long long)result_p->nodesExpanded,
+           result_p->startsAttempted, result_p->allocations);
+    return;
+  }
+  printf("%s\n  {\"scenario\": \"%s\", \"rows\": %u, \"cols\": %u, \"blocked_percent\": %u, "
+         "\"path_length\": %u, \"threads\": %u, \"repetitions\": %u, \"found\": %s, "
+         "\"median_ms\": %.3f, \"p95_ms\": %.3f, \"nodes_expanded\": %llu, "
+         "\"starts_attempted\": %u, \"allocations\": %u}",
+         isFirst ? "" : ",", scenario_p->name, scenario_p->rows, scenario_p->cols,
+         scenario_p->blockedPercent, result_p->pathLength, result_p->noOfThreads,
+         settings_p->repetitions, result_p->isFound ? "true" : "false", result_p->medianMs,
+         result_p->p95Ms, (unsigned long long)result_p->nodesExpanded, result_p->startsAttempted,
+         result_p->allocations);
+}
+
+static void BENCH_internal_sort(uint64_t *values_p, uint32_t noOfValues) {
+  // The repetitions are few, an insertion sort is enough.
+  for (uint32_t index = 1; index < noOfValues; index++) {
+    uint64_t value = values_p[index];
+    uint32_t position = index;
+    while (position > 0 && values_p[position - 1] > value) {
+      values_p[position] = values_p[position - 1];
+      position--;
+    }
+    values_p[position] = value;
+  }
+}
+
+static void BENCH_internal_startCounting(void) {
+  atomic_store(&noOfAllocations, 0);
+  atomic_store(&isCounting, true);
+}
+
+static uint32_t BENCH_internal_stopCounting(void) {
+  atomic_store(&isCounting, false);
+  return atomic_load(&noOfAllocations);
+}
@@ -0,0 +1,152 @@
+/* > Description ****************************************************************/
+/**
+ * @file arena.c
+ * @brief This is the file for handling the Arena. The arena lives in the first
+ *        cache line of its own anonymous mapping, so creating it is the only
+ *        system call of its lifetime and distinct arenas never share a line.
+ */
+
+/* > Includes ****************************************************************/
+#include "arena.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+
+/* > Defines *****************************************************************/
+#define ARENA_HUGE_PAGE_SIZE (2U * 1024U * 1024U)
+
+/* > Type Declarations *******************************************************/
+
+/**
+ * @brief Internal structure for the Arena.
+ * @details The header takes the first cache line of the mapping, the blocks
+ *          are carved from the bytes after it.
+ */
+struct Arena {
+    size_t mappingSize;  ///< Size of the whole mapping, the header included.
+    size_t capacity;     ///< Number of bytes that can be handed out.
+    size_t usedBytes;    ///< Offset of the next block from `blocks`.
+    bool usesHugePages;  ///< Whether hugepages were granted for the mapping.
+    _Alignas(ARENA_CACHE_LINE_SIZE) unsigned char blocks[]; ///< The carved bytes.
+};
+
+/* > Global Constant Definitions *********************************************/
+
+/* > Global Variable Definitions *********************************************/
+
+/* > Local Constant Definitions **********************************************/
+
+/* > Local Variable Definitions **********************************************/
+
+/* > Local Function Declarations *********************************************/
+
+/**
+ * @brief Rounds a size up to a multiple of a power of two.
+ * @param size[in]     The size to round.
+ * @param multiple[in] The power of two.
+ * @return The rounded size.
+ */
+static inline size_t ARENA_internal_roundUp(size_t size, size_t multiple);
+
+/**
+ * @brief Internal function to check for null pointers and exit on failure.
+ * @param arena_p[in] Pointer to the Arena.
+ * @param message[in] The error message to print on failure.
+ */
+static void ARENA_internal_nullCheck(const Arena *const arena_p, const char *restrict message);
+
+/* > Global Function Definitions *********************************************/
+
+Arena *ARENA_createArena(size_t capacity, bool useHugePages) {
+    const size_t pageSize = useHugePages ? ARENA_HUGE_PAGE_SIZE : 4096U;
+    const size_t mappingSize = ARENA_internal_roundUp(sizeof(Arena) + capacity, pageSize);
+    const int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+
+    void *mapping_p = MAP_FAILED;
+    bool usesHugePages = false;
+    if (useHugePages) {
+        // Reserved up front, so a short hugepage pool fails here instead of
+        // faulting on first touch.
+        mapping_p = mmap(NULL, mappingSize, PROT_READ | PROT_WRITE, flags | MAP_HUGETLB, -1, 0);
+        usesHugePages = mapping_p != MAP_FAILED;
+    }
+    if (mapping_p == MAP_FAILED) {
+        mapping_p = mmap(NULL, mappingSize, PROT_READ | PROT_WRITE, flags | MAP_NORESERVE, -1, 0);
+        if (mapping_p == MAP_FAILED) {
+            fprintf(stderr, "FATAL ERROR: Could not reserve %zu bytes for an Arena!\n",
+                    mappingSize);
+            exit(EXIT_FAILURE);
+        }
+        // No explicit hugepages reserved, ask for transparent ones instead.
+        usesHugePages = useHugePages && madvise(mapping_p, mappingSize, MADV_HUGEPAGE) == 0;
+    }
+
+    Arena *arena_p = mapping_p;
+    arena_p->mappingSize = mappingSize;
+    arena_p->capacity = mappingSize - sizeof(Arena);
+    arena_p->usedBytes = 0;
+    arena_p->usesHugePages = usesHugePages;
+    return arena_p;
+}
+
+void ARENA_destroyArena(Arena **const arena_pp) {
+    if (arena_pp != NULL && *arena_pp != NULL) {
+        munmap(*arena_pp, (*arena_pp)->mappingSize);
+        *arena_pp = NULL;
+    }
+}
+
+void *ARENA_allocate(Arena *const arena_p, size_t size) {
+    ARENA_internal_nullCheck(arena_p, "FATAL ERROR: Arena is uninitialized!\n");
+    const size_t blockSize = ARENA_internal_roundUp(size, ARENA_CACHE_LINE_SIZE);
+    if (blockSize < size || blockSize > arena_p->capacity - arena_p->usedBytes) {
+        fprintf(stderr, "FATAL ERROR: Arena of %zu bytes can not hand out %zu more bytes!\n",
+                arena_p->capacity, size);
+        exit(EXIT_FAILURE);
+    }
+    void *block_p = arena_p->blocks + arena_p->usedBytes;
+    arena_p->usedBytes += blockSize;
+    return block_p;
+}
+
+size_t ARENA_getUsedBytes(const Arena *const arena_p) {
+    ARENA_internal_nullCheck(arena_p, "FATAL ERROR: Arena is uninitialized!\n");
+    return arena_p->usedBytes;
+}
+
+size_t ARENA_getCapacity(const Arena *const arena_p) {
+    ARENA_internal_nullCheck(arena_p, "FATAL ERROR: Arena is uninitialized!\n");
+    return arena_p->capacity;
+}
+
+bool ARENA_usesHugePages(const Arena *const arena_p) {
+    ARENA_internal_nullCheck(arena_p, "FATAL ERROR: Arena is uninitialized!\n");
+    return arena_p->usesHugePages;
+}
+
+void ARENA_rewind(Arena *const arena_p, size_t mark) {
+    ARENA_internal_nullCheck(arena_p, "FATAL ERROR: Arena is uninitialized!\n");
+    if (mark > arena_p->usedBytes) {
+        fprintf(stderr, "FATAL ERROR: Arena can not be rewound forward to %zu bytes!\n", mark);
+        exit(EXIT_FAILURE);
+    }
+    arena_p->usedBytes = mark;
+}
+
+void ARENA_reset(Arena *const arena_p) {
+    ARENA_rewind(arena_p, 0);
+}
+
+/* > Local Function Definitions **********************************************/
+
+static inline size_t ARENA_internal_roundUp(size_t size, size_t multiple) {
+    return (size + multiple - 1) & ~(multiple - 1);
+}
+
+static void ARENA_internal_nullCheck(const Arena *const arena_p, const char *restrict message) {
+    if (arena_p == NULL) {
+        fprintf(stderr, "%s", message);
+        exit(EXIT_FAILURE);
+    }
+}
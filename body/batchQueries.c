@@ -0,0 +1,198 @@
+/* > Description ****************************************************************/
+/**
+ * @file batchQueries.c
+ * @brief This is the file for the batch mode, it reads the query stream line
+ *        by line and runs every search on one shared DFS_SearchContext, into
+ *        one answer path that only grows for longer queries. A PathCache keeps
+ *        the longest path of the matrix, so most queries need no full search.
+ *        The fingerprint of the matrix is computed once and then updated with
+ *        every edit.
+ */
+
+/* > Includes ****************************************************************/
+#define _GNU_SOURCE // getline
+#define MATRIXWORLD_UNCHECKED_API
+#define PATH_UNCHECKED_API
+#include "batchQueries.h"
+#include "dfsPathFinding.h"
+#include "matrixWorld.h"
+#include "path.h"
+#include "pathCache.h"
+#include "pathOutput.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/* > Defines *****************************************************************/
+
+/* > Type Declarations *******************************************************/
+
+/* > Global Constant Definitions *********************************************/
+
+/* > Global Variable Definitions *********************************************/
+
+/* > Local Constant Definitions **********************************************/
+
+/* > Local Variable Definitions **********************************************/
+
+/* > Local Function Declarations *********************************************/
+
+/**
+ * @brief Executes a single query line.
+ * @param matrix_p[in,out]  Pointer to the WorldMatrix.
+ * @param context_p[in,out] The search context bound to the matrix.
+ * @param cache_p[in,out]   The path cache of the matrix.
+ * @param fingerprint_p[in,out] The fingerprint of the matrix, updated by the edits.
+ * @param answer_pp[in,out] The reused answer path, NULL before the first search.
+ * @param line[in]          The query line, without its newline.
+ * @param writer_p[out]     The writer of the answers.
+ * @return false if the line is not a valid query.
+ */
+static bool BATCH_internal_runQuery(WorldMatrix *const matrix_p,
+                                    DFS_SearchContext *const context_p, PathCache *const cache_p,
+                                    uint64_t *const fingerprint_p, Path **const answer_pp,
+                                    const char *line, OutputWriter *const writer_p);
+
+/**
+ * @brief Writes the answer of a find query.
+ * @param writer_p[out]  The writer of the answers.
+ * @param pathLength[in] The requested length.
+ * @param path_p[in]     The found path, or NULL.
+ */
+static void BATCH_internal_writeAnswer(OutputWriter *const writer_p, uint32_t pathLength,
+                                       const Path *const path_p);
+
+/* > Global Function Definitions *********************************************/
+
+uint32_t BATCH_runQueries(WorldMatrix *const matrix_p, const DFS_SearchOptions *const options_p,
+                          FILE *input_p, FILE *output_p) {
+    if (matrix_p == NULL || input_p == NULL || output_p == NULL) {
+        fprintf(stderr, "FATAL ERROR: BATCH_runQueries needs a matrix, an input and an "
+                        "output stream!\n");
+        exit(EXIT_FAILURE);
+    }
+    // The threads are started once and parked between the searches.
+    DFS_SearchContext *context_p = DFS_createSearchContext(matrix_p, options_p);
+    PathCache *cache_p = PATHCACHE_createCache();
+    uint64_t fingerprint = MATRIXWORLD_getFingerprint(matrix_p);
+    Path *answer_p = NULL;
+    OutputWriter *writer_p = malloc(sizeof(OutputWriter));
+    if (writer_p == NULL) {
+        fprintf(stderr, "FATAL ERROR: Could not allocate memory for the OutputWriter!\n");
+        exit(EXIT_FAILURE);
+    }
+    OUTPUT_initWriter(writer_p, output_p);
+    // A typed query is answered at once, a file or a pipe in full buffers.
+    const bool isInteractive = isatty(fileno(input_p)) != 0;
+
+    uint32_t noOfRejectedLines = 0;
+    uint32_t lineNumber = 0;
+    char *line_p = NULL;
+    size_t lineCapacity = 0;
+    ssize_t lineLength;
+    while ((lineLength = getline(&line_p, &lineCapacity, input_p)) != -1) {
+        lineNumber++;
+        while (lineLength > 0 && (line_p[lineLength - 1] == '\n' || line_p[lineLength - 1] == '\r')) {
+            line_p[--lineLength] = '\0';
+        }
+        const char *query_p = line_p + strspn(line_p, " \t");
+        if (*query_p == '\0' || *query_p == '#') {
+            continue;
+        }
+        if (!BATCH_internal_runQuery(matrix_p, context_p, cache_p, &fingerprint, &answer_p, query_p,
+                                     writer_p)) {
+            OUTPUT_logDiagnostic("Error: Rejected query on line %u: %s\n", lineNumber, query_p);
+            noOfRejectedLines++;
+        }
+        if (isInteractive && !OUTPUT_flushWriter(writer_p)) {
+            fprintf(stderr, "Error: Could not write the answers of the batch!\n");
+        }
+    }
+    free(line_p);
+    PATH_freePath(&answer_p);
+    PATHCACHE_destroyCache(&cache_p);
+    DFS_destroySearchContext(&context_p);
+    if (!OUTPUT_flushWriter(writer_p)) {
+        fprintf(stderr, "Error: Could not write the answers of the batch!\n");
+    }
+    free(writer_p);
+    return noOfRejectedLines;
+}
+
+/* > Local Function Definitions **********************************************/
+
+static bool BATCH_internal_runQuery(WorldMatrix *const matrix_p,
+                                    DFS_SearchContext *const context_p, PathCache *const cache_p,
+                                    uint64_t *const fingerprint_p, Path **const answer_pp,
+                                    const char *line, OutputWriter *const writer_p) {
+    char command[16];
+    int noOfConsumed = 0;
+    if (sscanf(line, "%15s%n", command, &noOfConsumed) != 1) {
+        return false;
+    }
+    const char *arguments_p = line + noOfConsumed;
+    char trailing;
+    if (strchr(arguments_p, '-') != NULL) {
+        return false; // sscanf would wrap negative numbers around
+    }
+
+    if (strcmp(command, "find") == 0) {
+        uint32_t pathLength;
+        if (sscanf(arguments_p, "%u %c", &pathLength, &trailing) != 1 || pathLength == 0) {
+            return false;
+        }
+        if (pathLength > MATRIXWORLD_unchecked_getNoOfUnblockedCells(matrix_p)) {
+            BATCH_internal_writeAnswer(writer_p, pathLength, NULL);
+            return true;
+        }
+        if (*answer_pp == NULL || (*answer_pp)->pathSize < pathLength) {
+            PATH_freePath(answer_pp);
+            *answer_pp = PATH_initializePath(pathLength, matrix_p);
+        }
+        DFS_SearchStatus status = PATHCACHE_searchBounded(cache_p, context_p, matrix_p,
+                                                          *fingerprint_p, pathLength, *answer_pp);
+        if (status == DFS_STATUS_TIMED_OUT || status == DFS_STATUS_BUDGET_EXHAUSTED) {
+            // An unanswered query, a longer limit may still find the path.
+            OUTPUT_writeString(writer_p, "timeout ");
+            OUTPUT_writeUint(writer_p, pathLength);
+            OUTPUT_writeChar(writer_p, '\n');
+            return true;
+        }
+        BATCH_internal_writeAnswer(writer_p, pathLength,
+                                   (status == DFS_STATUS_FOUND) ? *answer_pp : NULL);
+        return true;
+    }
+
+    bool isBlocking = strcmp(command, "block") == 0;
+    if (!isBlocking && strcmp(command, "unblock") != 0) {
+        return false;
+    }
+    uint16_t row;
+    uint16_t col;
+    if (sscanf(arguments_p, "%hu %hu %c", &row, &col, &trailing) != 2 ||
+        row >= MATRIXWORLD_getRowSize(matrix_p) || col >= MATRIXWORLD_getColSize(matrix_p)) {
+        return false;
+    }
+    // Repeated edits are no-ops, the matrix is only touched on a change.
+    if (MATRIXWORLD_isBlocked(matrix_p, row, col) != isBlocking) {
+        MATRIXWORLD_setCell(matrix_p, row, col, isBlocking);
+        *fingerprint_p = PATHCACHE_noteCellChange(cache_p, matrix_p, *fingerprint_p, row, col);
+    }
+    return true;
+}
+
+static void BATCH_internal_writeAnswer(OutputWriter *const writer_p, uint32_t pathLength,
+                                       const Path *const path_p) {
+    OUTPUT_writeString(writer_p, (path_p == NULL) ? "none " : "path ");
+    OUTPUT_writeUint(writer_p, pathLength);
+    if (path_p != NULL) {
+        for (size_t index = 0; index < PATH_unchecked_getLength(path_p); index++) {
+            OUTPUT_writeChar(writer_p, ' ');
+            OUTPUT_writeUint(writer_p, path_p->pathArray[index].row);
+            OUTPUT_writeChar(writer_p, ',');
+            OUTPUT_writeUint(writer_p, path_p->pathArray[index].col);
+        }
+    }
+    OUTPUT_writeChar(writer_p, '\n');
+}
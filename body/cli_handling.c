@@ -34,6 +34,51 @@ static bool CLI_HANDLING_internal_parseUint16Arg(const char *str, uint16_t *valu
  */
 static bool CLI_HANDLING_internal_parseUint32Arg(const char *str, uint32_t *value);
 
+/**
+ * @brief Parses a string into a 64-bit unsigned integer.
+ *
+ * @param str[in]   The string to parse.
+ * @param value[out] Pointer to store the parsed value.
+ * @return           True on success, false on failure.
+ */
+static bool CLI_HANDLING_internal_parseUint64Arg(const char *str, uint64_t *value);
+
+/**
+ * @brief Parses the name of a neighbor ordering strategy.
+ *
+ * @param str[in]      The string to parse (random, fixed or warnsdorff).
+ * @param ordering[out] Pointer to store the parsed strategy.
+ * @return              True on success, false on failure.
+ */
+static bool CLI_HANDLING_internal_parseOrderingArg(const char *str, DFS_Ordering *ordering);
+
+/**
+ * @brief Parses the name of a search engine.
+ *
+ * @param str[in]     The string to parse (iterative, recursive or bidirectional).
+ * @param engine[out] Pointer to store the parsed engine.
+ * @return            True on success, false on failure.
+ */
+static bool CLI_HANDLING_internal_parseEngineArg(const char *str, DFS_Engine *engine);
+
+/**
+ * @brief Parses the name of a grid file encoding.
+ *
+ * @param str[in]       The string to parse (bitmap, rle or auto).
+ * @param encoding[out] Pointer to store the parsed encoding.
+ * @return              True on success, false on failure.
+ */
+static bool CLI_HANDLING_internal_parseEncodingArg(const char *str, LOADER_GridEncoding *encoding);
+
+/**
+ * @brief Parses the name of a path output format.
+ *
+ * @param str[in]     The string to parse (text or binary).
+ * @param format[out] Pointer to store the parsed format.
+ * @return            True on success, false on failure.
+ */
+static bool CLI_HANDLING_internal_parseFormatArg(const char *str, OUTPUT_Format *format);
+
 /**
  * @brief Adds a new coordinate to the blockedCells array in the Parameters struct.
  *
@@ -44,21 +89,13 @@ static bool CLI_HANDLING_internal_parseUint32Arg(const char *str, uint32_t *valu
  */
 static bool CLI_HANDLING_internal_addBlockedCell(Parameters *params, uint16_t row, uint16_t col);
 
-/**
- * @brief Parses a file containing blocked cell coordinates and adds them to the Parameters.
- *
- * @param filePath[in]   Path to the file to parse.
- * @param params[in,out] The Parameters struct to populate.
- * @return               True on success, false on failure.
- */
-static bool CLI_HANDLING_internal_parseBlockedCellsFile(const char *filePath, Parameters *params);
-
 /* > Public Function Definitions ******************************************************************/
 
 void CLI_printHelp(void) {
   printf("(pathFinder - Adaptive Path Finding in NxM Matrix\n\n"
          "USAGE:\n"
-         "    pathFinder --rows R --cols C --pathLength N [OPTIONS]\n\n"
+         "    pathFinder --rows R --cols C --pathLength N [OPTIONS]\n"
+         "    pathFinder --gridFile FILE --pathLength N [OPTIONS]\n\n"
          "REQUIRED:\n"
          "    --rows R                Number of matrix rows (e.g., --rows 5)\n"
          "    --cols C                Number of matrix columns (e.g., --cols 5)\n"
@@ -66,12 +103,45 @@ void CLI_printHelp(void) {
          "OPTIONAL:\n"
          "    --blockedCells COORDS   Blocked cell coordinates (e.g., --blockedCells {1,0} {2,1})\n"
          "    --blockedCellsFile FILE Path to file containing blocked cell coordinates\n"
+         "    --gridFile FILE         Binary grid file, replaces --rows and --cols\n"
+         "    --saveGridFile FILE     Write the final matrix as a binary grid file, without\n"
+         "                            --pathLength the program stops after writing it\n"
+         "    --gridEncoding NAME     Encoding of --saveGridFile: bitmap, rle or auto (default)\n"
+         "    --batch FILE            Run the queries of FILE (- for stdin) on the loaded matrix\n"
+         "                            instead of a single --pathLength search\n"
          "    --multithreading        Flag enabling the execution of the program on parallel threads\n"
+         "    --threads N             Number of worker threads, 0 detects the available CPUs\n"
+         "                            (implies --multithreading, default 0)\n"
+         "    --pinThreads            Pin every worker thread to its own CPU\n"
+         "    --hugePages             Back the search buffers with hugepages when available\n"
+         "    --seed S                Seed of the random search (default 42)\n"
+         "    --ordering NAME         Neighbor ordering: random (default), fixed or warnsdorff\n"
+         "    --engine NAME           Search engine: iterative (default), recursive or\n"
+         "                            bidirectional (grows the path at both ends)\n"
+         "    --output FILE           Write only the found path to FILE (- for stdout)\n"
+         "    --format NAME           Format of --output: text (default, row,col per line) or\n"
+         "                            binary (start cell and 2-bit steps), implies --output -\n"
+         "    --quiet                 Silence the banners and the ABNORMAL diagnostics\n"
+         "    --stats                 Print the per-thread statistics of the search on stderr\n"
+         "    --timeout MS            Stop the search after MS milliseconds, 0 for no limit\n"
+         "    --nodeBudget N          Stop the search after N expanded cells, 0 for no limit\n"
+         "                            (a stopped search prints its longest partial path)\n"
+         "    --complete              Search the whole tree of every start, slower but finds\n"
+         "                            any path starting at a tried cell\n"
+         "    --portfolio             Give the worker threads different orderings and restart\n"
+         "                            schedules (implies --multithreading)\n"
+         "    --tiles N               Split the world into NxN tiles searched by one worker\n"
+         "                            process each and join their segments (1 to 32), the\n"
+         "                            whole world is searched when they can not be joined\n"
          "    --help, -h              Show this help message\n\n"
          "EXAMPLES:\n"
          "    pathFinder --rows 5 --cols 5 --pathLength 6\n"
          "    pathFinder --rows 8 --cols 8 --pathLength 12 --blockedCells {1,0} {2,0} {1,1}\n"
-         "    pathFinder --rows 100 --cols 100 --pathLength 50 --blockedCellsFile blocked_cells.txt\n\n"
+         "    pathFinder --rows 100 --cols 100 --pathLength 50 --blockedCellsFile blocked_cells.txt\n"
+         "    pathFinder --rows 100 --cols 100 --blockedCellsFile blocked_cells.txt --saveGridFile blocked_cells.grid\n"
+         "    pathFinder --gridFile blocked_cells.grid --pathLength 50\n"
+         "    pathFinder --gridFile blocked_cells.grid --batch queries.txt --threads 4\n"
+         "    pathFinder --rows 1000 --cols 1000 --pathLength 50000 --output path.bin --format binary\n\n"
          "BLOCKED CELLS FILE FORMAT:\n"
          "    Each line should contain: row,col\n"
          "    Lines starting with # are treated as comments\n"
@@ -80,6 +150,12 @@ void CLI_printHelp(void) {
          "        0,1\n"
          "        1,0\n"
          "        2,2\n\n"
+         "BATCH QUERIES:\n"
+         "    One query per line, lines starting with # are treated as comments\n"
+         "        find N          Search a path of N cells, answered by one line:\n"
+         "                        path N r,c r,c ..., none N or timeout N\n"
+         "        block R C       Block a cell for the following searches\n"
+         "        unblock R C     Unblock a cell for the following searches\n\n"
          "NOTES:\n"
          "    - Matrix cells are 0-indexed\n"
          "    - Path finds contiguous route through unblocked cells (value 0)\n"
@@ -101,10 +177,31 @@ Parameters *CLI_parseCliCommands(int argc, char *argv[]) {
                            .pathLength = 0,
                            .blockedCells = NULL,
                            .blockedCellsCount = 0,
+                           .blockedCellsCapacity = 0,
                            .blockedCellsFile = NULL,
-                           .isMultithreading = false
+                           .gridFile = NULL,
+                           .saveGridFile = NULL,
+                           .gridEncoding = LOADER_ENCODING_AUTO,
+                           .batchFile = NULL,
+                           .outputFile = NULL,
+                           .outputFormat = OUTPUT_FORMAT_TEXT,
+                           .isQuiet = false,
+                           .printStats = false,
+                           .timeoutMs = 0,
+                           .nodeBudget = 0,
+                           .isComplete = false,
+                           .usePortfolio = false,
+                           .noOfTiles = 0,
+                           .isMultithreading = false,
+                           .noOfThreads = 0,
+                           .pinThreads = false,
+                           .useHugePages = false,
+                           .seed = RANDOM_GEN_SEED,
+                           .ordering = DFS_ORDERING_RANDOM,
+                           .engine = DFS_ENGINE_ITERATIVE
                           };
 
+    bool hasFormat = false;
     for (int i = 1; i < argc; ++i) {
         const char *arg = argv[i];
 
@@ -134,8 +231,93 @@ Parameters *CLI_parseCliCommands(int argc, char *argv[]) {
             goto error_exit;
           }
           params->blockedCellsFile = argv[i];
+        } else if (strcmp(arg, "--gridFile") == 0) {
+          if (++i >= argc) {
+            fprintf(stderr, "Error: Missing file path for --gridFile\n");
+            goto error_exit;
+          }
+          params->gridFile = argv[i];
+        } else if (strcmp(arg, "--saveGridFile") == 0) {
+          if (++i >= argc) {
+            fprintf(stderr, "Error: Missing file path for --saveGridFile\n");
+            goto error_exit;
+          }
+          params->saveGridFile = argv[i];
+        } else if (strcmp(arg, "--gridEncoding") == 0) {
+          if (++i >= argc || !CLI_HANDLING_internal_parseEncodingArg(argv[i], &params->gridEncoding)) {
+            fprintf(stderr, "Error: Invalid or missing argument for --gridEncoding\n");
+            goto error_exit;
+          }
+        } else if (strcmp(arg, "--batch") == 0) {
+          if (++i >= argc) {
+            fprintf(stderr, "Error: Missing file path for --batch\n");
+            goto error_exit;
+          }
+          params->batchFile = argv[i];
         } else if (strcmp(arg, "--multithreading") == 0) {
           params->isMultithreading = true;
+        } else if (strcmp(arg, "--threads") == 0) {
+          if (++i >= argc || !CLI_HANDLING_internal_parseUint16Arg(argv[i], &params->noOfThreads)) {
+            fprintf(stderr, "Error: Invalid or missing argument for --threads\n");
+            goto error_exit;
+          }
+          params->isMultithreading = true;
+        } else if (strcmp(arg, "--seed") == 0) {
+          if (++i >= argc || !CLI_HANDLING_internal_parseUint64Arg(argv[i], &params->seed)) {
+            fprintf(stderr, "Error: Invalid or missing argument for --seed\n");
+            goto error_exit;
+          }
+        } else if (strcmp(arg, "--pinThreads") == 0) {
+          params->pinThreads = true;
+        } else if (strcmp(arg, "--hugePages") == 0) {
+          params->useHugePages = true;
+        } else if (strcmp(arg, "--ordering") == 0) {
+          if (++i >= argc || !CLI_HANDLING_internal_parseOrderingArg(argv[i], &params->ordering)) {
+            fprintf(stderr, "Error: Invalid or missing argument for --ordering\n");
+            goto error_exit;
+          }
+        } else if (strcmp(arg, "--engine") == 0) {
+          if (++i >= argc || !CLI_HANDLING_internal_parseEngineArg(argv[i], &params->engine)) {
+            fprintf(stderr, "Error: Invalid or missing argument for --engine\n");
+            goto error_exit;
+          }
+        } else if (strcmp(arg, "--output") == 0) {
+          if (++i >= argc) {
+            fprintf(stderr, "Error: Missing file path for --output\n");
+            goto error_exit;
+          }
+          params->outputFile = argv[i];
+        } else if (strcmp(arg, "--format") == 0) {
+          if (++i >= argc || !CLI_HANDLING_internal_parseFormatArg(argv[i], &params->outputFormat)) {
+            fprintf(stderr, "Error: Invalid or missing argument for --format\n");
+            goto error_exit;
+          }
+          hasFormat = true;
+        } else if (strcmp(arg, "--quiet") == 0) {
+          params->isQuiet = true;
+        } else if (strcmp(arg, "--stats") == 0) {
+          params->printStats = true;
+        } else if (strcmp(arg, "--complete") == 0) {
+          params->isComplete = true;
+        } else if (strcmp(arg, "--portfolio") == 0) {
+          params->usePortfolio = true;
+          params->isMultithreading = true;
+        } else if (strcmp(arg, "--tiles") == 0) {
+          if (++i >= argc || !CLI_HANDLING_internal_parseUint16Arg(argv[i], &params->noOfTiles) ||
+              params->noOfTiles == 0 || params->noOfTiles > 32) {
+            fprintf(stderr, "Error: Invalid or missing argument for --tiles\n");
+            goto error_exit;
+          }
+        } else if (strcmp(arg, "--timeout") == 0) {
+          if (++i >= argc || !CLI_HANDLING_internal_parseUint32Arg(argv[i], &params->timeoutMs)) {
+            fprintf(stderr, "Error: Invalid or missing argument for --timeout\n");
+            goto error_exit;
+          }
+        } else if (strcmp(arg, "--nodeBudget") == 0) {
+          if (++i >= argc || !CLI_HANDLING_internal_parseUint64Arg(argv[i], &params->nodeBudget)) {
+            fprintf(stderr, "Error: Invalid or missing argument for --nodeBudget\n");
+            goto error_exit;
+          }
         } else if (strcmp(arg, "--blockedCells") == 0) {
           while (i + 1 < argc && argv[i + 1][0] == '{') {
             i++;
@@ -155,15 +337,25 @@ Parameters *CLI_parseCliCommands(int argc, char *argv[]) {
         }
     }
 
-    if (params->blockedCellsFile && !CLI_HANDLING_internal_parseBlockedCellsFile(params->blockedCellsFile, params)) {
+    // A grid file carries its size, a pure conversion or a batch needs no path length.
+    bool hasSize = (params->rows != 0 && params->cols != 0) || params->gridFile != NULL;
+    bool hasTask = params->pathLength != 0 || params->saveGridFile != NULL ||
+                   params->batchFile != NULL;
+    if (!hasSize || !hasTask) {
+        fprintf(stderr, "Error: Missing required arguments. --rows, --cols, and --pathLength must be provided.\n");
         goto error_exit;
     }
 
-    if (params->rows == 0 || params->cols == 0 || params->pathLength == 0) {
-        fprintf(stderr, "Error: Missing required arguments. --rows, --cols, and --pathLength must be provided.\n");
+    // The worker processes of a tiled search run without limits.
+    if (params->noOfTiles > 0 && (params->timeoutMs != 0 || params->nodeBudget != 0)) {
+        fprintf(stderr, "Error: --tiles can not be combined with --timeout or --nodeBudget.\n");
         goto error_exit;
     }
 
+    if (hasFormat && params->outputFile == NULL) {
+        params->outputFile = "-";
+    }
+
     return params;
 
 error_exit:
@@ -202,42 +394,84 @@ static bool CLI_HANDLING_internal_parseUint32Arg(const char *str, uint32_t *valu
     return true;
 }
 
-static bool CLI_HANDLING_internal_addBlockedCell(Parameters *params, uint16_t row, uint16_t col) {
-    uint32_t count = params->blockedCellsCount;
-    Cords *new_cells = realloc(params->blockedCells, (count + 1) * sizeof(Cords));
-    if (!new_cells) {
-        perror("Failed to allocate memory for blocked cells");
+static bool CLI_HANDLING_internal_parseUint64Arg(const char *str, uint64_t *value) {
+    char *end;
+    errno = 0;
+    if (str[0] == '-') {
+        return false;
+    }
+    unsigned long long val = strtoull(str, &end, 10);
+    if (errno || end == str || *end != '\0') {
+        return false;
+    }
+    *value = (uint64_t)val;
+    return true;
+}
+
+static bool CLI_HANDLING_internal_parseOrderingArg(const char *str, DFS_Ordering *ordering) {
+    if (strcmp(str, "random") == 0) {
+        *ordering = DFS_ORDERING_RANDOM;
+    } else if (strcmp(str, "fixed") == 0) {
+        *ordering = DFS_ORDERING_FIXED;
+    } else if (strcmp(str, "warnsdorff") == 0) {
+        *ordering = DFS_ORDERING_WARNSDORFF;
+    } else {
         return false;
     }
-    params->blockedCells = new_cells;
-    params->blockedCells[count] = (Cords){.row = row, .col = col};
-    params->blockedCellsCount++;
     return true;
 }
 
-static bool CLI_HANDLING_internal_parseBlockedCellsFile(const char *filePath, Parameters *params) {
-    FILE *file = fopen(filePath, "r");
-    if (!file) {
-        perror("Error opening blocked cells file");
+static bool CLI_HANDLING_internal_parseEngineArg(const char *str, DFS_Engine *engine) {
+    if (strcmp(str, "iterative") == 0) {
+        *engine = DFS_ENGINE_ITERATIVE;
+    } else if (strcmp(str, "recursive") == 0) {
+        *engine = DFS_ENGINE_RECURSIVE;
+    } else if (strcmp(str, "bidirectional") == 0) {
+        *engine = DFS_ENGINE_BIDIRECTIONAL;
+    } else {
         return false;
     }
+    return true;
+}
 
-    char line[256];
-    while (fgets(line, sizeof(line), file)) {
-        if (line[0] == '#' || line[0] == '\n' || line[0] == '\r') {
-            continue;
-        }
-        uint16_t row, col;
-        if (sscanf(line, "%hu,%hu", &row, &col) != 2) {
-            fprintf(stderr, "Warning: Skipping malformed line in %s: %s", filePath, line);
-            continue;
-        }
-        if (!CLI_HANDLING_internal_addBlockedCell(params, row, col)) {
-            fclose(file);
+static bool CLI_HANDLING_internal_parseEncodingArg(const char *str, LOADER_GridEncoding *encoding) {
+    if (strcmp(str, "bitmap") == 0) {
+        *encoding = LOADER_ENCODING_BITMAP;
+    } else if (strcmp(str, "rle") == 0) {
+        *encoding = LOADER_ENCODING_RLE;
+    } else if (strcmp(str, "auto") == 0) {
+        *encoding = LOADER_ENCODING_AUTO;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+static bool CLI_HANDLING_internal_parseFormatArg(const char *str, OUTPUT_Format *format) {
+    if (strcmp(str, "text") == 0) {
+        *format = OUTPUT_FORMAT_TEXT;
+    } else if (strcmp(str, "binary") == 0) {
+        *format = OUTPUT_FORMAT_BINARY;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+static bool CLI_HANDLING_internal_addBlockedCell(Parameters *params, uint16_t row, uint16_t col) {
+    uint32_t count = params->blockedCellsCount;
+    if (count == params->blockedCellsCapacity) {
+        // Grow geometrically, so adding n cells copies O(n) elements in total.
+        uint32_t newCapacity = (params->blockedCellsCapacity == 0) ? 16 : params->blockedCellsCapacity * 2;
+        Cords *new_cells = realloc(params->blockedCells, newCapacity * sizeof(Cords));
+        if (!new_cells) {
+            perror("Failed to allocate memory for blocked cells");
             return false;
         }
+        params->blockedCells = new_cells;
+        params->blockedCellsCapacity = newCapacity;
     }
-
-    fclose(file);
+    params->blockedCells[count] = (Cords){.row = row, .col = col};
+    params->blockedCellsCount++;
     return true;
-}
\ No newline at end of file
+}
@@ -0,0 +1,240 @@
+/* > Description ****************************************************************/
+/**
+ * @file compactPath.c
+ * @brief This is the file for the compact storage of a path. The steps are
+ *        packed 32 to a word, the first one in the lowest bits, and followed
+ *        by one checkpoint cell every COMPACTPATH_CHECKPOINT_INTERVAL steps in
+ *        the same allocation.
+ */
+
+/* > Includes ****************************************************************/
+#define PATH_UNCHECKED_API
+#include "compactPath.h"
+#include "path.h"
+#include "utilities.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+/* > Defines *****************************************************************/
+#define COMPACTPATH_STEPS_PER_WORD 32U
+#define COMPACTPATH_STEP_BITS 2U
+#define COMPACTPATH_STEP_MASK UINT64_C(0x3)
+#define COMPACTPATH_LOW_STEP_BITS UINT64_C(0x5555555555555555)
+
+/* > Type Declarations *******************************************************/
+
+/**
+ * @brief Defines the internal structure of the CompactPath.
+ */
+struct CompactPath {
+  size_t noOfCells;       ///< The number of cells of the path.
+  size_t noOfWords;       ///< The number of step words.
+  size_t noOfCheckpoints; ///< The number of checkpoint cells behind the steps.
+  uint64_t steps[];       ///< The steps, followed by the checkpoint cells.
+};
+
+/* > Global Constant Definitions *********************************************/
+
+/* > Global Variable Definitions *********************************************/
+
+/* > Local Constant Definitions **********************************************/
+
+/* > Local Variable Definitions **********************************************/
+
+/* > Local Function Declarations *********************************************/
+
+/**
+ * @brief Internal function to check for a null compact path and exit on failure.
+ * @param compact_p[in] Pointer to the CompactPath.
+ * @param message[in]   The error message to print on failure.
+ */
+static void COMPACTPATH_internal_nullCheck(const CompactPath *const compact_p,
+                                           const char *restrict message);
+
+/**
+ * @brief Gets the checkpoint cells stored behind the steps.
+ * @param compact_p[in] Pointer to the CompactPath.
+ * @return The first checkpoint cell, the one of the first cell of the path.
+ */
+static inline const Cords *COMPACTPATH_internal_getCheckpoints(const CompactPath *const compact_p);
+
+/**
+ * @brief Gets the index into directions[] of the step between two cells.
+ * @param from[in]         The previous cell.
+ * @param to[in]           The next cell.
+ * @param direction_p[out] The index of the step.
+ * @return false if the cells are not neighbors.
+ */
+static bool COMPACTPATH_internal_getStepDirection(Cords from, Cords to, uint8_t *direction_p);
+
+/**
+ * @brief Gets the index into directions[] of a stored step.
+ * @param compact_p[in] Pointer to the CompactPath.
+ * @param step[in]      The index of the step, the one leaving cell `step`.
+ * @return The index into directions[].
+ */
+static inline uint8_t COMPACTPATH_internal_getStep(const CompactPath *const compact_p, size_t step);
+
+/* > Global Function Definitions *********************************************/
+
+CompactPath *COMPACTPATH_encodePath(const Path *const path_p) {
+  if (path_p == NULL) {
+    fprintf(stderr, "FATAL ERROR: Path supplied to COMPACTPATH_encodePath is NULL!\n");
+    exit(EXIT_FAILURE);
+  }
+  const size_t noOfCells = PATH_unchecked_getLength(path_p);
+  const size_t noOfSteps = (noOfCells == 0) ? 0 : noOfCells - 1;
+  const size_t noOfWords = (noOfSteps + COMPACTPATH_STEPS_PER_WORD - 1) / COMPACTPATH_STEPS_PER_WORD;
+  const size_t noOfCheckpoints =
+      (noOfCells == 0) ? 0 : ((noOfCells - 1) / COMPACTPATH_CHECKPOINT_INTERVAL) + 1;
+  CompactPath *compact_p = calloc(1, sizeof(CompactPath) + (noOfWords * sizeof(uint64_t)) +
+                                         (noOfCheckpoints * sizeof(Cords)));
+  COMPACTPATH_internal_nullCheck(
+      compact_p, "FATAL ERROR: CompactPath structure could not be initialized. No memory!\n");
+  compact_p->noOfCells = noOfCells;
+  compact_p->noOfWords = noOfWords;
+  compact_p->noOfCheckpoints = noOfCheckpoints;
+
+  Cords *checkpoints_p = (Cords *)&compact_p->steps[noOfWords];
+  for (size_t index = 0; index < noOfCells; index++) {
+    if (index % COMPACTPATH_CHECKPOINT_INTERVAL == 0) {
+      checkpoints_p[index / COMPACTPATH_CHECKPOINT_INTERVAL] = path_p->pathArray[index];
+    }
+    if (index + 1 == noOfCells) {
+      break;
+    }
+    uint8_t direction;
+    if (!COMPACTPATH_internal_getStepDirection(path_p->pathArray[index],
+                                               path_p->pathArray[index + 1], &direction)) {
+      free(compact_p);
+      return NULL;
+    }
+    compact_p->steps[index / COMPACTPATH_STEPS_PER_WORD] |=
+        (uint64_t)direction << ((index % COMPACTPATH_STEPS_PER_WORD) * COMPACTPATH_STEP_BITS);
+  }
+  return compact_p;
+}
+
+void COMPACTPATH_freePath(CompactPath **const path_pp) {
+  if (path_pp == NULL) {
+    return;
+  }
+  free(*path_pp);
+  *path_pp = NULL;
+}
+
+bool COMPACTPATH_decodePath(const CompactPath *const compact_p, Path *const path_p) {
+  COMPACTPATH_internal_nullCheck(compact_p, "FATAL ERROR: CompactPath is not initialized!\n");
+  PATH_clearPath(path_p);
+  if (compact_p->noOfCells > path_p->pathSize) {
+    return false;
+  }
+  CompactPathIterator iterator;
+  COMPACTPATH_initIterator(&iterator, compact_p, 0);
+  Cords cell;
+  while (COMPACTPATH_nextCell(&iterator, &cell)) {
+    PATH_unchecked_addCoordinates(path_p, cell.row, cell.col);
+  }
+  return true;
+}
+
+size_t COMPACTPATH_getLength(const CompactPath *const compact_p) {
+  COMPACTPATH_internal_nullCheck(compact_p, "FATAL ERROR: CompactPath is not initialized!\n");
+  return compact_p->noOfCells;
+}
+
+Cords COMPACTPATH_getCell(const CompactPath *const compact_p, size_t index) {
+  COMPACTPATH_internal_nullCheck(compact_p, "FATAL ERROR: CompactPath is not initialized!\n");
+  if (index >= compact_p->noOfCells) {
+    return (Cords){.row = UINT16_MAX, .col = UINT16_MAX};
+  }
+  const Cords checkpoint =
+      COMPACTPATH_internal_getCheckpoints(compact_p)[index / COMPACTPATH_CHECKPOINT_INTERVAL];
+  int32_t row = checkpoint.row;
+  int32_t col = checkpoint.col;
+  // Every checkpoint starts a word, the steps in front of the cell are summed
+  // up a word at a time: the high bit of a step tells a vertical one, the low
+  // bit a negative one
+  size_t noOfSteps = index % COMPACTPATH_CHECKPOINT_INTERVAL;
+  size_t word = (index - noOfSteps) / COMPACTPATH_STEPS_PER_WORD;
+  while (noOfSteps > 0) {
+    uint64_t validSteps = COMPACTPATH_LOW_STEP_BITS;
+    if (noOfSteps < COMPACTPATH_STEPS_PER_WORD) {
+      validSteps &= (UINT64_C(1) << (noOfSteps * COMPACTPATH_STEP_BITS)) - 1;
+    }
+    const uint64_t bits = compact_p->steps[word++];
+    const uint64_t negative = bits & validSteps;
+    const uint64_t vertical = (bits >> 1) & validSteps;
+    const int32_t up = __builtin_popcountll(vertical & negative);
+    const int32_t down = __builtin_popcountll(vertical & ~negative);
+    const int32_t left = __builtin_popcountll(~vertical & negative);
+    const int32_t right = __builtin_popcountll(validSteps) - up - down - left;
+    row += down - up;
+    col += right - left;
+    noOfSteps -= (noOfSteps < COMPACTPATH_STEPS_PER_WORD) ? noOfSteps : COMPACTPATH_STEPS_PER_WORD;
+  }
+  return (Cords){.row = (uint16_t)row, .col = (uint16_t)col};
+}
+
+size_t COMPACTPATH_getByteSize(const CompactPath *const compact_p) {
+  COMPACTPATH_internal_nullCheck(compact_p, "FATAL ERROR: CompactPath is not initialized!\n");
+  return sizeof(CompactPath) + (compact_p->noOfWords * sizeof(uint64_t)) +
+         (compact_p->noOfCheckpoints * sizeof(Cords));
+}
+
+void COMPACTPATH_initIterator(CompactPathIterator *const iterator_p,
+                              const CompactPath *const compact_p, size_t startIndex) {
+  if (iterator_p == NULL) {
+    fprintf(stderr, "FATAL ERROR: COMPACTPATH_initIterator needs an iterator!\n");
+    exit(EXIT_FAILURE);
+  }
+  iterator_p->path_p = compact_p;
+  iterator_p->nextIndex = startIndex;
+  iterator_p->cell = COMPACTPATH_getCell(compact_p, startIndex);
+}
+
+bool COMPACTPATH_nextCell(CompactPathIterator *const iterator_p, Cords *const cell_p) {
+  const CompactPath *compact_p = iterator_p->path_p;
+  if (iterator_p->nextIndex >= compact_p->noOfCells) {
+    return false;
+  }
+  *cell_p = iterator_p->cell;
+  if (iterator_p->nextIndex + 1 < compact_p->noOfCells) {
+    const uint8_t direction = COMPACTPATH_internal_getStep(compact_p, iterator_p->nextIndex);
+    iterator_p->cell.row = (uint16_t)(iterator_p->cell.row + directions[direction].row);
+    iterator_p->cell.col = (uint16_t)(iterator_p->cell.col + directions[direction].col);
+  }
+  iterator_p->nextIndex++;
+  return true;
+}
+
+/* > Local Function Definitions **********************************************/
+
+static void COMPACTPATH_internal_nullCheck(const CompactPath *const compact_p,
+                                           const char *restrict message) {
+  if (compact_p == NULL) {
+    fprintf(stderr, "%s", message);
+    exit(EXIT_FAILURE);
+  }
+}
+
+static inline const Cords *COMPACTPATH_internal_getCheckpoints(const CompactPath *const compact_p) {
+  return (const Cords *)&compact_p->steps[compact_p->noOfWords];
+}
+
+static bool COMPACTPATH_internal_getStepDirection(Cords from, Cords to, uint8_t *direction_p) {
+  for (uint8_t direction = 0; direction < FOUR_DIRECTIONS; direction++) {
+    if ((int32_t)from.row + directions[direction].row == (int32_t)to.row &&
+        (int32_t)from.col + directions[direction].col == (int32_t)to.col) {
+      *direction_p = direction;
+      return true;
+    }
+  }
+  return false;
+}
+
+static inline uint8_t COMPACTPATH_internal_getStep(const CompactPath *const compact_p, size_t step) {
+  return (uint8_t)((compact_p->steps[step / COMPACTPATH_STEPS_PER_WORD] >>
+                    ((step % COMPACTPATH_STEPS_PER_WORD) * COMPACTPATH_STEP_BITS)) &
+                   COMPACTPATH_STEP_MASK);
+}
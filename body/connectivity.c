@@ -0,0 +1,334 @@
+/* > Description ****************************************************************/
+/**
+ * @file connectivity.c
+ * @brief This is the file for labelling the connected components of unblocked
+ *        cells of the worldMatrix. Labelling runs a union-find over horizontal
+ *        stripes in parallel and merges the stripes along their borders.
+ */
+
+/* > Includes ****************************************************************/
+#define MATRIXWORLD_UNCHECKED_API
+#include "connectivity.h"
+#include "matrixWorld.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* > Defines *****************************************************************/
+
+/* > Type Declarations *******************************************************/
+
+/**
+ * @brief Internal structure for the ComponentMap.
+ * @details After labelling, `labels` holds a dense component label per cell in
+ *          the row * cols + col mapping, and `componentSizes` the size of every
+ *          label.
+ */
+struct ComponentMap {
+    uint16_t rows;                 ///< Number of rows of the source matrix.
+    uint16_t cols;                 ///< Number of columns of the source matrix.
+    uint32_t noOfComponents;       ///< Number of components found.
+    uint32_t largestComponentSize; ///< Size of the largest component.
+    uint32_t *componentSizes;      ///< Size of every component, by label, sized
+                                   ///< for the most components the matrix holds.
+    uint32_t labels[];             ///< Flexible array member, one label per cell.
+};
+
+/*
+ * @brief Arguments passed to every stripe labelling thread.
+ */
+typedef struct {
+    ComponentMap *map_p;
+    const WorldMatrix *matrix_p;
+    uint16_t stripe;
+    uint16_t noOfStripes;
+} CONNECTIVITY_StripeArgs_t;
+
+/* > Global Constant Definitions *********************************************/
+
+/* > Global Variable Definitions *********************************************/
+
+/* > Local Constant Definitions **********************************************/
+
+/* > Local Variable Definitions **********************************************/
+
+/* > Local Function Declarations *********************************************/
+
+/**
+ * @brief Finds the root of a cell in the union-find forest, halving the path.
+ * @param parents_p[in,out] The parent array.
+ * @param index[in]         The one dimensional index of the cell.
+ * @return The index of the root.
+ */
+static uint32_t CONNECTIVITY_internal_find(uint32_t *parents_p, uint32_t index);
+
+/**
+ * @brief Joins the trees of two cells, the smaller root index becomes the root.
+ * @param parents_p[in,out] The parent array.
+ * @param aIndex[in]        The index of the first cell.
+ * @param bIndex[in]        The index of the second cell.
+ */
+static void CONNECTIVITY_internal_union(uint32_t *parents_p, uint32_t aIndex, uint32_t bIndex);
+
+/**
+ * @brief Labels the rows [firstRow, endRow) of the matrix.
+ * @param map_p[in,out] The map to label.
+ * @param matrix_p[in]  The source matrix.
+ * @param firstRow[in]  The first row of the stripe.
+ * @param endRow[in]    The row past the end of the stripe.
+ */
+static void CONNECTIVITY_internal_labelRows(ComponentMap *const map_p,
+                                            const WorldMatrix *const matrix_p,
+                                            uint16_t firstRow, uint16_t endRow);
+
+/**
+ * @brief Thread function labelling one stripe of the matrix.
+ * @param stripeArgs[in] A pointer to a CONNECTIVITY_StripeArgs_t.
+ * @return Always returns NULL.
+ */
+static void *CONNECTIVITY_internal_labelStripeThread(void *stripeArgs);
+
+/**
+ * @brief Gets the first row of a stripe.
+ * @param map_p[in]       The map.
+ * @param stripe[in]      The index of the stripe, noOfStripes for the end of the last one.
+ * @param noOfStripes[in] The number of stripes.
+ * @return The first row of the stripe.
+ */
+static inline uint16_t CONNECTIVITY_internal_stripeStart(const ComponentMap *const map_p,
+                                                         uint32_t stripe, uint16_t noOfStripes);
+
+/**
+ * @brief Internal function to check for null pointers and exit on failure.
+ * @param map_p[in]   Pointer to the ComponentMap.
+ * @param message[in] The error message to print on failure.
+ */
+static void CONNECTIVITY_internal_nullCheck(const ComponentMap *const map_p,
+                                            const char *restrict message);
+
+/* > Global Function Definitions *********************************************/
+
+ComponentMap *CONNECTIVITY_labelComponents(const WorldMatrix *const matrix_p,
+                                           uint16_t noOfThreads) {
+    ComponentMap *map_p = CONNECTIVITY_createComponentMap(matrix_p);
+
+    // 1. Union-find inside every stripe, each thread only links its own cells.
+    uint16_t noOfStripes = (noOfThreads == 0) ? 1 : noOfThreads;
+    if (noOfStripes > map_p->rows) {
+        noOfStripes = map_p->rows;
+    }
+    pthread_t *stripeThreads_p = malloc(sizeof(pthread_t) * noOfStripes);
+    CONNECTIVITY_StripeArgs_t *stripeArgs_p =
+        malloc(sizeof(CONNECTIVITY_StripeArgs_t) * noOfStripes);
+    if (stripeThreads_p == NULL || stripeArgs_p == NULL) {
+        fprintf(stderr, "FATAL ERROR: Could not allocate memory for labelling threads!\n");
+        exit(EXIT_FAILURE);
+    }
+    for (uint16_t stripe = 0; stripe < noOfStripes; stripe++) {
+        stripeArgs_p[stripe] = (CONNECTIVITY_StripeArgs_t){
+            .map_p = map_p, .matrix_p = matrix_p, .stripe = stripe, .noOfStripes = noOfStripes};
+    }
+    for (uint16_t stripe = 1; stripe < noOfStripes; stripe++) {
+        pthread_create(&stripeThreads_p[stripe], NULL, CONNECTIVITY_internal_labelStripeThread,
+                       &stripeArgs_p[stripe]);
+    }
+    UNUSED(CONNECTIVITY_internal_labelStripeThread(&stripeArgs_p[0]));
+    for (uint16_t stripe = 1; stripe < noOfStripes; stripe++) {
+        pthread_join(stripeThreads_p[stripe], NULL);
+    }
+    free(stripeThreads_p);
+    free(stripeArgs_p);
+
+    // 2. Merge the stripes and count the components.
+    CONNECTIVITY_finishLabelling(map_p, noOfStripes);
+    return map_p;
+}
+
+ComponentMap *CONNECTIVITY_createComponentMap(const WorldMatrix *const matrix_p) {
+    if (matrix_p == NULL) {
+        fprintf(stderr, "FATAL ERROR: WorldMatrix supplied to CONNECTIVITY_createComponentMap "
+                        "is NULL!\n");
+        exit(EXIT_FAILURE);
+    }
+    const uint16_t rows = MATRIXWORLD_unchecked_getRowSize(matrix_p);
+    const uint16_t cols = MATRIXWORLD_unchecked_getColSize(matrix_p);
+    const size_t noOfCells = (size_t)rows * cols;
+
+    ComponentMap *map_p = malloc(sizeof(ComponentMap) + sizeof(uint32_t) * noOfCells);
+    // A checkerboard holds the most 4-connected components, half of the cells.
+    uint32_t *componentSizes_p = malloc(sizeof(uint32_t) * ((noOfCells / 2) + 1));
+    if (map_p == NULL || componentSizes_p == NULL) {
+        fprintf(stderr, "FATAL ERROR: Could not allocate memory for ComponentMap!\n");
+        exit(EXIT_FAILURE);
+    }
+    map_p->rows = rows;
+    map_p->cols = cols;
+    map_p->noOfComponents = 0;
+    map_p->largestComponentSize = 0;
+    map_p->componentSizes = componentSizes_p;
+    return map_p;
+}
+
+void CONNECTIVITY_labelStripe(ComponentMap *const map_p, const WorldMatrix *const matrix_p,
+                              uint16_t stripe, uint16_t noOfStripes) {
+    CONNECTIVITY_internal_nullCheck(map_p, "FATAL ERROR: ComponentMap is uninitialized!\n");
+    if (matrix_p == NULL || MATRIXWORLD_unchecked_getRowSize(matrix_p) != map_p->rows ||
+        MATRIXWORLD_unchecked_getColSize(matrix_p) != map_p->cols) {
+        fprintf(stderr, "FATAL ERROR: WorldMatrix does not match the ComponentMap size!\n");
+        exit(EXIT_FAILURE);
+    }
+    CONNECTIVITY_internal_labelRows(map_p, matrix_p,
+                                    CONNECTIVITY_internal_stripeStart(map_p, stripe, noOfStripes),
+                                    CONNECTIVITY_internal_stripeStart(map_p, stripe + 1U,
+                                                                      noOfStripes));
+}
+
+void CONNECTIVITY_finishLabelling(ComponentMap *const map_p, uint16_t noOfStripes) {
+    CONNECTIVITY_internal_nullCheck(map_p, "FATAL ERROR: ComponentMap is uninitialized!\n");
+    const uint16_t cols = map_p->cols;
+    const size_t noOfCells = (size_t)map_p->rows * cols;
+
+    // 1. Merge the stripes along their shared borders.
+    for (uint16_t stripe = 1; stripe < noOfStripes; stripe++) {
+        uint16_t row = CONNECTIVITY_internal_stripeStart(map_p, stripe, noOfStripes);
+        for (uint16_t col = 0; col < cols; col++) {
+            uint32_t index = ((uint32_t)row * cols) + col;
+            if (map_p->labels[index] != CONNECTIVITY_NO_COMPONENT &&
+                map_p->labels[index - cols] != CONNECTIVITY_NO_COMPONENT) {
+                CONNECTIVITY_internal_union(map_p->labels, index, index - cols);
+            }
+        }
+    }
+
+    // 2. Flatten the forest. Parents always have smaller indices, so a single
+    //    ascending pass points every cell straight to its root.
+    for (uint32_t index = 0; index < noOfCells; index++) {
+        uint32_t parent = map_p->labels[index];
+        if (parent != CONNECTIVITY_NO_COMPONENT && parent != index) {
+            map_p->labels[index] = map_p->labels[parent];
+        }
+    }
+
+    // 3. Replace the root indices with dense labels and count the sizes.
+    map_p->noOfComponents = 0;
+    map_p->largestComponentSize = 0;
+    for (uint32_t index = 0; index < noOfCells; index++) {
+        uint32_t root = map_p->labels[index];
+        if (root == CONNECTIVITY_NO_COMPONENT) {
+            continue;
+        }
+        uint32_t label;
+        if (root == index) {
+            label = map_p->noOfComponents++;
+            map_p->componentSizes[label] = 0;
+        } else {
+            // The root precedes this cell and already holds its dense label.
+            label = map_p->labels[root];
+        }
+        map_p->labels[index] = label;
+        map_p->componentSizes[label]++;
+        if (map_p->componentSizes[label] > map_p->largestComponentSize) {
+            map_p->largestComponentSize = map_p->componentSizes[label];
+        }
+    }
+}
+
+void CONNECTIVITY_freeComponentMap(ComponentMap **const map_pp) {
+    if (map_pp != NULL && *map_pp != NULL) {
+        free((*map_pp)->componentSizes);
+        free(*map_pp);
+        *map_pp = NULL;
+    }
+}
+
+uint32_t CONNECTIVITY_getComponentLabel(const ComponentMap *const map_p, uint16_t row,
+                                        uint16_t col) {
+    CONNECTIVITY_internal_nullCheck(map_p, "FATAL ERROR: ComponentMap is uninitialized!\n");
+    if (row >= map_p->rows || col >= map_p->cols) {
+        fprintf(stderr, "ERROR: Cell (%d,%d) is out of bounds for this ComponentMap!\n",
+                row, col);
+        exit(EXIT_FAILURE);
+    }
+    return map_p->labels[((size_t)row * map_p->cols) + col];
+}
+
+uint32_t CONNECTIVITY_getComponentSize(const ComponentMap *const map_p, uint16_t row,
+                                       uint16_t col) {
+    uint32_t label = CONNECTIVITY_getComponentLabel(map_p, row, col);
+    return (label == CONNECTIVITY_NO_COMPONENT) ? 0 : map_p->componentSizes[label];
+}
+
+uint32_t CONNECTIVITY_getLargestComponentSize(const ComponentMap *const map_p) {
+    CONNECTIVITY_internal_nullCheck(map_p, "FATAL ERROR: ComponentMap is uninitialized!\n");
+    return map_p->largestComponentSize;
+}
+
+uint32_t CONNECTIVITY_getNoOfComponents(const ComponentMap *const map_p) {
+    CONNECTIVITY_internal_nullCheck(map_p, "FATAL ERROR: ComponentMap is uninitialized!\n");
+    return map_p->noOfComponents;
+}
+
+/* > Local Function Definitions **********************************************/
+
+static uint32_t CONNECTIVITY_internal_find(uint32_t *parents_p, uint32_t index) {
+    while (parents_p[index] != index) {
+        parents_p[index] = parents_p[parents_p[index]];
+        index = parents_p[index];
+    }
+    return index;
+}
+
+static void CONNECTIVITY_internal_union(uint32_t *parents_p, uint32_t aIndex, uint32_t bIndex) {
+    uint32_t aRoot = CONNECTIVITY_internal_find(parents_p, aIndex);
+    uint32_t bRoot = CONNECTIVITY_internal_find(parents_p, bIndex);
+    if (aRoot < bRoot) {
+        parents_p[bRoot] = aRoot;
+    } else if (bRoot < aRoot) {
+        parents_p[aRoot] = bRoot;
+    }
+}
+
+static void CONNECTIVITY_internal_labelRows(ComponentMap *const map_p,
+                                            const WorldMatrix *const matrix_p,
+                                            uint16_t firstRow, uint16_t endRow) {
+    uint32_t *parents_p = map_p->labels;
+    const uint16_t cols = map_p->cols;
+
+    for (uint16_t row = firstRow; row < endRow; row++) {
+        for (uint16_t col = 0; col < cols; col++) {
+            uint32_t index = ((uint32_t)row * cols) + col;
+            if (MATRIXWORLD_unchecked_isBlocked(matrix_p, row, col)) {
+                parents_p[index] = CONNECTIVITY_NO_COMPONENT;
+                continue;
+            }
+            parents_p[index] = index;
+            if (col > 0 && parents_p[index - 1] != CONNECTIVITY_NO_COMPONENT) {
+                CONNECTIVITY_internal_union(parents_p, index, index - 1);
+            }
+            if (row > firstRow && parents_p[index - cols] != CONNECTIVITY_NO_COMPONENT) {
+                CONNECTIVITY_internal_union(parents_p, index, index - cols);
+            }
+        }
+    }
+}
+
+static void *CONNECTIVITY_internal_labelStripeThread(void *stripeArgs) {
+    CONNECTIVITY_StripeArgs_t *args_p = (CONNECTIVITY_StripeArgs_t *)stripeArgs;
+    CONNECTIVITY_labelStripe(args_p->map_p, args_p->matrix_p, args_p->stripe,
+                             args_p->noOfStripes);
+    return NULL;
+}
+
+static inline uint16_t CONNECTIVITY_internal_stripeStart(const ComponentMap *const map_p,
+                                                         uint32_t stripe, uint16_t noOfStripes) {
+    return (uint16_t)(((uint32_t)map_p->rows * stripe) / noOfStripes);
+}
+
+static void CONNECTIVITY_internal_nullCheck(const ComponentMap *const map_p,
+                                            const char *restrict message) {
+    if (map_p == NULL) {
+        fprintf(stderr, "%s", message);
+        exit(EXIT_FAILURE);
+    }
+}
@@ -5,49 +5,284 @@
  * @brief Implements a randomized Depth-First Search (DFS) with backtracking
  *        to find a contiguous path in a 2D matrix.
  *
+ * Searches run through a DFS_SearchContext. It keeps the worker threads
+ * parked between searches and owns every buffer of a search, the component
+ * labels and the start list are rebuilt in place, so repeated searches on a
+ * warm context do not allocate. One-shot searches create and destroy a
+ * context around a single query.
  */
 
 /* > Includes ****************************************************************/
+// The search validates its inputs once at entry, the inner loop then uses the
+// header-inline unchecked accessors.
+#define _GNU_SOURCE // CPU affinity of the worker threads
+#define MATRIXWORLD_UNCHECKED_API
+#define PATH_UNCHECKED_API
+#define PATHDEQUE_UNCHECKED_API
+#define VISITED_UNCHECKED_API
 #include "dfsPathFinding.h"
+#include "arena.h"
+#include "connectivity.h"
 #include "matrixWorld.h"
 #include "path.h"
-#include "startingPointVector.h"
+#include "pathDeque.h"
+#include "snakePath.h"
+#include "startScheduler.h"
 #include "utilities.h"
+#include "visitedSet.h"
 #include <bits/pthreadtypes.h>
 #include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
 #include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <threads.h>
+#include <time.h>
+#include <unistd.h>
 
 /* > Defines *****************************************************************/
-#define NO_OF_THREADS 5
+#define CGROUP_CPU_MAX_FILE "/sys/fs/cgroup/cpu.max"
+#define NO_OF_DIRECTION_ORDERS 24
+#define FIXED_DIRECTION_ORDER 0xE4 // 0, 1, 2, 3 packed as 2-bit indices
+#define BITS_PER_DIRECTION 2
+#define DIRECTION_MASK 0x3
+#define NS_PER_SECOND 1000000000U
+#define NS_PER_MS 1000000U
+#define DFS_LIMIT_CHECK_INTERVAL 256U // Expansions between two checks of the limits
+#define DFS_UNDO_NODE_FACTOR 16U      // Expansions per path cell an attempt frees failed cells for
+#define DFS_LUBY_NODE_FACTOR 2U       // Expansions per path cell of a unit of the restart schedule
+#define NO_OF_PORTFOLIO_STRATEGIES 4
+#define DFS_FRONT_END 0U
+#define DFS_BACK_END 1U
+#define DFS_BOTH_ENDS 0x3U // closedEnds with both ends closed
+#define DFS_MAX_NO_OF_DIRECTIONS 8U
+#define DFS_KERNEL_WORD_BITS 64U          // Bits per word of the padded kernel maps
+#define DFS_KERNEL_FIXED_EIGHT_ORDER 0xFAC688U // 0, ..., 7 packed as 3-bit indices
+// The four neighborhood keeps the 2-bit orders of the generic loop.
+#define DFS_KERNEL_BITS_PER_DIRECTION(noOfDirections)                          \
+  (((noOfDirections) == FOUR_DIRECTIONS) ? BITS_PER_DIRECTION : 3U)
+#define DFS_KERNEL_DIRECTION_MASK(noOfDirections)                              \
+  (((noOfDirections) == FOUR_DIRECTIONS) ? DIRECTION_MASK : 0x7U)
+
+// Detailed statistics cost a branch or a clock read in the hot paths, they
+// are compiled in only with DFS_ENABLE_STATS.
+#ifdef DFS_ENABLE_STATS
+#define DFS_STATS_BACKTRACK(stats_p) ((stats_p)->backtracks++)
+#define DFS_STATS_DEPTH(stats_p, depth)                                        \
+  ((stats_p)->maxDepth = ((depth) > (stats_p)->maxDepth) ? (depth) : (stats_p)->maxDepth)
+#define DFS_STATS_LOCK(stats_p, mutex_p) DFS_internal_timedLock((stats_p), (mutex_p))
+#else
+#define DFS_STATS_BACKTRACK(stats_p) ((void)0)
+#define DFS_STATS_DEPTH(stats_p, depth) ((void)0)
+#define DFS_STATS_LOCK(stats_p, mutex_p) pthread_mutex_lock(mutex_p)
+#endif
 /* > Type Declarations *******************************************************/
 /*
- * @brief Arguments to be passed to each DFS pathfinding thread.
+ * @brief One level of the explicit DFS stack: a path cell and the directions
+ *        that are still to be tried from it.
  */
 typedef struct {
-  // Thread-specific identifier
-  uint16_t thread_id;
+  Cords position;
+  uint8_t directionOrder; // Four 2-bit indices into directions[]
+  uint8_t nextDirection;  // Number of directionOrder slots already tried
+} DFS_Frame_t;
 
-  // Input parameters (read-only for the thread)
-  const WorldMatrix *matrix_p;
-  uint16_t desiredPathLength;
+/*
+ * @brief One level of the frame stack of the bidirectional engine: the cell
+ *        added to one end of the path, and the end the path grows at from there.
+ */
+typedef struct {
+  Cords position;         // The cell this level added to the path
+  uint8_t addedAt;        // DFS_FRONT_END or DFS_BACK_END, where the cell was added
+  uint8_t growEnd;        // The end the directions below are tried at
+  uint8_t closedEnds;     // Ends that must not grow any more, one bit per end
+  uint8_t directionOrder; // Four 2-bit indices into directions[]
+  uint8_t nextDirection;  // Number of directionOrder slots already tried
+} DFS_EndFrame_t;
 
-  // Pointers to shared resources and their corresponding mutexes
-  StartingPointVector *usedStartingPoints_p;
-  pthread_mutex_t *used_points_mutex_p;
+/*
+ * @brief One level of the frame stack of a search kernel: a path cell, its
+ *        bit in the padded maps and the directions still to be tried from it.
+ */
+typedef struct {
+  Cords position;
+  uint32_t cell;           // Bit of the position in the padded maps
+  uint32_t directionOrder; // 2-bit (four) or 3-bit (eight) kernelDirections[] indices
+  uint8_t nextDirection;   // Number of directionOrder slots already tried
+} DFS_KernelFrame_t;
 
-  Path *final_path_p;
-  volatile bool *path_is_found_p;
-  pthread_mutex_t *completion_mutex_p;
+struct DFS_Worker;
+
+/*
+ * @brief A search attempt of the iterative engine specialized at compile
+ *        time for a neighborhood and a class of matrix widths.
+ */
+typedef bool (*DFS_Kernel_t)(struct DFS_Worker *const worker_p, uint32_t orderSalt);
+
+/*
+ * @brief Scratch buffers of the bounded flood fill used by the reachability
+ *        pruning.
+ */
+typedef struct {
+  uint32_t *stamps_p;    // Per cell, the flood fill that last reached it
+  uint32_t *queue_p;     // Per cell, the flood fill work queue
+  uint32_t currentStamp; // Identifier of the running flood fill
+} DFS_ReachScratch_t;
+
+/*
+ * @brief The time and node limits of the running search, shared by every
+ *        searcher.
+ */
+typedef struct {
+  uint64_t deadlineNs;             // CLOCK_MONOTONIC deadline, 0 for none
+  uint64_t nodeBudget;             // Expansions of all searchers, 0 for none
+  uint64_t checkInterval;          // Expansions between two checks of a searcher
+  atomic_uint_fast64_t nodesSpent; // Expansions reported by the searchers so far
+  atomic_int status;               // DFS_STATUS_NOT_FOUND until a limit is hit
+} DFS_SearchLimits_t;
+
+/*
+ * @brief How a portfolio worker searches.
+ */
+typedef struct {
+  DFS_Ordering ordering; // Neighbor ordering of every attempt
+  bool isRestarting;     // Random starts cut by the Luby schedule, instead of claimed ones
+} DFS_Strategy_t;
+
+/*
+ * @brief Everything a single searcher needs for its attempts. Buffers are
+ *        carved from the searcher's own arena and reused by every attempt.
+ *        Searchers start on their own cache line, so the threads never share
+ *        one.
+ */
+typedef struct DFS_Worker {
+  _Alignas(ARENA_CACHE_LINE_SIZE) const WorldMatrix *matrix_p;
+  const DFS_SearchOptions *options_p;
+  uint32_t pathLength;
+
+  Arena *arena_p;         // Single reservation holding every buffer below
+  size_t pathMark;        // Arena mark of the path and frame buffers
+  Path *path_p;           // The path being built
+  VisitedSet *visited_p;  // Cells visited by the current attempt
+  DFS_Frame_t *frames_p;  // Frame stack of the iterative engine
+  PathDeque *deque_p;     // The path of the bidirectional engine
+  DFS_EndFrame_t *endFrames_p; // Frame stack of the bidirectional engine
+  uint32_t capacity;      // Longest path the path and frame buffers can hold
+  DFS_ReachScratch_t reach;
+
+  // The kernel runs on a copy of the free cells framed by a border of
+  // blocked ones, so a step never leaves the map and needs no bounds check.
+  DFS_Kernel_t kernel;               // Attempt of the iterative engine, NULL for the generic loop
+  const uint64_t *kernelMap_p;       // Padded map of the free cells, owned by the context
+  uint64_t *open_p;                  // Padded map of the cells the attempt may still visit
+  DFS_KernelFrame_t *kernelFrames_p; // Frame stack of the kernel
+  uint32_t kernelStride;             // Bits per row of the padded maps, a multiple of 64
+  size_t kernelNoOfWords;            // Words of a padded map
+
+  RandomGenerator generator; // Private stream drawing the direction order salts
+  DFS_ThreadStats stats;     // Work of the current search
+
+  DFS_SearchLimits_t *limits_p; // The limits of the context
+  uint64_t nextLimitCheck;      // Expansions at which the limits are checked next
+  uint64_t reportedNodes;       // Expansions added to the shared budget so far
+  Path *bestBuffer_p;           // Carved with the path, holds the best partial path
+  Path *best_p;                 // bestBuffer_p under a limit, NULL otherwise
+  uint32_t bestSharedDepth;     // Cells the current path still shares with best_p
+  uint64_t undoEnd;             // Expansions from which failed cells stay visited
+
+  DFS_Engine engine;     // Engine of the attempts, the one of the options unless extending
+  DFS_Ordering ordering; // Neighbor ordering, the one of the options unless in a portfolio
+  bool isRestarting;     // Draws random starts and restarts them, see DFS_Strategy_t
+  uint64_t attemptEnd;   // Expansions at which the restart schedule cuts the attempt
+
+  atomic_bool *path_is_found_p; // Cancellation flag, NULL if single thread
+} DFS_Worker_t;
 
+/*
+ * @brief The kinds of work posted to the parked pool.
+ */
+typedef enum {
+  DFS_JOB_LABEL = 0, // Label one stripe of the component map per thread
+  DFS_JOB_SEARCH     // Run the search on every worker
+} DFS_Job_t;
+
+/*
+ * @brief Arguments to be passed to each pooled DFS pathfinding thread.
+ */
+typedef struct {
+  uint16_t thread_id;               // Index of the thread's worker
+  DFS_SearchContext *context_p;     // The context owning the pool
 } DFS_ThreadArgs_t;
+
+/*
+ * @brief Internal structure of the DFS_SearchContext.
+ */
+struct DFS_SearchContext {
+  WorldMatrix *matrix_p;
+  DFS_SearchOptions options;
+  uint16_t noOfThreads;
+  DFS_Worker_t *workers_p; // One per thread, the only one if single threaded
+
+  // Parked pool, NULL if single threaded
+  pthread_t *threads_p;
+  DFS_ThreadArgs_t *threadArgs_p;
+  pthread_mutex_t pool_mutex;
+  pthread_cond_t work_ready_cond; // Signalled when a new search is posted
+  pthread_cond_t work_done_cond;  // Signalled when the last thread finished it
+  uint64_t generation;            // Number of jobs posted so far
+  uint16_t noOfFinished;          // Threads done with the current job
+  bool isShuttingDown;
+  DFS_Job_t job;                  // The posted job
+  uint16_t noOfStripes;           // Labelling stripes, at most one per thread
+
+  // Rebuilt in place by every search, sized for the whole matrix.
+  ComponentMap *componentMap_p; // NULL without component pruning
+  StartScheduler *scheduler_p;  // Hands out the starts lock-free
+  uint64_t *kernelMap_p;        // Padded map of the free cells, NULL without a kernel
+
+  // The running search, written while the pool is parked.
+  DFS_SearchLimits_t limits;
+  bool isQueryArmed;       // Between DFS_beginQuery and DFS_endQuery, the limits are kept
+  DFS_SearchStatus status; // Outcome of the last search
+  Path *final_path_p;
+  int32_t finderThread; // Worker that handed over final_path_p, -1 if none
+  atomic_bool path_is_found;
+  atomic_uint noOfClaimingWorkers; // Workers still claiming starts, the restarts stop at 0
+  pthread_mutex_t completion_mutex;
+};
 /* > Global Constant Definitions *********************************************/
 
 /* > Global Variable Definitions *********************************************/
 
 /* > Local Constant Definitions **********************************************/
 
+/*
+ * @brief All 24 orders of the four directions, each packed as four 2-bit
+ *        indices into directions[] (first slot in the lowest bits).
+ */
+static const uint8_t directionOrders[NO_OF_DIRECTION_ORDERS] = {
+    0xE4, 0xB4, 0xD8, 0x78, 0x9C, 0x6C, 0xE1, 0xB1, 0xC9, 0x39, 0x8D, 0x2D,
+    0xD2, 0x72, 0xC6, 0x36, 0x4E, 0x1E, 0x93, 0x63, 0x87, 0x27, 0x4B, 0x1B};
+
+/*
+ * @brief The steps of the kernels, the first four are those of directions[],
+ *        the diagonal ones follow.
+ */
+static const fourWayDirections kernelDirections[DFS_MAX_NO_OF_DIRECTIONS] = {
+    {0, 1}, {0, -1}, {1, 0}, {-1, 0}, {1, 1}, {1, -1}, {-1, 1}, {-1, -1}};
+
+/*
+ * @brief The strategies of the portfolio workers after the first one, which
+ *        keeps the options. Worker i uses entry (i - 1) modulo the table size.
+ */
+static const DFS_Strategy_t portfolioStrategies[NO_OF_PORTFOLIO_STRATEGIES] = {
+    {.ordering = DFS_ORDERING_WARNSDORFF, .isRestarting = false},
+    {.ordering = DFS_ORDERING_RANDOM, .isRestarting = true},
+    {.ordering = DFS_ORDERING_WARNSDORFF, .isRestarting = true},
+    {.ordering = DFS_ORDERING_FIXED, .isRestarting = false}};
+
 /* > Local Variable Definitions **********************************************/
 
 /* > Local Function Declarations *********************************************/
@@ -56,155 +291,1228 @@ typedef struct {
  * @brief The recursive backtracking helper function for the DFS algorithm.
  *
  * This function attempts to extend the current path by exploring unvisited
- * neighbors. If a dead end is reached, it backtracks.
+ * neighbors. If a dead end is reached, it backtracks. It only uses unchecked
+ * accessors, the searcher must be prepared by the caller and its path must
+ * hold at least its starting point.
+ *
+ * @param[in,out] worker_p The searcher, with its path and visited set.
+ *
+ * @return `true` if a path of the target length is successfully found,
+ *         `false` otherwise, also when the search is stopped.
+ */
+static bool DFS_internal_backtracking(DFS_Worker_t *const worker_p);
+
+/**
+ * @brief The iterative backtracking engine of the DFS algorithm.
+ *
+ * Equivalent to DFS_internal_backtracking, but keeps an explicit stack of
+ * frames instead of recursing, so the depth of the search is bounded only by
+ * the preallocated frame array. Every frame expands its neighbors in the
+ * order selected by the ordering of the search options.
+ *
+ * @param[in,out] worker_p  The searcher, its path holds only the starting
+ *                          point, which is marked as visited.
+ * @param[in]     orderSalt Value varying the direction orders between attempts.
+ *
+ * @return `true` if a path of the target length is successfully found,
+ *         `false` otherwise.
+ */
+static bool DFS_internal_iterativeBacktracking(DFS_Worker_t *const worker_p,
+                                               uint32_t orderSalt);
+
+/**
+ * @brief The bidirectional backtracking engine of the DFS algorithm.
+ *
+ * Keeps the path in a PathDeque and grows it at either end. Every frame
+ * grows the end with more unvisited neighbors first. Once that end has no
+ * direction left, the end is closed for the frame and everything below it,
+ * and the frame grows the other end, so every path through the cells of
+ * the frame is still searched. The path of a single cell only grows at its
+ * back, a path growing at its front as well is the same path reversed.
+ *
+ * @param[in,out] worker_p  The searcher, its path holds only the starting
+ *                          point, which is marked as visited.
+ * @param[in]     orderSalt Value varying the direction orders between attempts.
+ *
+ * @return `true` if a path of the target length is successfully found, it is
+ *         then copied to the path of the searcher, `false` otherwise.
+ */
+static bool DFS_internal_bidirectionalBacktracking(DFS_Worker_t *const worker_p,
+                                                   uint32_t orderSalt);
+
+/**
+ * @brief Selects the end a frame of the bidirectional engine grows next,
+ *        the open end with more unvisited neighbors, the back on a tie.
+ *
+ * @param[in]     worker_p  The searcher.
+ * @param[in,out] frame_p   The frame, its closed ends must not be both set.
+ * @param[in]     orderSalt Value varying the direction orders between attempts.
+ */
+static void DFS_internal_openEnd(const DFS_Worker_t *const worker_p,
+                                 DFS_EndFrame_t *const frame_p, uint32_t orderSalt);
+
+/**
+ * @brief Computes the order in which the neighbors of a cell are expanded,
+ *        following the ordering selected in the search options.
+ *
+ * @param[in] worker_p  The searcher.
+ * @param[in] cell      The cell about to be expanded, already visited.
+ * @param[in] orderSalt Value varying the direction orders between attempts.
+ * @return Four 2-bit indices into directions[], first slot in the lowest bits.
+ */
+static uint8_t DFS_internal_orderDirections(const DFS_Worker_t *const worker_p,
+                                            Cords cell, uint32_t orderSalt);
+
+/**
+ * @brief Counts the unblocked neighbors of a cell that are not visited yet.
+ *
+ * @param[in] worker_p The searcher.
+ * @param[in] row      The row of the cell, must be in bounds.
+ * @param[in] col      The column of the cell, must be in bounds.
+ * @return The number of onward moves from the cell, 0 to 4.
+ */
+static uint8_t DFS_internal_countOnwardNeighbors(const DFS_Worker_t *const worker_p,
+                                                 uint16_t row, uint16_t col);
+
+/**
+ * @brief Checks whether enough unvisited cells remain reachable from a cell.
+ *
+ * Runs a flood fill over unblocked, unvisited cells that stops as soon as
+ * `required` cells have been reached.
+ *
+ * @param[in,out] worker_p The searcher owning the scratch buffers.
+ * @param[in]     head     The cell the path currently ends at.
+ * @param[in]     required Number of cells the path still needs.
+ * @return `true` if at least `required` cells are reachable.
+ */
+static bool DFS_internal_hasEnoughRoom(DFS_Worker_t *const worker_p, Cords head,
+                                       uint32_t required);
+
+/**
+ * @brief The search kernels, the iterative engine compiled once per
+ *        neighborhood and class of matrix widths.
+ *
+ * The narrow kernels serve matrices whose padded rows fit in one word, the
+ * stride between two rows is then the constant 64 and every neighbor check
+ * is a shift and a mask of the three row words around the cell. The wide
+ * kernels use the stride of the matrix. Each attempt visits the cells in the
+ * same order as DFS_internal_iterativeBacktracking does in the four
+ * neighborhood.
  *
- * @param[in]     matrix_p        A pointer to the world matrix.
- * @param[in,out] path_p          A pointer to the current path being built.
- * @param[in,out] visited_p       A pointer to the vector of visited cells for the
- *                                current search attempt.
- * @param[in]     path_is_found_p A pointer to flag used to indicate the
- *                                thread success during multithreaded scenario,
- *                                otherwise it is NULL
- * @param[in]     pathLength      The target length of the path.
+ * @param[in,out] worker_p  The searcher, its path holds only the starting
+ *                          point, which is still open in its padded map.
+ * @param[in]     orderSalt Value varying the direction orders between attempts.
  *
  * @return `true` if a path of the target length is successfully found,
  *         `false` otherwise.
  */
-static bool DFS_internal_backtracking(const WorldMatrix *const matrix_p,
-                                      Path *path_p,
-                                      StartingPointVector *visited_p,
-                                      volatile bool *path_is_found_p,
-                                      uint32_t pathLength);
+static bool DFS_internal_kernelFourNarrow(DFS_Worker_t *const worker_p, uint32_t orderSalt);
+static bool DFS_internal_kernelFourWide(DFS_Worker_t *const worker_p, uint32_t orderSalt);
+static bool DFS_internal_kernelEightNarrow(DFS_Worker_t *const worker_p, uint32_t orderSalt);
+static bool DFS_internal_kernelEightWide(DFS_Worker_t *const worker_p, uint32_t orderSalt);
+
+/**
+ * @brief The body of every search kernel, inlined with constant arguments.
+ *
+ * @param[in,out] worker_p       The searcher.
+ * @param[in]     orderSalt      Value varying the direction orders between attempts.
+ * @param[in]     noOfDirections FOUR_DIRECTIONS or DFS_MAX_NO_OF_DIRECTIONS.
+ * @param[in]     isNarrow       The padded rows are one word long.
+ * @return `true` if a path of the target length is successfully found.
+ */
+[[gnu::always_inline]] static inline bool DFS_internal_runKernel(DFS_Worker_t *const worker_p,
+                                                                 uint32_t orderSalt,
+                                                                 uint8_t noOfDirections,
+                                                                 bool isNarrow);
+
+/**
+ * @brief Gets the open neighbors of a cell of a padded map.
+ *
+ * @param[in] open_p         The padded map.
+ * @param[in] cell           The bit of the cell, not on the border.
+ * @param[in] offsets_p      The bit offsets of the kernel directions.
+ * @param[in] noOfDirections FOUR_DIRECTIONS or DFS_MAX_NO_OF_DIRECTIONS.
+ * @param[in] isNarrow       The padded rows are one word long.
+ * @return Bit i is set when the neighbor reached with kernelDirections[i] is open.
+ */
+[[gnu::always_inline]] static inline uint32_t DFS_internal_getOpenNeighborMask(
+    const uint64_t *const open_p, uint32_t cell, const int32_t *const offsets_p,
+    uint8_t noOfDirections, bool isNarrow);
+
+/**
+ * @brief Computes the order of the kernel directions of a cell, the same
+ *        order as DFS_internal_orderDirections in the four neighborhood.
+ *
+ * @param[in] worker_p       The searcher.
+ * @param[in] frame_p        The frame of the cell about to be expanded, its
+ *                           cell is closed already.
+ * @param[in] orderSalt      Value varying the direction orders between attempts.
+ * @param[in] offsets_p      The bit offsets of the kernel directions.
+ * @param[in] noOfDirections FOUR_DIRECTIONS or DFS_MAX_NO_OF_DIRECTIONS.
+ * @param[in] isNarrow       The padded rows are one word long.
+ * @return 3-bit indices into kernelDirections[], first slot in the lowest bits.
+ */
+[[gnu::always_inline]] static inline uint32_t DFS_internal_orderKernelDirections(
+    const DFS_Worker_t *const worker_p, const DFS_KernelFrame_t *const frame_p,
+    uint32_t orderSalt, const int32_t *const offsets_p, uint8_t noOfDirections, bool isNarrow);
+
+/**
+ * @brief DFS_internal_hasEnoughRoom on the padded map of a kernel.
+ *
+ * @param[in,out] worker_p       The searcher owning the scratch buffers.
+ * @param[in]     head           The bit of the cell the path currently ends at.
+ * @param[in]     required       Number of cells the path still needs.
+ * @param[in]     offsets_p      The bit offsets of the kernel directions.
+ * @param[in]     noOfDirections FOUR_DIRECTIONS or DFS_MAX_NO_OF_DIRECTIONS.
+ * @param[in]     isNarrow       The padded rows are one word long.
+ * @return `true` if at least `required` cells are reachable.
+ */
+[[gnu::always_inline]] static inline bool DFS_internal_kernelHasEnoughRoom(
+    DFS_Worker_t *const worker_p, uint32_t head, uint32_t required,
+    const int32_t *const offsets_p, uint8_t noOfDirections, bool isNarrow);
+
+/**
+ * @brief Picks the kernel of the searchers of a matrix, and the layout of
+ *        their padded maps.
+ *
+ * @param[in]  matrix_p      The matrix searched.
+ * @param[in]  options_p     The search options.
+ * @param[out] stride_p      Bits per padded row, set with a kernel.
+ * @param[out] noOfWords_p   Words of a padded map, set with a kernel.
+ * @return The kernel, NULL when the options ask for the generic loop or
+ *         another engine, or the bits of a padded map do not fit 32 bits.
+ *         The eight neighborhood has no generic loop, see
+ *         DFS_internal_isSupported.
+ */
+static DFS_Kernel_t DFS_internal_selectKernel(const WorldMatrix *const matrix_p,
+                                              const DFS_SearchOptions *const options_p,
+                                              uint32_t *const stride_p,
+                                              size_t *const noOfWords_p);
+
+/**
+ * @brief Copies the free cells of the matrix into the padded map of the
+ *        context, the border stays blocked. Does nothing without a kernel.
+ *
+ * @param[in,out] context_p The context.
+ */
+static void DFS_internal_buildKernelMap(DFS_SearchContext *const context_p);
+
+/**
+ * @brief Opens the free cells of the padded map of a searcher for an attempt.
+ *
+ * @param[in,out] worker_p The searcher, it runs on a kernel.
+ * @param[in]     prefix_p The cells to keep closed but the last one, NULL for none.
+ */
+static void DFS_internal_loadKernelMap(DFS_Worker_t *const worker_p, const Path *const prefix_p);
+
+/**
+ * @brief Tells whether the options of a context can search its matrix.
+ *
+ * @param[in] context_p The context.
+ * @return `false` for the eight neighborhood on a matrix too large for its
+ *         kernels, which are the only loop stepping diagonally.
+ */
+static bool DFS_internal_isSupported(const DFS_SearchContext *const context_p);
+
+/**
+ * @brief Tells whether the attempts of a searcher run on a kernel.
+ *
+ * @param[in] worker_p The searcher.
+ * @return `true` for the iterative engine with a kernel.
+ */
+static inline bool DFS_internal_usesKernel(const DFS_Worker_t *const worker_p);
 
 /**
- * @brief The worker function for each thread, responsible for executing the DFS
- * search.
+ * @brief Checks that every cell of a prefix is a step of the neighborhood
+ *        away from the previous one.
  *
- * This function continuously searches for a valid path from random starting
- * points until a path is found by any thread or the search space is exhausted.
- * It manages its own local path and visited points vectors and only interacts
- * with shared data structures under mutex protection.
+ * @param[in] prefix_p     The prefix.
+ * @param[in] neighborhood The neighborhood of the search.
+ * @return `true` if the prefix is contiguous.
+ */
+static bool DFS_internal_isPrefixContiguous(const Path *const prefix_p,
+                                            DFS_Neighborhood neighborhood);
+
+/**
+ * @brief Runs one search attempt from a starting point with the selected
+ *        engine.
+ *
+ * @param[in,out] worker_p      The searcher.
+ * @param[in]     startingPoint The unblocked cell to start from.
+ * @param[in]     orderSalt     Value varying the direction orders.
+ * @return `true` if a path of the target length is found, it is then held
+ *         by worker_p->path_p.
+ */
+static bool DFS_internal_searchFromStart(DFS_Worker_t *const worker_p,
+                                         Cords startingPoint,
+                                         uint32_t orderSalt);
+
+/**
+ * @brief Runs one attempt from a starting point like
+ *        DFS_internal_searchFromStart, over the cells already marked in the
+ *        visited set of the searcher.
+ *
+ * @param[in,out] worker_p      The searcher, its visited set holds the cells
+ *                              the path must avoid.
+ * @param[in]     startingPoint The first cell of the path.
+ * @param[in]     orderSalt     Value varying the direction orders between attempts.
+ * @return `true` if a path of the target length is found.
+ */
+static bool DFS_internal_searchFromMarked(DFS_Worker_t *const worker_p,
+                                          Cords startingPoint,
+                                          uint32_t orderSalt);
+
+/**
+ * @brief Marks the cells of a prefix but its last one in the visited set of
+ *        a searcher, checking that they form a valid path.
+ *
+ * @param[in,out] worker_p The searcher, its visited set is cleared first.
+ * @param[in]     prefix_p The prefix, not empty.
+ * @return `false` if the prefix is not contiguous, leaves the matrix, holds
+ *         a blocked cell or holds a cell twice.
+ */
+static bool DFS_internal_markPrefix(DFS_Worker_t *const worker_p, const Path *const prefix_p);
+
+/**
+ * @brief Reserves the arena of a searcher and carves its matrix-sized buffers.
+ *        The path and frame buffers are carved by DFS_internal_prepareWorker.
+ *
+ * @param[out] worker_p       The searcher to initialize.
+ * @param[in]  matrix_p       A pointer to the world matrix.
+ * @param[in]  options_p      A pointer to the search options.
+ */
+static void DFS_internal_createWorker(DFS_Worker_t *const worker_p,
+                                      const WorldMatrix *const matrix_p,
+                                      const DFS_SearchOptions *const options_p);
+
+/**
+ * @brief Readies a searcher for a new search, carving its path and frame
+ *        buffers again if the path is longer than any before, arming the
+ *        limits of the search and resetting the strategy to the options.
+ *
+ * @param[in,out] worker_p   The searcher.
+ * @param[in]     pathLength The target length of the path.
+ */
+static void DFS_internal_prepareWorker(DFS_Worker_t *const worker_p, uint32_t pathLength);
+
+/**
+ * @brief Carves the path, frame and best path buffers of a searcher over the
+ *        shorter ones.
+ *
+ * @param[in,out] worker_p   The searcher.
+ * @param[in]     pathLength The length the buffers must hold.
+ */
+static void DFS_internal_carvePathBuffers(DFS_Worker_t *const worker_p, uint32_t pathLength);
+
+/**
+ * @brief Frees the buffers of a searcher.
+ *
+ * @param[in,out] worker_p The searcher to clean up.
+ */
+static void DFS_internal_destroyWorker(DFS_Worker_t *const worker_p);
+
+/**
+ * @brief Reads the CPU quota of the cgroup (v2) the process runs in.
+ *
+ * @return The quota rounded up to whole CPUs, 0 if there is no quota.
+ */
+static uint16_t DFS_internal_readCgroupCpuQuota(void);
+
+/**
+ * @brief Pins every worker thread to one of the CPUs the process may run on,
+ *        round robin.
+ *
+ * @param[in,out] threadAttrs_p One attribute object per thread.
+ * @param[in]     noOfThreads   The number of threads.
+ */
+static void DFS_internal_pinThreads(pthread_attr_t *const threadAttrs_p,
+                                    uint16_t noOfThreads);
+
+/**
+ * @brief Posts a job to the parked pool and waits until every thread is done
+ *        with it.
+ *
+ * @param[in,out] context_p The context owning the pool.
+ * @param[in]     job       The job to run.
+ */
+static void DFS_internal_runPoolJob(DFS_SearchContext *const context_p, DFS_Job_t job);
+
+/**
+ * @brief Labels the component map of the context's matrix, on the pool if
+ *        there is one.
+ *
+ * @param[in,out] context_p The context owning the component map.
+ */
+static void DFS_internal_labelComponents(DFS_SearchContext *const context_p);
+
+/**
+ * @brief Checks a constructed path before it is returned: its length, that it
+ *        is contiguous, and that every cell is unblocked and visited once.
+ *
+ * @param[in,out] context_p  The context, its first visited set is the scratch.
+ * @param[in]     pathLength The length the path should have.
+ * @param[in]     path_p     The constructed path.
+ * @return `true` if the path is a valid answer.
+ */
+static bool DFS_internal_isValidConstruction(DFS_SearchContext *const context_p,
+                                             uint32_t pathLength, const Path *const path_p);
+
+/**
+ * @brief The function of every pooled thread. It parks until a job is
+ * posted, runs it and parks again until the context shuts down.
  *
- * @param[in] threadArgs A void pointer to a DFS_ThreadArgs_t struct containing
- *                       all necessary data and mutexes for the thread.
+ * @param[in] threadArgs A void pointer to the thread's DFS_ThreadArgs_t.
  * @return Always returns NULL.
  */
 static void *DFS_findPathThreaded(void *threadArgs);
 
 /**
- * @brief The original single-threaded implementation of the DFS pathfinding
- * algorithm.
+ * @brief Runs the posted search on one pooled worker.
+ *
+ * The worker continuously claims starting points from the shared scheduler
+ * until a path is found by any thread or every start has been tried. Starts
+ * are claimed through the scheduler's atomic cursor, only the handoff of the
+ * found path is protected by a mutex.
+ *
+ * @param[in,out] context_p The context holding the posted search.
+ * @param[in,out] worker_p  The worker of the calling thread.
+ */
+static void DFS_internal_runPooledWorker(DFS_SearchContext *const context_p,
+                                         DFS_Worker_t *const worker_p);
+
+/**
+ * @brief Runs the posted search on one restarting portfolio worker.
+ *
+ * The worker draws random starts from the scheduler without claiming them,
+ * and cuts every attempt after the next term of the Luby sequence times
+ * DFS_LUBY_NODE_FACTOR expansions per path cell. It cannot prove that there
+ * is no path, so it stops once the claiming workers have tried every start.
+ *
+ * @param[in,out] context_p The context holding the posted search.
+ * @param[in,out] worker_p  The worker of the calling thread.
+ */
+static void DFS_internal_runRestartingWorker(DFS_SearchContext *const context_p,
+                                             DFS_Worker_t *const worker_p);
+
+/**
+ * @brief Hands the path of a worker over as the result of the search, unless
+ *        another worker was first.
+ * @param[in,out] context_p The context holding the posted search.
+ * @param[in]     worker_p  The worker that found a path.
+ */
+static void DFS_internal_handOverPath(DFS_SearchContext *const context_p,
+                                      DFS_Worker_t *const worker_p);
+
+/**
+ * @brief Gives a prepared pooled worker its portfolio strategy, if the
+ *        options ask for a portfolio.
+ * @param[in,out] worker_p   The worker.
+ * @param[in]     thrIndex   The index of the worker.
+ * @param[in]     options_p  The options of the search.
+ */
+static void DFS_internal_assignStrategy(DFS_Worker_t *const worker_p, uint16_t thrIndex,
+                                        const DFS_SearchOptions *const options_p);
+
+/**
+ * @brief Returns a term of the Luby sequence 1, 1, 2, 1, 1, 2, 4, 1, 1, 2, ...
+ * @param[in] index The index of the term, from 1.
+ * @return The term.
+ */
+static uint64_t DFS_internal_luby(uint32_t index);
+
+/**
+ * @brief The single-threaded implementation of the DFS pathfinding algorithm.
  *
  * This function serves as the fallback when multithreading is disabled. It
- * iteratively picks random starting points and performs a DFS search until a
- * path is found or the search space is exhausted.
+ * takes the starting points from the scheduler one by one and performs a DFS
+ * search until a path is found or every start has been tried.
+ *
+ * @param[in,out] worker_p    The prepared searcher.
+ * @param[in]     scheduler_p The scheduler of the starting points.
+ * @return `true` if a path is found, it is then held by worker_p->path_p.
+ */
+static bool DFS_internal_findPathSingleThread(DFS_Worker_t *const worker_p,
+                                              StartScheduler *const scheduler_p);
+
+#ifdef DFS_ENABLE_STATS
+/**
+ * @brief Locks a mutex and adds the time spent waiting for it to the
+ *        statistics of a searcher.
+ *
+ * @param[in,out] stats_p The statistics of the searcher.
+ * @param[in,out] mutex_p The mutex to lock.
+ */
+static void DFS_internal_timedLock(DFS_ThreadStats *const stats_p, pthread_mutex_t *mutex_p);
+#endif
+
+/**
+ * @brief Reports the expansions of a searcher to the shared budget and checks
+ *        the limits of the search, called every checkInterval expansions.
+ *
+ * @param[in,out] worker_p The searcher.
+ * @return `true` if a limit has been hit, by this or any other searcher.
+ */
+static bool DFS_internal_checkLimits(DFS_Worker_t *const worker_p);
+
+/**
+ * @brief Whether the searcher must stop: due to check its limits and one of
+ *        them is hit. A single comparison when the search has no limits.
+ *
+ * @param[in,out] worker_p The searcher.
+ * @return `true` if the search must stop.
+ */
+static inline bool DFS_internal_isOverLimit(DFS_Worker_t *const worker_p);
+
+/**
+ * @brief Whether the current attempt still frees the cells of a failed
+ *        branch. Past its undo budget the cells stay visited, so the rest of
+ *        the attempt is linear in the free cells. Always in the completeness
+ *        mode.
+ *
+ * @param[in] worker_p The searcher.
+ * @return `true` if a backtracked cell is to be unmarked.
+ */
+static inline bool DFS_internal_isUndoing(const DFS_Worker_t *const worker_p);
+
+/**
+ * @brief Keeps the current path of a searcher as its best partial path if it
+ *        is longer. Only the cells pushed since the last copy are copied.
+ *
+ * @param[in,out] worker_p The searcher.
+ * @param[in]     depth    The number of cells of the current path.
+ */
+static void DFS_internal_recordBest(DFS_Worker_t *const worker_p, uint32_t depth);
+
+/**
+ * @brief Gets the current monotonic time.
+ *
+ * @return The CLOCK_MONOTONIC time in nanoseconds.
+ */
+static uint64_t DFS_internal_getMonotonicNs(void);
+
+/**
+ * @brief Zeroes the statistics of every worker before a search.
+ *
+ * @param[in,out] context_p The context owning the workers.
+ */
+static void DFS_internal_resetCounters(DFS_SearchContext *const context_p);
+
+/**
+ * @brief Starts the clock and the budget of a search from the options of a
+ *        context.
+ *
+ * @param[in,out] context_p The context about to search.
+ * @return `true` if the search has a timeout or a node budget.
+ */
+static bool DFS_internal_armLimits(DFS_SearchContext *const context_p);
+
+/**
+ * @brief Copies the coordinates of a path into a path of enough capacity.
  *
- * @param[in] matrix_p   A pointer to the WorldMatrix to search within.
- * @param[in] pathLength The desired length of the path.
- * @return A pointer to a Path object if a path is found, otherwise NULL.
+ * @param[out] destination_p The path to overwrite.
+ * @param[in]  source_p      The path to copy.
  */
-static Path *
-DFS_internal_findPathSingleThread(const WorldMatrix *const matrix_p,
-                                  uint32_t pathLength);
+static void DFS_internal_copyPath(Path *const destination_p, const Path *const source_p);
 
 /* > Global Function Definitions
  * *********************************************/
 
 Path *DFS_findPath(WorldMatrix *matrix_p, uint32_t pathLength,
                    bool isMultithreading) {
-  if (isMultithreading) {
-    // Keep track of starting points that have already been tried.
-    StartingPointVector *usedStartingPoints_p = STPOINT_createVector(matrix_p);
-    // The path to be built and returned.
-    Path *foundPath_p = PATH_initializePath(pathLength, matrix_p);
-
-    pthread_t arrThread[NO_OF_THREADS] = {0};
-    pthread_mutex_t usedStartingPointsMutex = {0};
-    pthread_mutex_t completionCondMutex = {0};
-
-    pthread_mutex_init(&usedStartingPointsMutex, NULL);
-    pthread_mutex_init(&completionCondMutex, NULL);
-
-    bool isPathFound = false;
-    DFS_ThreadArgs_t threadArgsArr[NO_OF_THREADS] = {0};
-
-    for (uint16_t thrIndex = 0; thrIndex < NO_OF_THREADS; thrIndex++) {
-      DFS_ThreadArgs_t threadArgs = {
-          .thread_id = thrIndex,
-          .completion_mutex_p = &completionCondMutex,
-          .used_points_mutex_p = &usedStartingPointsMutex,
-          .usedStartingPoints_p = usedStartingPoints_p,
-          .desiredPathLength = pathLength,
-          .final_path_p = foundPath_p,
-          .matrix_p = matrix_p,
-          .path_is_found_p = &isPathFound};
-      threadArgsArr[thrIndex] = threadArgs;
-
-      pthread_create(&arrThread[thrIndex], NULL, DFS_findPathThreaded,
-                     &threadArgsArr[thrIndex]);
-    }
-    for (int i = 0; i < NO_OF_THREADS; i++) {
-      pthread_join(arrThread[i], NULL);
-    }
-    pthread_mutex_destroy(&usedStartingPointsMutex);
-    pthread_mutex_destroy(&completionCondMutex);
-    STPOINT_destroyVector(&usedStartingPoints_p);
-    if (isPathFound) {
-      return foundPath_p;
-    }
-    PATH_freePath(&foundPath_p);
-    return NULL;
-  } else {
-    return DFS_internal_findPathSingleThread(matrix_p, pathLength);
-  }
+  DFS_SearchOptions options = DFS_getDefaultOptions();
+  options.isMultithreading = isMultithreading;
+  return DFS_findPathWithOptions(matrix_p, pathLength, &options);
 }
 
-/* > Local Function Definitions **********************************************/
+DFS_SearchOptions DFS_getDefaultOptions(void) {
+  return (DFS_SearchOptions){.isMultithreading = false,
+                             .engine = DFS_ENGINE_ITERATIVE,
+                             .ordering = DFS_ORDERING_RANDOM,
+                             .useComponentPruning = true,
+                             .useReachabilityPruning = false,
+                             .startOrder = SCHEDULER_ORDER_SHUFFLED,
+                             .seed = RANDOM_GEN_SEED,
+                             .noOfThreads = 0,
+                             .pinThreads = false,
+                             .useHugePages = false,
+                             .timeoutMs = 0,
+                             .nodeBudget = 0,
+                             .isComplete = false,
+                             .useConstruction = true,
+                             .usePortfolio = false,
+                             .neighborhood = DFS_NEIGHBORHOOD_FOUR,
+                             .useKernels = true};
+}
 
-static bool DFS_internal_backtracking(const WorldMatrix *const matrix_p,
-                                      Path *path_p,
-                                      StartingPointVector *visited_p,
-                                      volatile bool *path_is_found_p,
-                                      uint32_t pathLength) {
-  // Base case: If the path has reached the desired length, we are done.
-  if (PATH_getLength(path_p) == pathLength) {
-    return true;
+uint16_t DFS_detectNoOfThreads(void) {
+  long noOfCpus = sysconf(_SC_NPROCESSORS_ONLN);
+  cpu_set_t allowedCpus;
+  CPU_ZERO(&allowedCpus);
+  if (sched_getaffinity(0, sizeof(allowedCpus), &allowedCpus) == 0 &&
+      CPU_COUNT(&allowedCpus) < noOfCpus) {
+    noOfCpus = CPU_COUNT(&allowedCpus);
   }
-  if (path_is_found_p != NULL && *path_is_found_p == true) {
-    return false;
+  uint16_t cgroupQuota = DFS_internal_readCgroupCpuQuota();
+  if (cgroupQuota != 0 && cgroupQuota < noOfCpus) {
+    noOfCpus = cgroupQuota;
   }
+  if (noOfCpus < 1) {
+    return 1;
+  }
+  return (noOfCpus > UINT16_MAX) ? UINT16_MAX : (uint16_t)noOfCpus;
+}
 
-  Cords currentPosition = PATH_getLastCoordinates(path_p);
+Path *DFS_findPathWithOptions(WorldMatrix *matrix_p, uint32_t pathLength,
+                              const DFS_SearchOptions *options_p) {
+  DFS_SearchReport report;
+  return DFS_findPathWithReport(matrix_p, pathLength, options_p, &report);
+}
 
-  // Explore neighbors in all four directions.
-  for (uint8_t index = 0; index < FOUR_DIRECTIONS; index++) {
-    // Use signed integers for temporary calculation to detect underflow.
-    int16_t tempNewRow = (currentPosition.row + directions[index].row);
-    int16_t tempNewCol = currentPosition.col + directions[index].col;
+Path *DFS_findPathWithReport(WorldMatrix *matrix_p, uint32_t pathLength,
+                             const DFS_SearchOptions *options_p,
+                             DFS_SearchReport *report_p) {
+  if (matrix_p == NULL || report_p == NULL) {
+    fprintf(stderr, "FATAL ERROR: WorldMatrix or report supplied to DFS_findPath is NULL!\n");
+    exit(EXIT_FAILURE);
+  }
+  *report_p = (DFS_SearchReport){.status = DFS_STATUS_NOT_FOUND};
+  if (pathLength > MATRIXWORLD_unchecked_getNoOfUnblockedCells(matrix_p)) {
+    // Not enough free cells for such a path, no need to start any thread.
+    return NULL;
+  }
+  DFS_SearchContext *context_p = DFS_createSearchContext(matrix_p, options_p);
+  Path *result_p = DFS_searchWithContext(context_p, pathLength);
+  DFS_getSearchReport(context_p, report_p);
+  DFS_destroySearchContext(&context_p);
+  return result_p;
+}
 
-    // Safely convert back to unsigned, handling potential negative values.
-    uint16_t newRow = (tempNewRow >= 0) ? tempNewRow : UINT16_MAX;
+DFS_SearchStatus DFS_findPathBounded(WorldMatrix *matrix_p, uint32_t pathLength,
+                                     const DFS_SearchOptions *options_p, Path **path_pp) {
+  if (matrix_p == NULL || path_pp == NULL) {
+    fprintf(stderr, "FATAL ERROR: WorldMatrix or result supplied to DFS_findPathBounded is NULL!\n");
+    exit(EXIT_FAILURE);
+  }
+  *path_pp = NULL;
+  if (pathLength == 0 || pathLength > MATRIXWORLD_unchecked_getNoOfUnblockedCells(matrix_p)) {
+    // Not enough free cells for such a path, no need to start any thread.
+    return DFS_STATUS_NOT_FOUND;
+  }
+  DFS_SearchContext *context_p = DFS_createSearchContext(matrix_p, options_p);
+  Path *result_p = PATH_initializePath(pathLength, matrix_p);
+  DFS_SearchStatus status = DFS_searchBounded(context_p, pathLength, result_p);
+  DFS_destroySearchContext(&context_p);
+  if (PATH_unchecked_getLength(result_p) == 0) {
+    PATH_freePath(&result_p);
+  }
+  *path_pp = result_p;
+  return status;
+}
+
+Path *DFS_extendPath(WorldMatrix *matrix_p, uint32_t pathLength, const Path *prefix_p,
+                     const DFS_SearchOptions *options_p) {
+  if (matrix_p == NULL) {
+    fprintf(stderr, "FATAL ERROR: WorldMatrix supplied to DFS_extendPath is NULL!\n");
+    exit(EXIT_FAILURE);
+  }
+  if (pathLength == 0 || prefix_p == NULL || PATH_unchecked_getLength(prefix_p) == 0) {
+    return NULL;
+  }
+  // A single prefix is grown by a single searcher.
+  DFS_SearchOptions options = (options_p == NULL) ? DFS_getDefaultOptions() : *options_p;
+  options.isMultithreading = false;
+  DFS_SearchContext *context_p = DFS_createSearchContext(matrix_p, &options);
+  Path *result_p = PATH_initializePath(pathLength, matrix_p);
+  DFS_SearchStatus status = DFS_extendBounded(context_p, prefix_p, pathLength, result_p);
+  DFS_destroySearchContext(&context_p);
+  if (status != DFS_STATUS_FOUND) {
+    PATH_freePath(&result_p);
+  }
+  return result_p;
+}
+
+Path *DFS_findPathFromStart(WorldMatrix *matrix_p, uint32_t pathLength, Cords start,
+                            const DFS_SearchOptions *options_p) {
+  if (matrix_p == NULL) {
+    fprintf(stderr, "FATAL ERROR: WorldMatrix supplied to DFS_findPathFromStart is NULL!\n");
+    exit(EXIT_FAILURE);
+  }
+  if (pathLength == 0 || pathLength > MATRIXWORLD_unchecked_getNoOfUnblockedCells(matrix_p) ||
+      start.row >= MATRIXWORLD_unchecked_getRowSize(matrix_p) ||
+      start.col >= MATRIXWORLD_unchecked_getColSize(matrix_p) ||
+      MATRIXWORLD_unchecked_isBlocked(matrix_p, start.row, start.col)) {
+    return NULL;
+  }
+  // A single start is searched by a single searcher, to the end of its tree.
+  DFS_SearchOptions options = (options_p == NULL) ? DFS_getDefaultOptions() : *options_p;
+  options.isMultithreading = false;
+  options.isComplete = true;
+  // The bidirectional engine may grow in front of the start, which must stay first.
+  if (options.engine == DFS_ENGINE_BIDIRECTIONAL) {
+    options.engine = DFS_ENGINE_ITERATIVE;
+  }
+  DFS_SearchContext *context_p = DFS_createSearchContext(matrix_p, &options);
+  if (!DFS_internal_isSupported(context_p)) {
+    DFS_destroySearchContext(&context_p);
+    return NULL;
+  }
+  DFS_Worker_t *worker_p = &context_p->workers_p[0];
+  DFS_internal_resetCounters(context_p);
+  UNUSED(DFS_internal_armLimits(context_p));
+  DFS_internal_prepareWorker(worker_p, pathLength);
+  DFS_internal_buildKernelMap(context_p);
+  UTILITY_seedGenerator(&worker_p->generator, options.seed);
+
+  Path *result_p = NULL;
+  if (DFS_internal_searchFromStart(worker_p, start,
+                                   (uint32_t)UTILITY_nextRandom(&worker_p->generator))) {
+    result_p = PATH_initializePath(pathLength, matrix_p);
+    DFS_internal_copyPath(result_p, worker_p->path_p);
+  }
+  DFS_destroySearchContext(&context_p);
+  return result_p;
+}
+
+Path *DFS_findPathWithStats(WorldMatrix *matrix_p, uint32_t pathLength,
+                            const DFS_SearchOptions *options_p, DFS_SearchStats *stats_p) {
+  if (matrix_p == NULL || stats_p == NULL) {
+    fprintf(stderr, "FATAL ERROR: WorldMatrix or statistics supplied to DFS_findPath are NULL!\n");
+    exit(EXIT_FAILURE);
+  }
+  // The context also reports a search refused for its length.
+  DFS_SearchContext *context_p = DFS_createSearchContext(matrix_p, options_p);
+  Path *result_p = DFS_searchWithContext(context_p, pathLength);
+  DFS_getSearchStats(context_p, stats_p);
+  DFS_destroySearchContext(&context_p);
+  return result_p;
+}
+
+DFS_SearchStatus DFS_findPathBoundedWithStats(WorldMatrix *matrix_p, uint32_t pathLength,
+                                              const DFS_SearchOptions *options_p, Path **path_pp,
+                                              DFS_SearchStats *stats_p) {
+  if (matrix_p == NULL || path_pp == NULL || stats_p == NULL) {
+    fprintf(stderr, "FATAL ERROR: WorldMatrix, result or statistics supplied to "
+                    "DFS_findPathBoundedWithStats are NULL!\n");
+    exit(EXIT_FAILURE);
+  }
+  *path_pp = NULL;
+  // The context also reports a search refused for its length.
+  DFS_SearchContext *context_p = DFS_createSearchContext(matrix_p, options_p);
+  DFS_SearchStatus status = DFS_STATUS_NOT_FOUND;
+  if (pathLength == 0 || pathLength > MATRIXWORLD_unchecked_getNoOfUnblockedCells(matrix_p)) {
+    // Not enough free cells for such a path, no need to search.
+    DFS_internal_resetCounters(context_p);
+  } else {
+    Path *result_p = PATH_initializePath(pathLength, matrix_p);
+    status = DFS_searchBounded(context_p, pathLength, result_p);
+    if (PATH_unchecked_getLength(result_p) == 0) {
+      PATH_freePath(&result_p);
+    }
+    *path_pp = result_p;
+  }
+  DFS_getSearchStats(context_p, stats_p);
+  DFS_destroySearchContext(&context_p);
+  return status;
+}
+
+DFS_SearchContext *DFS_createSearchContext(WorldMatrix *matrix_p,
+                                           const DFS_SearchOptions *options_p) {
+  if (matrix_p == NULL) {
+    fprintf(stderr, "FATAL ERROR: WorldMatrix supplied to DFS_createSearchContext is NULL!\n");
+    exit(EXIT_FAILURE);
+  }
+  DFS_SearchContext *context_p = calloc(1, sizeof(DFS_SearchContext));
+  if (context_p == NULL) {
+    fprintf(stderr, "FATAL ERROR: Could not allocate memory for the DFS_SearchContext!\n");
+    exit(EXIT_FAILURE);
+  }
+  context_p->matrix_p = matrix_p;
+  context_p->finderThread = -1;
+  context_p->status = DFS_STATUS_NOT_FOUND;
+  context_p->options = (options_p == NULL) ? DFS_getDefaultOptions() : *options_p;
+  context_p->noOfThreads = 1;
+  if (context_p->options.isMultithreading) {
+    context_p->noOfThreads = (context_p->options.noOfThreads == 0)
+                                 ? DFS_detectNoOfThreads()
+                                 : context_p->options.noOfThreads;
+  }
+  context_p->workers_p =
+      aligned_alloc(ARENA_CACHE_LINE_SIZE, sizeof(DFS_Worker_t) * context_p->noOfThreads);
+  if (context_p->workers_p == NULL) {
+    fprintf(stderr, "FATAL ERROR: Could not allocate memory for the DFS workers!\n");
+    exit(EXIT_FAILURE);
+  }
+  for (uint16_t thrIndex = 0; thrIndex < context_p->noOfThreads; thrIndex++) {
+    DFS_internal_createWorker(&context_p->workers_p[thrIndex], matrix_p,
+                              &context_p->options);
+    context_p->workers_p[thrIndex].limits_p = &context_p->limits;
+  }
+  // Every searcher runs on the same kernel, their maps are copied from this one.
+  if (context_p->workers_p[0].kernel != NULL) {
+    context_p->kernelMap_p = calloc(context_p->workers_p[0].kernelNoOfWords, sizeof(uint64_t));
+    if (context_p->kernelMap_p == NULL) {
+      fprintf(stderr, "FATAL ERROR: Could not allocate memory for the kernel map!\n");
+      exit(EXIT_FAILURE);
+    }
+    for (uint16_t thrIndex = 0; thrIndex < context_p->noOfThreads; thrIndex++) {
+      context_p->workers_p[thrIndex].kernelMap_p = context_p->kernelMap_p;
+    }
+  }
+  // Every cell may be unblocked by a later search, so both hold the whole matrix.
+  if (context_p->options.useComponentPruning) {
+    context_p->componentMap_p = CONNECTIVITY_createComponentMap(matrix_p);
+  }
+  context_p->scheduler_p = SCHEDULER_createEmptyScheduler(
+      (uint32_t)MATRIXWORLD_unchecked_getRowSize(matrix_p) *
+      MATRIXWORLD_unchecked_getColSize(matrix_p));
+  context_p->noOfStripes = context_p->noOfThreads;
+  if (context_p->noOfStripes > MATRIXWORLD_unchecked_getRowSize(matrix_p)) {
+    context_p->noOfStripes = MATRIXWORLD_unchecked_getRowSize(matrix_p);
+  }
+  if (!context_p->options.isMultithreading) {
+    return context_p;
+  }
+
+  context_p->threads_p = calloc(context_p->noOfThreads, sizeof(pthread_t));
+  pthread_attr_t *threadAttrs = calloc(context_p->noOfThreads, sizeof(pthread_attr_t));
+  context_p->threadArgs_p = calloc(context_p->noOfThreads, sizeof(DFS_ThreadArgs_t));
+  if (context_p->threads_p == NULL || threadAttrs == NULL || context_p->threadArgs_p == NULL) {
+    fprintf(stderr, "FATAL ERROR: Could not allocate memory for the DFS threads!\n");
+    exit(EXIT_FAILURE);
+  }
+  pthread_mutex_init(&context_p->pool_mutex, NULL);
+  pthread_mutex_init(&context_p->completion_mutex, NULL);
+  pthread_cond_init(&context_p->work_ready_cond, NULL);
+  pthread_cond_init(&context_p->work_done_cond, NULL);
+  atomic_init(&context_p->path_is_found, false);
+  for (uint16_t thrIndex = 0; thrIndex < context_p->noOfThreads; thrIndex++) {
+    pthread_attr_init(&threadAttrs[thrIndex]);
+    context_p->workers_p[thrIndex].path_is_found_p = &context_p->path_is_found;
+  }
+  if (context_p->options.pinThreads) {
+    DFS_internal_pinThreads(threadAttrs, context_p->noOfThreads);
+  }
+  for (uint16_t thrIndex = 0; thrIndex < context_p->noOfThreads; thrIndex++) {
+    context_p->threadArgs_p[thrIndex] =
+        (DFS_ThreadArgs_t){.thread_id = thrIndex, .context_p = context_p};
+    if (pthread_create(&context_p->threads_p[thrIndex], &threadAttrs[thrIndex],
+                       DFS_findPathThreaded, &context_p->threadArgs_p[thrIndex]) != 0) {
+      fprintf(stderr, "FATAL ERROR: Could not create DFS thread %u!\n", thrIndex);
+      exit(EXIT_FAILURE);
+    }
+    pthread_attr_destroy(&threadAttrs[thrIndex]);
+  }
+  free(threadAttrs);
+  return context_p;
+}
+
+void DFS_destroySearchContext(DFS_SearchContext **const context_pp) {
+  if (context_pp == NULL || *context_pp == NULL) {
+    return;
+  }
+  DFS_SearchContext *context_p = *context_pp;
+  if (context_p->threads_p != NULL) {
+    pthread_mutex_lock(&context_p->pool_mutex);
+    context_p->isShuttingDown = true;
+    pthread_cond_broadcast(&context_p->work_ready_cond);
+    pthread_mutex_unlock(&context_p->pool_mutex);
+    for (uint16_t thrIndex = 0; thrIndex < context_p->noOfThreads; thrIndex++) {
+      pthread_join(context_p->threads_p[thrIndex], NULL);
+    }
+    pthread_cond_destroy(&context_p->work_ready_cond);
+    pthread_cond_destroy(&context_p->work_done_cond);
+    pthread_mutex_destroy(&context_p->completion_mutex);
+    pthread_mutex_destroy(&context_p->pool_mutex);
+    free(context_p->threads_p);
+    free(context_p->threadArgs_p);
+  }
+  for (uint16_t thrIndex = 0; thrIndex < context_p->noOfThreads; thrIndex++) {
+    DFS_internal_destroyWorker(&context_p->workers_p[thrIndex]);
+  }
+  CONNECTIVITY_freeComponentMap(&context_p->componentMap_p);
+  SCHEDULER_destroyScheduler(&context_p->scheduler_p);
+  free(context_p->kernelMap_p);
+  free(context_p->workers_p);
+  free(context_p);
+  *context_pp = NULL;
+}
+
+Path *DFS_searchWithContext(DFS_SearchContext *const context_p, uint32_t pathLength) {
+  if (context_p == NULL) {
+    fprintf(stderr, "FATAL ERROR: DFS_SearchContext supplied to DFS_searchWithContext "
+                    "is NULL!\n");
+    exit(EXIT_FAILURE);
+  }
+  if (pathLength > MATRIXWORLD_unchecked_getNoOfUnblockedCells(context_p->matrix_p)) {
+    // Not enough free cells for such a path, no need to search.
+    DFS_internal_resetCounters(context_p);
+    return NULL;
+  }
+  // The path to be built and returned.
+  Path *result_p = PATH_initializePath(pathLength, context_p->matrix_p);
+  if (!DFS_searchIntoPath(context_p, pathLength, result_p)) {
+    PATH_freePath(&result_p);
+    return NULL;
+  }
+  return result_p;
+}
+
+bool DFS_searchIntoPath(DFS_SearchContext *const context_p, uint32_t pathLength,
+                        Path *const result_p) {
+  if (DFS_searchBounded(context_p, pathLength, result_p) == DFS_STATUS_FOUND) {
+    return true;
+  }
+  // A partial path is no answer here.
+  PATH_clearPath(result_p);
+  return false;
+}
+
+DFS_SearchStatus DFS_searchBounded(DFS_SearchContext *const context_p, uint32_t pathLength,
+                                   Path *const result_p) {
+  if (context_p == NULL || result_p == NULL) {
+    fprintf(stderr, "FATAL ERROR: DFS_searchBounded needs a DFS_SearchContext and "
+                    "a result Path!\n");
+    exit(EXIT_FAILURE);
+  }
+  if (pathLength == 0 || result_p->pathSize < pathLength) {
+    fprintf(stderr, "FATAL ERROR: The result Path holds %zu cells, a path of %u cells "
+                    "was requested!\n",
+            result_p->pathSize, pathLength);
+    exit(EXIT_FAILURE);
+  }
+  WorldMatrix *matrix_p = context_p->matrix_p;
+  const DFS_SearchOptions *options_p = &context_p->options;
+  PATH_clearPath(result_p);
+  DFS_internal_resetCounters(context_p);
+  if (!DFS_internal_isSupported(context_p)) {
+    context_p->status = DFS_STATUS_UNSUPPORTED;
+    return DFS_STATUS_UNSUPPORTED;
+  }
+  if (pathLength > MATRIXWORLD_unchecked_getNoOfUnblockedCells(matrix_p)) {
+    // Not enough free cells for such a path, no need to search.
+    return DFS_STATUS_NOT_FOUND;
+  }
+  // The deadline covers the whole query, the labelling included.
+  DFS_SearchLimits_t *limits_p = &context_p->limits;
+  const bool hasLimits = DFS_internal_armLimits(context_p);
+
+  // Empty and sparse matrices mostly need no search at all.
+  // The builder is a heuristic, a path it returns is checked before it is
+  // trusted and the search runs as if there were none when it fails.
+  if (options_p->useConstruction &&
+      SNAKE_buildPath(matrix_p, pathLength, context_p->workers_p[0].visited_p, result_p) &&
+      DFS_internal_isValidConstruction(context_p, pathLength, result_p)) {
+    // Reported as a single attempt that added every cell once.
+    context_p->workers_p[0].stats.startsAttempted = 1;
+    context_p->workers_p[0].stats.nodesExpanded = pathLength;
+    DFS_STATS_DEPTH(&context_p->workers_p[0].stats, pathLength);
+    context_p->finderThread = 0;
+    context_p->status = DFS_STATUS_FOUND;
+    return DFS_STATUS_FOUND;
+  }
+  PATH_clearPath(result_p);
+
+  // Label the components once, so undersized ones are never searched.
+  const ComponentMap *componentMap_p = NULL;
+  if (options_p->useComponentPruning && options_p->neighborhood == DFS_NEIGHBORHOOD_FOUR &&
+      !MATRIXWORLD_matrixIsEmpty(matrix_p)) {
+    DFS_internal_labelComponents(context_p);
+    if (CONNECTIVITY_getLargestComponentSize(context_p->componentMap_p) < pathLength) {
+      return DFS_STATUS_NOT_FOUND;
+    }
+    componentMap_p = context_p->componentMap_p;
+  }
+  DFS_internal_buildKernelMap(context_p);
+  // Every eligible starting point is handed out exactly once.
+  SCHEDULER_refillScheduler(context_p->scheduler_p, matrix_p, componentMap_p, pathLength,
+                            options_p->startOrder, options_p->seed);
+
+  bool isFound = false;
+  if (context_p->threads_p != NULL) {
+    // Every thread gets its own stream, derived from the seed in thread order.
+    RandomGenerator seedGenerator;
+    UTILITY_seedGenerator(&seedGenerator, options_p->seed);
+    uint16_t noOfClaimingWorkers = 0;
+    for (uint16_t thrIndex = 0; thrIndex < context_p->noOfThreads; thrIndex++) {
+      DFS_Worker_t *worker_p = &context_p->workers_p[thrIndex];
+      DFS_internal_prepareWorker(worker_p, pathLength);
+      DFS_internal_assignStrategy(worker_p, thrIndex, options_p);
+      worker_p->generator.state = UTILITY_nextRandom(&seedGenerator);
+      noOfClaimingWorkers += worker_p->isRestarting ? 0U : 1U;
+    }
+    atomic_store_explicit(&context_p->noOfClaimingWorkers, noOfClaimingWorkers,
+                          memory_order_relaxed);
+    context_p->final_path_p = result_p;
+    atomic_store_explicit(&context_p->path_is_found, false, memory_order_relaxed);
+    DFS_internal_runPoolJob(context_p, DFS_JOB_SEARCH);
+    context_p->final_path_p = NULL;
+    isFound = atomic_load_explicit(&context_p->path_is_found, memory_order_acquire);
+  } else {
+    DFS_Worker_t *worker_p = &context_p->workers_p[0];
+    DFS_internal_prepareWorker(worker_p, pathLength);
+    UTILITY_seedGenerator(&worker_p->generator, options_p->seed);
+    isFound = DFS_internal_findPathSingleThread(worker_p, context_p->scheduler_p);
+    if (isFound) {
+      DFS_internal_copyPath(result_p, worker_p->path_p);
+      context_p->finderThread = 0;
+    }
+  }
+  if (isFound) {
+    context_p->status = DFS_STATUS_FOUND;
+    return DFS_STATUS_FOUND;
+  }
+  context_p->status = (DFS_SearchStatus)atomic_load_explicit(&limits_p->status, memory_order_relaxed);
+  if (hasLimits && context_p->status != DFS_STATUS_NOT_FOUND) {
+    // Hand out the longest partial path of all searchers.
+    const Path *best_p = NULL;
+    for (uint16_t thrIndex = 0; thrIndex < context_p->noOfThreads; thrIndex++) {
+      const Path *candidate_p = context_p->workers_p[thrIndex].best_p;
+      if (best_p == NULL || PATH_unchecked_getLength(candidate_p) > PATH_unchecked_getLength(best_p)) {
+        best_p = candidate_p;
+      }
+    }
+    DFS_internal_copyPath(result_p, best_p);
+  }
+  return context_p->status;
+}
+
+DFS_SearchStatus DFS_extendBounded(DFS_SearchContext *const context_p, const Path *const prefix_p,
+                                   uint32_t pathLength, Path *const result_p) {
+  if (context_p == NULL || prefix_p == NULL || result_p == NULL ||
+      PATH_unchecked_getLength(prefix_p) == 0) {
+    fprintf(stderr, "FATAL ERROR: DFS_extendBounded needs a DFS_SearchContext, a "
+                    "non-empty prefix and a result Path!\n");
+    exit(EXIT_FAILURE);
+  }
+  if (pathLength == 0 || result_p->pathSize < pathLength) {
+    fprintf(stderr, "FATAL ERROR: The result Path holds %zu cells, a path of %u cells "
+                    "was requested!\n",
+            result_p->pathSize, pathLength);
+    exit(EXIT_FAILURE);
+  }
+  const DFS_SearchOptions *options_p = &context_p->options;
+  DFS_Worker_t *worker_p = &context_p->workers_p[0];
+  PATH_clearPath(result_p);
+  DFS_internal_resetCounters(context_p);
+  if (!DFS_internal_isSupported(context_p)) {
+    context_p->status = DFS_STATUS_UNSUPPORTED;
+    return DFS_STATUS_UNSUPPORTED;
+  }
+  const uint32_t prefixLength = (uint32_t)PATH_unchecked_getLength(prefix_p);
+  if (pathLength > MATRIXWORLD_unchecked_getNoOfUnblockedCells(context_p->matrix_p) ||
+      !DFS_internal_markPrefix(worker_p, prefix_p)) {
+    return DFS_STATUS_NOT_FOUND;
+  }
+  if (prefixLength >= pathLength) {
+    // A prefix of a path is a path, it only needs to be cut.
+    memcpy(result_p->pathArray, prefix_p->pathArray, sizeof(Cords) * pathLength);
+    result_p->currentNoOfCordsInPath = pathLength;
+    context_p->finderThread = 0;
+    context_p->status = DFS_STATUS_FOUND;
+    return DFS_STATUS_FOUND;
+  }
+  const bool hasLimits = DFS_internal_armLimits(context_p);
+
+  // A single searcher grows the last cell of the prefix, every other cell of
+  // it stays marked. The searcher only builds the remaining cells.
+  const uint32_t sharedLength = prefixLength - 1;
+  DFS_internal_prepareWorker(worker_p, pathLength - sharedLength);
+  // The bidirectional engine would grow in front of the last cell as well.
+  if (worker_p->engine == DFS_ENGINE_BIDIRECTIONAL) {
+    worker_p->engine = DFS_ENGINE_ITERATIVE;
+  }
+  if (DFS_internal_usesKernel(worker_p)) {
+    DFS_internal_buildKernelMap(context_p);
+    DFS_internal_loadKernelMap(worker_p, prefix_p);
+  }
+  UTILITY_seedGenerator(&worker_p->generator, options_p->seed);
+  const bool isFound = DFS_internal_searchFromMarked(
+      worker_p, PATH_unchecked_getLastCoordinates(prefix_p),
+      (uint32_t)UTILITY_nextRandom(&worker_p->generator));
+  context_p->status =
+      isFound ? DFS_STATUS_FOUND
+              : (DFS_SearchStatus)atomic_load_explicit(&context_p->limits.status,
+                                                       memory_order_relaxed);
+  const Path *grown_p = isFound ? worker_p->path_p : NULL;
+  if (!isFound && hasLimits && context_p->status != DFS_STATUS_NOT_FOUND) {
+    grown_p = worker_p->best_p;
+  }
+  if (grown_p != NULL) {
+    memcpy(result_p->pathArray, prefix_p->pathArray, sizeof(Cords) * sharedLength);
+    memcpy(&result_p->pathArray[sharedLength], grown_p->pathArray,
+           sizeof(Cords) * PATH_unchecked_getLength(grown_p));
+    result_p->currentNoOfCordsInPath = sharedLength + PATH_unchecked_getLength(grown_p);
+  }
+  if (isFound) {
+    context_p->finderThread = 0;
+  }
+  return context_p->status;
+}
+
+void DFS_beginQuery(DFS_SearchContext *const context_p) {
+  if (context_p == NULL) {
+    fprintf(stderr, "FATAL ERROR: DFS_beginQuery needs a DFS_SearchContext!\n");
+    exit(EXIT_FAILURE);
+  }
+  context_p->isQueryArmed = false;
+  DFS_internal_resetCounters(context_p);
+  UNUSED(DFS_internal_armLimits(context_p));
+  context_p->isQueryArmed = true;
+}
+
+void DFS_endQuery(DFS_SearchContext *const context_p) {
+  if (context_p == NULL) {
+    fprintf(stderr, "FATAL ERROR: DFS_endQuery needs a DFS_SearchContext!\n");
+    exit(EXIT_FAILURE);
+  }
+  context_p->isQueryArmed = false;
+}
+
+void DFS_setSearchContextMatrix(DFS_SearchContext *const context_p, WorldMatrix *matrix_p) {
+  if (context_p == NULL || matrix_p == NULL) {
+    fprintf(stderr, "FATAL ERROR: DFS_setSearchContextMatrix needs a DFS_SearchContext "
+                    "and a WorldMatrix!\n");
+    exit(EXIT_FAILURE);
+  }
+  const WorldMatrix *boundMatrix_p = context_p->matrix_p;
+  if (MATRIXWORLD_unchecked_getRowSize(matrix_p) != MATRIXWORLD_unchecked_getRowSize(boundMatrix_p) ||
+      MATRIXWORLD_unchecked_getColSize(matrix_p) != MATRIXWORLD_unchecked_getColSize(boundMatrix_p)) {
+    fprintf(stderr, "FATAL ERROR: A %ux%u WorldMatrix can not be bound to the context of a "
+                    "%ux%u one!\n",
+            MATRIXWORLD_unchecked_getRowSize(matrix_p), MATRIXWORLD_unchecked_getColSize(matrix_p),
+            MATRIXWORLD_unchecked_getRowSize(boundMatrix_p),
+            MATRIXWORLD_unchecked_getColSize(boundMatrix_p));
+    exit(EXIT_FAILURE);
+  }
+  // The pool is parked between searches, the workers pick the matrix up on the next one.
+  context_p->matrix_p = matrix_p;
+  for (uint16_t thrIndex = 0; thrIndex < context_p->noOfThreads; thrIndex++) {
+    context_p->workers_p[thrIndex].matrix_p = matrix_p;
+  }
+}
+
+const DFS_SearchOptions *DFS_getSearchContextOptions(const DFS_SearchContext *const context_p) {
+  if (context_p == NULL) {
+    fprintf(stderr, "FATAL ERROR: DFS_SearchContext supplied to DFS_getSearchContextOptions "
+                    "is NULL!\n");
+    exit(EXIT_FAILURE);
+  }
+  return &context_p->options;
+}
+
+void DFS_getSearchReport(const DFS_SearchContext *const context_p, DFS_SearchReport *report_p) {
+  if (context_p == NULL || report_p == NULL) {
+    fprintf(stderr, "FATAL ERROR: DFS_getSearchReport needs a DFS_SearchContext and a "
+                    "report!\n");
+    exit(EXIT_FAILURE);
+  }
+  // The pool is parked, the counters of the last search are settled.
+  *report_p = (DFS_SearchReport){0};
+  for (uint16_t thrIndex = 0; thrIndex < context_p->noOfThreads; thrIndex++) {
+    report_p->nodesExpanded += context_p->workers_p[thrIndex].stats.nodesExpanded;
+    report_p->startsAttempted += context_p->workers_p[thrIndex].stats.startsAttempted;
+  }
+  report_p->status = context_p->status;
+}
+
+void DFS_getSearchStats(const DFS_SearchContext *const context_p, DFS_SearchStats *stats_p) {
+  if (context_p == NULL || stats_p == NULL) {
+    fprintf(stderr, "FATAL ERROR: DFS_getSearchStats needs a DFS_SearchContext and "
+                    "statistics!\n");
+    exit(EXIT_FAILURE);
+  }
+#ifdef DFS_ENABLE_STATS
+  stats_p->isDetailed = true;
+#else
+  stats_p->isDetailed = false;
+#endif
+  stats_p->finderThread = context_p->finderThread;
+  stats_p->status = context_p->status;
+  stats_p->noOfThreads = context_p->noOfThreads;
+  stats_p->threads_p = malloc(sizeof(DFS_ThreadStats) * context_p->noOfThreads);
+  if (stats_p->threads_p == NULL) {
+    fprintf(stderr, "FATAL ERROR: Could not allocate memory for the search statistics!\n");
+    exit(EXIT_FAILURE);
+  }
+  for (uint16_t thrIndex = 0; thrIndex < context_p->noOfThreads; thrIndex++) {
+    stats_p->threads_p[thrIndex] = context_p->workers_p[thrIndex].stats;
+  }
+}
+
+void DFS_freeSearchStats(DFS_SearchStats *stats_p) {
+  if (stats_p == NULL) {
+    return;
+  }
+  free(stats_p->threads_p);
+  stats_p->threads_p = NULL;
+  stats_p->noOfThreads = 0;
+}
+
+/* > Local Function Definitions **********************************************/
+
+static bool DFS_internal_backtracking(DFS_Worker_t *const worker_p) {
+  const WorldMatrix *matrix_p = worker_p->matrix_p;
+  Path *path_p = worker_p->path_p;
+  VisitedSet *visited_p = worker_p->visited_p;
+  DFS_ThreadStats *stats_p = &worker_p->stats;
+  // Base case: If the path has reached the desired length, we are done.
+  if (PATH_unchecked_getLength(path_p) == worker_p->pathLength) {
+    return true;
+  }
+  if (worker_p->path_is_found_p != NULL &&
+      atomic_load_explicit(worker_p->path_is_found_p, memory_order_acquire)) {
+    return false;
+  }
+
+  Cords currentPosition = PATH_unchecked_getLastCoordinates(path_p);
+  uint16_t noOfRows = MATRIXWORLD_unchecked_getRowSize(matrix_p);
+  uint16_t noOfCols = MATRIXWORLD_unchecked_getColSize(matrix_p);
+
+  // Explore neighbors in all four directions.
+  for (uint8_t index = 0; index < FOUR_DIRECTIONS; index++) {
+    // Use signed integers for temporary calculation to detect underflow.
+    int16_t tempNewRow = (currentPosition.row + directions[index].row);
+    int16_t tempNewCol = currentPosition.col + directions[index].col;
+
+    // Safely convert back to unsigned, handling potential negative values.
+    uint16_t newRow = (tempNewRow >= 0) ? tempNewRow : UINT16_MAX;
     uint16_t newCol = (tempNewCol >= 0) ? tempNewCol : UINT16_MAX;
-    Cords newPoint = {.row = newRow, .col = newCol};
 
     // Check if the new point is a valid move.
-    if (newRow < MATRIXWORLD_getColSize(matrix_p) &&
-        newCol < MATRIXWORLD_getRowSize(matrix_p) &&
-        !MATRIXWORLD_isBlocked(matrix_p, newRow, newCol) &&
-        !STPOINT_containsPoint(visited_p, newPoint)) {
+    if (newRow < noOfRows && newCol < noOfCols &&
+        !MATRIXWORLD_unchecked_isBlocked(matrix_p, newRow, newCol) &&
+        !VISITED_unchecked_isMarked(visited_p, newRow, newCol)) {
       // Mark the new point as visited and add it to the current path.
-      STPOINT_addPoint(visited_p, newPoint);
-      PATH_addCoordinates(path_p, newRow, newCol);
+      VISITED_unchecked_markCell(visited_p, newRow, newCol);
+      PATH_unchecked_addCoordinates(path_p, newRow, newCol);
+      stats_p->nodesExpanded++;
+      DFS_STATS_DEPTH(stats_p, (uint32_t)PATH_unchecked_getLength(path_p));
+      if (DFS_internal_isOverLimit(worker_p) ||
+          stats_p->nodesExpanded >= worker_p->attemptEnd) {
+        DFS_internal_recordBest(worker_p, (uint32_t)PATH_unchecked_getLength(path_p));
+        return false;
+      }
 
       // Recursively explore from the new point.
-      if (DFS_internal_backtracking(matrix_p, path_p, visited_p,
-                                    path_is_found_p, pathLength)) {
+      if (DFS_internal_backtracking(worker_p)) {
         return true; // Path found, propagate success upwards.
       }
+      if (atomic_load_explicit(&worker_p->limits_p->status, memory_order_relaxed) !=
+              DFS_STATUS_NOT_FOUND ||
+          stats_p->nodesExpanded >= worker_p->attemptEnd) {
+        return false; // Stopped by a limit or cut, unwind without recording again.
+      }
 
       // Backtrack: If the recursive call failed, remove the point from the
-      // path.
-      UNUSED(PATH_popCoordinates(path_p));
+      // path, and free it for the other branches while the attempt undoes.
+      if (worker_p->best_p != NULL) {
+        DFS_internal_recordBest(worker_p, (uint32_t)PATH_unchecked_getLength(path_p));
+      }
+      UNUSED(PATH_unchecked_popCoordinates(path_p));
+      if (DFS_internal_isUndoing(worker_p)) {
+        VISITED_unchecked_unmarkCell(visited_p, newRow, newCol);
+      }
+      DFS_STATS_BACKTRACK(stats_p);
     }
   }
 
@@ -213,124 +1521,1217 @@ static bool DFS_internal_backtracking(const WorldMatrix *const matrix_p,
   return false;
 }
 
-static void *DFS_findPathThreaded(void *threadParams) {
-  DFS_ThreadArgs_t *thisThreadArgs_p = (DFS_ThreadArgs_t *)threadParams;
-  uint32_t noOfUnblockedElements =
-      MATRIXWORLD_getNoOfUnblockedCells(thisThreadArgs_p->matrix_p);
-  uint16_t noOfCols = MATRIXWORLD_getRowSize(thisThreadArgs_p->matrix_p);
-  uint16_t noOfRows = MATRIXWORLD_getColSize(thisThreadArgs_p->matrix_p);
+static bool DFS_internal_iterativeBacktracking(DFS_Worker_t *const worker_p,
+                                               uint32_t orderSalt) {
+  const WorldMatrix *matrix_p = worker_p->matrix_p;
+  VisitedSet *visited_p = worker_p->visited_p;
+  DFS_Frame_t *frames_p = worker_p->frames_p;
+  atomic_bool *path_is_found_p = worker_p->path_is_found_p;
+  const uint32_t pathLength = worker_p->pathLength;
+  const bool useReachabilityPruning = worker_p->options_p->useReachabilityPruning;
+  uint16_t noOfRows = MATRIXWORLD_unchecked_getRowSize(matrix_p);
+  uint16_t noOfCols = MATRIXWORLD_unchecked_getColSize(matrix_p);
+  Cords startingPoint = PATH_unchecked_getLastCoordinates(worker_p->path_p);
 
-  // Keep track of visited points for a single search attempt.
-  StartingPointVector *visitedPoints_p =
-      STPOINT_createVector(thisThreadArgs_p->matrix_p);
-  // The path to be built and returned.
-  Path *foundPath_p = PATH_initializePath(thisThreadArgs_p->desiredPathLength,
-                                          thisThreadArgs_p->matrix_p);
-
-  // Loop to try different random starting points.
-  for (uint32_t index = 0; index < noOfUnblockedElements; index++) {
-    // Clear vectors for the new attempt.
-    STPOINT_cleanVector(visitedPoints_p);
-    PATH_clearPath(foundPath_p);
-
-    Cords startingPoint = {.row = UTILITY_generateRandomNumber(noOfRows),
-                           .col = UTILITY_generateRandomNumber(noOfCols)};
-
-    bool isStartingPointValid = false;
-    // **** Lock the usedStartingPoints_p vector ****
-    pthread_mutex_lock(thisThreadArgs_p->used_points_mutex_p);
-    if (!STPOINT_containsPoint(thisThreadArgs_p->usedStartingPoints_p,
-                               startingPoint)) {
-      STPOINT_addPoint(thisThreadArgs_p->usedStartingPoints_p, startingPoint);
-      isStartingPointValid = true;
-    }
-    pthread_mutex_unlock(thisThreadArgs_p->used_points_mutex_p);
-    // **** Unlock the usedStartingPoints_p vector ****
-
-    // Try this starting point if it's valid and hasn't been used before.
-    if (isStartingPointValid &&
-        !MATRIXWORLD_isBlocked(thisThreadArgs_p->matrix_p, startingPoint.row,
-                               startingPoint.col)) {
-      if (*thisThreadArgs_p->path_is_found_p)
-      {
-        // Finish earlier if the path has been already found.
-        break;
-      }
-      STPOINT_addPoint(visitedPoints_p, startingPoint);
-      PATH_addCoordinates(foundPath_p, startingPoint.row, startingPoint.col);
-
-      // Start the recursive search.
-      if (DFS_internal_backtracking(thisThreadArgs_p->matrix_p, foundPath_p,
-                                    visitedPoints_p,
-                                    thisThreadArgs_p->path_is_found_p,
-                                    thisThreadArgs_p->desiredPathLength) ||
-          *thisThreadArgs_p->path_is_found_p) {
-        // On success, free the helper vectors and return the found path.
-
-        // **** Lock the completion_mutex_p vector ****
-        pthread_mutex_lock(thisThreadArgs_p->completion_mutex_p);
-        if (*thisThreadArgs_p->path_is_found_p == false) {
-          *thisThreadArgs_p->path_is_found_p = true;
-          memcpy(thisThreadArgs_p->final_path_p, foundPath_p,
-                 PATH_getByteSize(foundPath_p));
+  frames_p[0] = (DFS_Frame_t){
+      .position = startingPoint,
+      .directionOrder =
+          DFS_internal_orderDirections(worker_p, startingPoint, orderSalt),
+      .nextDirection = 0};
+  uint32_t depth = 1;
+
+  while (depth > 0) {
+    // Base case: If the path has reached the desired length, we are done.
+    if (depth == pathLength) {
+      PATH_clearPath(worker_p->path_p);
+      for (uint32_t index = 0; index < pathLength; index++) {
+        PATH_unchecked_addCoordinates(worker_p->path_p,
+                                      frames_p[index].position.row,
+                                      frames_p[index].position.col);
+      }
+      return true;
+    }
+    if (path_is_found_p != NULL &&
+        atomic_load_explicit(path_is_found_p, memory_order_acquire)) {
+      return false;
+    }
+
+    DFS_Frame_t *frame_p = &frames_p[depth - 1];
+    if (frame_p->nextDirection == FOUR_DIRECTIONS) {
+      // All neighbors have been explored, backtrack to the previous cell.
+      if (worker_p->best_p != NULL) {
+        DFS_internal_recordBest(worker_p, depth);
+      }
+      if (DFS_internal_isUndoing(worker_p)) {
+        VISITED_unchecked_unmarkCell(visited_p, frame_p->position.row, frame_p->position.col);
+      }
+      depth--;
+      DFS_STATS_BACKTRACK(&worker_p->stats);
+      continue;
+    }
+    uint8_t index = (frame_p->directionOrder >>
+                     (BITS_PER_DIRECTION * frame_p->nextDirection)) &
+                    DIRECTION_MASK;
+    frame_p->nextDirection++;
+
+    // Use signed integers for temporary calculation to detect underflow.
+    int32_t tempNewRow = frame_p->position.row + directions[index].row;
+    int32_t tempNewCol = frame_p->position.col + directions[index].col;
+    if (tempNewRow < 0 || tempNewRow >= noOfRows || tempNewCol < 0 ||
+        tempNewCol >= noOfCols) {
+      continue;
+    }
+    uint16_t newRow = (uint16_t)tempNewRow;
+    uint16_t newCol = (uint16_t)tempNewCol;
+
+    if (!MATRIXWORLD_unchecked_isBlocked(matrix_p, newRow, newCol) &&
+        !VISITED_unchecked_isMarked(visited_p, newRow, newCol)) {
+      // Mark the new point as visited and push a frame for it.
+      VISITED_unchecked_markCell(visited_p, newRow, newCol);
+      Cords newPoint = {.row = newRow, .col = newCol};
+      if (useReachabilityPruning &&
+          !DFS_internal_hasEnoughRoom(worker_p, newPoint,
+                                      pathLength - depth - 1)) {
+        // The path could never reach its length from here, prune the branch.
+        if (DFS_internal_isUndoing(worker_p)) {
+          VISITED_unchecked_unmarkCell(visited_p, newRow, newCol);
         }
-        pthread_mutex_unlock(thisThreadArgs_p->completion_mutex_p);
-        // **** Unlock the usedStartingPoints_p vector ****
-        STPOINT_destroyVector(&visitedPoints_p);
+        continue;
+      }
+      frames_p[depth] = (DFS_Frame_t){
+          .position = newPoint,
+          .directionOrder =
+              DFS_internal_orderDirections(worker_p, newPoint, orderSalt),
+          .nextDirection = 0};
+      depth++;
+      worker_p->stats.nodesExpanded++;
+      DFS_STATS_DEPTH(&worker_p->stats, depth);
+      if (DFS_internal_isOverLimit(worker_p) ||
+          worker_p->stats.nodesExpanded >= worker_p->attemptEnd) {
+        DFS_internal_recordBest(worker_p, depth);
+        return false;
       }
     }
   }
 
-  // If loop finishes and no path was found. Clean up all resources.
-  PATH_freePath(&foundPath_p);
-  STPOINT_destroyVector(&visitedPoints_p);
-  return NULL;
+  // The whole search tree of this starting point has been explored.
+  return false;
+}
+
+static bool DFS_internal_bidirectionalBacktracking(DFS_Worker_t *const worker_p,
+                                                   uint32_t orderSalt) {
+  const WorldMatrix *matrix_p = worker_p->matrix_p;
+  VisitedSet *visited_p = worker_p->visited_p;
+  PathDeque *deque_p = worker_p->deque_p;
+  DFS_EndFrame_t *frames_p = worker_p->endFrames_p;
+  atomic_bool *path_is_found_p = worker_p->path_is_found_p;
+  const uint32_t pathLength = worker_p->pathLength;
+  uint16_t noOfRows = MATRIXWORLD_unchecked_getRowSize(matrix_p);
+  uint16_t noOfCols = MATRIXWORLD_unchecked_getColSize(matrix_p);
+  Cords startingPoint = PATH_unchecked_getLastCoordinates(worker_p->path_p);
+
+  PATHDEQUE_unchecked_clearDeque(deque_p);
+  PATHDEQUE_unchecked_pushBack(deque_p, startingPoint.row, startingPoint.col);
+  // Both ends are the starting point, so the tie picks the back.
+  frames_p[0] = (DFS_EndFrame_t){.position = startingPoint, .addedAt = DFS_BACK_END};
+  DFS_internal_openEnd(worker_p, &frames_p[0], orderSalt);
+  uint32_t depth = 1;
+
+  while (depth > 0) {
+    // Base case: If the path has reached the desired length, we are done.
+    if (depth == pathLength) {
+      PATHDEQUE_copyToPath(deque_p, worker_p->path_p);
+      return true;
+    }
+    if (path_is_found_p != NULL &&
+        atomic_load_explicit(path_is_found_p, memory_order_acquire)) {
+      return false;
+    }
+
+    DFS_EndFrame_t *frame_p = &frames_p[depth - 1];
+    if (frame_p->nextDirection == FOUR_DIRECTIONS) {
+      // The grown end is used up, the other one may still lead to a path.
+      // A single cell grown at its front gives the reversed paths only.
+      frame_p->closedEnds |= (uint8_t)(1U << frame_p->growEnd);
+      if (frame_p->closedEnds != DFS_BOTH_ENDS && depth > 1) {
+        DFS_internal_openEnd(worker_p, frame_p, orderSalt);
+        continue;
+      }
+      // Both ends have been explored, remove the cell of this frame again.
+      if (worker_p->best_p != NULL) {
+        DFS_internal_recordBest(worker_p, depth);
+      }
+      if (DFS_internal_isUndoing(worker_p)) {
+        VISITED_unchecked_unmarkCell(visited_p, frame_p->position.row, frame_p->position.col);
+      }
+      if (frame_p->addedAt == DFS_FRONT_END) {
+        UNUSED(PATHDEQUE_unchecked_popFront(deque_p));
+      } else {
+        UNUSED(PATHDEQUE_unchecked_popBack(deque_p));
+      }
+      depth--;
+      DFS_STATS_BACKTRACK(&worker_p->stats);
+      continue;
+    }
+    uint8_t index = (frame_p->directionOrder >>
+                     (BITS_PER_DIRECTION * frame_p->nextDirection)) &
+                    DIRECTION_MASK;
+    frame_p->nextDirection++;
+
+    Cords end = (frame_p->growEnd == DFS_FRONT_END) ? PATHDEQUE_unchecked_getFront(deque_p)
+                                                    : PATHDEQUE_unchecked_getBack(deque_p);
+    int32_t tempNewRow = end.row + directions[index].row;
+    int32_t tempNewCol = end.col + directions[index].col;
+    if (tempNewRow < 0 || tempNewRow >= noOfRows || tempNewCol < 0 ||
+        tempNewCol >= noOfCols) {
+      continue;
+    }
+    uint16_t newRow = (uint16_t)tempNewRow;
+    uint16_t newCol = (uint16_t)tempNewCol;
+
+    if (!MATRIXWORLD_unchecked_isBlocked(matrix_p, newRow, newCol) &&
+        !VISITED_unchecked_isMarked(visited_p, newRow, newCol)) {
+      // Mark the new point as visited and add it at the grown end.
+      VISITED_unchecked_markCell(visited_p, newRow, newCol);
+      if (frame_p->growEnd == DFS_FRONT_END) {
+        PATHDEQUE_unchecked_pushFront(deque_p, newRow, newCol);
+      } else {
+        PATHDEQUE_unchecked_pushBack(deque_p, newRow, newCol);
+      }
+      frames_p[depth] = (DFS_EndFrame_t){.position = {.row = newRow, .col = newCol},
+                                         .addedAt = frame_p->growEnd,
+                                         .closedEnds = frame_p->closedEnds};
+      DFS_internal_openEnd(worker_p, &frames_p[depth], orderSalt);
+      depth++;
+      worker_p->stats.nodesExpanded++;
+      DFS_STATS_DEPTH(&worker_p->stats, depth);
+      if (DFS_internal_isOverLimit(worker_p) ||
+          worker_p->stats.nodesExpanded >= worker_p->attemptEnd) {
+        DFS_internal_recordBest(worker_p, depth);
+        return false;
+      }
+    }
+  }
+
+  // The whole search tree of this starting point has been explored.
+  return false;
 }
 
-static Path *
-DFS_internal_findPathSingleThread(const WorldMatrix *const matrix_p,
-                                  uint32_t pathLength) {
-  uint32_t noOfUnblockedElements = MATRIXWORLD_getNoOfUnblockedCells(matrix_p);
-  uint16_t noOfCols = MATRIXWORLD_getRowSize(matrix_p);
-  uint16_t noOfRows = MATRIXWORLD_getColSize(matrix_p);
+static void DFS_internal_openEnd(const DFS_Worker_t *const worker_p,
+                                 DFS_EndFrame_t *const frame_p, uint32_t orderSalt) {
+  const PathDeque *deque_p = worker_p->deque_p;
+  const Cords front = PATHDEQUE_unchecked_getFront(deque_p);
+  const Cords back = PATHDEQUE_unchecked_getBack(deque_p);
+  uint8_t growEnd = DFS_BACK_END;
+  if (frame_p->closedEnds & (1U << DFS_BACK_END)) {
+    growEnd = DFS_FRONT_END;
+  } else if (!(frame_p->closedEnds & (1U << DFS_FRONT_END)) &&
+             DFS_internal_countOnwardNeighbors(worker_p, front.row, front.col) >
+                 DFS_internal_countOnwardNeighbors(worker_p, back.row, back.col)) {
+    growEnd = DFS_FRONT_END;
+  }
+  frame_p->growEnd = growEnd;
+  frame_p->directionOrder = DFS_internal_orderDirections(
+      worker_p, (growEnd == DFS_FRONT_END) ? front : back, orderSalt);
+  frame_p->nextDirection = 0;
+}
+
+static uint8_t DFS_internal_orderDirections(const DFS_Worker_t *const worker_p,
+                                            Cords cell, uint32_t orderSalt) {
+  if (worker_p->ordering == DFS_ORDERING_FIXED) {
+    return FIXED_DIRECTION_ORDER;
+  }
+  uint8_t randomOrder = directionOrders[UTILITY_mixBits(
+      (((uint32_t)cell.row << 16) | cell.col) ^ orderSalt) %
+      NO_OF_DIRECTION_ORDERS];
+  if (worker_p->ordering == DFS_ORDERING_RANDOM) {
+    return randomOrder;
+  }
+
+  // Warnsdorff's rule: neighbors with the fewest onward moves go first, the
+  // random order breaks the ties. Blocked, visited and outside neighbors rank
+  // last, they are rejected when expanded anyway.
+  const uint8_t unreachableRank = FOUR_DIRECTIONS + 1;
+  uint8_t neighborMask = MATRIXWORLD_unchecked_getUnblockedNeighborMask(
+      worker_p->matrix_p, cell.row, cell.col);
+  uint8_t slots[FOUR_DIRECTIONS];
+  uint8_t ranks[FOUR_DIRECTIONS];
+  for (uint8_t slot = 0; slot < FOUR_DIRECTIONS; slot++) {
+    uint8_t index = (randomOrder >> (BITS_PER_DIRECTION * slot)) & DIRECTION_MASK;
+    uint8_t rank = unreachableRank;
+    if (neighborMask & (1U << index)) {
+      uint16_t row = (uint16_t)(cell.row + directions[index].row);
+      uint16_t col = (uint16_t)(cell.col + directions[index].col);
+      if (!VISITED_unchecked_isMarked(worker_p->visited_p, row, col)) {
+        rank = DFS_internal_countOnwardNeighbors(worker_p, row, col);
+      }
+    }
+    // Stable insertion sort, so equal ranks keep their random order.
+    uint8_t position = slot;
+    while (position > 0 && ranks[position - 1] > rank) {
+      ranks[position] = ranks[position - 1];
+      slots[position] = slots[position - 1];
+      position--;
+    }
+    ranks[position] = rank;
+    slots[position] = index;
+  }
+
+  uint8_t order = 0;
+  for (uint8_t slot = 0; slot < FOUR_DIRECTIONS; slot++) {
+    order |= (uint8_t)(slots[slot] << (BITS_PER_DIRECTION * slot));
+  }
+  return order;
+}
+
+static uint8_t DFS_internal_countOnwardNeighbors(const DFS_Worker_t *const worker_p,
+                                                 uint16_t row, uint16_t col) {
+  uint8_t neighborMask =
+      MATRIXWORLD_unchecked_getUnblockedNeighborMask(worker_p->matrix_p, row, col);
+  uint8_t noOfOnwardNeighbors = 0;
+  for (uint8_t index = 0; index < FOUR_DIRECTIONS; index++) {
+    if ((neighborMask & (1U << index)) &&
+        !VISITED_unchecked_isMarked(worker_p->visited_p,
+                                    (uint16_t)(row + directions[index].row),
+                                    (uint16_t)(col + directions[index].col))) {
+      noOfOnwardNeighbors++;
+    }
+  }
+  return noOfOnwardNeighbors;
+}
+
+static bool DFS_internal_hasEnoughRoom(DFS_Worker_t *const worker_p, Cords head,
+                                       uint32_t required) {
+  if (required == 0) {
+    return true;
+  }
+  const WorldMatrix *matrix_p = worker_p->matrix_p;
+  const VisitedSet *visited_p = worker_p->visited_p;
+  DFS_ReachScratch_t *reach_p = &worker_p->reach;
+  uint16_t noOfRows = MATRIXWORLD_unchecked_getRowSize(matrix_p);
+  uint16_t noOfCols = MATRIXWORLD_unchecked_getColSize(matrix_p);
+
+  if (reach_p->currentStamp == UINT32_MAX) {
+    memset(reach_p->stamps_p, 0, sizeof(uint32_t) * (size_t)noOfRows * noOfCols);
+    reach_p->currentStamp = 0;
+  }
+  uint32_t stamp = ++reach_p->currentStamp;
+
+  // The head is visited already, the fill starts from its free neighbors.
+  uint32_t queueHead = 0;
+  uint32_t queueTail = 0;
+  reach_p->queue_p[queueTail++] = ((uint32_t)head.row * noOfCols) + head.col;
+  reach_p->stamps_p[reach_p->queue_p[0]] = stamp;
+  uint32_t noOfReached = 0;
+
+  while (queueHead < queueTail) {
+    uint32_t cellIndex = reach_p->queue_p[queueHead++];
+    uint16_t row = (uint16_t)(cellIndex / noOfCols);
+    uint16_t col = (uint16_t)(cellIndex % noOfCols);
+    for (uint8_t index = 0; index < FOUR_DIRECTIONS; index++) {
+      int32_t newRow = row + directions[index].row;
+      int32_t newCol = col + directions[index].col;
+      if (newRow < 0 || newRow >= noOfRows || newCol < 0 || newCol >= noOfCols) {
+        continue;
+      }
+      uint32_t newIndex = ((uint32_t)newRow * noOfCols) + (uint32_t)newCol;
+      if (reach_p->stamps_p[newIndex] == stamp ||
+          MATRIXWORLD_unchecked_isBlocked(matrix_p, (uint16_t)newRow, (uint16_t)newCol) ||
+          VISITED_unchecked_isMarked(visited_p, (uint16_t)newRow, (uint16_t)newCol)) {
+        continue;
+      }
+      if (++noOfReached >= required) {
+        return true;
+      }
+      reach_p->stamps_p[newIndex] = stamp;
+      reach_p->queue_p[queueTail++] = newIndex;
+    }
+  }
+  return false;
+}
+
+// The kernels are the same loop with the neighborhood and the stride fixed
+// at compile time, DFS_internal_selectKernel picks one per matrix.
+#define DFS_DEFINE_KERNEL(name, noOfDirections, isNarrow)                      \
+  static bool name(DFS_Worker_t *const worker_p, uint32_t orderSalt) {         \
+    return DFS_internal_runKernel(worker_p, orderSalt, (noOfDirections), (isNarrow)); \
+  }
+
+DFS_DEFINE_KERNEL(DFS_internal_kernelFourNarrow, FOUR_DIRECTIONS, true)
+DFS_DEFINE_KERNEL(DFS_internal_kernelFourWide, FOUR_DIRECTIONS, false)
+DFS_DEFINE_KERNEL(DFS_internal_kernelEightNarrow, DFS_MAX_NO_OF_DIRECTIONS, true)
+DFS_DEFINE_KERNEL(DFS_internal_kernelEightWide, DFS_MAX_NO_OF_DIRECTIONS, false)
+
+[[gnu::always_inline]] static inline bool DFS_internal_runKernel(DFS_Worker_t *const worker_p,
+                                                                 uint32_t orderSalt,
+                                                                 uint8_t noOfDirections,
+                                                                 bool isNarrow) {
+  uint64_t *open_p = worker_p->open_p;
+  DFS_KernelFrame_t *frames_p = worker_p->kernelFrames_p;
+  atomic_bool *path_is_found_p = worker_p->path_is_found_p;
+  const uint32_t pathLength = worker_p->pathLength;
+  const bool useReachabilityPruning = worker_p->options_p->useReachabilityPruning;
+  const uint32_t stride = isNarrow ? DFS_KERNEL_WORD_BITS : worker_p->kernelStride;
+  int32_t offsets[DFS_MAX_NO_OF_DIRECTIONS];
+  for (uint8_t index = 0; index < noOfDirections; index++) {
+    offsets[index] = (kernelDirections[index].row * (int32_t)stride) + kernelDirections[index].col;
+  }
+  Cords startingPoint = PATH_unchecked_getLastCoordinates(worker_p->path_p);
+  const uint32_t startCell = ((uint32_t)(startingPoint.row + 1U) * stride) + startingPoint.col + 1U;
+
+  open_p[startCell / DFS_KERNEL_WORD_BITS] &= ~(UINT64_C(1) << (startCell % DFS_KERNEL_WORD_BITS));
+  frames_p[0] = (DFS_KernelFrame_t){.position = startingPoint, .cell = startCell};
+  frames_p[0].directionOrder = DFS_internal_orderKernelDirections(
+      worker_p, &frames_p[0], orderSalt, offsets, noOfDirections, isNarrow);
+  uint32_t depth = 1;
+
+  while (depth > 0) {
+    // Base case: If the path has reached the desired length, we are done.
+    if (depth == pathLength) {
+      PATH_clearPath(worker_p->path_p);
+      for (uint32_t index = 0; index < pathLength; index++) {
+        PATH_unchecked_addCoordinates(worker_p->path_p, frames_p[index].position.row,
+                                      frames_p[index].position.col);
+      }
+      return true;
+    }
+    if (path_is_found_p != NULL &&
+        atomic_load_explicit(path_is_found_p, memory_order_acquire)) {
+      return false;
+    }
+
+    DFS_KernelFrame_t *frame_p = &frames_p[depth - 1];
+    if (frame_p->nextDirection == noOfDirections) {
+      // All neighbors have been explored, backtrack to the previous cell.
+      if (worker_p->best_p != NULL) {
+        DFS_internal_recordBest(worker_p, depth);
+      }
+      if (DFS_internal_isUndoing(worker_p)) {
+        open_p[frame_p->cell / DFS_KERNEL_WORD_BITS] |= UINT64_C(1)
+                                                         << (frame_p->cell % DFS_KERNEL_WORD_BITS);
+      }
+      depth--;
+      DFS_STATS_BACKTRACK(&worker_p->stats);
+      continue;
+    }
+    const uint8_t index = (frame_p->directionOrder >>
+                           (DFS_KERNEL_BITS_PER_DIRECTION(noOfDirections) *
+                            frame_p->nextDirection)) &
+                          DFS_KERNEL_DIRECTION_MASK(noOfDirections);
+    frame_p->nextDirection++;
+
+    // The border is closed, so a neighbor is always a bit of the map.
+    const uint32_t newCell = frame_p->cell + (uint32_t)offsets[index];
+    uint64_t *word_p = &open_p[newCell / DFS_KERNEL_WORD_BITS];
+    const uint64_t bit = UINT64_C(1) << (newCell % DFS_KERNEL_WORD_BITS);
+    if (!(*word_p & bit)) {
+      continue;
+    }
+    // Close the new point and push a frame for it.
+    *word_p &= ~bit;
+    if (useReachabilityPruning &&
+        !DFS_internal_kernelHasEnoughRoom(worker_p, newCell, pathLength - depth - 1, offsets,
+                                          noOfDirections, isNarrow)) {
+      // The path could never reach its length from here, prune the branch.
+      if (DFS_internal_isUndoing(worker_p)) {
+        *word_p |= bit;
+      }
+      continue;
+    }
+    DFS_KernelFrame_t *newFrame_p = &frames_p[depth];
+    *newFrame_p = (DFS_KernelFrame_t){
+        .position = {.row = (uint16_t)(frame_p->position.row + kernelDirections[index].row),
+                     .col = (uint16_t)(frame_p->position.col + kernelDirections[index].col)},
+        .cell = newCell};
+    newFrame_p->directionOrder = DFS_internal_orderKernelDirections(
+        worker_p, newFrame_p, orderSalt, offsets, noOfDirections, isNarrow);
+    depth++;
+    worker_p->stats.nodesExpanded++;
+    DFS_STATS_DEPTH(&worker_p->stats, depth);
+    if (DFS_internal_isOverLimit(worker_p) ||
+        worker_p->stats.nodesExpanded >= worker_p->attemptEnd) {
+      DFS_internal_recordBest(worker_p, depth);
+      return false;
+    }
+  }
+
+  // The whole search tree of this starting point has been explored.
+  return false;
+}
+
+[[gnu::always_inline]] static inline uint32_t DFS_internal_getOpenNeighborMask(
+    const uint64_t *const open_p, uint32_t cell, const int32_t *const offsets_p,
+    uint8_t noOfDirections, bool isNarrow) {
+  uint32_t mask = 0;
+  if (isNarrow) {
+    // The three rows around the cell, bits 0, 1 and 2 of a window are its
+    // left, own and right column. The border keeps col - 1 and col + 1 in the word.
+    const uint32_t row = cell / DFS_KERNEL_WORD_BITS;
+    const uint32_t shift = (cell % DFS_KERNEL_WORD_BITS) - 1U;
+    const uint64_t above = open_p[row - 1U] >> shift;
+    const uint64_t here = open_p[row] >> shift;
+    const uint64_t below = open_p[row + 1U] >> shift;
+    mask = (uint32_t)(((here >> 2) & 1U) | ((here & 1U) << 1) | (((below >> 1) & 1U) << 2) |
+                      (((above >> 1) & 1U) << 3));
+    if (noOfDirections == DFS_MAX_NO_OF_DIRECTIONS) {
+      mask |= (uint32_t)((((below >> 2) & 1U) << 4) | ((below & 1U) << 5) |
+                         (((above >> 2) & 1U) << 6) | ((above & 1U) << 7));
+    }
+    return mask;
+  }
+  for (uint8_t index = 0; index < noOfDirections; index++) {
+    const uint32_t neighbor = cell + (uint32_t)offsets_p[index];
+    mask |= (uint32_t)((open_p[neighbor / DFS_KERNEL_WORD_BITS] >>
+                        (neighbor % DFS_KERNEL_WORD_BITS)) &
+                       1U)
+            << index;
+  }
+  return mask;
+}
+
+[[gnu::always_inline]] static inline uint32_t DFS_internal_orderKernelDirections(
+    const DFS_Worker_t *const worker_p, const DFS_KernelFrame_t *const frame_p,
+    uint32_t orderSalt, const int32_t *const offsets_p, uint8_t noOfDirections, bool isNarrow) {
+  if (worker_p->ordering == DFS_ORDERING_FIXED) {
+    return (noOfDirections == FOUR_DIRECTIONS) ? FIXED_DIRECTION_ORDER
+                                               : DFS_KERNEL_FIXED_EIGHT_ORDER;
+  }
+  const Cords cell = frame_p->position;
+  const uint32_t hash = UTILITY_mixBits((((uint32_t)cell.row << 16) | cell.col) ^ orderSalt);
+  uint8_t randomSlots[DFS_MAX_NO_OF_DIRECTIONS];
+  if (noOfDirections == FOUR_DIRECTIONS) {
+    // The orders of DFS_internal_orderDirections, so both loops find the same paths.
+    const uint8_t randomOrder = directionOrders[hash % NO_OF_DIRECTION_ORDERS];
+    if (worker_p->ordering == DFS_ORDERING_RANDOM) {
+      return randomOrder;
+    }
+    for (uint8_t slot = 0; slot < FOUR_DIRECTIONS; slot++) {
+      randomSlots[slot] = (randomOrder >> (BITS_PER_DIRECTION * slot)) & DIRECTION_MASK;
+    }
+  } else {
+    // Fisher-Yates shuffle, one byte of the hashed bits per swap.
+    uint64_t bits = ((uint64_t)UTILITY_mixBits(hash) << 32) | hash;
+    for (uint8_t slot = 0; slot < DFS_MAX_NO_OF_DIRECTIONS; slot++) {
+      randomSlots[slot] = slot;
+    }
+    for (uint8_t slot = DFS_MAX_NO_OF_DIRECTIONS - 1U; slot > 0; slot--) {
+      const uint8_t swapSlot = (uint8_t)(((bits & 0xFFU) * (slot + 1U)) >> 8);
+      bits >>= 8;
+      const uint8_t temp = randomSlots[slot];
+      randomSlots[slot] = randomSlots[swapSlot];
+      randomSlots[swapSlot] = temp;
+    }
+  }
+
+  uint8_t slots[DFS_MAX_NO_OF_DIRECTIONS];
+  if (worker_p->ordering == DFS_ORDERING_RANDOM) {
+    memcpy(slots, randomSlots, noOfDirections);
+  } else {
+    // Warnsdorff's rule as in DFS_internal_orderDirections, a closed
+    // neighbor is blocked, visited or on the border and ranks last.
+    const uint8_t unreachableRank = noOfDirections + 1U;
+    const uint32_t openMask = DFS_internal_getOpenNeighborMask(worker_p->open_p, frame_p->cell,
+                                                               offsets_p, noOfDirections, isNarrow);
+    uint8_t ranks[DFS_MAX_NO_OF_DIRECTIONS];
+    for (uint8_t slot = 0; slot < noOfDirections; slot++) {
+      const uint8_t index = randomSlots[slot];
+      uint8_t rank = unreachableRank;
+      if (openMask & (1U << index)) {
+        rank = (uint8_t)__builtin_popcount(DFS_internal_getOpenNeighborMask(
+            worker_p->open_p, frame_p->cell + (uint32_t)offsets_p[index], offsets_p,
+            noOfDirections, isNarrow));
+      }
+      // Stable insertion sort, so equal ranks keep their random order.
+      uint8_t position = slot;
+      while (position > 0 && ranks[position - 1] > rank) {
+        ranks[position] = ranks[position - 1];
+        slots[position] = slots[position - 1];
+        position--;
+      }
+      ranks[position] = rank;
+      slots[position] = index;
+    }
+  }
+
+  uint32_t order = 0;
+  for (uint8_t slot = 0; slot < noOfDirections; slot++) {
+    order |= (uint32_t)slots[slot] << (DFS_KERNEL_BITS_PER_DIRECTION(noOfDirections) * slot);
+  }
+  return order;
+}
+
+[[gnu::always_inline]] static inline bool DFS_internal_kernelHasEnoughRoom(
+    DFS_Worker_t *const worker_p, uint32_t head, uint32_t required,
+    const int32_t *const offsets_p, uint8_t noOfDirections, bool isNarrow) {
+  if (required == 0) {
+    return true;
+  }
+  const uint64_t *open_p = worker_p->open_p;
+  DFS_ReachScratch_t *reach_p = &worker_p->reach;
+  if (reach_p->currentStamp == UINT32_MAX) {
+    memset(reach_p->stamps_p, 0,
+           sizeof(uint32_t) * worker_p->kernelNoOfWords * DFS_KERNEL_WORD_BITS);
+    reach_p->currentStamp = 0;
+  }
+  uint32_t stamp = ++reach_p->currentStamp;
+
+  // The head is closed already, the fill starts from its open neighbors.
+  uint32_t queueHead = 0;
+  uint32_t queueTail = 0;
+  reach_p->queue_p[queueTail++] = head;
+  reach_p->stamps_p[head] = stamp;
+  uint32_t noOfReached = 0;
+
+  while (queueHead < queueTail) {
+    const uint32_t cell = reach_p->queue_p[queueHead++];
+    uint32_t openMask =
+        DFS_internal_getOpenNeighborMask(open_p, cell, offsets_p, noOfDirections, isNarrow);
+    while (openMask != 0) {
+      const uint32_t neighbor = cell + (uint32_t)offsets_p[__builtin_ctz(openMask)];
+      openMask &= openMask - 1U;
+      if (reach_p->stamps_p[neighbor] == stamp) {
+        continue;
+      }
+      if (++noOfReached >= required) {
+        return true;
+      }
+      reach_p->stamps_p[neighbor] = stamp;
+      reach_p->queue_p[queueTail++] = neighbor;
+    }
+  }
+  return false;
+}
+
+static DFS_Kernel_t DFS_internal_selectKernel(const WorldMatrix *const matrix_p,
+                                              const DFS_SearchOptions *const options_p,
+                                              uint32_t *const stride_p,
+                                              size_t *const noOfWords_p) {
+  const bool isEight = options_p->neighborhood == DFS_NEIGHBORHOOD_EIGHT;
+  if (!isEight && (!options_p->useKernels || options_p->engine != DFS_ENGINE_ITERATIVE)) {
+    return NULL;
+  }
+  // A border column on either side and a border row above and below.
+  const uint32_t wordsPerRow =
+      ((uint32_t)MATRIXWORLD_unchecked_getColSize(matrix_p) + 2U + DFS_KERNEL_WORD_BITS - 1U) /
+      DFS_KERNEL_WORD_BITS;
+  const size_t noOfWords = ((size_t)MATRIXWORLD_unchecked_getRowSize(matrix_p) + 2U) * wordsPerRow;
+  if (noOfWords * DFS_KERNEL_WORD_BITS > UINT32_MAX) {
+    return NULL;
+  }
+  *stride_p = wordsPerRow * DFS_KERNEL_WORD_BITS;
+  *noOfWords_p = noOfWords;
+  if (wordsPerRow == 1) {
+    return isEight ? DFS_internal_kernelEightNarrow : DFS_internal_kernelFourNarrow;
+  }
+  return isEight ? DFS_internal_kernelEightWide : DFS_internal_kernelFourWide;
+}
+
+static void DFS_internal_buildKernelMap(DFS_SearchContext *const context_p) {
+  if (context_p->kernelMap_p == NULL) {
+    return;
+  }
+  const WorldMatrix *matrix_p = context_p->matrix_p;
+  const DFS_Worker_t *worker_p = &context_p->workers_p[0];
+  const uint16_t noOfRows = MATRIXWORLD_unchecked_getRowSize(matrix_p);
+  const uint16_t noOfCols = MATRIXWORLD_unchecked_getColSize(matrix_p);
+  const uint32_t noOfRowWords = (noOfCols + DFS_KERNEL_WORD_BITS - 1U) / DFS_KERNEL_WORD_BITS;
+  const uint32_t kernelWordsPerRow = worker_p->kernelStride / DFS_KERNEL_WORD_BITS;
+  memset(context_p->kernelMap_p, 0, sizeof(uint64_t) * worker_p->kernelNoOfWords);
+  for (uint16_t row = 0; row < noOfRows; row++) {
+    uint64_t *kernelRow_p = &context_p->kernelMap_p[(size_t)(row + 1U) * kernelWordsPerRow];
+    for (uint32_t word = 0; word < noOfRowWords; word++) {
+      uint64_t freeCells = ~MATRIXWORLD_unchecked_getRowWord(matrix_p, row, (uint16_t)word);
+      const uint32_t noOfCellsInWord = noOfCols - (word * DFS_KERNEL_WORD_BITS);
+      if (noOfCellsInWord < DFS_KERNEL_WORD_BITS) {
+        freeCells &= (UINT64_C(1) << noOfCellsInWord) - 1U;
+      }
+      // Every cell moves one bit up, past the border column.
+      kernelRow_p[word] |= freeCells << 1;
+      if (word + 1U < kernelWordsPerRow) {
+        kernelRow_p[word + 1U] |= freeCells >> (DFS_KERNEL_WORD_BITS - 1U);
+      }
+    }
+  }
+}
+
+static void DFS_internal_loadKernelMap(DFS_Worker_t *const worker_p, const Path *const prefix_p) {
+  memcpy(worker_p->open_p, worker_p->kernelMap_p, sizeof(uint64_t) * worker_p->kernelNoOfWords);
+  if (prefix_p == NULL) {
+    return;
+  }
+  // The last cell is closed again as the start of the attempt.
+  for (size_t index = 0; index + 1U < PATH_unchecked_getLength(prefix_p); index++) {
+    const Cords cell = prefix_p->pathArray[index];
+    const uint32_t bit = ((uint32_t)(cell.row + 1U) * worker_p->kernelStride) + cell.col + 1U;
+    worker_p->open_p[bit / DFS_KERNEL_WORD_BITS] &= ~(UINT64_C(1) << (bit % DFS_KERNEL_WORD_BITS));
+  }
+}
+
+static bool DFS_internal_isSupported(const DFS_SearchContext *const context_p) {
+  return context_p->options.neighborhood != DFS_NEIGHBORHOOD_EIGHT ||
+         context_p->workers_p[0].kernel != NULL;
+}
+
+static inline bool DFS_internal_usesKernel(const DFS_Worker_t *const worker_p) {
+  return worker_p->engine == DFS_ENGINE_ITERATIVE && worker_p->kernel != NULL;
+}
+
+static bool DFS_internal_isPrefixContiguous(const Path *const prefix_p,
+                                            DFS_Neighborhood neighborhood) {
+  if (neighborhood == DFS_NEIGHBORHOOD_FOUR) {
+    return PATH_isContiguous(prefix_p);
+  }
+  for (size_t index = 1; index < PATH_unchecked_getLength(prefix_p); index++) {
+    const int32_t rowStep =
+        abs((int32_t)prefix_p->pathArray[index].row - prefix_p->pathArray[index - 1].row);
+    const int32_t colStep =
+        abs((int32_t)prefix_p->pathArray[index].col - prefix_p->pathArray[index - 1].col);
+    if (rowStep > 1 || colStep > 1 || (rowStep == 0 && colStep == 0)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static bool DFS_internal_searchFromStart(DFS_Worker_t *const worker_p,
+                                         Cords startingPoint,
+                                         uint32_t orderSalt) {
+  // Clear the visited set or the padded map for the new attempt.
+  if (DFS_internal_usesKernel(worker_p)) {
+    DFS_internal_loadKernelMap(worker_p, NULL);
+  } else {
+    VISITED_clearSet(worker_p->visited_p);
+  }
+  return DFS_internal_searchFromMarked(worker_p, startingPoint, orderSalt);
+}
+
+static bool DFS_internal_searchFromMarked(DFS_Worker_t *const worker_p,
+                                          Cords startingPoint,
+                                          uint32_t orderSalt) {
+  PATH_clearPath(worker_p->path_p);
+  // A kernel closes the start in its own map.
+  if (!DFS_internal_usesKernel(worker_p)) {
+    VISITED_unchecked_markCell(worker_p->visited_p, startingPoint.row, startingPoint.col);
+  }
+  PATH_unchecked_addCoordinates(worker_p->path_p, startingPoint.row,
+                                startingPoint.col);
+  worker_p->stats.startsAttempted++;
+  worker_p->stats.nodesExpanded++;
+  DFS_STATS_DEPTH(&worker_p->stats, 1U);
+  // The new path shares no cell with the best one.
+  worker_p->bestSharedDepth = 0;
+  worker_p->undoEnd =
+      worker_p->options_p->isComplete
+          ? UINT64_MAX
+          : worker_p->stats.nodesExpanded + (uint64_t)DFS_UNDO_NODE_FACTOR * worker_p->pathLength;
+
+  if (worker_p->engine == DFS_ENGINE_RECURSIVE) {
+    return DFS_internal_backtracking(worker_p);
+  }
+  if (worker_p->engine == DFS_ENGINE_BIDIRECTIONAL) {
+    return DFS_internal_bidirectionalBacktracking(worker_p, orderSalt);
+  }
+  if (worker_p->kernel != NULL) {
+    return worker_p->kernel(worker_p, orderSalt);
+  }
+  return DFS_internal_iterativeBacktracking(worker_p, orderSalt);
+}
+
+static bool DFS_internal_markPrefix(DFS_Worker_t *const worker_p, const Path *const prefix_p) {
+  const WorldMatrix *matrix_p = worker_p->matrix_p;
+  VisitedSet *visited_p = worker_p->visited_p;
+  const size_t prefixLength = PATH_unchecked_getLength(prefix_p);
+  if (!DFS_internal_isPrefixContiguous(prefix_p, worker_p->options_p->neighborhood)) {
+    return false;
+  }
+  VISITED_clearSet(visited_p);
+  for (size_t index = 0; index < prefixLength; index++) {
+    Cords cell = prefix_p->pathArray[index];
+    if (cell.row >= MATRIXWORLD_unchecked_getRowSize(matrix_p) ||
+        cell.col >= MATRIXWORLD_unchecked_getColSize(matrix_p) ||
+        MATRIXWORLD_unchecked_isBlocked(matrix_p, cell.row, cell.col) ||
+        VISITED_unchecked_isMarked(visited_p, cell.row, cell.col)) {
+      return false;
+    }
+    VISITED_unchecked_markCell(visited_p, cell.row, cell.col);
+  }
+  // The last cell is marked again as the start of the attempt.
+  Cords last = prefix_p->pathArray[prefixLength - 1];
+  VISITED_unchecked_unmarkCell(visited_p, last.row, last.col);
+  return true;
+}
+
+static void DFS_internal_createWorker(DFS_Worker_t *const worker_p,
+                                      const WorldMatrix *const matrix_p,
+                                      const DFS_SearchOptions *const options_p) {
+  *worker_p = (DFS_Worker_t){.matrix_p = matrix_p,
+                             .options_p = options_p,
+                             .pathLength = 0,
+                             .capacity = 0,
+                             .path_is_found_p = NULL};
+  worker_p->kernel = DFS_internal_selectKernel(matrix_p, options_p, &worker_p->kernelStride,
+                                               &worker_p->kernelNoOfWords);
+  // Reserve room for the longest possible path, only the touched pages are
+  // ever backed, and every block may lose a cache line to its alignment.
+  const size_t noOfCells = (size_t)MATRIXWORLD_unchecked_getRowSize(matrix_p) *
+                           MATRIXWORLD_unchecked_getColSize(matrix_p);
+  size_t reservation = sizeof(VisitedSet) +
+                       sizeof(uint64_t) * VISITED_unchecked_getNoOfWords(
+                                              MATRIXWORLD_unchecked_getRowSize(matrix_p),
+                                              MATRIXWORLD_unchecked_getColSize(matrix_p)) +
+                       2 * sizeof(Path) + (2 * sizeof(Cords) + sizeof(DFS_Frame_t)) * noOfCells +
+                       5 * ARENA_CACHE_LINE_SIZE;
+  // A kernel fills its padded map, the border cells included.
+  const size_t noOfReachCells = (worker_p->kernel != NULL)
+                                    ? worker_p->kernelNoOfWords * DFS_KERNEL_WORD_BITS
+                                    : noOfCells;
+  if (options_p->useReachabilityPruning) {
+    reservation += 2 * sizeof(uint32_t) * noOfReachCells;
+  }
+  if (worker_p->kernel != NULL) {
+    reservation += sizeof(uint64_t) * worker_p->kernelNoOfWords +
+                   sizeof(DFS_KernelFrame_t) * noOfCells + 2 * ARENA_CACHE_LINE_SIZE;
+  }
+  if (options_p->engine == DFS_ENGINE_BIDIRECTIONAL) {
+    reservation += sizeof(PathDeque) + (sizeof(Cords) + sizeof(DFS_EndFrame_t)) * noOfCells +
+                   2 * ARENA_CACHE_LINE_SIZE;
+  }
+  worker_p->arena_p = ARENA_createArena(reservation, options_p->useHugePages);
 
-  // Keep track of starting points that have already been tried.
-  StartingPointVector *usedStartingPoints_p = STPOINT_createVector(matrix_p);
   // Keep track of visited points for a single search attempt.
-  StartingPointVector *visitedPoints_p = STPOINT_createVector(matrix_p);
-  // The path to be built and returned.
-  Path *foundPath_p = PATH_initializePath(pathLength, matrix_p);
-  // Loop to try different random starting points.
-  for (uint32_t index = 0; index < noOfUnblockedElements; index++) {
-    // Clear vectors for the new attempt.
-    STPOINT_cleanVector(visitedPoints_p);
-    PATH_clearPath(foundPath_p);
-
-    Cords startingPoint = {.row = UTILITY_generateRandomNumber(noOfRows),
-                           .col = UTILITY_generateRandomNumber(noOfCols)};
-
-    // Try this starting point if it's valid and hasn't been used before.
-    if (!STPOINT_containsPoint(usedStartingPoints_p, startingPoint) &&
-        !MATRIXWORLD_isBlocked(matrix_p, startingPoint.row,
-                               startingPoint.col)) {
-      STPOINT_addPoint(usedStartingPoints_p, startingPoint);
-      STPOINT_addPoint(visitedPoints_p, startingPoint);
-      PATH_addCoordinates(foundPath_p, startingPoint.row, startingPoint.col);
-
-      // Start the recursive search.
-      if (DFS_internal_backtracking(matrix_p, foundPath_p, visitedPoints_p,
-                                    NULL, pathLength)) {
-        // On success, free the helper vectors and return the found path.
-        STPOINT_destroyVector(&usedStartingPoints_p);
-        STPOINT_destroyVector(&visitedPoints_p);
-        return foundPath_p;
-      }
-    }
-  }
-
-  // If loop finishes, no path was found. Clean up all resources.
-  PATH_freePath(&foundPath_p);
-  STPOINT_destroyVector(&usedStartingPoints_p);
-  STPOINT_destroyVector(&visitedPoints_p);
+  worker_p->visited_p = VISITED_createSetInArena(matrix_p, worker_p->arena_p);
+  if (options_p->useReachabilityPruning) {
+    worker_p->reach.stamps_p =
+        ARENA_allocate(worker_p->arena_p, sizeof(uint32_t) * noOfReachCells);
+    worker_p->reach.queue_p = ARENA_allocate(worker_p->arena_p, sizeof(uint32_t) * noOfReachCells);
+    memset(worker_p->reach.stamps_p, 0, sizeof(uint32_t) * noOfReachCells);
+  }
+  if (worker_p->kernel != NULL) {
+    worker_p->open_p =
+        ARENA_allocate(worker_p->arena_p, sizeof(uint64_t) * worker_p->kernelNoOfWords);
+  }
+  worker_p->pathMark = ARENA_getUsedBytes(worker_p->arena_p);
+}
+
+static void DFS_internal_prepareWorker(DFS_Worker_t *const worker_p, uint32_t pathLength) {
+  worker_p->pathLength = pathLength;
+  worker_p->engine = (worker_p->options_p->neighborhood == DFS_NEIGHBORHOOD_EIGHT)
+                         ? DFS_ENGINE_ITERATIVE
+                         : worker_p->options_p->engine;
+  worker_p->ordering = worker_p->options_p->ordering;
+  worker_p->isRestarting = false;
+  worker_p->attemptEnd = UINT64_MAX;
+  // Without limits the check never triggers and no best path is kept.
+  const DFS_SearchLimits_t *limits_p = worker_p->limits_p;
+  const bool hasLimits = limits_p->deadlineNs != 0 || limits_p->nodeBudget != 0;
+  worker_p->nextLimitCheck = hasLimits ? limits_p->checkInterval : UINT64_MAX;
+  worker_p->reportedNodes = 0;
+  worker_p->bestSharedDepth = 0;
+  if (pathLength > worker_p->capacity) {
+    DFS_internal_carvePathBuffers(worker_p, pathLength);
+  }
+  worker_p->best_p = hasLimits ? worker_p->bestBuffer_p : NULL;
+  if (worker_p->best_p != NULL) {
+    PATH_clearPath(worker_p->best_p);
+  }
+}
+
+static void DFS_internal_carvePathBuffers(DFS_Worker_t *const worker_p, uint32_t pathLength) {
+  // The path being built and the frame stack of the iterative engine, reused
+  // by every attempt and every later search up to this length. The shorter
+  // buffers are the last blocks of the arena and are simply carved over.
+  ARENA_rewind(worker_p->arena_p, worker_p->pathMark);
+  worker_p->path_p = PATH_initializePathInArena(pathLength, worker_p->matrix_p, worker_p->arena_p);
+  worker_p->frames_p = ARENA_allocate(worker_p->arena_p, sizeof(DFS_Frame_t) * pathLength);
+  if (worker_p->kernel != NULL) {
+    worker_p->kernelFrames_p =
+        ARENA_allocate(worker_p->arena_p, sizeof(DFS_KernelFrame_t) * pathLength);
+  }
+  if (worker_p->options_p->engine == DFS_ENGINE_BIDIRECTIONAL) {
+    worker_p->deque_p =
+        PATHDEQUE_initializeDequeInArena(pathLength, worker_p->matrix_p, worker_p->arena_p);
+    worker_p->endFrames_p =
+        ARENA_allocate(worker_p->arena_p, sizeof(DFS_EndFrame_t) * pathLength);
+  }
+  // Carved by hand, it would repeat the size warning of the path.
+  worker_p->bestBuffer_p =
+      ARENA_allocate(worker_p->arena_p, sizeof(Path) + sizeof(Cords) * pathLength);
+  worker_p->bestBuffer_p->pathSize = pathLength;
+  worker_p->bestBuffer_p->currentNoOfCordsInPath = 0;
+  worker_p->capacity = pathLength;
+}
+
+static void DFS_internal_destroyWorker(DFS_Worker_t *const worker_p) {
+  ARENA_destroyArena(&worker_p->arena_p);
+  *worker_p = (DFS_Worker_t){0};
+}
+
+static uint16_t DFS_internal_readCgroupCpuQuota(void) {
+  FILE *cpuMaxFile = fopen(CGROUP_CPU_MAX_FILE, "r");
+  if (cpuMaxFile == NULL) {
+    return 0;
+  }
+  // The file holds "<quota> <period>", or "max <period>" without a quota.
+  long long quota = 0;
+  long long period = 0;
+  int noOfFields = fscanf(cpuMaxFile, "%lld %lld", &quota, &period);
+  fclose(cpuMaxFile);
+  if (noOfFields != 2 || quota <= 0 || period <= 0) {
+    return 0;
+  }
+  long long noOfCpus = (quota + period - 1) / period;
+  return (noOfCpus > UINT16_MAX) ? UINT16_MAX : (uint16_t)noOfCpus;
+}
+
+static void DFS_internal_pinThreads(pthread_attr_t *const threadAttrs_p,
+                                    uint16_t noOfThreads) {
+  cpu_set_t allowedCpus;
+  CPU_ZERO(&allowedCpus);
+  if (sched_getaffinity(0, sizeof(allowedCpus), &allowedCpus) != 0 ||
+      CPU_COUNT(&allowedCpus) == 0) {
+    fprintf(stderr, "WARNING: Could not read the CPU affinity, threads are not pinned.\n");
+    return;
+  }
+  int cpu = -1;
+  for (uint16_t thrIndex = 0; thrIndex < noOfThreads; thrIndex++) {
+    // Next allowed CPU, wrapping around when there are more threads than CPUs.
+    do {
+      cpu = (cpu + 1) % CPU_SETSIZE;
+    } while (!CPU_ISSET(cpu, &allowedCpus));
+    cpu_set_t threadCpu;
+    CPU_ZERO(&threadCpu);
+    CPU_SET(cpu, &threadCpu);
+    pthread_attr_setaffinity_np(&threadAttrs_p[thrIndex], sizeof(threadCpu), &threadCpu);
+  }
+}
+
+static void DFS_internal_runPoolJob(DFS_SearchContext *const context_p, DFS_Job_t job) {
+  // Wake the parked pool and wait until every thread is done with the job.
+  pthread_mutex_lock(&context_p->pool_mutex);
+  context_p->job = job;
+  context_p->noOfFinished = 0;
+  context_p->generation++;
+  pthread_cond_broadcast(&context_p->work_ready_cond);
+  while (context_p->noOfFinished < context_p->noOfThreads) {
+    pthread_cond_wait(&context_p->work_done_cond, &context_p->pool_mutex);
+  }
+  pthread_mutex_unlock(&context_p->pool_mutex);
+}
+
+static void DFS_internal_labelComponents(DFS_SearchContext *const context_p) {
+  if (context_p->threads_p != NULL) {
+    DFS_internal_runPoolJob(context_p, DFS_JOB_LABEL);
+  } else {
+    CONNECTIVITY_labelStripe(context_p->componentMap_p, context_p->matrix_p, 0, 1);
+  }
+  CONNECTIVITY_finishLabelling(context_p->componentMap_p,
+                               (context_p->threads_p != NULL) ? context_p->noOfStripes : 1);
+}
+
+static bool DFS_internal_isValidConstruction(DFS_SearchContext *const context_p,
+                                             uint32_t pathLength, const Path *const path_p) {
+  if (PATH_unchecked_getLength(path_p) != pathLength || !PATH_isContiguous(path_p)) {
+    return false;
+  }
+  VisitedSet *visited_p = context_p->workers_p[0].visited_p;
+  VISITED_clearSet(visited_p);
+  for (uint32_t index = 0; index < pathLength; index++) {
+    const Cords cell = path_p->pathArray[index];
+    if (MATRIXWORLD_unchecked_isBlocked(context_p->matrix_p, cell.row, cell.col) ||
+        VISITED_unchecked_isMarked(visited_p, cell.row, cell.col)) {
+      return false;
+    }
+    VISITED_unchecked_markCell(visited_p, cell.row, cell.col);
+  }
+  return true;
+}
+
+static void *DFS_findPathThreaded(void *threadParams) {
+  DFS_ThreadArgs_t *thisThreadArgs_p = (DFS_ThreadArgs_t *)threadParams;
+  DFS_SearchContext *context_p = thisThreadArgs_p->context_p;
+  const uint16_t thread_id = thisThreadArgs_p->thread_id;
+  DFS_Worker_t *worker_p = &context_p->workers_p[thread_id];
+  uint64_t seenGeneration = 0;
+
+  pthread_mutex_lock(&context_p->pool_mutex);
+  while (true) {
+    // Park until a new job is posted or the context shuts down.
+    while (!context_p->isShuttingDown && context_p->generation == seenGeneration) {
+      pthread_cond_wait(&context_p->work_ready_cond, &context_p->pool_mutex);
+    }
+    if (context_p->isShuttingDown) {
+      break;
+    }
+    seenGeneration = context_p->generation;
+    const DFS_Job_t job = context_p->job;
+    pthread_mutex_unlock(&context_p->pool_mutex);
+
+    if (job == DFS_JOB_SEARCH) {
+      DFS_internal_runPooledWorker(context_p, worker_p);
+    } else if (thread_id < context_p->noOfStripes) {
+      CONNECTIVITY_labelStripe(context_p->componentMap_p, worker_p->matrix_p, thread_id,
+                               context_p->noOfStripes);
+    }
+
+    DFS_STATS_LOCK(&worker_p->stats, &context_p->pool_mutex);
+    if (++context_p->noOfFinished == context_p->noOfThreads) {
+      pthread_cond_signal(&context_p->work_done_cond);
+    }
+  }
+  pthread_mutex_unlock(&context_p->pool_mutex);
   return NULL;
-}
\ No newline at end of file
+}
+
+static void DFS_internal_runPooledWorker(DFS_SearchContext *const context_p,
+                                         DFS_Worker_t *const worker_p) {
+  if (worker_p->isRestarting) {
+    DFS_internal_runRestartingWorker(context_p, worker_p);
+    return;
+  }
+  // Loop over the starting points handed out by the scheduler.
+  while (!atomic_load_explicit(&context_p->path_is_found, memory_order_acquire) &&
+         !DFS_internal_isOverLimit(worker_p)) {
+    uint32_t startIndex = SCHEDULER_claimNext(context_p->scheduler_p);
+    if (startIndex == SCHEDULER_EXHAUSTED) {
+      break;
+    }
+    Cords startingPoint = SCHEDULER_getStart(context_p->scheduler_p, startIndex);
+
+    // Start the search from this point.
+    if (DFS_internal_searchFromStart(
+            worker_p, startingPoint, (uint32_t)UTILITY_nextRandom(&worker_p->generator))) {
+      DFS_internal_handOverPath(context_p, worker_p);
+      break;
+    }
+  }
+  atomic_fetch_sub_explicit(&context_p->noOfClaimingWorkers, 1, memory_order_release);
+}
+
+static void DFS_internal_runRestartingWorker(DFS_SearchContext *const context_p,
+                                             DFS_Worker_t *const worker_p) {
+  const uint32_t noOfStarts = SCHEDULER_getNoOfStarts(context_p->scheduler_p);
+  const uint64_t unit = (uint64_t)DFS_LUBY_NODE_FACTOR * worker_p->pathLength;
+  for (uint32_t restart = 1;
+       noOfStarts > 0 &&
+       !atomic_load_explicit(&context_p->path_is_found, memory_order_acquire) &&
+       atomic_load_explicit(&context_p->noOfClaimingWorkers, memory_order_acquire) > 0 &&
+       !DFS_internal_isOverLimit(worker_p);
+       restart++) {
+    Cords startingPoint = SCHEDULER_getStart(
+        context_p->scheduler_p, UTILITY_nextBoundedRandom(&worker_p->generator, noOfStarts));
+    worker_p->attemptEnd = worker_p->stats.nodesExpanded + DFS_internal_luby(restart) * unit;
+    if (DFS_internal_searchFromStart(
+            worker_p, startingPoint, (uint32_t)UTILITY_nextRandom(&worker_p->generator))) {
+      DFS_internal_handOverPath(context_p, worker_p);
+      break;
+    }
+  }
+  worker_p->attemptEnd = UINT64_MAX;
+}
+
+static void DFS_internal_handOverPath(DFS_SearchContext *const context_p,
+                                      DFS_Worker_t *const worker_p) {
+  // **** Lock the completion_mutex ****
+  DFS_STATS_LOCK(&worker_p->stats, &context_p->completion_mutex);
+  if (!atomic_load_explicit(&context_p->path_is_found, memory_order_relaxed)) {
+    DFS_internal_copyPath(context_p->final_path_p, worker_p->path_p);
+    context_p->finderThread = (int32_t)(worker_p - context_p->workers_p);
+    // Publish the flag only once the path has been copied.
+    atomic_store_explicit(&context_p->path_is_found, true, memory_order_release);
+  }
+  pthread_mutex_unlock(&context_p->completion_mutex);
+  // **** Unlock the completion_mutex ****
+}
+
+static void DFS_internal_assignStrategy(DFS_Worker_t *const worker_p, uint16_t thrIndex,
+                                        const DFS_SearchOptions *const options_p) {
+  // The first worker keeps the options, so a portfolio is never worse off
+  // than the plain search on one thread less.
+  if (options_p->usePortfolio && thrIndex > 0) {
+    const DFS_Strategy_t *strategy_p =
+        &portfolioStrategies[(thrIndex - 1U) % NO_OF_PORTFOLIO_STRATEGIES];
+    worker_p->ordering = strategy_p->ordering;
+    worker_p->isRestarting = strategy_p->isRestarting;
+  }
+}
+
+static uint64_t DFS_internal_luby(uint32_t index) {
+  // A block of 2^k - 1 terms repeats the block of 2^(k-1) - 1 terms twice and ends on 2^(k-1).
+  while (true) {
+    uint32_t exponent = 1;
+    while ((1ULL << exponent) - 1U < index) {
+      exponent++;
+    }
+    if ((1ULL << exponent) - 1U == index) {
+      return 1ULL << (exponent - 1U);
+    }
+    index -= (uint32_t)((1ULL << (exponent - 1U)) - 1U);
+  }
+}
+
+static bool DFS_internal_findPathSingleThread(DFS_Worker_t *const worker_p,
+                                              StartScheduler *const scheduler_p) {
+  // Loop over the starting points handed out by the scheduler.
+  for (uint32_t startIndex = SCHEDULER_claimNext(scheduler_p);
+       startIndex != SCHEDULER_EXHAUSTED; startIndex = SCHEDULER_claimNext(scheduler_p)) {
+    if (DFS_internal_isOverLimit(worker_p)) {
+      return false;
+    }
+    Cords startingPoint = SCHEDULER_getStart(scheduler_p, startIndex);
+
+    // Start the search from this point.
+    if (DFS_internal_searchFromStart(
+            worker_p, startingPoint, (uint32_t)UTILITY_nextRandom(&worker_p->generator))) {
+      return true;
+    }
+  }
+  // Every start has been tried, no path was found.
+  return false;
+}
+
+#ifdef DFS_ENABLE_STATS
+static void DFS_internal_timedLock(DFS_ThreadStats *const stats_p, pthread_mutex_t *mutex_p) {
+  // An uncontended lock is not timed at all.
+  if (pthread_mutex_trylock(mutex_p) == 0) {
+    return;
+  }
+  struct timespec start;
+  struct timespec end;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  pthread_mutex_lock(mutex_p);
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  stats_p->lockWaitNs += (uint64_t)(end.tv_sec - start.tv_sec) * NS_PER_SECOND +
+                         (uint64_t)end.tv_nsec - (uint64_t)start.tv_nsec;
+}
+#endif
+
+static bool DFS_internal_checkLimits(DFS_Worker_t *const worker_p) {
+  DFS_SearchLimits_t *limits_p = worker_p->limits_p;
+  // Once stopped, every later check stops the searcher at once.
+  worker_p->nextLimitCheck = 0;
+  if (atomic_load_explicit(&limits_p->status, memory_order_relaxed) != DFS_STATUS_NOT_FOUND) {
+    return true;
+  }
+  // The first limit hit by any searcher is the outcome of the search.
+  int hitStatus = DFS_STATUS_NOT_FOUND;
+  if (limits_p->nodeBudget != 0) {
+    uint64_t newNodes = worker_p->stats.nodesExpanded - worker_p->reportedNodes;
+    worker_p->reportedNodes = worker_p->stats.nodesExpanded;
+    if (atomic_fetch_add_explicit(&limits_p->nodesSpent, newNodes, memory_order_relaxed) +
+            newNodes >= limits_p->nodeBudget) {
+      hitStatus = DFS_STATUS_BUDGET_EXHAUSTED;
+    }
+  }
+  if (hitStatus == DFS_STATUS_NOT_FOUND && limits_p->deadlineNs != 0 &&
+      DFS_internal_getMonotonicNs() >= limits_p->deadlineNs) {
+    hitStatus = DFS_STATUS_TIMED_OUT;
+  }
+  if (hitStatus == DFS_STATUS_NOT_FOUND) {
+    worker_p->nextLimitCheck = worker_p->stats.nodesExpanded + limits_p->checkInterval;
+    return false;
+  }
+  int expected = DFS_STATUS_NOT_FOUND;
+  atomic_compare_exchange_strong_explicit(&limits_p->status, &expected, hitStatus,
+                                          memory_order_relaxed, memory_order_relaxed);
+  return true;
+}
+
+static inline bool DFS_internal_isOverLimit(DFS_Worker_t *const worker_p) {
+  return worker_p->stats.nodesExpanded >= worker_p->nextLimitCheck &&
+         DFS_internal_checkLimits(worker_p);
+}
+
+static void DFS_internal_recordBest(DFS_Worker_t *const worker_p, uint32_t depth) {
+  Path *best_p = worker_p->best_p;
+  if (best_p == NULL) {
+    return;
+  }
+  if (worker_p->engine == DFS_ENGINE_BIDIRECTIONAL) {
+    // A cell added at the front moves every other one, nothing is shared.
+    if (depth > PATH_unchecked_getLength(best_p)) {
+      PATHDEQUE_copyToPath(worker_p->deque_p, best_p);
+    }
+    return;
+  }
+  if (depth > PATH_unchecked_getLength(best_p)) {
+    // The first bestSharedDepth cells are the same in both paths already.
+    best_p->currentNoOfCordsInPath = worker_p->bestSharedDepth;
+    const bool isIterative = worker_p->engine != DFS_ENGINE_RECURSIVE;
+    const bool usesKernel = DFS_internal_usesKernel(worker_p);
+    for (uint32_t index = worker_p->bestSharedDepth; index < depth; index++) {
+      Cords cell = usesKernel    ? worker_p->kernelFrames_p[index].position
+                   : isIterative ? worker_p->frames_p[index].position
+                                 : worker_p->path_p->pathArray[index];
+      PATH_unchecked_addCoordinates(best_p, cell.row, cell.col);
+    }
+    worker_p->bestSharedDepth = depth;
+  }
+  // The caller removes the last cell next.
+  if (worker_p->bestSharedDepth >= depth) {
+    worker_p->bestSharedDepth = depth - 1;
+  }
+}
+
+static inline bool DFS_internal_isUndoing(const DFS_Worker_t *const worker_p) {
+  return worker_p->stats.nodesExpanded < worker_p->undoEnd;
+}
+
+static uint64_t DFS_internal_getMonotonicNs(void) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return ((uint64_t)now.tv_sec * NS_PER_SECOND) + (uint64_t)now.tv_nsec;
+}
+
+static bool DFS_internal_armLimits(DFS_SearchContext *const context_p) {
+  const DFS_SearchOptions *options_p = &context_p->options;
+  DFS_SearchLimits_t *limits_p = &context_p->limits;
+  if (context_p->isQueryArmed) {
+    // The searches of a query go on with its deadline and what is left of
+    // its budget, a limit already hit stops them at their first check.
+    limits_p->checkInterval = DFS_LIMIT_CHECK_INTERVAL;
+    if (limits_p->nodeBudget != 0) {
+      const uint64_t nodesSpent =
+          atomic_load_explicit(&limits_p->nodesSpent, memory_order_relaxed);
+      const uint64_t nodesLeft =
+          (nodesSpent < limits_p->nodeBudget) ? limits_p->nodeBudget - nodesSpent : 1U;
+      if (nodesLeft < limits_p->checkInterval) {
+        limits_p->checkInterval = nodesLeft;
+      }
+    }
+    return limits_p->deadlineNs != 0 || limits_p->nodeBudget != 0;
+  }
+  limits_p->deadlineNs = (options_p->timeoutMs == 0)
+                             ? 0
+                             : DFS_internal_getMonotonicNs() +
+                                   (uint64_t)options_p->timeoutMs * NS_PER_MS;
+  limits_p->nodeBudget = options_p->nodeBudget;
+  limits_p->checkInterval = DFS_LIMIT_CHECK_INTERVAL;
+  if (limits_p->nodeBudget != 0 && limits_p->nodeBudget < limits_p->checkInterval) {
+    limits_p->checkInterval = limits_p->nodeBudget;
+  }
+  atomic_store_explicit(&limits_p->nodesSpent, 0, memory_order_relaxed);
+  atomic_store_explicit(&limits_p->status, DFS_STATUS_NOT_FOUND, memory_order_relaxed);
+  return limits_p->deadlineNs != 0 || limits_p->nodeBudget != 0;
+}
+
+static void DFS_internal_resetCounters(DFS_SearchContext *const context_p) {
+  for (uint16_t thrIndex = 0; thrIndex < context_p->noOfThreads; thrIndex++) {
+    DFS_Worker_t *worker_p = &context_p->workers_p[thrIndex];
+    if (context_p->isQueryArmed) {
+      // The expansions after the last check of the previous search count too.
+      atomic_fetch_add_explicit(&context_p->limits.nodesSpent,
+                                worker_p->stats.nodesExpanded - worker_p->reportedNodes,
+                                memory_order_relaxed);
+    }
+    worker_p->stats = (DFS_ThreadStats){0};
+    worker_p->reportedNodes = 0;
+  }
+  context_p->finderThread = -1;
+  context_p->status = DFS_STATUS_NOT_FOUND;
+}
+
+static void DFS_internal_copyPath(Path *const destination_p, const Path *const source_p) {
+  memcpy(destination_p->pathArray, source_p->pathArray,
+         sizeof(Cords) * source_p->currentNoOfCordsInPath);
+  destination_p->currentNoOfCordsInPath = source_p->currentNoOfCordsInPath;
+}
@@ -0,0 +1,518 @@
+/* > Description ****************************************************************/
+/**
+ * @file gridLoader.c
+ * @brief This is the file for loading obstacle maps into the worldMatrix. The
+ *        text loader maps the file into memory, splits it into newline-aligned
+ *        chunks and lets every thread OR its blocked bits into the matrix words.
+ *        The binary grid files are read and written here as well.
+ */
+
+/* > Includes ****************************************************************/
+#define MATRIXWORLD_UNCHECKED_API
+#include "gridLoader.h"
+#include "matrixWorld.h"
+#include "utilities.h"
+#include <fcntl.h>
+#include <pthread.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/* > Defines *****************************************************************/
+
+#define LOADER_GRID_MAGIC "PFGR"
+#define LOADER_GRID_VERSION 1U
+
+/* > Type Declarations *******************************************************/
+
+/*
+ * @brief Arguments and results of every chunk parsing thread.
+ */
+typedef struct {
+    WorldMatrix *matrix_p;
+    const char *text_p;   // Start of the mapped file
+    size_t textSize;       // Size of the mapped file
+    size_t chunkStart;     // Lines starting in [chunkStart, chunkEnd) belong to the chunk
+    size_t chunkEnd;
+    uint32_t noOfMalformedLines;
+    uint32_t noOfOutOfBoundsCells;
+} LOADER_ChunkArgs_t;
+
+/* > Global Constant Definitions *********************************************/
+
+/* > Global Variable Definitions *********************************************/
+
+/* > Local Constant Definitions **********************************************/
+
+/* > Local Variable Definitions **********************************************/
+
+/* > Local Function Declarations *********************************************/
+
+/**
+ * @brief Thread function parsing the lines of one chunk of the file.
+ * @param chunkArgs[in,out] A pointer to a LOADER_ChunkArgs_t.
+ * @return Always returns NULL.
+ */
+static void *LOADER_internal_parseChunk(void *chunkArgs);
+
+/**
+ * @brief Maps a whole file read-only into memory.
+ * @param filePath[in]    Path to the file.
+ * @param text_pp[out]    The mapping, NULL for an empty file.
+ * @param textSize_p[out] Size of the file.
+ * @return false if the file can not be opened or mapped.
+ */
+static bool LOADER_internal_mapFile(const char *filePath, const char **text_pp,
+                                    size_t *textSize_p);
+
+/**
+ * @brief Fills the blocked runs of a row from an RLE payload.
+ * @param matrix_p[in,out] Pointer to the WorldMatrix.
+ * @param row[in]          The row to fill.
+ * @param cursor_pp[in,out] Parse position in the payload, advanced past the row.
+ * @param end_p[in]        End of the payload.
+ * @return false if the row is truncated or a run leaves the row.
+ */
+static bool LOADER_internal_decodeRleRow(WorldMatrix *const matrix_p, uint16_t row,
+                                         const uint8_t **cursor_pp, const uint8_t *end_p);
+
+/**
+ * @brief Counts the runs of blocked cells within a row.
+ * @param matrix_p[in] Pointer to the WorldMatrix.
+ * @param row[in]      The row to scan.
+ * @return The number of runs.
+ */
+static uint16_t LOADER_internal_countBlockedRuns(const WorldMatrix *const matrix_p, uint16_t row);
+
+/**
+ * @brief Writes a 16-bit value in little-endian byte order.
+ * @param bytes_p[out] Destination of the two bytes.
+ * @param value[in]    The value to write.
+ */
+static inline void LOADER_internal_storeUint16(uint8_t *bytes_p, uint16_t value);
+
+/**
+ * @brief Reads a 16-bit value stored in little-endian byte order.
+ * @param bytes_p[in] The two bytes.
+ * @return The value.
+ */
+static inline uint16_t LOADER_internal_loadUint16(const uint8_t *bytes_p);
+
+/**
+ * @brief Parses an unsigned decimal number of at most 16 bits.
+ * @param cursor_pp[in,out] Pointer to the parse position, advanced past the digits.
+ * @param end_p[in]         End of the text.
+ * @param value_p[out]      The parsed value.
+ * @return true if at least one digit was read and the value fits in 16 bits.
+ */
+static bool LOADER_internal_parseUint16(const char **cursor_pp, const char *end_p,
+                                        uint16_t *value_p);
+
+/* > Global Function Definitions *********************************************/
+
+bool LOADER_loadBlockedCellsFile(WorldMatrix *const matrix_p, const char *filePath,
+                                 uint16_t noOfThreads) {
+    if (matrix_p == NULL) {
+        fprintf(stderr, "FATAL ERROR: WorldMatrix supplied to LOADER_loadBlockedCellsFile "
+                        "is NULL!\n");
+        exit(EXIT_FAILURE);
+    }
+    const char *text_p;
+    size_t textSize;
+    if (!LOADER_internal_mapFile(filePath, &text_p, &textSize)) {
+        return false;
+    }
+    if (textSize == 0) {
+        return true;
+    }
+
+    uint16_t noOfChunks = (noOfThreads == 0) ? 1 : noOfThreads;
+    if (noOfChunks > textSize) {
+        noOfChunks = (uint16_t)textSize;
+    }
+    pthread_t *chunkThreads_p = malloc(sizeof(pthread_t) * noOfChunks);
+    LOADER_ChunkArgs_t *chunkArgs_p = malloc(sizeof(LOADER_ChunkArgs_t) * noOfChunks);
+    if (chunkThreads_p == NULL || chunkArgs_p == NULL) {
+        fprintf(stderr, "FATAL ERROR: Could not allocate memory for loading threads!\n");
+        exit(EXIT_FAILURE);
+    }
+    for (uint16_t chunk = 0; chunk < noOfChunks; chunk++) {
+        chunkArgs_p[chunk] = (LOADER_ChunkArgs_t){
+            .matrix_p = matrix_p,
+            .text_p = text_p,
+            .textSize = textSize,
+            .chunkStart = (textSize * chunk) / noOfChunks,
+            .chunkEnd = (textSize * (chunk + 1)) / noOfChunks,
+            .noOfMalformedLines = 0,
+            .noOfOutOfBoundsCells = 0};
+    }
+    for (uint16_t chunk = 1; chunk < noOfChunks; chunk++) {
+        pthread_create(&chunkThreads_p[chunk], NULL, LOADER_internal_parseChunk,
+                       &chunkArgs_p[chunk]);
+    }
+    UNUSED(LOADER_internal_parseChunk(&chunkArgs_p[0]));
+    uint32_t noOfMalformedLines = chunkArgs_p[0].noOfMalformedLines;
+    uint32_t noOfOutOfBoundsCells = chunkArgs_p[0].noOfOutOfBoundsCells;
+    for (uint16_t chunk = 1; chunk < noOfChunks; chunk++) {
+        pthread_join(chunkThreads_p[chunk], NULL);
+        noOfMalformedLines += chunkArgs_p[chunk].noOfMalformedLines;
+        noOfOutOfBoundsCells += chunkArgs_p[chunk].noOfOutOfBoundsCells;
+    }
+    free(chunkThreads_p);
+    free(chunkArgs_p);
+    munmap((void *)text_p, textSize);
+
+    // The threads wrote the bits directly, bring the counters up to date.
+    MATRIXWORLD_recountCells(matrix_p);
+
+    if (noOfMalformedLines != 0) {
+        fprintf(stderr, "Warning: Skipped %u malformed lines in %s\n", noOfMalformedLines,
+                filePath);
+    }
+    if (noOfOutOfBoundsCells != 0) {
+        fprintf(stderr, "Error: %s holds %u cells outside of the %ux%u matrix\n", filePath,
+                noOfOutOfBoundsCells, MATRIXWORLD_unchecked_getRowSize(matrix_p),
+                MATRIXWORLD_unchecked_getColSize(matrix_p));
+        return false;
+    }
+    return true;
+}
+
+WorldMatrix *LOADER_loadGridFile(const char *filePath) {
+    const char *text_p;
+    size_t textSize;
+    if (!LOADER_internal_mapFile(filePath, &text_p, &textSize)) {
+        return NULL;
+    }
+    const uint8_t *bytes_p = (const uint8_t *)text_p;
+    if (textSize < LOADER_GRID_HEADER_SIZE || memcmp(bytes_p, LOADER_GRID_MAGIC, 4) != 0 ||
+        bytes_p[4] != LOADER_GRID_VERSION) {
+        fprintf(stderr, "Error: %s is not a version %u grid file\n", filePath,
+                LOADER_GRID_VERSION);
+        if (text_p != NULL) {
+            munmap((void *)text_p, textSize);
+        }
+        return NULL;
+    }
+    const uint8_t encoding = bytes_p[5];
+    const uint16_t rows = LOADER_internal_loadUint16(&bytes_p[8]);
+    const uint16_t cols = LOADER_internal_loadUint16(&bytes_p[10]);
+    const uint8_t *payload_p = bytes_p + LOADER_GRID_HEADER_SIZE;
+    const uint8_t *end_p = bytes_p + textSize;
+    if (rows == 0 || cols == 0) {
+        fprintf(stderr, "Error: %s holds an empty %ux%u grid\n", filePath, rows, cols);
+        munmap((void *)text_p, textSize);
+        return NULL;
+    }
+
+    WorldMatrix *matrix_p = MATRIXWORLD_matrixInitialization(rows, cols);
+    const size_t noOfWords = (size_t)rows * matrix_p->wordsPerRow;
+    bool isValid = false;
+    if (encoding == LOADER_ENCODING_BITMAP) {
+        isValid = (size_t)(end_p - payload_p) == noOfWords * sizeof(uint64_t);
+        if (isValid) {
+#if defined(MATRIXWORLD_TILED_LAYOUT)
+            // The payload holds packed rows, they are spread over the tiles.
+            for (uint16_t row = 0; row < rows; row++) {
+                for (uint16_t word = 0; word < matrix_p->wordsPerRow; word++) {
+                    uint64_t bits;
+                    memcpy(&bits, payload_p + (((size_t)row * matrix_p->wordsPerRow) + word) *
+                                                  sizeof(uint64_t),
+                           sizeof(bits));
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+                    bits = __builtin_bswap64(bits);
+#endif
+                    MATRIXWORLD_unchecked_blockRowWord(matrix_p, row, word, bits);
+                }
+            }
+#else
+            // The payload already has the matrix layout, a single copy loads it.
+            memcpy(matrix_p->worldMatrix, payload_p, noOfWords * sizeof(uint64_t));
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+            for (size_t index = 0; index < noOfWords; index++) {
+                matrix_p->worldMatrix[index] = __builtin_bswap64(matrix_p->worldMatrix[index]);
+            }
+#endif
+            // Files may leave the padding clear, the matrix needs it set.
+            const uint16_t usedBitsInLastWord = cols % MATRIXWORLD_CELLS_PER_WORD;
+            if (usedBitsInLastWord != 0) {
+                const uint64_t paddingMask = ~((UINT64_C(1) << usedBitsInLastWord) - 1);
+                for (uint16_t row = 0; row < rows; row++) {
+                    *MATRIXWORLD_unchecked_cellWord(matrix_p, row, cols - 1) |= paddingMask;
+                }
+            }
+#endif
+        }
+    } else if (encoding == LOADER_ENCODING_RLE) {
+        const uint8_t *cursor_p = payload_p;
+        isValid = true;
+        for (uint16_t row = 0; isValid && row < rows; row++) {
+            isValid = LOADER_internal_decodeRleRow(matrix_p, row, &cursor_p, end_p);
+        }
+        isValid = isValid && cursor_p == end_p;
+    }
+    munmap((void *)text_p, textSize);
+    if (!isValid) {
+        fprintf(stderr, "Error: %s holds a malformed or truncated grid payload\n", filePath);
+        MATRIXWORLD_matrixFree(&matrix_p);
+        return NULL;
+    }
+    MATRIXWORLD_recountCells(matrix_p);
+    return matrix_p;
+}
+
+bool LOADER_saveGridFile(const WorldMatrix *const matrix_p, const char *filePath,
+                         LOADER_GridEncoding encoding) {
+    if (matrix_p == NULL) {
+        fprintf(stderr, "FATAL ERROR: WorldMatrix supplied to LOADER_saveGridFile is NULL!\n");
+        exit(EXIT_FAILURE);
+    }
+    const uint16_t rows = MATRIXWORLD_unchecked_getRowSize(matrix_p);
+    const uint16_t cols = MATRIXWORLD_unchecked_getColSize(matrix_p);
+    const size_t noOfWords = (size_t)rows * matrix_p->wordsPerRow;
+    if (encoding == LOADER_ENCODING_AUTO) {
+        size_t rleSize = 0;
+        for (uint16_t row = 0; row < rows; row++) {
+            rleSize += sizeof(uint16_t) +
+                       (2 * sizeof(uint16_t) * LOADER_internal_countBlockedRuns(matrix_p, row));
+        }
+        encoding = (rleSize < noOfWords * sizeof(uint64_t)) ? LOADER_ENCODING_RLE
+                                                            : LOADER_ENCODING_BITMAP;
+    }
+
+    FILE *file_p = fopen(filePath, "wb");
+    if (file_p == NULL) {
+        perror("Error opening grid file for writing");
+        return false;
+    }
+    uint8_t header[LOADER_GRID_HEADER_SIZE] = {0};
+    memcpy(header, LOADER_GRID_MAGIC, 4);
+    header[4] = LOADER_GRID_VERSION;
+    header[5] = (uint8_t)encoding;
+    LOADER_internal_storeUint16(&header[8], rows);
+    LOADER_internal_storeUint16(&header[10], cols);
+    bool isWritten = fwrite(header, sizeof(header), 1, file_p) == 1;
+
+    if (encoding == LOADER_ENCODING_BITMAP) {
+#if defined(MATRIXWORLD_TILED_LAYOUT)
+        // The file holds packed rows, they are gathered from the tiles.
+        for (uint16_t row = 0; isWritten && row < rows; row++) {
+            for (uint16_t word = 0; isWritten && word < matrix_p->wordsPerRow; word++) {
+                uint64_t bits = MATRIXWORLD_unchecked_getRowWord(matrix_p, row, word);
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+                bits = __builtin_bswap64(bits);
+#endif
+                isWritten = fwrite(&bits, sizeof(bits), 1, file_p) == 1;
+            }
+        }
+#elif __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        for (size_t index = 0; isWritten && index < noOfWords; index++) {
+            uint64_t word = __builtin_bswap64(matrix_p->worldMatrix[index]);
+            isWritten = fwrite(&word, sizeof(word), 1, file_p) == 1;
+        }
+#else
+        isWritten = isWritten &&
+                    fwrite(matrix_p->worldMatrix, sizeof(uint64_t), noOfWords, file_p) == noOfWords;
+#endif
+    } else {
+        for (uint16_t row = 0; isWritten && row < rows; row++) {
+            uint8_t bytes[2 * sizeof(uint16_t)];
+            LOADER_internal_storeUint16(bytes, LOADER_internal_countBlockedRuns(matrix_p, row));
+            isWritten = fwrite(bytes, sizeof(uint16_t), 1, file_p) == 1;
+            uint16_t col = 0;
+            while (isWritten && col < cols) {
+                if (!MATRIXWORLD_unchecked_isBlocked(matrix_p, row, col)) {
+                    col++;
+                    continue;
+                }
+                uint16_t runStart = col;
+                while (col < cols && MATRIXWORLD_unchecked_isBlocked(matrix_p, row, col)) {
+                    col++;
+                }
+                LOADER_internal_storeUint16(&bytes[0], runStart);
+                LOADER_internal_storeUint16(&bytes[2], (uint16_t)(col - runStart));
+                isWritten = fwrite(bytes, sizeof(bytes), 1, file_p) == 1;
+            }
+        }
+    }
+    if (fclose(file_p) != 0 || !isWritten) {
+        perror("Error writing grid file");
+        return false;
+    }
+    return true;
+}
+
+/* > Local Function Definitions **********************************************/
+
+static bool LOADER_internal_mapFile(const char *filePath, const char **text_pp,
+                                    size_t *textSize_p) {
+    int fileDescriptor = open(filePath, O_RDONLY);
+    if (fileDescriptor < 0) {
+        perror("Error opening obstacle map file");
+        return false;
+    }
+    struct stat fileStat;
+    if (fstat(fileDescriptor, &fileStat) != 0) {
+        perror("Error reading obstacle map file size");
+        close(fileDescriptor);
+        return false;
+    }
+    *textSize_p = (size_t)fileStat.st_size;
+    *text_pp = NULL;
+    if (*textSize_p == 0) {
+        close(fileDescriptor);
+        return true;
+    }
+    const char *text_p = mmap(NULL, *textSize_p, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+    close(fileDescriptor);
+    if (text_p == MAP_FAILED) {
+        perror("Error mapping obstacle map file");
+        return false;
+    }
+    UNUSED(madvise((void *)text_p, *textSize_p, MADV_SEQUENTIAL));
+    *text_pp = text_p;
+    return true;
+}
+
+static bool LOADER_internal_decodeRleRow(WorldMatrix *const matrix_p, uint16_t row,
+                                         const uint8_t **cursor_pp, const uint8_t *end_p) {
+    const uint8_t *cursor_p = *cursor_pp;
+    const uint16_t cols = MATRIXWORLD_unchecked_getColSize(matrix_p);
+    if (end_p - cursor_p < (ptrdiff_t)sizeof(uint16_t)) {
+        return false;
+    }
+    const uint16_t noOfRuns = LOADER_internal_loadUint16(cursor_p);
+    cursor_p += sizeof(uint16_t);
+    if (end_p - cursor_p < (ptrdiff_t)(2 * sizeof(uint16_t) * noOfRuns)) {
+        return false;
+    }
+    for (uint16_t run = 0; run < noOfRuns; run++) {
+        const uint32_t runStart = LOADER_internal_loadUint16(&cursor_p[0]);
+        const uint32_t runEnd = runStart + LOADER_internal_loadUint16(&cursor_p[2]);
+        cursor_p += 2 * sizeof(uint16_t);
+        if (runEnd > cols) {
+            return false;
+        }
+        // Fill the run a word at a time.
+        for (uint32_t col = runStart; col < runEnd;) {
+            const uint32_t bit = col % MATRIXWORLD_CELLS_PER_WORD;
+            uint32_t noOfBits = MATRIXWORLD_CELLS_PER_WORD - bit;
+            if (noOfBits > runEnd - col) {
+                noOfBits = runEnd - col;
+            }
+            const uint64_t mask = (noOfBits == MATRIXWORLD_CELLS_PER_WORD)
+                                      ? ~UINT64_C(0)
+                                      : ((UINT64_C(1) << noOfBits) - 1) << bit;
+            MATRIXWORLD_unchecked_blockRowWord(matrix_p, row,
+                                               (uint16_t)(col / MATRIXWORLD_CELLS_PER_WORD), mask);
+            col += noOfBits;
+        }
+    }
+    *cursor_pp = cursor_p;
+    return true;
+}
+
+static uint16_t LOADER_internal_countBlockedRuns(const WorldMatrix *const matrix_p, uint16_t row) {
+    const uint16_t cols = MATRIXWORLD_unchecked_getColSize(matrix_p);
+    uint32_t noOfRuns = 0;
+    uint64_t previousLastBit = 0;
+    for (uint16_t word = 0; word < matrix_p->wordsPerRow; word++) {
+        uint64_t bits = MATRIXWORLD_unchecked_getRowWord(matrix_p, row, word);
+        const uint16_t usedBits = (uint16_t)(cols - (word * MATRIXWORLD_CELLS_PER_WORD));
+        if (usedBits < MATRIXWORLD_CELLS_PER_WORD) {
+            bits &= (UINT64_C(1) << usedBits) - 1;
+        }
+        // A run starts on every set bit whose lower neighbour is clear.
+        noOfRuns += (uint32_t)__builtin_popcountll(bits & ~((bits << 1) | previousLastBit));
+        previousLastBit = bits >> (MATRIXWORLD_CELLS_PER_WORD - 1);
+    }
+    return (uint16_t)noOfRuns;
+}
+
+static void *LOADER_internal_parseChunk(void *chunkArgs) {
+    LOADER_ChunkArgs_t *args_p = (LOADER_ChunkArgs_t *)chunkArgs;
+    WorldMatrix *matrix_p = args_p->matrix_p;
+    const uint16_t rows = MATRIXWORLD_unchecked_getRowSize(matrix_p);
+    const uint16_t cols = MATRIXWORLD_unchecked_getColSize(matrix_p);
+    const char *textEnd_p = args_p->text_p + args_p->textSize;
+    const char *chunkEnd_p = args_p->text_p + args_p->chunkEnd;
+    const char *cursor_p = args_p->text_p + args_p->chunkStart;
+
+    // A line cut by the chunk start belongs to the previous chunk.
+    if (args_p->chunkStart != 0 && cursor_p[-1] != '\n') {
+        const char *newline_p = memchr(cursor_p, '\n', (size_t)(textEnd_p - cursor_p));
+        cursor_p = (newline_p == NULL) ? textEnd_p : newline_p + 1;
+    }
+
+    while (cursor_p < chunkEnd_p) {
+        const char *lineEnd_p = memchr(cursor_p, '\n', (size_t)(textEnd_p - cursor_p));
+        if (lineEnd_p == NULL) {
+            lineEnd_p = textEnd_p;
+        }
+        const char *next_p = (lineEnd_p == textEnd_p) ? textEnd_p : lineEnd_p + 1;
+        while (cursor_p < lineEnd_p && (*cursor_p == ' ' || *cursor_p == '\t')) {
+            cursor_p++;
+        }
+        if (cursor_p == lineEnd_p || *cursor_p == '#' || *cursor_p == '\r') {
+            cursor_p = next_p;
+            continue;
+        }
+
+        uint16_t row;
+        uint16_t col;
+        bool isValid = LOADER_internal_parseUint16(&cursor_p, lineEnd_p, &row);
+        while (isValid && cursor_p < lineEnd_p && *cursor_p == ' ') {
+            cursor_p++;
+        }
+        isValid = isValid && cursor_p < lineEnd_p && *cursor_p++ == ',';
+        while (isValid && cursor_p < lineEnd_p && *cursor_p == ' ') {
+            cursor_p++;
+        }
+        isValid = isValid && LOADER_internal_parseUint16(&cursor_p, lineEnd_p, &col);
+        // Anything after the column, like a trailing \r, is ignored as sscanf did.
+        if (!isValid) {
+            args_p->noOfMalformedLines++;
+        } else if (row >= rows || col >= cols) {
+            args_p->noOfOutOfBoundsCells++;
+        } else {
+            // Neighbouring chunks may share a word, so the bits are ORed atomically.
+            __atomic_fetch_or(MATRIXWORLD_unchecked_cellWord(matrix_p, row, col),
+                              UINT64_C(1) << MATRIXWORLD_unchecked_cellBit(row, col),
+                              __ATOMIC_RELAXED);
+        }
+        cursor_p = next_p;
+    }
+    return NULL;
+}
+
+static inline void LOADER_internal_storeUint16(uint8_t *bytes_p, uint16_t value) {
+    bytes_p[0] = (uint8_t)(value & 0xFFU);
+    bytes_p[1] = (uint8_t)(value >> 8);
+}
+
+static inline uint16_t LOADER_internal_loadUint16(const uint8_t *bytes_p) {
+    return (uint16_t)(bytes_p[0] | (bytes_p[1] << 8));
+}
+
+static bool LOADER_internal_parseUint16(const char **cursor_pp, const char *end_p,
+                                        uint16_t *value_p) {
+    const char *cursor_p = *cursor_pp;
+    uint32_t value = 0;
+    while (cursor_p < end_p && *cursor_p >= '0' && *cursor_p <= '9') {
+        value = (value * 10U) + (uint32_t)(*cursor_p - '0');
+        if (value > UINT16_MAX) {
+            return false;
+        }
+        cursor_p++;
+    }
+    if (cursor_p == *cursor_pp) {
+        return false;
+    }
+    *cursor_pp = cursor_p;
+    *value_p = (uint16_t)value;
+    return true;
+}
@@ -9,7 +9,9 @@
  */
 
 /* > Includes ****************************************************************/
+#define MATRIXWORLD_UNCHECKED_API
 #include "matrixWorld.h"
+#include "pathOutput.h"
 #include <stdarg.h>
 #include <stdint.h>
 #include <stdio.h>
@@ -18,16 +20,13 @@
 
 /* > Defines *****************************************************************/
 #define MINIMUM_MATRIX_SIZE 4
+#define CELLS_PER_WORD MATRIXWORLD_CELLS_PER_WORD
+#define LAST_BIT_IN_WORD (CELLS_PER_WORD - 1)
+#if defined(MATRIXWORLD_TILED_LAYOUT)
+#define TILE_SIZE MATRIXWORLD_TILE_SIZE
+#endif
 
 /* > Type Declarations *******************************************************/ 
-struct WorldMatrix {
-  uint16_t rows;
-  uint16_t cols;
-  uint32_t noOfUnblockedCells;
-  uint32_t noOfBlockedCells;
-  size_t worldSize;
-  bool worldMatrix[];
-};
 
 /* > Global Constant Definitions *********************************************/
 
@@ -62,17 +61,42 @@ MATRIXWORLD_internal_checkSizeBoundaries(const WorldMatrix *const matrix_p, uint
                                          uint16_t col,
                                          const char *restrict message, ...);
 
+/**
+ * @brief Internal function to reset every cell to unblocked while keeping the
+ *        row padding bits set.
+ *
+ * @param matrix_p[in,out] Pointer to the WorldMatrix.
+ */
+static void MATRIXWORLD_internal_resetStorage(WorldMatrix *const matrix_p);
+
+/**
+ * @brief Internal function to hash one matrix word together with its index
+ *        (splitmix64 finalizer).
+ *
+ * @param index[in] The index of the word in the matrix.
+ * @param word[in]  The word.
+ * @return The share of the word in the fingerprint.
+ */
+static uint64_t MATRIXWORLD_internal_hashWord(size_t index, uint64_t word);
+
 /* > Global Function Definitions *********************************************/
 
 WorldMatrix *MATRIXWORLD_matrixInitialization(uint16_t rows, uint16_t cols) {
-  size_t noOfMatrixBoolElements = rows * cols;
+  size_t noOfMatrixBoolElements = (size_t)rows * cols;
   if (noOfMatrixBoolElements < MINIMUM_MATRIX_SIZE)
   {
     fprintf(stderr, "FATAL ERROR: Matrix size can not be smaller than 4!\n");
     exit(EXIT_FAILURE);
   }
+  uint16_t wordsPerRow = (uint16_t)((cols + LAST_BIT_IN_WORD) / CELLS_PER_WORD);
+#if defined(MATRIXWORLD_TILED_LAYOUT)
+  uint16_t tilesPerRow = (uint16_t)((cols + TILE_SIZE - 1) / TILE_SIZE);
+  size_t noOfWords = ((size_t)(rows + TILE_SIZE - 1) / TILE_SIZE) * tilesPerRow;
+#else
+  size_t noOfWords = (size_t)rows * wordsPerRow;
+#endif
   WorldMatrix *matrix_p = (WorldMatrix*)malloc(
-      sizeof(WorldMatrix) + (sizeof(bool) * noOfMatrixBoolElements));
+      sizeof(WorldMatrix) + (sizeof(uint64_t) * noOfWords));
 
   if (matrix_p == NULL) {
     fprintf(stderr,
@@ -81,16 +105,25 @@ WorldMatrix *MATRIXWORLD_matrixInitialization(uint16_t rows, uint16_t cols) {
   }
   matrix_p->rows = rows;
   matrix_p->cols = cols;
+  matrix_p->wordsPerRow = wordsPerRow;
+#if defined(MATRIXWORLD_TILED_LAYOUT)
+  matrix_p->tilesPerRow = tilesPerRow;
+#endif
+  matrix_p->noOfWords = noOfWords;
   matrix_p->worldSize = noOfMatrixBoolElements;
   matrix_p->noOfBlockedCells = 0;
   matrix_p->noOfUnblockedCells = (uint32_t)noOfMatrixBoolElements;
-  memset(matrix_p->worldMatrix, 0,
-         (uint64_t)(sizeof(bool) * noOfMatrixBoolElements));
+  MATRIXWORLD_internal_resetStorage(matrix_p);
 
   return matrix_p;
 }
 
-void MATRIXWORLD_matrixFree(WorldMatrix **const matrix_pp) { free(*matrix_pp); }
+void MATRIXWORLD_matrixFree(WorldMatrix **const matrix_pp) {
+  if (matrix_pp != NULL) {
+    free(*matrix_pp);
+    *matrix_pp = NULL;
+  }
+}
 
 WorldMatrix *MATRIXWORLD_matrixResize(WorldMatrix *matrix_p, uint16_t rows,
                                       uint16_t cols) {
@@ -103,22 +136,35 @@ WorldMatrix *MATRIXWORLD_matrixResize(WorldMatrix *matrix_p, uint16_t rows,
 
 bool MATRIXWORLD_matrixBlanking(WorldMatrix *const matrix_p,
                                 const Cords *const coordinates_p,
-                                uint16_t noOfElementsToBlock) {
+                                size_t noOfElementsToBlock) {
+  MATRIXWORLD_internal_nullCheck(
+      matrix_p, "FATAL ERROR: Trying to blank cells of uninitialized matrix\n");
   if (noOfElementsToBlock > matrix_p->worldSize) {
     fprintf(
         stderr,
         "FATAL ERROR: Can not blank more elements than a matrix can hold\n");
     exit(EXIT_FAILURE);
   }
+  uint32_t noOfNewlyBlocked = 0;
   const Cords* currentCoords_p = coordinates_p;
-  for (uint16_t index = 0; index < noOfElementsToBlock; index++) {
+  for (size_t index = 0; index < noOfElementsToBlock; index++) {
     Cords elementToSet = *currentCoords_p;
-    MATRIXWORLD_setCell(matrix_p, elementToSet.row, elementToSet.col, true);
+    MATRIXWORLD_internal_checkSizeBoundaries(
+        matrix_p, elementToSet.row, elementToSet.col,
+        "ERROR: Trying to blank cell(%d,%d) in WorldMatrix, but the cell "
+        "coordinates are out of bounds for this matrix!\n",
+        elementToSet.row, elementToSet.col);
+    uint64_t *word_p = MATRIXWORLD_unchecked_cellWord(matrix_p, elementToSet.row,
+                                                     elementToSet.col);
+    uint64_t bit = UINT64_C(1)
+                   << MATRIXWORLD_unchecked_cellBit(elementToSet.row, elementToSet.col);
+    // Duplicated coordinates are counted only once
+    noOfNewlyBlocked += (*word_p & bit) == 0;
+    *word_p |= bit;
     currentCoords_p++;
   }
-  matrix_p->noOfBlockedCells = noOfElementsToBlock;
-  matrix_p->noOfUnblockedCells =
-      matrix_p->noOfUnblockedCells - noOfElementsToBlock;
+  matrix_p->noOfBlockedCells += noOfNewlyBlocked;
+  matrix_p->noOfUnblockedCells -= noOfNewlyBlocked;
   return true;
 }
 
@@ -138,32 +184,48 @@ void MATRIXWORLD_setCell(WorldMatrix *const matrix_p, uint16_t row,
       "coordinates are out of bounds for this matrix!\n",
       row, col);
 
-  uint32_t oneDimMappedIndex = (uint32_t)((row * matrix_p->cols) + col);
+  uint64_t *word_p = MATRIXWORLD_unchecked_cellWord(matrix_p, row, col);
+  uint64_t bit = UINT64_C(1) << MATRIXWORLD_unchecked_cellBit(row, col);
 
-  if (matrix_p->worldMatrix[oneDimMappedIndex] != state) {
-    matrix_p->worldMatrix[oneDimMappedIndex] = state;
+  if (((*word_p & bit) != 0) != state) {
+    *word_p ^= bit;
     matrix_p->noOfBlockedCells = state ? (matrix_p->noOfBlockedCells + 1)
                                        : (matrix_p->noOfBlockedCells - 1);
     matrix_p->noOfUnblockedCells = state ? (matrix_p->noOfUnblockedCells - 1)
                                          : (matrix_p->noOfUnblockedCells + 1);
   } else {
-    fprintf(stdout,
+    OUTPUT_logDiagnostic(
             "ABNORMAL: The cell state for cell (%d,%d) has not been changed as "
             "it was already in state=%d\n",
             row, col, state);
   }
 }
 
+void MATRIXWORLD_recountCells(WorldMatrix *const matrix_p) {
+  MATRIXWORLD_internal_nullCheck(
+      matrix_p,
+      "ERROR: Trying to recountCells but WorldMatrix is uninitialized!\n");
+  size_t noOfSetBits = 0;
+  for (size_t index = 0; index < matrix_p->noOfWords; index++) {
+    noOfSetBits += (size_t)__builtin_popcountll(matrix_p->worldMatrix[index]);
+  }
+  // Padding bits are always set, they are not cells.
+  size_t noOfPaddingBits = matrix_p->noOfWords * CELLS_PER_WORD - matrix_p->worldSize;
+  matrix_p->noOfBlockedCells = (uint32_t)(noOfSetBits - noOfPaddingBits);
+  matrix_p->noOfUnblockedCells =
+      (uint32_t)(matrix_p->worldSize - matrix_p->noOfBlockedCells);
+}
+
 void MATRIXWORLD_clearMatrix(WorldMatrix *const matrix_p) {
   MATRIXWORLD_internal_nullCheck(
       matrix_p,
       "ERROR: Trying to clearMatrix but WorldMatrix is uninitialized!\n");
   if (matrix_p->noOfBlockedCells != 0) {
-    memset(matrix_p->worldMatrix, 0, (sizeof(bool) * matrix_p->worldSize));
+    MATRIXWORLD_internal_resetStorage(matrix_p);
     matrix_p->noOfBlockedCells = 0;
     matrix_p->noOfUnblockedCells = matrix_p->worldSize;
   } else {
-    fprintf(stdout, "ABNORMAL: Attempting to clear the WorldMatrix but it is "
+    OUTPUT_logDiagnostic("ABNORMAL: Attempting to clear the WorldMatrix but it is "
                     "empty already\n");
   }
 }
@@ -189,20 +251,40 @@ uint16_t MATRIXWORLD_countUnblockedNeighbors(WorldMatrix *const matrix_p,
       "ERROR: Trying to countUnblockedNeighbors in WorldMatrix, but the cell "
       "coordinates are out of bounds for this matrix!\n");
 
-  uint16_t unblockedNeighbours = 0;
-  for (uint8_t index = 0; index < FOUR_DIRECTIONS; index++) {
-    int16_t newRow = row + directions[index].row;
-    int16_t newCol = col + directions[index].col;
-
-    if (newRow >= 0 && newRow < matrix_p->rows && newCol >= 0 &&
-        newCol < matrix_p->cols) {
-      if (!MATRIXWORLD_isBlocked(matrix_p, (uint16_t)newRow,
-                                 (uint16_t)newCol)) {
-        unblockedNeighbours++;
-      }
-    }
+  return (uint16_t)__builtin_popcount(
+      MATRIXWORLD_getUnblockedNeighborMask(matrix_p, row, col));
+}
+
+uint8_t MATRIXWORLD_getUnblockedNeighborMask(const WorldMatrix *const matrix_p,
+                                             uint16_t row, uint16_t col) {
+  MATRIXWORLD_internal_nullCheck(matrix_p,
+                                 "FATAL ERROR: WorldMatrix is uninitialized\n");
+  MATRIXWORLD_internal_checkSizeBoundaries(
+      matrix_p, row, col,
+      "ERROR: Trying to getUnblockedNeighborMask in WorldMatrix, but the cell "
+      "coordinates are out of bounds for this matrix!\n");
+
+  return MATRIXWORLD_unchecked_getUnblockedNeighborMask(matrix_p, row, col);
+}
+
+uint64_t MATRIXWORLD_getRowWord(const WorldMatrix *const matrix_p, uint16_t row,
+                                uint16_t wordIndex) {
+  MATRIXWORLD_internal_nullCheck(matrix_p,
+                                 "FATAL ERROR: WorldMatrix is uninitialized\n");
+  if (row >= matrix_p->rows || wordIndex >= matrix_p->wordsPerRow) {
+    fprintf(stderr,
+            "ERROR: Trying to getRowWord(%d,%d) in WorldMatrix, but the word is "
+            "out of bounds for this matrix!\n",
+            row, wordIndex);
+    exit(EXIT_FAILURE);
   }
-  return unblockedNeighbours;
+  return MATRIXWORLD_unchecked_getRowWord(matrix_p, row, wordIndex);
+}
+
+uint16_t MATRIXWORLD_getWordsPerRow(const WorldMatrix *const matrix_p) {
+  MATRIXWORLD_internal_nullCheck(matrix_p,
+                                 "FATAL ERROR: WorldMatrix is uninitialized\n");
+  return matrix_p->wordsPerRow;
 }
 
 bool MATRIXWORLD_isBlocked(const WorldMatrix *const matrix_p, uint16_t row,
@@ -216,19 +298,17 @@ bool MATRIXWORLD_isBlocked(const WorldMatrix *const matrix_p, uint16_t row,
       "the cell coordinates are out of bounds for this matrix!\n",
       row, col);
 
-  uint32_t oneDimMappedIndex = (uint32_t)((row * matrix_p->cols) + col);
-
-  return matrix_p->worldMatrix[oneDimMappedIndex];
+  return MATRIXWORLD_unchecked_isBlocked(matrix_p, row, col);
 }
 
-uint16_t MATRIXWORLD_getNoOfUnblockedCells(const WorldMatrix *const matrix_p) {
+uint32_t MATRIXWORLD_getNoOfUnblockedCells(const WorldMatrix *const matrix_p) {
   MATRIXWORLD_internal_nullCheck(
       matrix_p, "FATAL ERROR: trying to get noOfUnblockedCells, but "
                 "WorldMatrix is uninitialized\n");
   return matrix_p->noOfUnblockedCells;
 }
 
-uint16_t MATRIXWORLD_getNoOfBlockedCells(WorldMatrix *const matrix_p) {
+uint32_t MATRIXWORLD_getNoOfBlockedCells(WorldMatrix *const matrix_p) {
   MATRIXWORLD_internal_nullCheck(
       matrix_p, "FATAL ERROR: trying to get noOfBlockedCells, but "
                 "WorldMatrix is uninitialized\n");
@@ -240,7 +320,7 @@ double MATRIXWORLD_getBlockedToUnblockedRatio(WorldMatrix *const matrix_p) {
       matrix_p, "FATAL ERROR: trying to get blockedToUnblockedRatio, but "
                 "WorldMatrix is uninitialized\n");
   if (matrix_p->noOfBlockedCells == 0 || matrix_p->noOfUnblockedCells == 0) {
-    fprintf(stderr,
+    OUTPUT_logDiagnostic(
             "ABNORMAL: Division by zero when getBlockedToUnblockedRatio "
             "noOfBlockedCells=%d noOfUnblockedCells=%d\n",
             matrix_p->noOfBlockedCells, matrix_p->noOfUnblockedCells);
@@ -256,6 +336,34 @@ size_t MATRIXWORLD_getSize(const WorldMatrix *const matrix_p) {
   return matrix_p->worldSize;
 }
 
+uint64_t MATRIXWORLD_getFingerprint(const WorldMatrix *const matrix_p) {
+  MATRIXWORLD_internal_nullCheck(matrix_p,
+                                 "FATAL ERROR: WorldMatrix is uninitialized\n");
+  uint64_t fingerprint = MATRIXWORLD_internal_hashWord(
+      SIZE_MAX, ((uint64_t)matrix_p->rows << 16) | matrix_p->cols);
+  for (size_t index = 0; index < matrix_p->noOfWords; index++) {
+    fingerprint ^= MATRIXWORLD_internal_hashWord(index, matrix_p->worldMatrix[index]);
+  }
+  return fingerprint;
+}
+
+uint64_t MATRIXWORLD_updateFingerprint(uint64_t fingerprint, const WorldMatrix *const matrix_p,
+                                       uint16_t row, uint16_t col) {
+  MATRIXWORLD_internal_nullCheck(matrix_p,
+                                 "FATAL ERROR: WorldMatrix is uninitialized\n");
+  MATRIXWORLD_internal_checkSizeBoundaries(
+      matrix_p, row, col,
+      "ERROR: Trying to updateFingerprint(%d,%d) in WorldMatrix, but the cell is out of "
+      "bounds for this matrix!\n",
+      row, col);
+  const uint64_t *word_p = MATRIXWORLD_unchecked_cellWord(matrix_p, row, col);
+  const size_t index = (size_t)(word_p - matrix_p->worldMatrix);
+  const uint64_t word = *word_p;
+  const uint64_t flippedWord = word ^ (UINT64_C(1) << MATRIXWORLD_unchecked_cellBit(row, col));
+  return fingerprint ^ MATRIXWORLD_internal_hashWord(index, word) ^
+         MATRIXWORLD_internal_hashWord(index, flippedWord);
+}
+
 /* > Local Function Definitions **********************************************/
 
 static void
@@ -278,4 +386,46 @@ MATRIXWORLD_internal_checkSizeBoundaries(const WorldMatrix *const matrix_p, uint
     va_end(args);
     exit(EXIT_FAILURE);
   }
-}
\ No newline at end of file
+}
+
+static void MATRIXWORLD_internal_resetStorage(WorldMatrix *const matrix_p) {
+  memset(matrix_p->worldMatrix, 0, sizeof(uint64_t) * matrix_p->noOfWords);
+
+#if defined(MATRIXWORLD_TILED_LAYOUT)
+  // The columns past the last one in every tile row, then the rows past the
+  // last one in every tile column.
+  const size_t noOfTileRows = matrix_p->noOfWords / matrix_p->tilesPerRow;
+  uint16_t usedCols = matrix_p->cols % TILE_SIZE;
+  if (usedCols != 0) {
+    uint64_t paddingMask = (UINT64_C(0xFF) & ~((UINT64_C(1) << usedCols) - 1)) *
+                           UINT64_C(0x0101010101010101);
+    for (size_t tileRow = 0; tileRow < noOfTileRows; tileRow++) {
+      matrix_p->worldMatrix[(tileRow * matrix_p->tilesPerRow) + matrix_p->tilesPerRow - 1] |=
+          paddingMask;
+    }
+  }
+  uint16_t usedRows = matrix_p->rows % TILE_SIZE;
+  if (usedRows != 0) {
+    uint64_t paddingMask = ~((UINT64_C(1) << (usedRows * TILE_SIZE)) - 1);
+    for (uint16_t tile = 0; tile < matrix_p->tilesPerRow; tile++) {
+      matrix_p->worldMatrix[((noOfTileRows - 1) * matrix_p->tilesPerRow) + tile] |= paddingMask;
+    }
+  }
+#else
+  uint16_t usedBitsInLastWord = matrix_p->cols % CELLS_PER_WORD;
+  if (usedBitsInLastWord != 0) {
+    uint64_t paddingMask = ~((UINT64_C(1) << usedBitsInLastWord) - 1);
+    for (uint16_t row = 0; row < matrix_p->rows; row++) {
+      matrix_p->worldMatrix[((size_t)row * matrix_p->wordsPerRow) +
+                            matrix_p->wordsPerRow - 1] = paddingMask;
+    }
+  }
+#endif
+}
+
+static uint64_t MATRIXWORLD_internal_hashWord(size_t index, uint64_t word) {
+  uint64_t value = word + ((uint64_t)index + 1) * UINT64_C(0x9E3779B97F4A7C15);
+  value = (value ^ (value >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
+  value = (value ^ (value >> 27)) * UINT64_C(0x94D049BB133111EB);
+  return value ^ (value >> 31);
+}
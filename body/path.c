@@ -8,8 +8,10 @@
  */
 
 /* > Includes ****************************************************************/
+#define PATH_UNCHECKED_API
 #include "path.h"
 #include "matrixWorld.h"
+#include "pathOutput.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -19,14 +21,6 @@
 
 /* > Type Declarations *******************************************************/ 
 
-/**
- * @brief Defines the internal structure of the Path.
- */
-struct Path {
-  size_t pathSize; ///< The total capacity of the path.
-  size_t currentNoOfCordsInPath; ///< The current number of coordinates stored.
-  Cords pathArray[]; ///< A flexible array member to hold the coordinates.
-};
 
 /* > Global Constant Definitions *********************************************/
 
@@ -46,18 +40,18 @@ struct Path {
 static void PATH_internal_nullCheck(const Path *const path_p,
                                     const char *restrict message);
 
+/**
+ * @brief Internal function to validate the capacity of a new path.
+ * @param pathSize[in] The requested capacity.
+ * @param matrix_p[in] Pointer to the WorldMatrix the path is for.
+ */
+static void PATH_internal_checkSize(const size_t pathSize, const WorldMatrix *const matrix_p);
+
 /* > Global Function Definitions *********************************************/
 
 Path *PATH_initializePath(const size_t pathSize,
                           const WorldMatrix *const matrix_p) {
-  size_t matrixSize = MATRIXWORLD_getSize(matrix_p);
-  if (pathSize == 0) {
-    fprintf(stderr, "FATAL ERROR: Path size can not be 0!\n");
-    exit(EXIT_FAILURE);
-  } else if (pathSize > (matrixSize * SEVENTY_FIVE_PERCENT)) {
-    fprintf(stderr, "ERROR: Path size must be within 75%% size "
-                    "constraint of the matrix!\n");
-  }
+  PATH_internal_checkSize(pathSize, matrix_p);
   size_t sizeOfThePathStruct = sizeof(Path) + (sizeof(Cords) * pathSize);
   Path *newPath = (Path*)malloc(sizeOfThePathStruct);
   PATH_internal_nullCheck(
@@ -69,7 +63,24 @@ Path *PATH_initializePath(const size_t pathSize,
   return newPath;
 }
 
-void PATH_freePath(Path** const path_pp) { free(*path_pp); }
+Path *PATH_initializePathInArena(const size_t pathSize,
+                                 const WorldMatrix *const matrix_p,
+                                 Arena *const arena_p) {
+  PATH_internal_checkSize(pathSize, matrix_p);
+  Path *newPath = ARENA_allocate(arena_p, sizeof(Path) + (sizeof(Cords) * pathSize));
+  newPath->pathSize = pathSize;
+  newPath->currentNoOfCordsInPath = 0;
+
+  return newPath;
+}
+
+void PATH_freePath(Path** const path_pp) {
+  if (path_pp == NULL) {
+    return;
+  }
+  free(*path_pp);
+  *path_pp = NULL;
+}
 
 void PATH_addCoordinates(Path* const path_p, uint16_t row, uint16_t col) {
   PATH_internal_nullCheck(
@@ -194,11 +205,29 @@ void PATH_printPath(const Path* const path_p) {
     printf("Path is empty.\n");
     return;
   }
-  printf("Path (length %zu):\n", path_p->currentNoOfCordsInPath);
+  // One fwrite per buffer instead of one printf per cell.
+  OutputWriter *writer_p = malloc(sizeof(OutputWriter));
+  if (writer_p == NULL) {
+    fprintf(stderr, "FATAL ERROR: Could not allocate memory for the OutputWriter!\n");
+    exit(EXIT_FAILURE);
+  }
+  OUTPUT_initWriter(writer_p, stdout);
+  OUTPUT_writeString(writer_p, "Path (length ");
+  OUTPUT_writeUint(writer_p, path_p->currentNoOfCordsInPath);
+  OUTPUT_writeString(writer_p, "):\n");
   for (size_t i = 0; i < path_p->currentNoOfCordsInPath; ++i) {
-    printf("  [%zu]: (%u, %u)\n", i, path_p->pathArray[i].row,
-           path_p->pathArray[i].col);
+    OUTPUT_writeString(writer_p, "  [");
+    OUTPUT_writeUint(writer_p, i);
+    OUTPUT_writeString(writer_p, "]: (");
+    OUTPUT_writeUint(writer_p, path_p->pathArray[i].row);
+    OUTPUT_writeString(writer_p, ", ");
+    OUTPUT_writeUint(writer_p, path_p->pathArray[i].col);
+    OUTPUT_writeString(writer_p, ")\n");
   }
+  if (!OUTPUT_flushWriter(writer_p)) {
+    fprintf(stderr, "ERROR: Could not print the Path!\n");
+  }
+  free(writer_p);
 }
 
 size_t PATH_getByteSize(const Path* const path_p)
@@ -208,6 +237,17 @@ size_t PATH_getByteSize(const Path* const path_p)
 
 /* > Local Function Definitions **********************************************/
 
+static void PATH_internal_checkSize(const size_t pathSize, const WorldMatrix *const matrix_p) {
+  size_t matrixSize = MATRIXWORLD_getSize(matrix_p);
+  if (pathSize == 0) {
+    fprintf(stderr, "FATAL ERROR: Path size can not be 0!\n");
+    exit(EXIT_FAILURE);
+  } else if (pathSize > (matrixSize * SEVENTY_FIVE_PERCENT)) {
+    OUTPUT_logDiagnostic("ERROR: Path size must be within 75%% size "
+                    "constraint of the matrix!\n");
+  }
+}
+
 static void PATH_internal_nullCheck(const Path *const path_p,
                                     const char *restrict message) {
   if (path_p == NULL) {
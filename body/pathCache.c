@@ -0,0 +1,421 @@
+/* > Description ****************************************************************/
+/**
+ * @file pathCache.c
+ * @brief This is the file for the path cache. Every entry holds the longest
+ *        path found for one world and neighborhood together with the set of
+ *        its cells, so an edit of the matrix finds out in constant time
+ *        whether it touches the path. The entries are few and searched
+ *        linearly.
+ */
+
+/* > Includes ****************************************************************/
+#define MATRIXWORLD_UNCHECKED_API
+#define PATH_UNCHECKED_API
+#define VISITED_UNCHECKED_API
+#include "pathCache.h"
+#include "dfsPathFinding.h"
+#include "matrixWorld.h"
+#include "path.h"
+#include "visitedSet.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* > Defines *****************************************************************/
+
+/* > Type Declarations *******************************************************/
+
+/**
+ * @brief The cached path of one world.
+ */
+typedef struct {
+    uint64_t fingerprint;          ///< Fingerprint of the world, see MATRIXWORLD_getFingerprint.
+    uint16_t rows;                 ///< Size of the world, compared on top of the fingerprint.
+    uint16_t cols;
+    DFS_Neighborhood neighborhood; ///< Steps of the path, compared as well.
+    uint64_t lastUse;              ///< Use clock of the last lookup, 0 for a free entry.
+    Path *path_p;                  ///< The longest path found for the world.
+    VisitedSet *cells_p;           ///< The cells of the path.
+} PathCacheEntry_t;
+
+/**
+ * @brief Defines the internal structure of the PathCache.
+ */
+struct PathCache {
+    PathCacheEntry_t entries[PATHCACHE_NO_OF_ENTRIES];
+    uint64_t useClock; ///< Incremented on every lookup.
+    Path *reversed_p;  ///< Scratch path, a cached path grown from its first cell.
+};
+
+/* > Global Constant Definitions *********************************************/
+
+/* > Global Variable Definitions *********************************************/
+
+/* > Local Constant Definitions **********************************************/
+
+/* > Local Variable Definitions **********************************************/
+
+/* > Local Function Declarations *********************************************/
+
+/**
+ * @brief Internal function to check for a null cache and exit on failure.
+ * @param cache_p[in] Pointer to the PathCache.
+ * @param message[in] The error message to print on failure.
+ */
+static void PATHCACHE_internal_nullCheck(const PathCache *const cache_p,
+                                         const char *restrict message);
+
+/**
+ * @brief Looks up the entry of a world for a neighborhood and marks it as used.
+ * @param cache_p[in,out]  Pointer to the PathCache.
+ * @param matrix_p[in]     Pointer to the WorldMatrix of the world.
+ * @param fingerprint[in]  The fingerprint of the world.
+ * @param neighborhood[in] The steps of the paths of the entry.
+ * @return The entry, or NULL if the world has none.
+ */
+static PathCacheEntry_t *PATHCACHE_internal_findEntry(PathCache *const cache_p,
+                                                      const WorldMatrix *const matrix_p,
+                                                      uint64_t fingerprint,
+                                                      DFS_Neighborhood neighborhood);
+
+/**
+ * @brief Looks up the entry holding the longest cached path a query may use.
+ *
+ * A path of the four neighborhood is a path of the eight neighborhood as
+ * well, so an eight-neighborhood query may also use the four-neighborhood
+ * entry, never the other way around.
+ *
+ * @param cache_p[in,out]  Pointer to the PathCache.
+ * @param matrix_p[in]     Pointer to the WorldMatrix of the world.
+ * @param fingerprint[in]  The fingerprint of the world.
+ * @param neighborhood[in] The steps of the query.
+ * @return The entry, or NULL if the world has none for the query.
+ */
+static PathCacheEntry_t *PATHCACHE_internal_findUsableEntry(PathCache *const cache_p,
+                                                            const WorldMatrix *const matrix_p,
+                                                            uint64_t fingerprint,
+                                                            DFS_Neighborhood neighborhood);
+
+/**
+ * @brief Gives a world an entry, the free one or the least recently used one.
+ * @param cache_p[in,out]  Pointer to the PathCache.
+ * @param matrix_p[in]     Pointer to the WorldMatrix of the world.
+ * @param fingerprint[in]  The fingerprint of the world.
+ * @param neighborhood[in] The steps of the paths of the entry.
+ * @return The entry, holding an empty path and no cell.
+ */
+static PathCacheEntry_t *PATHCACHE_internal_claimEntry(PathCache *const cache_p,
+                                                       const WorldMatrix *const matrix_p,
+                                                       uint64_t fingerprint,
+                                                       DFS_Neighborhood neighborhood);
+
+/**
+ * @brief Frees the path and the cells of an entry and marks it as free.
+ * @param entry_p[in,out] The entry.
+ */
+static void PATHCACHE_internal_releaseEntry(PathCacheEntry_t *const entry_p);
+
+/**
+ * @brief Cuts the path of an entry at a cell that got blocked, keeping the
+ *        longer of the two remaining parts.
+ * @param entry_p[in,out] The entry, its path holds the cell.
+ * @param blocked[in]     The blocked cell.
+ */
+static void PATHCACHE_internal_cutPath(PathCacheEntry_t *const entry_p, Cords blocked);
+
+/**
+ * @brief Writes the first cells of a cached path into a result path.
+ * @param result_p[out]  The result, holding at least pathLength cells.
+ * @param cells_p[in]    The first cell of the cached path.
+ * @param pathLength[in] The number of cells to copy.
+ */
+static void PATHCACHE_internal_copyPrefix(Path *const result_p, const Cords *const cells_p,
+                                          uint32_t pathLength);
+
+/* > Global Function Definitions *********************************************/
+
+PathCache *PATHCACHE_createCache(void) {
+    PathCache *cache_p = calloc(1, sizeof(PathCache));
+    PATHCACHE_internal_nullCheck(
+        cache_p, "FATAL ERROR: PathCache structure could not be initialized. No memory!\n");
+    return cache_p;
+}
+
+void PATHCACHE_destroyCache(PathCache **const cache_pp) {
+    if (cache_pp == NULL || *cache_pp == NULL) {
+        return;
+    }
+    for (size_t index = 0; index < PATHCACHE_NO_OF_ENTRIES; index++) {
+        PATHCACHE_internal_releaseEntry(&(*cache_pp)->entries[index]);
+    }
+    PATH_freePath(&(*cache_pp)->reversed_p);
+    free(*cache_pp);
+    *cache_pp = NULL;
+}
+
+Path *PATHCACHE_findPath(PathCache *const cache_p, WorldMatrix *matrix_p, uint32_t pathLength,
+                         const DFS_SearchOptions *options_p) {
+    PATHCACHE_internal_nullCheck(cache_p, "FATAL ERROR: PathCache is not initialized!\n");
+    if (matrix_p == NULL) {
+        fprintf(stderr, "FATAL ERROR: WorldMatrix supplied to PATHCACHE_findPath is NULL!\n");
+        exit(EXIT_FAILURE);
+    }
+    if (pathLength == 0 || pathLength > MATRIXWORLD_unchecked_getNoOfUnblockedCells(matrix_p)) {
+        return NULL;
+    }
+    const uint64_t fingerprint = MATRIXWORLD_getFingerprint(matrix_p);
+    const DFS_Neighborhood neighborhood =
+        (options_p == NULL) ? DFS_getDefaultOptions().neighborhood : options_p->neighborhood;
+    Path *result_p = PATH_initializePath(pathLength, matrix_p);
+    // A hit needs no search context, and so no thread and no search buffer.
+    const Cords *prefix_p =
+        PATHCACHE_getPrefix(cache_p, matrix_p, fingerprint, neighborhood, pathLength);
+    if (prefix_p != NULL) {
+        PATHCACHE_internal_copyPrefix(result_p, prefix_p, pathLength);
+        return result_p;
+    }
+    DFS_SearchContext *context_p = DFS_createSearchContext(matrix_p, options_p);
+    DFS_SearchStatus status =
+        PATHCACHE_searchBounded(cache_p, context_p, matrix_p, fingerprint, pathLength, result_p);
+    DFS_destroySearchContext(&context_p);
+    if (status != DFS_STATUS_FOUND) {
+        PATH_freePath(&result_p);
+    }
+    return result_p;
+}
+
+DFS_SearchStatus PATHCACHE_searchBounded(PathCache *const cache_p,
+                                         DFS_SearchContext *const context_p,
+                                         const WorldMatrix *const matrix_p, uint64_t fingerprint,
+                                         uint32_t pathLength, Path *const result_p) {
+    PATHCACHE_internal_nullCheck(cache_p, "FATAL ERROR: PathCache is not initialized!\n");
+    if (context_p == NULL || matrix_p == NULL || result_p == NULL ||
+        result_p->pathSize < pathLength) {
+        fprintf(stderr, "FATAL ERROR: PATHCACHE_searchBounded needs a DFS_SearchContext, its "
+                        "WorldMatrix and a result Path of the requested length!\n");
+        exit(EXIT_FAILURE);
+    }
+    const DFS_Neighborhood neighborhood = DFS_getSearchContextOptions(context_p)->neighborhood;
+    const Cords *prefix_p =
+        PATHCACHE_getPrefix(cache_p, matrix_p, fingerprint, neighborhood, pathLength);
+    if (prefix_p != NULL) {
+        PATHCACHE_internal_copyPrefix(result_p, prefix_p, pathLength);
+        return DFS_STATUS_FOUND;
+    }
+
+    // The deadline and the node budget cover the whole query, not each search of it.
+    DFS_beginQuery(context_p);
+    DFS_SearchStatus status = DFS_STATUS_NOT_FOUND;
+    PathCacheEntry_t *entry_p =
+        PATHCACHE_internal_findUsableEntry(cache_p, matrix_p, fingerprint, neighborhood);
+    if (entry_p != NULL) {
+        // Grow the cached path at its last cell, then at its first one.
+        const Path *cached_p = entry_p->path_p;
+        const size_t cachedLength = PATH_unchecked_getLength(cached_p);
+        status = DFS_extendBounded(context_p, cached_p, pathLength, result_p);
+        if (status == DFS_STATUS_NOT_FOUND && cachedLength > 1) {
+            if (cache_p->reversed_p == NULL || cache_p->reversed_p->pathSize < cachedLength) {
+                PATH_freePath(&cache_p->reversed_p);
+                cache_p->reversed_p = PATH_initializePath(cachedLength, matrix_p);
+            }
+            Path *reversed_p = cache_p->reversed_p;
+            for (size_t index = 0; index < cachedLength; index++) {
+                reversed_p->pathArray[index] = cached_p->pathArray[cachedLength - 1 - index];
+            }
+            reversed_p->currentNoOfCordsInPath = cachedLength;
+            status = DFS_extendBounded(context_p, reversed_p, pathLength, result_p);
+        }
+    }
+    if (status == DFS_STATUS_NOT_FOUND) {
+        status = DFS_searchBounded(context_p, pathLength, result_p);
+    }
+    DFS_endQuery(context_p);
+    if (PATH_unchecked_getLength(result_p) > 0) {
+        PATHCACHE_storePath(cache_p, matrix_p, fingerprint, neighborhood, result_p);
+    }
+    return status;
+}
+
+const Cords *PATHCACHE_getPrefix(PathCache *const cache_p, const WorldMatrix *const matrix_p,
+                                 uint64_t fingerprint, DFS_Neighborhood neighborhood,
+                                 uint32_t pathLength) {
+    PATHCACHE_internal_nullCheck(cache_p, "FATAL ERROR: PathCache is not initialized!\n");
+    const PathCacheEntry_t *entry_p =
+        PATHCACHE_internal_findUsableEntry(cache_p, matrix_p, fingerprint, neighborhood);
+    if (entry_p == NULL || pathLength == 0 || PATH_unchecked_getLength(entry_p->path_p) < pathLength) {
+        return NULL;
+    }
+    return entry_p->path_p->pathArray;
+}
+
+void PATHCACHE_storePath(PathCache *const cache_p, const WorldMatrix *const matrix_p,
+                         uint64_t fingerprint, DFS_Neighborhood neighborhood,
+                         const Path *const path_p) {
+    PATHCACHE_internal_nullCheck(cache_p, "FATAL ERROR: PathCache is not initialized!\n");
+    if (matrix_p == NULL || path_p == NULL) {
+        fprintf(stderr, "FATAL ERROR: PATHCACHE_storePath needs a WorldMatrix and a Path!\n");
+        exit(EXIT_FAILURE);
+    }
+    const size_t pathLength = PATH_unchecked_getLength(path_p);
+    PathCacheEntry_t *entry_p =
+        PATHCACHE_internal_findEntry(cache_p, matrix_p, fingerprint, neighborhood);
+    if (pathLength == 0 ||
+        (entry_p != NULL && PATH_unchecked_getLength(entry_p->path_p) >= pathLength)) {
+        return;
+    }
+    if (entry_p == NULL) {
+        entry_p = PATHCACHE_internal_claimEntry(cache_p, matrix_p, fingerprint, neighborhood);
+    }
+    if (entry_p->path_p->pathSize < pathLength) {
+        PATH_freePath(&entry_p->path_p);
+        entry_p->path_p = PATH_initializePath(pathLength, matrix_p);
+    }
+    memcpy(entry_p->path_p->pathArray, path_p->pathArray, sizeof(Cords) * pathLength);
+    entry_p->path_p->currentNoOfCordsInPath = pathLength;
+    VISITED_clearSet(entry_p->cells_p);
+    for (size_t index = 0; index < pathLength; index++) {
+        VISITED_unchecked_markCell(entry_p->cells_p, path_p->pathArray[index].row,
+                                   path_p->pathArray[index].col);
+    }
+}
+
+uint64_t PATHCACHE_noteCellChange(PathCache *const cache_p, const WorldMatrix *const matrix_p,
+                                  uint64_t fingerprint, uint16_t row, uint16_t col) {
+    PATHCACHE_internal_nullCheck(cache_p, "FATAL ERROR: PathCache is not initialized!\n");
+    const uint64_t newFingerprint = MATRIXWORLD_updateFingerprint(fingerprint, matrix_p, row, col);
+    const DFS_Neighborhood neighborhoods[] = {DFS_NEIGHBORHOOD_FOUR, DFS_NEIGHBORHOOD_EIGHT};
+    for (size_t index = 0; index < sizeof(neighborhoods) / sizeof(neighborhoods[0]); index++) {
+        PathCacheEntry_t *entry_p =
+            PATHCACHE_internal_findEntry(cache_p, matrix_p, fingerprint, neighborhoods[index]);
+        if (entry_p == NULL) {
+            continue;
+        }
+        // The world may have been cached before, the changed path replaces it.
+        PathCacheEntry_t *stale_p =
+            PATHCACHE_internal_findEntry(cache_p, matrix_p, newFingerprint, neighborhoods[index]);
+        if (stale_p != NULL) {
+            PATHCACHE_internal_releaseEntry(stale_p);
+        }
+        entry_p->fingerprint = newFingerprint;
+        if (MATRIXWORLD_unchecked_isBlocked(matrix_p, row, col) &&
+            VISITED_unchecked_isMarked(entry_p->cells_p, row, col)) {
+            PATHCACHE_internal_cutPath(entry_p, (Cords){.row = row, .col = col});
+            if (PATH_unchecked_getLength(entry_p->path_p) == 0) {
+                PATHCACHE_internal_releaseEntry(entry_p);
+            }
+        }
+    }
+    return newFingerprint;
+}
+
+/* > Local Function Definitions **********************************************/
+
+static void PATHCACHE_internal_nullCheck(const PathCache *const cache_p,
+                                         const char *restrict message) {
+    if (cache_p == NULL) {
+        fprintf(stderr, "%s", message);
+        exit(EXIT_FAILURE);
+    }
+}
+
+static PathCacheEntry_t *PATHCACHE_internal_findEntry(PathCache *const cache_p,
+                                                      const WorldMatrix *const matrix_p,
+                                                      uint64_t fingerprint,
+                                                      DFS_Neighborhood neighborhood) {
+    for (size_t index = 0; index < PATHCACHE_NO_OF_ENTRIES; index++) {
+        PathCacheEntry_t *entry_p = &cache_p->entries[index];
+        if (entry_p->lastUse != 0 && entry_p->fingerprint == fingerprint &&
+            entry_p->neighborhood == neighborhood &&
+            entry_p->rows == MATRIXWORLD_unchecked_getRowSize(matrix_p) &&
+            entry_p->cols == MATRIXWORLD_unchecked_getColSize(matrix_p)) {
+            entry_p->lastUse = ++cache_p->useClock;
+            return entry_p;
+        }
+    }
+    return NULL;
+}
+
+static PathCacheEntry_t *PATHCACHE_internal_findUsableEntry(PathCache *const cache_p,
+                                                            const WorldMatrix *const matrix_p,
+                                                            uint64_t fingerprint,
+                                                            DFS_Neighborhood neighborhood) {
+    PathCacheEntry_t *entry_p =
+        PATHCACHE_internal_findEntry(cache_p, matrix_p, fingerprint, neighborhood);
+    if (neighborhood == DFS_NEIGHBORHOOD_EIGHT) {
+        PathCacheEntry_t *fourEntry_p =
+            PATHCACHE_internal_findEntry(cache_p, matrix_p, fingerprint, DFS_NEIGHBORHOOD_FOUR);
+        if (fourEntry_p != NULL &&
+            (entry_p == NULL || PATH_unchecked_getLength(fourEntry_p->path_p) >
+                                    PATH_unchecked_getLength(entry_p->path_p))) {
+            entry_p = fourEntry_p;
+        }
+    }
+    return entry_p;
+}
+
+static PathCacheEntry_t *PATHCACHE_internal_claimEntry(PathCache *const cache_p,
+                                                       const WorldMatrix *const matrix_p,
+                                                       uint64_t fingerprint,
+                                                       DFS_Neighborhood neighborhood) {
+    PathCacheEntry_t *entry_p = &cache_p->entries[0];
+    for (size_t index = 1; index < PATHCACHE_NO_OF_ENTRIES; index++) {
+        if (cache_p->entries[index].lastUse < entry_p->lastUse) {
+            entry_p = &cache_p->entries[index];
+        }
+    }
+    // The buffers of an entry of the same size are kept for the new world.
+    if (entry_p->rows != MATRIXWORLD_unchecked_getRowSize(matrix_p) ||
+        entry_p->cols != MATRIXWORLD_unchecked_getColSize(matrix_p)) {
+        PATHCACHE_internal_releaseEntry(entry_p);
+    }
+    if (entry_p->path_p == NULL) {
+        entry_p->path_p = PATH_initializePath(1, matrix_p);
+        entry_p->cells_p = VISITED_createSet(matrix_p);
+    }
+    PATH_clearPath(entry_p->path_p);
+    entry_p->fingerprint = fingerprint;
+    entry_p->neighborhood = neighborhood;
+    entry_p->rows = MATRIXWORLD_unchecked_getRowSize(matrix_p);
+    entry_p->cols = MATRIXWORLD_unchecked_getColSize(matrix_p);
+    entry_p->lastUse = ++cache_p->useClock;
+    return entry_p;
+}
+
+static void PATHCACHE_internal_releaseEntry(PathCacheEntry_t *const entry_p) {
+    PATH_freePath(&entry_p->path_p);
+    VISITED_destroySet(&entry_p->cells_p);
+    *entry_p = (PathCacheEntry_t){0};
+}
+
+static void PATHCACHE_internal_cutPath(PathCacheEntry_t *const entry_p, Cords blocked) {
+    Path *path_p = entry_p->path_p;
+    const size_t pathLength = PATH_unchecked_getLength(path_p);
+    size_t position = 0;
+    while (path_p->pathArray[position].row != blocked.row ||
+           path_p->pathArray[position].col != blocked.col) {
+        position++;
+    }
+    const size_t tailLength = pathLength - position - 1;
+    if (position >= tailLength) {
+        // Keep the cells in front of the blocked one.
+        for (size_t index = position; index < pathLength; index++) {
+            VISITED_unchecked_unmarkCell(entry_p->cells_p, path_p->pathArray[index].row,
+                                         path_p->pathArray[index].col);
+        }
+        path_p->currentNoOfCordsInPath = position;
+        return;
+    }
+    // Keep the cells behind the blocked one.
+    for (size_t index = 0; index <= position; index++) {
+        VISITED_unchecked_unmarkCell(entry_p->cells_p, path_p->pathArray[index].row,
+                                     path_p->pathArray[index].col);
+    }
+    memmove(path_p->pathArray, &path_p->pathArray[position + 1], sizeof(Cords) * tailLength);
+    path_p->currentNoOfCordsInPath = tailLength;
+}
+
+static void PATHCACHE_internal_copyPrefix(Path *const result_p, const Cords *const cells_p,
+                                          uint32_t pathLength) {
+    memcpy(result_p->pathArray, cells_p, sizeof(Cords) * pathLength);
+    result_p->currentNoOfCordsInPath = pathLength;
+}
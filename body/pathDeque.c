@@ -0,0 +1,225 @@
+/* > Description ****************************************************************/
+/**
+ * @file pathDeque.c
+ * @brief
+ *   This file provides the functionality of the PathDeque, a ring buffer of
+ *   coordinates in a struct with a flexible array member. The first
+ *   coordinate moves back and forth in the buffer, so both ends grow and
+ *   shrink without moving any other coordinate.
+ */
+
+/* > Includes ****************************************************************/
+#define PATH_UNCHECKED_API
+#define PATHDEQUE_UNCHECKED_API
+#include "pathDeque.h"
+#include "matrixWorld.h"
+#include "path.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* > Defines *****************************************************************/
+
+/* > Type Declarations *******************************************************/
+
+/* > Global Constant Definitions *********************************************/
+
+/* > Global Variable Definitions *********************************************/
+
+/* > Local Constant Definitions **********************************************/
+
+/* > Local Variable Definitions **********************************************/
+
+/* > Local Function Declarations *********************************************/
+
+/**
+ * @brief Internal function to check for null pointers and exit on failure.
+ * @param deque_p[in] Pointer to the PathDeque.
+ * @param message[in] The error message to print on failure.
+ */
+static void PATHDEQUE_internal_nullCheck(const PathDeque *const deque_p,
+                                         const char *restrict message);
+
+/**
+ * @brief Internal function to validate the capacity of a new deque.
+ * @param capacity[in] The requested capacity.
+ * @param matrix_p[in] Pointer to the WorldMatrix the deque is for.
+ */
+static void PATHDEQUE_internal_checkCapacity(const size_t capacity,
+                                             const WorldMatrix *const matrix_p);
+
+/**
+ * @brief Internal function to exit when a coordinate is added to a full deque.
+ * @param deque_p[in] Pointer to the PathDeque.
+ */
+static void PATHDEQUE_internal_checkNotFull(const PathDeque *const deque_p);
+
+/**
+ * @brief Internal function to report an empty deque.
+ * @param deque_p[in] Pointer to the PathDeque.
+ * @return true if the deque is empty, the error is then reported.
+ */
+static bool PATHDEQUE_internal_reportEmpty(const PathDeque *const deque_p);
+
+/* > Global Function Definitions *********************************************/
+
+PathDeque *PATHDEQUE_initializeDeque(const size_t capacity, const WorldMatrix *const matrix_p) {
+  PATHDEQUE_internal_checkCapacity(capacity, matrix_p);
+  PathDeque *newDeque = malloc(sizeof(PathDeque) + (sizeof(Cords) * capacity));
+  PATHDEQUE_internal_nullCheck(
+      newDeque, "FATAL ERROR: PathDeque structure could not be initialized. No memory!\n");
+  newDeque->capacity = capacity;
+  PATHDEQUE_unchecked_clearDeque(newDeque);
+  return newDeque;
+}
+
+PathDeque *PATHDEQUE_initializeDequeInArena(const size_t capacity,
+                                            const WorldMatrix *const matrix_p,
+                                            Arena *const arena_p) {
+  PATHDEQUE_internal_checkCapacity(capacity, matrix_p);
+  PathDeque *newDeque = ARENA_allocate(arena_p, sizeof(PathDeque) + (sizeof(Cords) * capacity));
+  newDeque->capacity = capacity;
+  PATHDEQUE_unchecked_clearDeque(newDeque);
+  return newDeque;
+}
+
+void PATHDEQUE_freeDeque(PathDeque **const deque_pp) {
+  if (deque_pp == NULL) {
+    return;
+  }
+  free(*deque_pp);
+  *deque_pp = NULL;
+}
+
+void PATHDEQUE_pushFront(PathDeque *const deque_p, uint16_t row, uint16_t col) {
+  PATHDEQUE_internal_nullCheck(deque_p, "FATAL ERROR: Trying to add coordinates to the "
+                                        "PathDeque, but it is not initialized!\n");
+  PATHDEQUE_internal_checkNotFull(deque_p);
+  PATHDEQUE_unchecked_pushFront(deque_p, row, col);
+}
+
+void PATHDEQUE_pushBack(PathDeque *const deque_p, uint16_t row, uint16_t col) {
+  PATHDEQUE_internal_nullCheck(deque_p, "FATAL ERROR: Trying to add coordinates to the "
+                                        "PathDeque, but it is not initialized!\n");
+  PATHDEQUE_internal_checkNotFull(deque_p);
+  PATHDEQUE_unchecked_pushBack(deque_p, row, col);
+}
+
+Cords PATHDEQUE_popFront(PathDeque *const deque_p) {
+  PATHDEQUE_internal_nullCheck(deque_p, "FATAL ERROR: Trying to remove coordinates from the "
+                                        "PathDeque, but it is not initialized!\n");
+  if (PATHDEQUE_internal_reportEmpty(deque_p)) {
+    return (Cords){.row = UINT16_MAX, .col = UINT16_MAX};
+  }
+  return PATHDEQUE_unchecked_popFront(deque_p);
+}
+
+Cords PATHDEQUE_popBack(PathDeque *const deque_p) {
+  PATHDEQUE_internal_nullCheck(deque_p, "FATAL ERROR: Trying to remove coordinates from the "
+                                        "PathDeque, but it is not initialized!\n");
+  if (PATHDEQUE_internal_reportEmpty(deque_p)) {
+    return (Cords){.row = UINT16_MAX, .col = UINT16_MAX};
+  }
+  return PATHDEQUE_unchecked_popBack(deque_p);
+}
+
+Cords PATHDEQUE_getFront(const PathDeque *const deque_p) {
+  PATHDEQUE_internal_nullCheck(deque_p, "FATAL ERROR: PathDeque is not initialized!\n");
+  if (PATHDEQUE_internal_reportEmpty(deque_p)) {
+    return (Cords){.row = UINT16_MAX, .col = UINT16_MAX};
+  }
+  return PATHDEQUE_unchecked_getFront(deque_p);
+}
+
+Cords PATHDEQUE_getBack(const PathDeque *const deque_p) {
+  PATHDEQUE_internal_nullCheck(deque_p, "FATAL ERROR: PathDeque is not initialized!\n");
+  if (PATHDEQUE_internal_reportEmpty(deque_p)) {
+    return (Cords){.row = UINT16_MAX, .col = UINT16_MAX};
+  }
+  return PATHDEQUE_unchecked_getBack(deque_p);
+}
+
+Cords PATHDEQUE_getAt(const PathDeque *const deque_p, size_t index) {
+  PATHDEQUE_internal_nullCheck(deque_p, "FATAL ERROR: PathDeque is not initialized!\n");
+  if (index >= deque_p->length) {
+    fprintf(stderr, "ERROR: Index %zu is outside the %zu coordinates of the PathDeque!\n", index,
+            deque_p->length);
+    return (Cords){.row = UINT16_MAX, .col = UINT16_MAX};
+  }
+  return PATHDEQUE_unchecked_getAt(deque_p, index);
+}
+
+size_t PATHDEQUE_getLength(const PathDeque *const deque_p) {
+  PATHDEQUE_internal_nullCheck(deque_p, "FATAL ERROR: PathDeque is not initialized!\n");
+  return deque_p->length;
+}
+
+bool PATHDEQUE_isEmpty(const PathDeque *const deque_p) {
+  PATHDEQUE_internal_nullCheck(deque_p, "FATAL ERROR: PathDeque is not initialized!\n");
+  return deque_p->length == 0;
+}
+
+void PATHDEQUE_clearDeque(PathDeque *const deque_p) {
+  PATHDEQUE_internal_nullCheck(deque_p, "FATAL ERROR: PathDeque is not initialized!\n");
+  PATHDEQUE_unchecked_clearDeque(deque_p);
+}
+
+void PATHDEQUE_copyToPath(const PathDeque *const deque_p, Path *const path_p) {
+  PATHDEQUE_internal_nullCheck(deque_p, "FATAL ERROR: PathDeque is not initialized!\n");
+  if (path_p == NULL || path_p->pathSize < deque_p->length) {
+    fprintf(stderr, "FATAL ERROR: The Path can not hold the %zu coordinates of the "
+                    "PathDeque!\n",
+            deque_p->length);
+    exit(EXIT_FAILURE);
+  }
+  // At most two runs, the one up to the end of the buffer and the wrapped one.
+  size_t firstRun = deque_p->capacity - deque_p->first;
+  if (firstRun > deque_p->length) {
+    firstRun = deque_p->length;
+  }
+  memcpy(path_p->pathArray, &deque_p->cellArray[deque_p->first], sizeof(Cords) * firstRun);
+  memcpy(&path_p->pathArray[firstRun], deque_p->cellArray,
+         sizeof(Cords) * (deque_p->length - firstRun));
+  path_p->currentNoOfCordsInPath = deque_p->length;
+}
+
+/* > Local Function Definitions **********************************************/
+
+static void PATHDEQUE_internal_nullCheck(const PathDeque *const deque_p,
+                                         const char *restrict message) {
+  if (deque_p == NULL) {
+    fprintf(stderr, "%s", message);
+    exit(EXIT_FAILURE);
+  }
+}
+
+static void PATHDEQUE_internal_checkCapacity(const size_t capacity,
+                                             const WorldMatrix *const matrix_p) {
+  if (capacity == 0) {
+    fprintf(stderr, "FATAL ERROR: PathDeque capacity can not be 0!\n");
+    exit(EXIT_FAILURE);
+  }
+  if (capacity > MATRIXWORLD_getSize(matrix_p)) {
+    fprintf(stderr, "FATAL ERROR: A PathDeque of %zu coordinates does not fit into the "
+                    "matrix!\n",
+            capacity);
+    exit(EXIT_FAILURE);
+  }
+}
+
+static void PATHDEQUE_internal_checkNotFull(const PathDeque *const deque_p) {
+  if (deque_p->length == deque_p->capacity) {
+    fprintf(stderr, "FATAL ERROR: Trying to add new coordinates to the PathDeque "
+                    "but reached its capacity!\n");
+    exit(EXIT_FAILURE);
+  }
+}
+
+static bool PATHDEQUE_internal_reportEmpty(const PathDeque *const deque_p) {
+  if (deque_p->length != 0) {
+    return false;
+  }
+  fprintf(stderr, "ERROR: The PathDeque structure is initialized, but it holds no "
+                  "coordinates. The PathDeque is EMPTY!\n");
+  return true;
+}
@@ -0,0 +1,240 @@
+/* > Description ****************************************************************/
+/**
+ * @file pathIndex.c
+ * @brief This is the file for the position index of a path. The cells are
+ *        keyed by their row * cols + col index in an open addressing table
+ *        with linear probing, kept at most half full, so a lookup touches one
+ *        or two slots on average. Removed cells shift the cells behind them
+ *        back instead of leaving tombstones, the table never degrades.
+ */
+
+/* > Includes ****************************************************************/
+#define MATRIXWORLD_UNCHECKED_API
+#define PATH_UNCHECKED_API
+#include "pathIndex.h"
+#include "matrixWorld.h"
+#include "path.h"
+#include "utilities.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* > Defines *****************************************************************/
+#define PATHINDEX_MINIMUM_NO_OF_SLOTS 16U
+#define PATHINDEX_EMPTY_SLOT UINT32_MAX
+
+/* > Type Declarations *******************************************************/
+
+/**
+ * @brief One cell of the path and the step it is visited at.
+ */
+typedef struct {
+    uint32_t cell; ///< row * cols + col, PATHINDEX_EMPTY_SLOT for a free slot.
+    uint32_t step; ///< The index of the cell in the path.
+} PathIndexSlot_t;
+
+/**
+ * @brief Defines the internal structure of the PathIndex.
+ */
+struct PathIndex {
+    uint16_t rows;             ///< Size of the matrix of the path.
+    uint16_t cols;
+    size_t noOfSteps;          ///< Number of cells added, the length of the path.
+    size_t maxPathSize;        ///< Capacity of the path the table is sized for.
+    size_t slotMask;           ///< Number of slots - 1, a power of two - 1.
+    PathIndexSlot_t slots[];   ///< The hash table.
+};
+
+/* > Global Constant Definitions *********************************************/
+
+/* > Global Variable Definitions *********************************************/
+
+/* > Local Constant Definitions **********************************************/
+
+/* > Local Variable Definitions **********************************************/
+
+/* > Local Function Declarations *********************************************/
+
+/**
+ * @brief Internal function to check for a null index and exit on failure.
+ * @param index_p[in] Pointer to the PathIndex.
+ * @param message[in] The error message to print on failure.
+ */
+static void PATHINDEX_internal_nullCheck(const PathIndex *const index_p,
+                                         const char *restrict message);
+
+/**
+ * @brief Gets the slot a cell is looked up from first.
+ * @param index_p[in] Pointer to the PathIndex.
+ * @param cell[in]    The row * cols + col index of the cell.
+ * @return The index of the home slot of the cell.
+ */
+static inline size_t PATHINDEX_internal_getHomeSlot(const PathIndex *const index_p,
+                                                    uint32_t cell);
+
+/**
+ * @brief Finds the slot of a cell, or the free slot it would be stored in.
+ * @param index_p[in] Pointer to the PathIndex.
+ * @param cell[in]    The row * cols + col index of the cell.
+ * @return The index of the slot.
+ */
+static size_t PATHINDEX_internal_findSlot(const PathIndex *const index_p, uint32_t cell);
+
+/**
+ * @brief Stores the next step of the path, a cell already indexed keeps its step.
+ * @param index_p[in,out] Pointer to the PathIndex.
+ * @param cords[in]       The cell of the step.
+ */
+static void PATHINDEX_internal_addStep(PathIndex *const index_p, Cords cords);
+
+/**
+ * @brief Frees a slot and shifts the cells probed past it back into it.
+ * @param index_p[in,out] Pointer to the PathIndex.
+ * @param slot[in]        The index of the slot to free.
+ */
+static void PATHINDEX_internal_removeSlot(PathIndex *const index_p, size_t slot);
+
+/* > Global Function Definitions *********************************************/
+
+PathIndex *PATHINDEX_createIndex(const Path *const path_p, const WorldMatrix *const matrix_p) {
+    if (path_p == NULL || matrix_p == NULL) {
+        fprintf(stderr, "FATAL ERROR: PATHINDEX_createIndex needs a path and its matrix!\n");
+        exit(EXIT_FAILURE);
+    }
+    size_t noOfSlots = PATHINDEX_MINIMUM_NO_OF_SLOTS;
+    while (noOfSlots < 2 * path_p->pathSize) {
+        noOfSlots *= 2;
+    }
+    PathIndex *index_p = calloc(1, sizeof(PathIndex) + (noOfSlots * sizeof(PathIndexSlot_t)));
+    PATHINDEX_internal_nullCheck(
+        index_p, "FATAL ERROR: PathIndex structure could not be initialized. No memory!\n");
+    index_p->rows = MATRIXWORLD_unchecked_getRowSize(matrix_p);
+    index_p->cols = MATRIXWORLD_unchecked_getColSize(matrix_p);
+    index_p->maxPathSize = path_p->pathSize;
+    index_p->slotMask = noOfSlots - 1;
+    PATHINDEX_rebuildIndex(index_p, path_p);
+    return index_p;
+}
+
+void PATHINDEX_destroyIndex(PathIndex **const index_pp) {
+    if (index_pp == NULL) {
+        return;
+    }
+    free(*index_pp);
+    *index_pp = NULL;
+}
+
+void PATHINDEX_rebuildIndex(PathIndex *const index_p, const Path *const path_p) {
+    PATHINDEX_internal_nullCheck(index_p, "FATAL ERROR: PathIndex is not initialized!\n");
+    if (path_p == NULL || path_p->pathSize > index_p->maxPathSize) {
+        fprintf(stderr, "FATAL ERROR: PathIndex is too small for the path to index!\n");
+        exit(EXIT_FAILURE);
+    }
+    // All bytes 0xFF mark every slot as free
+    memset(index_p->slots, 0xFF, (index_p->slotMask + 1) * sizeof(PathIndexSlot_t));
+    index_p->noOfSteps = 0;
+    for (size_t step = 0; step < PATH_unchecked_getLength(path_p); step++) {
+        PATHINDEX_internal_addStep(index_p, path_p->pathArray[step]);
+    }
+}
+
+void PATHINDEX_addCoordinates(PathIndex *const index_p, Path *const path_p, uint16_t row,
+                              uint16_t col) {
+    PATHINDEX_internal_nullCheck(index_p, "FATAL ERROR: PathIndex is not initialized!\n");
+    PATH_addCoordinates(path_p, row, col);
+    PATHINDEX_internal_addStep(index_p, (Cords){.row = row, .col = col});
+}
+
+Cords PATHINDEX_popCoordinates(PathIndex *const index_p, Path *const path_p) {
+    PATHINDEX_internal_nullCheck(index_p, "FATAL ERROR: PathIndex is not initialized!\n");
+    const Cords cords = PATH_popCoordinates(path_p);
+    if (cords.row == UINT16_MAX || index_p->noOfSteps == 0) {
+        return cords;
+    }
+    index_p->noOfSteps--;
+    const uint32_t cell = ((uint32_t)cords.row * index_p->cols) + cords.col;
+    const size_t slot = PATHINDEX_internal_findSlot(index_p, cell);
+    // A repeated cell stays indexed at its first step
+    if (index_p->slots[slot].cell == cell && index_p->slots[slot].step == index_p->noOfSteps) {
+        PATHINDEX_internal_removeSlot(index_p, slot);
+    }
+    return cords;
+}
+
+bool PATHINDEX_containsCoordinates(const PathIndex *const index_p, uint16_t row, uint16_t col) {
+    return PATHINDEX_getStep(index_p, row, col) != PATHINDEX_NOT_ON_PATH;
+}
+
+size_t PATHINDEX_getStep(const PathIndex *const index_p, uint16_t row, uint16_t col) {
+    PATHINDEX_internal_nullCheck(index_p, "FATAL ERROR: PathIndex is not initialized!\n");
+    if (row >= index_p->rows || col >= index_p->cols) {
+        return PATHINDEX_NOT_ON_PATH;
+    }
+    const uint32_t cell = ((uint32_t)row * index_p->cols) + col;
+    const PathIndexSlot_t *slot_p = &index_p->slots[PATHINDEX_internal_findSlot(index_p, cell)];
+    return (slot_p->cell == cell) ? slot_p->step : PATHINDEX_NOT_ON_PATH;
+}
+
+size_t PATHINDEX_getNoOfSteps(const PathIndex *const index_p) {
+    PATHINDEX_internal_nullCheck(index_p, "FATAL ERROR: PathIndex is not initialized!\n");
+    return index_p->noOfSteps;
+}
+
+/* > Local Function Definitions **********************************************/
+
+static void PATHINDEX_internal_nullCheck(const PathIndex *const index_p,
+                                         const char *restrict message) {
+    if (index_p == NULL) {
+        fprintf(stderr, "%s", message);
+        exit(EXIT_FAILURE);
+    }
+}
+
+static inline size_t PATHINDEX_internal_getHomeSlot(const PathIndex *const index_p,
+                                                    uint32_t cell) {
+    return UTILITY_mixBits(cell) & index_p->slotMask;
+}
+
+static size_t PATHINDEX_internal_findSlot(const PathIndex *const index_p, uint32_t cell) {
+    size_t slot = PATHINDEX_internal_getHomeSlot(index_p, cell);
+    // The table is at most half full, so the probe always meets a free slot
+    while (index_p->slots[slot].cell != PATHINDEX_EMPTY_SLOT && index_p->slots[slot].cell != cell) {
+        slot = (slot + 1) & index_p->slotMask;
+    }
+    return slot;
+}
+
+static void PATHINDEX_internal_addStep(PathIndex *const index_p, Cords cords) {
+    if (cords.row >= index_p->rows || cords.col >= index_p->cols) {
+        fprintf(stderr,
+                "FATAL ERROR: Cell (%u,%u) is out of bounds of the matrix of the PathIndex!\n",
+                cords.row, cords.col);
+        exit(EXIT_FAILURE);
+    }
+    const uint32_t cell = ((uint32_t)cords.row * index_p->cols) + cords.col;
+    PathIndexSlot_t *slot_p = &index_p->slots[PATHINDEX_internal_findSlot(index_p, cell)];
+    if (slot_p->cell == PATHINDEX_EMPTY_SLOT) {
+        *slot_p = (PathIndexSlot_t){.cell = cell, .step = (uint32_t)index_p->noOfSteps};
+    }
+    index_p->noOfSteps++;
+}
+
+static void PATHINDEX_internal_removeSlot(PathIndex *const index_p, size_t slot) {
+    size_t next = slot;
+    while (true) {
+        next = (next + 1) & index_p->slotMask;
+        if (index_p->slots[next].cell == PATHINDEX_EMPTY_SLOT) {
+            break;
+        }
+        // A cell may move back into the free slot unless its home slot lies
+        // cyclically in (slot, next], the probe would then miss it
+        const size_t home = PATHINDEX_internal_getHomeSlot(index_p, index_p->slots[next].cell);
+        const size_t distanceToHome = (next - home) & index_p->slotMask;
+        const size_t distanceToSlot = (next - slot) & index_p->slotMask;
+        if (distanceToHome >= distanceToSlot) {
+            index_p->slots[slot] = index_p->slots[next];
+            slot = next;
+        }
+    }
+    index_p->slots[slot].cell = PATHINDEX_EMPTY_SLOT;
+}
@@ -0,0 +1,316 @@
+/* > Description ****************************************************************/
+/**
+ * @file pathOutput.c
+ * @brief This is the file for the output of the program. Text is formatted by
+ *        hand into the buffer of an OutputWriter and written with a single
+ *        fwrite per buffer, instead of one printf per cell.
+ */
+
+/* > Includes ****************************************************************/
+#define PATH_UNCHECKED_API
+#include "pathOutput.h"
+#include "path.h"
+#include "utilities.h"
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* > Defines *****************************************************************/
+#define OUTPUT_MAX_UINT64_DIGITS 20U
+#define OUTPUT_STEPS_PER_BYTE 4U
+#define OUTPUT_STEP_BITS 2U
+#define OUTPUT_STEP_MASK 0x3U
+
+/* > Type Declarations *******************************************************/
+
+/* > Global Constant Definitions *********************************************/
+
+/* > Global Variable Definitions *********************************************/
+
+/* > Local Constant Definitions **********************************************/
+
+/**
+ * @brief Magic bytes at the start of every binary path.
+ */
+static const char pathMagic[4] = {'P', 'F', 'P', 'T'};
+
+/**
+ * @brief The two digits of every value from 0 to 99.
+ */
+static const char digitPairs[201] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+/* > Local Variable Definitions **********************************************/
+
+/**
+ * @brief Whether the diagnostics are silenced, shared by every thread.
+ */
+static atomic_bool isQuietOutput = false;
+
+/* > Local Function Declarations *********************************************/
+
+/**
+ * @brief Gets the index into directions[] of the step between two cells.
+ * @param from[in]         The previous cell.
+ * @param to[in]           The next cell.
+ * @param direction_p[out] The index of the step.
+ * @return false if the cells are not neighbors.
+ */
+static bool OUTPUT_internal_getStepDirection(Cords from, Cords to, uint8_t *direction_p);
+
+/**
+ * @brief Writes a path as one `row,col` line per cell.
+ * @param writer_p[in,out] The writer.
+ * @param path_p[in]       The path.
+ */
+static void OUTPUT_internal_writeTextPath(OutputWriter *const writer_p, const Path *const path_p);
+
+/**
+ * @brief Writes a path in the binary encoding.
+ * @param writer_p[in,out] The writer.
+ * @param path_p[in]       The path.
+ * @return false if the path is not contiguous.
+ */
+static bool OUTPUT_internal_writeBinaryPath(OutputWriter *const writer_p, const Path *const path_p);
+
+/**
+ * @brief Stores a 16 or 32-bit value in little endian order.
+ * @param destination_p[out] The destination bytes.
+ * @param value[in]          The value.
+ * @param noOfBytes[in]      The number of bytes, 2 or 4.
+ */
+static inline void OUTPUT_internal_storeLittleEndian(uint8_t *destination_p, uint32_t value,
+                                                     uint8_t noOfBytes);
+
+/**
+ * @brief Loads a 16 or 32-bit little endian value.
+ * @param source_p[in]  The source bytes.
+ * @param noOfBytes[in] The number of bytes, 2 or 4.
+ * @return The value.
+ */
+static inline uint32_t OUTPUT_internal_loadLittleEndian(const uint8_t *source_p,
+                                                        uint8_t noOfBytes);
+
+/* > Global Function Definitions *********************************************/
+
+void OUTPUT_initWriter(OutputWriter *const writer_p, FILE *stream_p) {
+  if (writer_p == NULL || stream_p == NULL) {
+    fprintf(stderr, "FATAL ERROR: OUTPUT_initWriter needs a writer and a stream!\n");
+    exit(EXIT_FAILURE);
+  }
+  writer_p->stream_p = stream_p;
+  writer_p->usedBytes = 0;
+  writer_p->hasFailed = false;
+}
+
+void OUTPUT_writeBytes(OutputWriter *const writer_p, const void *data_p, size_t size) {
+  const char *bytes_p = data_p;
+  while (size > 0) {
+    if (writer_p->usedBytes == OUTPUT_BUFFER_SIZE) {
+      writer_p->hasFailed |=
+          fwrite(writer_p->buffer, 1, OUTPUT_BUFFER_SIZE, writer_p->stream_p) != OUTPUT_BUFFER_SIZE;
+      writer_p->usedBytes = 0;
+    }
+    size_t chunk = OUTPUT_BUFFER_SIZE - writer_p->usedBytes;
+    chunk = (chunk < size) ? chunk : size;
+    memcpy(writer_p->buffer + writer_p->usedBytes, bytes_p, chunk);
+    writer_p->usedBytes += chunk;
+    bytes_p += chunk;
+    size -= chunk;
+  }
+}
+
+void OUTPUT_writeString(OutputWriter *const writer_p, const char *string_p) {
+  OUTPUT_writeBytes(writer_p, string_p, strlen(string_p));
+}
+
+void OUTPUT_writeChar(OutputWriter *const writer_p, char character) {
+  if (writer_p->usedBytes == OUTPUT_BUFFER_SIZE) {
+    OUTPUT_writeBytes(writer_p, &character, 1);
+    return;
+  }
+  writer_p->buffer[writer_p->usedBytes++] = character;
+}
+
+void OUTPUT_writeUint(OutputWriter *const writer_p, uint64_t value) {
+  // Digits are produced two at a time from the lowest ones, right to left.
+  char digits[OUTPUT_MAX_UINT64_DIGITS];
+  size_t start = OUTPUT_MAX_UINT64_DIGITS;
+  while (value >= 100) {
+    const size_t pair = (size_t)(value % 100) * 2;
+    value /= 100;
+    digits[--start] = digitPairs[pair + 1];
+    digits[--start] = digitPairs[pair];
+  }
+  if (value >= 10) {
+    digits[--start] = digitPairs[(value * 2) + 1];
+    digits[--start] = digitPairs[value * 2];
+  } else {
+    digits[--start] = (char)('0' + value);
+  }
+  OUTPUT_writeBytes(writer_p, digits + start, OUTPUT_MAX_UINT64_DIGITS - start);
+}
+
+bool OUTPUT_flushWriter(OutputWriter *const writer_p) {
+  if (writer_p->usedBytes > 0) {
+    writer_p->hasFailed |= fwrite(writer_p->buffer, 1, writer_p->usedBytes, writer_p->stream_p) !=
+                           writer_p->usedBytes;
+    writer_p->usedBytes = 0;
+  }
+  writer_p->hasFailed |= fflush(writer_p->stream_p) != 0;
+  return !writer_p->hasFailed;
+}
+
+bool OUTPUT_writePath(const Path *const path_p, FILE *stream_p, OUTPUT_Format format) {
+  if (path_p == NULL || stream_p == NULL) {
+    fprintf(stderr, "FATAL ERROR: OUTPUT_writePath needs a path and a stream!\n");
+    exit(EXIT_FAILURE);
+  }
+  // Large enough to be kept off the stack of the caller.
+  OutputWriter *writer_p = malloc(sizeof(OutputWriter));
+  if (writer_p == NULL) {
+    fprintf(stderr, "FATAL ERROR: Could not allocate memory for the OutputWriter!\n");
+    exit(EXIT_FAILURE);
+  }
+  OUTPUT_initWriter(writer_p, stream_p);
+  bool isWritten = true;
+  if (format == OUTPUT_FORMAT_BINARY) {
+    isWritten = OUTPUT_internal_writeBinaryPath(writer_p, path_p);
+  } else {
+    OUTPUT_internal_writeTextPath(writer_p, path_p);
+  }
+  isWritten = OUTPUT_flushWriter(writer_p) && isWritten;
+  free(writer_p);
+  return isWritten;
+}
+
+bool OUTPUT_decodeBinaryPath(const uint8_t *data_p, size_t size, Path *const path_p) {
+  if (data_p == NULL || path_p == NULL) {
+    fprintf(stderr, "FATAL ERROR: OUTPUT_decodeBinaryPath needs the data and a path!\n");
+    exit(EXIT_FAILURE);
+  }
+  PATH_clearPath(path_p);
+  if (size < OUTPUT_PATH_HEADER_SIZE || memcmp(data_p, pathMagic, sizeof(pathMagic)) != 0 ||
+      data_p[4] != OUTPUT_PATH_VERSION) {
+    return false;
+  }
+  const uint32_t noOfCells = OUTPUT_internal_loadLittleEndian(data_p + 8, 4);
+  const size_t noOfStepBytes =
+      (noOfCells == 0) ? 0 : ((size_t)noOfCells - 1 + OUTPUT_STEPS_PER_BYTE - 1) / OUTPUT_STEPS_PER_BYTE;
+  if (size != OUTPUT_PATH_HEADER_SIZE + noOfStepBytes || noOfCells > path_p->pathSize) {
+    return false;
+  }
+  if (noOfCells == 0) {
+    return true;
+  }
+  int32_t row = (int32_t)OUTPUT_internal_loadLittleEndian(data_p + 12, 2);
+  int32_t col = (int32_t)OUTPUT_internal_loadLittleEndian(data_p + 14, 2);
+  PATH_unchecked_addCoordinates(path_p, (uint16_t)row, (uint16_t)col);
+  const uint8_t *steps_p = data_p + OUTPUT_PATH_HEADER_SIZE;
+  for (uint32_t step = 0; step + 1 < noOfCells; step++) {
+    const uint8_t direction = (steps_p[step / OUTPUT_STEPS_PER_BYTE] >>
+                               ((step % OUTPUT_STEPS_PER_BYTE) * OUTPUT_STEP_BITS)) &
+                              OUTPUT_STEP_MASK;
+    row += directions[direction].row;
+    col += directions[direction].col;
+    if (row < 0 || row > UINT16_MAX || col < 0 || col > UINT16_MAX) {
+      PATH_clearPath(path_p);
+      return false;
+    }
+    PATH_unchecked_addCoordinates(path_p, (uint16_t)row, (uint16_t)col);
+  }
+  return true;
+}
+
+void OUTPUT_setQuiet(bool isQuiet) {
+  atomic_store_explicit(&isQuietOutput, isQuiet, memory_order_relaxed);
+}
+
+bool OUTPUT_isQuiet(void) {
+  return atomic_load_explicit(&isQuietOutput, memory_order_relaxed);
+}
+
+void OUTPUT_logDiagnostic(const char *format_p, ...) {
+  if (OUTPUT_isQuiet()) {
+    return;
+  }
+  va_list arguments;
+  va_start(arguments, format_p);
+  vfprintf(stderr, format_p, arguments);
+  va_end(arguments);
+}
+
+/* > Local Function Definitions **********************************************/
+
+static bool OUTPUT_internal_getStepDirection(Cords from, Cords to, uint8_t *direction_p) {
+  for (uint8_t direction = 0; direction < FOUR_DIRECTIONS; direction++) {
+    if ((int32_t)from.row + directions[direction].row == (int32_t)to.row &&
+        (int32_t)from.col + directions[direction].col == (int32_t)to.col) {
+      *direction_p = direction;
+      return true;
+    }
+  }
+  return false;
+}
+
+static void OUTPUT_internal_writeTextPath(OutputWriter *const writer_p, const Path *const path_p) {
+  for (size_t index = 0; index < PATH_unchecked_getLength(path_p); index++) {
+    OUTPUT_writeUint(writer_p, path_p->pathArray[index].row);
+    OUTPUT_writeChar(writer_p, ',');
+    OUTPUT_writeUint(writer_p, path_p->pathArray[index].col);
+    OUTPUT_writeChar(writer_p, '\n');
+  }
+}
+
+static bool OUTPUT_internal_writeBinaryPath(OutputWriter *const writer_p, const Path *const path_p) {
+  const size_t noOfCells = PATH_unchecked_getLength(path_p);
+  if (noOfCells > UINT32_MAX) {
+    return false;
+  }
+  uint8_t header[OUTPUT_PATH_HEADER_SIZE] = {0};
+  memcpy(header, pathMagic, sizeof(pathMagic));
+  header[4] = OUTPUT_PATH_VERSION;
+  OUTPUT_internal_storeLittleEndian(header + 8, (uint32_t)noOfCells, 4);
+  if (noOfCells > 0) {
+    OUTPUT_internal_storeLittleEndian(header + 12, path_p->pathArray[0].row, 2);
+    OUTPUT_internal_storeLittleEndian(header + 14, path_p->pathArray[0].col, 2);
+  }
+  OUTPUT_writeBytes(writer_p, header, sizeof(header));
+
+  // Every step byte is complete before it is written, the last one is padded with zeros.
+  uint8_t stepByte = 0;
+  for (size_t index = 1; index < noOfCells; index++) {
+    uint8_t direction;
+    if (!OUTPUT_internal_getStepDirection(path_p->pathArray[index - 1], path_p->pathArray[index],
+                                          &direction)) {
+      return false;
+    }
+    const size_t step = index - 1;
+    stepByte |= (uint8_t)(direction << ((step % OUTPUT_STEPS_PER_BYTE) * OUTPUT_STEP_BITS));
+    if (step % OUTPUT_STEPS_PER_BYTE == OUTPUT_STEPS_PER_BYTE - 1 || index == noOfCells - 1) {
+      OUTPUT_writeChar(writer_p, (char)stepByte);
+      stepByte = 0;
+    }
+  }
+  return true;
+}
+
+static inline void OUTPUT_internal_storeLittleEndian(uint8_t *destination_p, uint32_t value,
+                                                     uint8_t noOfBytes) {
+  for (uint8_t byte = 0; byte < noOfBytes; byte++) {
+    destination_p[byte] = (uint8_t)(value >> (8U * byte));
+  }
+}
+
+static inline uint32_t OUTPUT_internal_loadLittleEndian(const uint8_t *source_p,
+                                                        uint8_t noOfBytes) {
+  uint32_t value = 0;
+  for (uint8_t byte = 0; byte < noOfBytes; byte++) {
+    value |= (uint32_t)source_p[byte] << (8U * byte);
+  }
+  return value;
+}
@@ -0,0 +1,340 @@
+/* > Description ****************************************************************/
+/**
+ * @file pathRepair.c
+ * @brief This is the file for the repair of a path after a cell of its matrix
+ *        changed. The detour is a breadth-first search in a small window
+ *        around the blocked cell, so it never touches more than the window
+ *        and one pass over the path. The other steps reuse the searches of
+ *        the DFS module.
+ */
+
+/* > Includes ****************************************************************/
+#define MATRIXWORLD_UNCHECKED_API
+#define PATH_UNCHECKED_API
+#include "pathRepair.h"
+#include "dfsPathFinding.h"
+#include "matrixWorld.h"
+#include "path.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* > Defines *****************************************************************/
+
+/**
+ * @brief Number of rows and columns of the detour window.
+ */
+#define PATHREPAIR_WINDOW_SIZE (2U * PATHREPAIR_DETOUR_RADIUS + 1U)
+
+/**
+ * @brief Number of cells of the detour window.
+ */
+#define PATHREPAIR_WINDOW_CELLS (PATHREPAIR_WINDOW_SIZE * PATHREPAIR_WINDOW_SIZE)
+
+/**
+ * @brief Marks a window cell without a parent in the detour search.
+ */
+#define PATHREPAIR_NO_PARENT UINT8_MAX
+
+/* > Type Declarations *******************************************************/
+
+/**
+ * @brief The window of the matrix a detour is searched in.
+ */
+typedef struct {
+    uint16_t firstRow; ///< Row of the window cell 0.
+    uint16_t firstCol; ///< Column of the window cell 0.
+    uint16_t rows;     ///< Rows of the window, cut at the matrix border.
+    uint16_t cols;     ///< Columns of the window, cut at the matrix border.
+    bool isFree[PATHREPAIR_WINDOW_CELLS];   ///< Unblocked and off the path.
+    uint8_t parent[PATHREPAIR_WINDOW_CELLS]; ///< Window cell the search came from.
+} PathRepairWindow_t;
+
+/* > Global Constant Definitions *********************************************/
+
+/* > Global Variable Definitions *********************************************/
+
+/* > Local Constant Definitions **********************************************/
+
+/* > Local Variable Definitions **********************************************/
+
+/* > Local Function Declarations *********************************************/
+
+/**
+ * @brief Internal function to check the arguments of a repair and exit on failure.
+ * @param matrix_p[in] Pointer to the WorldMatrix.
+ * @param path_p[in]   Pointer to the Path.
+ * @param row[in]      The row of the changed cell.
+ * @param col[in]      The column of the changed cell.
+ */
+static void PATHREPAIR_internal_checkArguments(const WorldMatrix *const matrix_p,
+                                               const Path *const path_p, uint16_t row,
+                                               uint16_t col);
+
+/**
+ * @brief Finds the cell of the path a change broke.
+ * @param matrix_p[in]    Pointer to the WorldMatrix, after the change.
+ * @param path_p[in]      Pointer to the Path.
+ * @param row[in]         The row of the changed cell.
+ * @param col[in]         The column of the changed cell.
+ * @param position_p[out] The position of the cell on the path.
+ * @return true if the cell is blocked and on the path.
+ */
+static bool PATHREPAIR_internal_findDamage(const WorldMatrix *const matrix_p,
+                                           const Path *const path_p, uint16_t row, uint16_t col,
+                                           size_t *const position_p);
+
+/**
+ * @brief Splices the shortest detour within the window around a blocked cell
+ *        into the path, and cuts the path back to its length behind it.
+ * @param matrix_p[in]     Pointer to the WorldMatrix.
+ * @param path_p[in,out]   Pointer to the Path.
+ * @param position[in]     The position of the blocked cell, not an end of the path.
+ * @param neighborhood[in] The steps of the path and of the detour.
+ * @return true if a detour was spliced in, the path is unchanged otherwise.
+ */
+static bool PATHREPAIR_internal_spliceDetour(const WorldMatrix *const matrix_p,
+                                             Path *const path_p, size_t position,
+                                             DFS_Neighborhood neighborhood);
+
+/**
+ * @brief Grows the parts of the path around a blocked cell back to its
+ *        length, and searches from scratch when neither grows.
+ * @param context_p[in,out] Pointer to a search context bound to matrix_p.
+ * @param matrix_p[in]      Pointer to the WorldMatrix.
+ * @param path_p[in,out]    Pointer to the Path.
+ * @param position[in]      The position of the blocked cell.
+ * @return PATHREPAIR_EXTENDED, PATHREPAIR_RESEARCHED or PATHREPAIR_FAILED.
+ */
+static PATHREPAIR_Outcome PATHREPAIR_internal_search(DFS_SearchContext *const context_p,
+                                                     const WorldMatrix *const matrix_p,
+                                                     Path *const path_p, size_t position);
+
+/* > Global Function Definitions *********************************************/
+
+PATHREPAIR_Outcome PATHREPAIR_repairPath(WorldMatrix *matrix_p, Path *const path_p, uint16_t row,
+                                         uint16_t col, const DFS_SearchOptions *options_p) {
+    PATHREPAIR_internal_checkArguments(matrix_p, path_p, row, col);
+    size_t position;
+    if (!PATHREPAIR_internal_findDamage(matrix_p, path_p, row, col, &position)) {
+        return PATHREPAIR_INTACT;
+    }
+    const DFS_Neighborhood neighborhood =
+        (options_p == NULL) ? DFS_getDefaultOptions().neighborhood : options_p->neighborhood;
+    if (PATHREPAIR_internal_spliceDetour(matrix_p, path_p, position, neighborhood)) {
+        return PATHREPAIR_DETOUR;
+    }
+    DFS_SearchContext *context_p = DFS_createSearchContext(matrix_p, options_p);
+    PATHREPAIR_Outcome outcome = PATHREPAIR_internal_search(context_p, matrix_p, path_p, position);
+    DFS_destroySearchContext(&context_p);
+    if (outcome == PATHREPAIR_FAILED) {
+        PATH_clearPath(path_p);
+    }
+    return outcome;
+}
+
+PATHREPAIR_Outcome PATHREPAIR_repairBounded(DFS_SearchContext *const context_p,
+                                            const WorldMatrix *const matrix_p, Path *const path_p,
+                                            uint16_t row, uint16_t col) {
+    PATHREPAIR_internal_checkArguments(matrix_p, path_p, row, col);
+    if (context_p == NULL) {
+        fprintf(stderr, "FATAL ERROR: PATHREPAIR_repairBounded needs a DFS_SearchContext!\n");
+        exit(EXIT_FAILURE);
+    }
+    size_t position;
+    if (!PATHREPAIR_internal_findDamage(matrix_p, path_p, row, col, &position)) {
+        return PATHREPAIR_INTACT;
+    }
+    if (PATHREPAIR_internal_spliceDetour(matrix_p, path_p, position,
+                                         DFS_getSearchContextOptions(context_p)->neighborhood)) {
+        return PATHREPAIR_DETOUR;
+    }
+    return PATHREPAIR_internal_search(context_p, matrix_p, path_p, position);
+}
+
+/* > Local Function Definitions **********************************************/
+
+static void PATHREPAIR_internal_checkArguments(const WorldMatrix *const matrix_p,
+                                               const Path *const path_p, uint16_t row,
+                                               uint16_t col) {
+    if (matrix_p == NULL || path_p == NULL) {
+        fprintf(stderr, "FATAL ERROR: A path repair needs a WorldMatrix and a Path!\n");
+        exit(EXIT_FAILURE);
+    }
+    if (row >= MATRIXWORLD_unchecked_getRowSize(matrix_p) ||
+        col >= MATRIXWORLD_unchecked_getColSize(matrix_p)) {
+        fprintf(stderr, "FATAL ERROR: The changed cell (%u, %u) is outside of the matrix!\n",
+                row, col);
+        exit(EXIT_FAILURE);
+    }
+}
+
+static bool PATHREPAIR_internal_findDamage(const WorldMatrix *const matrix_p,
+                                           const Path *const path_p, uint16_t row, uint16_t col,
+                                           size_t *const position_p) {
+    // A freed cell never breaks a path.
+    if (!MATRIXWORLD_unchecked_isBlocked(matrix_p, row, col)) {
+        return false;
+    }
+    const size_t pathLength = PATH_unchecked_getLength(path_p);
+    for (size_t index = 0; index < pathLength; index++) {
+        if (path_p->pathArray[index].row == row && path_p->pathArray[index].col == col) {
+            *position_p = index;
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool PATHREPAIR_internal_spliceDetour(const WorldMatrix *const matrix_p,
+                                             Path *const path_p, size_t position,
+                                             DFS_Neighborhood neighborhood) {
+    const size_t pathLength = PATH_unchecked_getLength(path_p);
+    if (position == 0 || position == pathLength - 1) {
+        return false;
+    }
+    const Cords blocked = path_p->pathArray[position];
+    PathRepairWindow_t window;
+    window.firstRow = (blocked.row > PATHREPAIR_DETOUR_RADIUS)
+                          ? (uint16_t)(blocked.row - PATHREPAIR_DETOUR_RADIUS)
+                          : 0;
+    window.firstCol = (blocked.col > PATHREPAIR_DETOUR_RADIUS)
+                          ? (uint16_t)(blocked.col - PATHREPAIR_DETOUR_RADIUS)
+                          : 0;
+    const uint32_t lastRow = (uint32_t)blocked.row + PATHREPAIR_DETOUR_RADIUS;
+    const uint32_t lastCol = (uint32_t)blocked.col + PATHREPAIR_DETOUR_RADIUS;
+    window.rows = (uint16_t)(((lastRow < MATRIXWORLD_unchecked_getRowSize(matrix_p))
+                                  ? lastRow + 1
+                                  : MATRIXWORLD_unchecked_getRowSize(matrix_p)) -
+                             window.firstRow);
+    window.cols = (uint16_t)(((lastCol < MATRIXWORLD_unchecked_getColSize(matrix_p))
+                                  ? lastCol + 1
+                                  : MATRIXWORLD_unchecked_getColSize(matrix_p)) -
+                             window.firstCol);
+    for (uint16_t r = 0; r < window.rows; r++) {
+        for (uint16_t c = 0; c < window.cols; c++) {
+            window.isFree[r * window.cols + c] = !MATRIXWORLD_unchecked_isBlocked(
+                matrix_p, (uint16_t)(window.firstRow + r), (uint16_t)(window.firstCol + c));
+            window.parent[r * window.cols + c] = PATHREPAIR_NO_PARENT;
+        }
+    }
+    // The detour must not cross the path, only its cells in the window matter.
+    for (size_t index = 0; index < pathLength; index++) {
+        const Cords cell = path_p->pathArray[index];
+        if (cell.row >= window.firstRow && cell.row < window.firstRow + window.rows &&
+            cell.col >= window.firstCol && cell.col < window.firstCol + window.cols) {
+            window.isFree[(cell.row - window.firstRow) * window.cols + cell.col - window.firstCol] =
+                false;
+        }
+    }
+
+    const Cords before = path_p->pathArray[position - 1];
+    const Cords after = path_p->pathArray[position + 1];
+    const uint8_t source =
+        (uint8_t)((before.row - window.firstRow) * window.cols + before.col - window.firstCol);
+    const uint8_t target =
+        (uint8_t)((after.row - window.firstRow) * window.cols + after.col - window.firstCol);
+    uint8_t queue[PATHREPAIR_WINDOW_CELLS];
+    size_t head = 0;
+    size_t tail = 0;
+    queue[tail++] = source;
+    window.parent[source] = source;
+    window.isFree[target] = true;
+    const size_t noOfNeighbors = (neighborhood == DFS_NEIGHBORHOOD_EIGHT) ? 8 : 4;
+    bool isReached = false;
+    while (head < tail && !isReached) {
+        const uint8_t current = queue[head++];
+        const int r = current / window.cols;
+        const int c = current % window.cols;
+        const int neighbors[8][2] = {{r - 1, c},     {r + 1, c},     {r, c - 1},
+                                     {r, c + 1},     {r - 1, c - 1}, {r - 1, c + 1},
+                                     {r + 1, c - 1}, {r + 1, c + 1}};
+        for (size_t i = 0; i < noOfNeighbors; i++) {
+            const int nr = neighbors[i][0];
+            const int nc = neighbors[i][1];
+            if (nr < 0 || nc < 0 || nr >= window.rows || nc >= window.cols) {
+                continue;
+            }
+            const uint8_t next = (uint8_t)(nr * window.cols + nc);
+            if (!window.isFree[next] || window.parent[next] != PATHREPAIR_NO_PARENT) {
+                continue;
+            }
+            // Diagonal steps may join the two neighbors directly, a detour
+            // takes the place of the blocked cell with at least one cell.
+            if (current == source && next == target) {
+                continue;
+            }
+            window.parent[next] = current;
+            if (next == target) {
+                isReached = true;
+                break;
+            }
+            queue[tail++] = next;
+        }
+    }
+    if (!isReached) {
+        return false;
+    }
+
+    // The detour replaces the blocked cell, and pushes the cells behind it
+    // back, the ones pushed beyond the length of the path fall off.
+    size_t detourLength = 0;
+    for (uint8_t cell = window.parent[target]; cell != source; cell = window.parent[cell]) {
+        detourLength++;
+    }
+    if (detourLength == 0) {
+        return false;
+    }
+    const size_t behindLength = pathLength - position - 1;
+    const size_t keptBehind =
+        (behindLength > detourLength - 1) ? behindLength - (detourLength - 1) : 0;
+    memmove(&path_p->pathArray[position + detourLength], &path_p->pathArray[position + 1],
+            sizeof(Cords) * keptBehind);
+    size_t index = position + detourLength;
+    for (uint8_t cell = window.parent[target]; cell != source; cell = window.parent[cell]) {
+        index--;
+        if (index < pathLength) {
+            path_p->pathArray[index] =
+                (Cords){.row = (uint16_t)(window.firstRow + cell / window.cols),
+                        .col = (uint16_t)(window.firstCol + cell % window.cols)};
+        }
+    }
+    return true;
+}
+
+static PATHREPAIR_Outcome PATHREPAIR_internal_search(DFS_SearchContext *const context_p,
+                                                     const WorldMatrix *const matrix_p,
+                                                     Path *const path_p, size_t position) {
+    const size_t pathLength = PATH_unchecked_getLength(path_p);
+    if (pathLength > MATRIXWORLD_unchecked_getNoOfUnblockedCells(matrix_p)) {
+        PATH_clearPath(path_p);
+        return PATHREPAIR_FAILED;
+    }
+    // Both parts are grown at the cell next to the blocked one.
+    Path *part_p = PATH_initializePath(pathLength, matrix_p);
+    const size_t behindLength = pathLength - position - 1;
+    Path *behind_p = PATH_initializePath(pathLength, matrix_p);
+    for (size_t index = 0; index < behindLength; index++) {
+        behind_p->pathArray[index] = path_p->pathArray[pathLength - 1 - index];
+    }
+    behind_p->currentNoOfCordsInPath = behindLength;
+    memcpy(part_p->pathArray, path_p->pathArray, sizeof(Cords) * position);
+    part_p->currentNoOfCordsInPath = position;
+
+    PATHREPAIR_Outcome outcome = PATHREPAIR_FAILED;
+    const Path *parts[2] = {part_p, behind_p};
+    for (size_t i = 0; i < 2 && outcome == PATHREPAIR_FAILED; i++) {
+        if (PATH_unchecked_getLength(parts[i]) > 0 &&
+            DFS_extendBounded(context_p, parts[i], (uint32_t)pathLength, path_p) ==
+                DFS_STATUS_FOUND) {
+            outcome = PATHREPAIR_EXTENDED;
+        }
+    }
+    if (outcome == PATHREPAIR_FAILED &&
+        DFS_searchBounded(context_p, (uint32_t)pathLength, path_p) == DFS_STATUS_FOUND) {
+        outcome = PATHREPAIR_RESEARCHED;
+    }
+    PATH_freePath(&behind_p);
+    PATH_freePath(&part_p);
+    return outcome;
+}
@@ -0,0 +1,413 @@
+/* > Description ****************************************************************/
+/**
+ * @file snakePath.c
+ * @brief This is the file for the constructive path builder. An empty matrix
+ *        gets its serpentine path directly. On a sparse matrix a serpentine
+ *        walk runs over bands of two rows, visiting both cells of a column
+ *        where it can, and a bounded breadth-first search over a window of the
+ *        band and the band below it carries the walk past a blocked cell.
+ */
+
+/* > Includes ****************************************************************/
+#define MATRIXWORLD_UNCHECKED_API
+#define PATH_UNCHECKED_API
+#define VISITED_UNCHECKED_API
+#include "snakePath.h"
+#include "matrixWorld.h"
+#include "path.h"
+#include "utilities.h"
+#include "visitedSet.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+/* > Defines *****************************************************************/
+
+#define SNAKE_REPAIR_HALF_WIDTH 16 // Columns the local search reaches on either side
+#define SNAKE_REPAIR_ROWS 6        // The band of the walk and the two bands below it
+#define SNAKE_REPAIR_CELLS (SNAKE_REPAIR_ROWS * (2 * SNAKE_REPAIR_HALF_WIDTH + 1))
+#define SNAKE_UNSEEN INT16_MAX     // Parent of a window cell not reached yet
+
+/* > Type Declarations *******************************************************/
+
+/**
+ * @brief State of the serpentine walk over the bands.
+ */
+typedef struct {
+    const WorldMatrix *matrix_p;
+    VisitedSet *visited_p;
+    Path *path_p;
+    uint32_t pathLength;
+    uint16_t noOfRows;
+    uint16_t noOfCols;
+    uint16_t bandTop; ///< First row of the band the walk is in.
+    int8_t direction; ///< +1 while the band is walked to the right, -1 to the left.
+    size_t bandStart; ///< Length of the path when the walk entered its band.
+    Cords head;       ///< The last cell of the path.
+} SnakeWalk_t;
+
+/* > Global Constant Definitions *********************************************/
+
+/* > Global Variable Definitions *********************************************/
+
+/* > Local Constant Definitions **********************************************/
+
+/* > Local Variable Definitions **********************************************/
+
+/* > Local Function Declarations *********************************************/
+
+/**
+ * @brief Lays the serpentine path over the full rows of an empty matrix.
+ * @param matrix_p[in]  Pointer to the empty WorldMatrix.
+ * @param pathLength[in] The length of the path.
+ * @param result_p[out] The cleared path to fill.
+ */
+static void SNAKE_internal_layEmptySnake(const WorldMatrix *const matrix_p, uint32_t pathLength,
+                                         Path *const result_p);
+
+/**
+ * @brief Whether a cell is inside the matrix, unblocked and not on the path yet.
+ * @param walk_p[in] The walk.
+ * @param row[in]    The row of the cell, may be out of bounds.
+ * @param col[in]    The column of the cell, may be out of bounds.
+ * @return `true` if the walk may step onto the cell.
+ */
+static inline bool SNAKE_internal_isOpen(const SnakeWalk_t *const walk_p, int32_t row,
+                                         int32_t col);
+
+/**
+ * @brief Turns the walk around into the band below its band.
+ * @param walk_p[in,out] The walk, its head already in the next band.
+ * @param bandBottom[in] The last row of the band the walk leaves.
+ */
+static inline void SNAKE_internal_enterNextBand(SnakeWalk_t *const walk_p, uint16_t bandBottom);
+
+/**
+ * @brief Whether the walk could go on from a cell it reaches from a neighbour.
+ * @param walk_p[in]  The walk.
+ * @param row[in]     The row of the cell.
+ * @param col[in]     The column of the cell.
+ * @param fromRow[in] The row of the neighbour the walk arrives from.
+ * @param fromCol[in] The column of the neighbour the walk arrives from.
+ * @return `true` if another neighbour of the cell is open.
+ */
+static bool SNAKE_internal_hasExit(const SnakeWalk_t *const walk_p, int32_t row, int32_t col,
+                                   int32_t fromRow, int32_t fromCol);
+
+/**
+ * @brief Appends a cell to the path and moves the head onto it.
+ * @param walk_p[in,out] The walk.
+ * @param row[in]        The row of the open cell.
+ * @param col[in]        The column of the open cell.
+ * @return `true` once the path has reached its length.
+ */
+static bool SNAKE_internal_append(SnakeWalk_t *const walk_p, uint16_t row, uint16_t col);
+
+/**
+ * @brief Runs the serpentine walk over the bands from its first cell.
+ * @param walk_p[in,out] The walk, holding its first cell.
+ * @return `true` once the path has reached its length, `false` if the walk got stuck.
+ */
+static bool SNAKE_internal_walk(SnakeWalk_t *const walk_p);
+
+/**
+ * @brief Carries the walk past a blocked cell. While no detour leaves the
+ *        head, the head gives back its last cells within the band and the
+ *        detour is searched again from the earlier cell.
+ * @param walk_p[in,out]   The walk.
+ * @param isTransition[in] Whether the walk is leaving its band.
+ * @return `true` if a detour was appended, `false` if there is none.
+ */
+static bool SNAKE_internal_repair(SnakeWalk_t *const walk_p, bool isTransition);
+
+/**
+ * @brief Searches the shortest detour with a breadth-first search over a
+ *        window around the head, and appends it.
+ *
+ * Within the band the detour ends on the first band cell ahead of the blocked
+ * column, at the end of a band, or when the rest of the band is cut off, it
+ * ends on the first cell of the next band.
+ *
+ * @param walk_p[in,out]   The walk.
+ * @param isTransition[in] Whether the walk is leaving its band.
+ * @param blockedCol[in]   The column the walk got stuck in.
+ * @return `true` if a detour was appended, `false` if there is none in the window.
+ */
+static bool SNAKE_internal_findDetour(SnakeWalk_t *const walk_p, bool isTransition,
+                                      int32_t blockedCol);
+
+/* > Global Function Definitions *********************************************/
+
+bool SNAKE_buildPath(const WorldMatrix *const matrix_p, uint32_t pathLength,
+                     VisitedSet *const visited_p, Path *const result_p) {
+    if (matrix_p == NULL || visited_p == NULL || result_p == NULL) {
+        fprintf(stderr, "FATAL ERROR: SNAKE_buildPath needs a matrix, a visited set and a "
+                        "result Path!\n");
+        exit(EXIT_FAILURE);
+    }
+    if (result_p->pathSize < pathLength) {
+        fprintf(stderr, "FATAL ERROR: The result Path holds %zu cells, a path of %u cells "
+                        "was requested!\n",
+                result_p->pathSize, pathLength);
+        exit(EXIT_FAILURE);
+    }
+    PATH_clearPath(result_p);
+    const uint32_t noOfUnblocked = MATRIXWORLD_unchecked_getNoOfUnblockedCells(matrix_p);
+    if (pathLength == 0 || pathLength > noOfUnblocked) {
+        return false;
+    }
+    const uint16_t rows = MATRIXWORLD_unchecked_getRowSize(matrix_p);
+    const uint16_t cols = MATRIXWORLD_unchecked_getColSize(matrix_p);
+    const uint64_t noOfCells = (uint64_t)rows * cols;
+    if (noOfUnblocked == noOfCells) {
+        SNAKE_internal_layEmptySnake(matrix_p, pathLength, result_p);
+        return true;
+    }
+    if ((noOfCells - noOfUnblocked) * 100U > noOfCells * SNAKE_MAX_BLOCKED_PERCENT) {
+        return false;
+    }
+
+    VISITED_clearSet(visited_p);
+    SnakeWalk_t walk = {.matrix_p = matrix_p,
+                        .visited_p = visited_p,
+                        .path_p = result_p,
+                        .pathLength = pathLength,
+                        .noOfRows = rows,
+                        .noOfCols = cols,
+                        .bandTop = 0,
+                        .direction = 1,
+                        .bandStart = 1};
+    // The walk starts in the first column of the first band.
+    if (SNAKE_internal_isOpen(&walk, 0, 0)) {
+        if (SNAKE_internal_append(&walk, 0, 0)) {
+            return true;
+        }
+    } else if (SNAKE_internal_isOpen(&walk, 1, 0)) {
+        if (SNAKE_internal_append(&walk, 1, 0)) {
+            return true;
+        }
+    } else {
+        return false;
+    }
+    if (!SNAKE_internal_walk(&walk)) {
+        PATH_clearPath(result_p);
+        return false;
+    }
+    return true;
+}
+
+/* > Local Function Definitions **********************************************/
+
+static void SNAKE_internal_layEmptySnake(const WorldMatrix *const matrix_p, uint32_t pathLength,
+                                         Path *const result_p) {
+    const uint16_t cols = MATRIXWORLD_unchecked_getColSize(matrix_p);
+    uint16_t row = 0;
+    uint16_t offset = 0;
+    for (uint32_t index = 0; index < pathLength; index++) {
+        // Even rows run to the right, odd rows back to the left.
+        uint16_t col = (row % 2U == 0) ? offset : (uint16_t)(cols - 1U - offset);
+        PATH_unchecked_addCoordinates(result_p, row, col);
+        if (++offset == cols) {
+            offset = 0;
+            row++;
+        }
+    }
+}
+
+static bool SNAKE_internal_walk(SnakeWalk_t *const walk_p) {
+    const uint16_t rows = walk_p->noOfRows;
+    const uint16_t cols = walk_p->noOfCols;
+    const Path *const result_p = walk_p->path_p;
+    const uint32_t pathLength = walk_p->pathLength;
+    while (true) {
+        const uint16_t row = walk_p->head.row;
+        const uint16_t col = walk_p->head.col;
+        const uint16_t bandBottom =
+            (walk_p->bandTop + 1U < rows) ? walk_p->bandTop + 1U : walk_p->bandTop;
+        const uint16_t otherRow = (row == walk_p->bandTop) ? bandBottom : walk_p->bandTop;
+        const int32_t lastCol = (walk_p->direction > 0) ? cols - 1 : 0;
+
+        if (col != lastCol) {
+            const int32_t nextCol = col + walk_p->direction;
+            bool isComplete = false;
+            if (otherRow != row && SNAKE_internal_isOpen(walk_p, otherRow, col) &&
+                SNAKE_internal_isOpen(walk_p, otherRow, nextCol)) {
+                // Both cells of the column, then on along the other row.
+                isComplete = SNAKE_internal_append(walk_p, otherRow, col) ||
+                             SNAKE_internal_append(walk_p, otherRow, (uint16_t)nextCol);
+            } else if (SNAKE_internal_isOpen(walk_p, row, nextCol)) {
+                isComplete = SNAKE_internal_append(walk_p, row, (uint16_t)nextCol);
+            } else if (!SNAKE_internal_repair(walk_p, false)) {
+                return false;
+            } else if (walk_p->head.row > bandBottom) {
+                SNAKE_internal_enterNextBand(walk_p, bandBottom);
+            }
+            if (isComplete || PATH_unchecked_getLength(result_p) == pathLength) {
+                return true;
+            }
+            continue;
+        }
+
+        // At the end of the band the walk leaves from its bottom row.
+        if (row != bandBottom && SNAKE_internal_isOpen(walk_p, bandBottom, col)) {
+            if (SNAKE_internal_append(walk_p, bandBottom, col)) {
+                return true;
+            }
+            continue;
+        }
+        if (bandBottom + 1U >= rows) {
+            return false; // The last band is used up before the path is complete.
+        }
+        if (row == bandBottom && SNAKE_internal_isOpen(walk_p, bandBottom + 1, col) &&
+            SNAKE_internal_hasExit(walk_p, bandBottom + 1, col, row, col)) {
+            if (SNAKE_internal_append(walk_p, bandBottom + 1U, col)) {
+                return true;
+            }
+        } else if (!SNAKE_internal_repair(walk_p, true)) {
+            return false;
+        } else if (PATH_unchecked_getLength(result_p) == pathLength) {
+            return true;
+        }
+        SNAKE_internal_enterNextBand(walk_p, bandBottom);
+    }
+}
+
+static inline void SNAKE_internal_enterNextBand(SnakeWalk_t *const walk_p, uint16_t bandBottom) {
+    walk_p->bandTop = bandBottom + 1U;
+    walk_p->direction = (int8_t)-walk_p->direction;
+    walk_p->bandStart = PATH_unchecked_getLength(walk_p->path_p);
+}
+
+static inline bool SNAKE_internal_isOpen(const SnakeWalk_t *const walk_p, int32_t row,
+                                         int32_t col) {
+    return row >= 0 && row < walk_p->noOfRows && col >= 0 && col < walk_p->noOfCols &&
+           !MATRIXWORLD_unchecked_isBlocked(walk_p->matrix_p, (uint16_t)row, (uint16_t)col) &&
+           !VISITED_unchecked_isMarked(walk_p->visited_p, (uint16_t)row, (uint16_t)col);
+}
+
+static bool SNAKE_internal_hasExit(const SnakeWalk_t *const walk_p, int32_t row, int32_t col,
+                                   int32_t fromRow, int32_t fromCol) {
+    for (uint8_t index = 0; index < FOUR_DIRECTIONS; index++) {
+        const int32_t newRow = row + directions[index].row;
+        const int32_t newCol = col + directions[index].col;
+        if ((newRow != fromRow || newCol != fromCol) &&
+            SNAKE_internal_isOpen(walk_p, newRow, newCol)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool SNAKE_internal_append(SnakeWalk_t *const walk_p, uint16_t row, uint16_t col) {
+    VISITED_unchecked_markCell(walk_p->visited_p, row, col);
+    PATH_unchecked_addCoordinates(walk_p->path_p, row, col);
+    walk_p->head = (Cords){.row = row, .col = col};
+    return PATH_unchecked_getLength(walk_p->path_p) == walk_p->pathLength;
+}
+
+static bool SNAKE_internal_repair(SnakeWalk_t *const walk_p, bool isTransition) {
+    const int32_t blockedCol = walk_p->head.col;
+    while (!SNAKE_internal_findDetour(walk_p, isTransition, blockedCol)) {
+        // The head sits in a dead end, the cells it gave back open a way around it.
+        if (PATH_unchecked_getLength(walk_p->path_p) <= walk_p->bandStart) {
+            return false;
+        }
+        const Cords cell = PATH_unchecked_popCoordinates(walk_p->path_p);
+        VISITED_unchecked_unmarkCell(walk_p->visited_p, cell.row, cell.col);
+        walk_p->head = PATH_unchecked_getLastCoordinates(walk_p->path_p);
+        if (abs(walk_p->head.col - blockedCol) >= SNAKE_REPAIR_HALF_WIDTH) {
+            return false; // The blocked column would leave the window.
+        }
+    }
+    return true;
+}
+
+static bool SNAKE_internal_findDetour(SnakeWalk_t *const walk_p, bool isTransition,
+                                      int32_t blockedCol) {
+    const Cords head = walk_p->head;
+    const uint16_t bandBottom =
+        (walk_p->bandTop + 1U < walk_p->noOfRows) ? walk_p->bandTop + 1U : walk_p->bandTop;
+    // A detour may pass through the band after the next one, but it ends in
+    // the next band at the latest, the walk only turns into that one.
+    const int32_t nextBandBottom = bandBottom + 2;
+    // The window: the band and the two bands below it, around the head.
+    const int32_t firstRow = walk_p->bandTop;
+    const int32_t lastRow = (firstRow + SNAKE_REPAIR_ROWS - 1 < walk_p->noOfRows)
+                                ? firstRow + SNAKE_REPAIR_ROWS - 1
+                                : walk_p->noOfRows - 1;
+    const int32_t firstCol =
+        (head.col > SNAKE_REPAIR_HALF_WIDTH) ? head.col - SNAKE_REPAIR_HALF_WIDTH : 0;
+    const int32_t lastCol = (head.col + SNAKE_REPAIR_HALF_WIDTH < walk_p->noOfCols)
+                                ? head.col + SNAKE_REPAIR_HALF_WIDTH
+                                : walk_p->noOfCols - 1;
+    const int32_t windowCols = lastCol - firstCol + 1;
+
+    int16_t parents[SNAKE_REPAIR_CELLS];
+    int16_t queue[SNAKE_REPAIR_CELLS];
+    for (int32_t index = 0; index < (lastRow - firstRow + 1) * windowCols; index++) {
+        parents[index] = SNAKE_UNSEEN;
+    }
+    const int16_t headIndex = (int16_t)((head.row - firstRow) * windowCols + (head.col - firstCol));
+    parents[headIndex] = headIndex;
+    queue[0] = headIndex;
+    int32_t queueHead = 0;
+    int32_t queueTail = 1;
+    int16_t goalIndex = -1;
+    int16_t nextBandIndex = -1;
+
+    while (queueHead < queueTail && goalIndex < 0) {
+        const int16_t cellIndex = queue[queueHead++];
+        const int32_t row = firstRow + cellIndex / windowCols;
+        const int32_t col = firstCol + cellIndex % windowCols;
+        for (uint8_t index = 0; index < FOUR_DIRECTIONS; index++) {
+            const int32_t newRow = row + directions[index].row;
+            const int32_t newCol = col + directions[index].col;
+            if (newRow < firstRow || newRow > lastRow || newCol < firstCol || newCol > lastCol ||
+                !SNAKE_internal_isOpen(walk_p, newRow, newCol)) {
+                continue;
+            }
+            const int16_t newIndex =
+                (int16_t)((newRow - firstRow) * windowCols + (newCol - firstCol));
+            if (parents[newIndex] != SNAKE_UNSEEN) {
+                continue;
+            }
+            parents[newIndex] = cellIndex;
+            // A goal without a way on would trap the walk again at once.
+            const bool isInNextBand = newRow > bandBottom && newRow <= nextBandBottom;
+            const bool isAhead = isTransition
+                                     ? isInNextBand
+                                     : newRow <= bandBottom &&
+                                           (newCol - blockedCol) * walk_p->direction > 0;
+            const bool isGoal = isAhead && SNAKE_internal_hasExit(walk_p, newRow, newCol, row, col);
+            if (isGoal) {
+                goalIndex = newIndex;
+                break;
+            }
+            if (isInNextBand && nextBandIndex < 0 &&
+                SNAKE_internal_hasExit(walk_p, newRow, newCol, row, col)) {
+                nextBandIndex = newIndex;
+            }
+            queue[queueTail++] = newIndex;
+        }
+    }
+    if (goalIndex < 0) {
+        // The rest of the band is cut off, the walk goes on in the next band.
+        goalIndex = nextBandIndex;
+    }
+    if (goalIndex < 0) {
+        return false;
+    }
+
+    // Walk the parents back to the head, then append the detour in order.
+    int32_t noOfSteps = 0;
+    for (int16_t cellIndex = goalIndex; cellIndex != headIndex; cellIndex = parents[cellIndex]) {
+        queue[noOfSteps++] = cellIndex;
+    }
+    while (noOfSteps > 0) {
+        const int16_t cellIndex = queue[--noOfSteps];
+        if (SNAKE_internal_append(walk_p, (uint16_t)(firstRow + cellIndex / windowCols),
+                                  (uint16_t)(firstCol + cellIndex % windowCols))) {
+            break;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,225 @@
+/* > Description ****************************************************************/
+/**
+ * @file startScheduler.c
+ * @brief This is the file for handling the StartScheduler, the precomputed list
+ *        of starting points of the search. The list is built once per search,
+ *        in place when the scheduler is reused, and replaces the rejection
+ *        sampling of random cells.
+ */
+
+/* > Includes ****************************************************************/
+#define MATRIXWORLD_UNCHECKED_API
+#include "startScheduler.h"
+#include "connectivity.h"
+#include "matrixWorld.h"
+#include "utilities.h"
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* > Defines *****************************************************************/
+
+/* > Type Declarations *******************************************************/
+
+/**
+ * @brief Internal structure for the StartScheduler.
+ * @details This struct uses a flexible array member `starts` so the header and
+ *          the list live within a single contiguous block of memory. The
+ *          block holds twice the capacity, the second half is the scratch space
+ *          of the sort, so refilling never allocates.
+ */
+struct StartScheduler {
+    uint32_t capacity;       ///< Most starting points the scheduler can hold.
+    uint32_t noOfStarts;     ///< Number of starting points in `starts`.
+    _Atomic uint32_t cursor; ///< Index of the next start to hand out.
+    Cords starts[];          ///< Flexible array member holding the starting points.
+};
+
+/* > Global Constant Definitions *********************************************/
+
+/* > Global Variable Definitions *********************************************/
+
+/* > Local Constant Definitions **********************************************/
+
+/* > Local Variable Definitions **********************************************/
+
+/* > Local Function Declarations *********************************************/
+
+/**
+ * @brief Shuffles the starting points with a Fisher-Yates shuffle.
+ * @param scheduler_p[in,out] Pointer to the StartScheduler.
+ * @param generator_p[in,out] The seeded generator.
+ */
+static void SCHEDULER_internal_shuffle(StartScheduler *const scheduler_p,
+                                       RandomGenerator *const generator_p);
+
+/**
+ * @brief Stable counting sort of the starting points by their number of
+ *        unblocked neighbors.
+ * @param scheduler_p[in,out] Pointer to the StartScheduler.
+ * @param matrix_p[in]        Pointer to the source WorldMatrix.
+ */
+static void SCHEDULER_internal_sortByDegree(StartScheduler *const scheduler_p,
+                                            const WorldMatrix *const matrix_p);
+
+/**
+ * @brief Internal function to check for null pointers and exit on failure.
+ * @param scheduler_p[in] Pointer to the StartScheduler.
+ * @param message[in]     The error message to print on failure.
+ */
+static void SCHEDULER_internal_nullCheck(const StartScheduler *const scheduler_p,
+                                         const char *restrict message);
+
+/* > Global Function Definitions *********************************************/
+
+StartScheduler *SCHEDULER_createScheduler(const WorldMatrix *const matrix_p,
+                                          const ComponentMap *const componentMap_p,
+                                          uint32_t minComponentSize,
+                                          SchedulerOrder order, uint64_t seed) {
+    if (matrix_p == NULL) {
+        fprintf(stderr, "FATAL ERROR: WorldMatrix supplied to SCHEDULER_createScheduler "
+                        "is NULL!\n");
+        exit(EXIT_FAILURE);
+    }
+    StartScheduler *scheduler_p =
+        SCHEDULER_createEmptyScheduler(MATRIXWORLD_unchecked_getNoOfUnblockedCells(matrix_p));
+    SCHEDULER_refillScheduler(scheduler_p, matrix_p, componentMap_p, minComponentSize, order,
+                              seed);
+    return scheduler_p;
+}
+
+StartScheduler *SCHEDULER_createEmptyScheduler(uint32_t capacity) {
+    StartScheduler *scheduler_p =
+        malloc(sizeof(StartScheduler) + sizeof(Cords) * 2 * (size_t)capacity);
+    if (scheduler_p == NULL) {
+        fprintf(stderr, "FATAL ERROR: Could not allocate memory for StartScheduler!\n");
+        exit(EXIT_FAILURE);
+    }
+    scheduler_p->capacity = capacity;
+    scheduler_p->noOfStarts = 0;
+    atomic_init(&scheduler_p->cursor, 0);
+    return scheduler_p;
+}
+
+void SCHEDULER_refillScheduler(StartScheduler *const scheduler_p,
+                               const WorldMatrix *const matrix_p,
+                               const ComponentMap *const componentMap_p,
+                               uint32_t minComponentSize, SchedulerOrder order, uint64_t seed) {
+    SCHEDULER_internal_nullCheck(scheduler_p, "FATAL ERROR: StartScheduler is uninitialized!\n");
+    if (matrix_p == NULL) {
+        fprintf(stderr, "FATAL ERROR: WorldMatrix supplied to SCHEDULER_refillScheduler "
+                        "is NULL!\n");
+        exit(EXIT_FAILURE);
+    }
+    if (MATRIXWORLD_unchecked_getNoOfUnblockedCells(matrix_p) > scheduler_p->capacity) {
+        fprintf(stderr, "FATAL ERROR: %u unblocked cells exceed the capacity %u of the "
+                        "StartScheduler!\n",
+                MATRIXWORLD_unchecked_getNoOfUnblockedCells(matrix_p), scheduler_p->capacity);
+        exit(EXIT_FAILURE);
+    }
+    const uint16_t rows = MATRIXWORLD_unchecked_getRowSize(matrix_p);
+    const uint16_t cols = MATRIXWORLD_unchecked_getColSize(matrix_p);
+    scheduler_p->noOfStarts = 0;
+    atomic_store_explicit(&scheduler_p->cursor, 0, memory_order_relaxed);
+
+    for (uint16_t row = 0; row < rows; row++) {
+        for (uint16_t col = 0; col < cols; col++) {
+            if (MATRIXWORLD_unchecked_isBlocked(matrix_p, row, col)) {
+                continue;
+            }
+            if (componentMap_p != NULL &&
+                CONNECTIVITY_getComponentSize(componentMap_p, row, col) < minComponentSize) {
+                continue;
+            }
+            scheduler_p->starts[scheduler_p->noOfStarts++] = (Cords){.row = row, .col = col};
+        }
+    }
+
+    RandomGenerator generator;
+    UTILITY_seedGenerator(&generator, seed);
+    SCHEDULER_internal_shuffle(scheduler_p, &generator);
+    if (order == SCHEDULER_ORDER_LOW_DEGREE) {
+        SCHEDULER_internal_sortByDegree(scheduler_p, matrix_p);
+    }
+}
+
+void SCHEDULER_destroyScheduler(StartScheduler **const scheduler_pp) {
+    if (scheduler_pp != NULL && *scheduler_pp != NULL) {
+        free(*scheduler_pp);
+        *scheduler_pp = NULL;
+    }
+}
+
+uint32_t SCHEDULER_claimNext(StartScheduler *const scheduler_p) {
+    SCHEDULER_internal_nullCheck(scheduler_p, "FATAL ERROR: StartScheduler is uninitialized!\n");
+    // Every claimer gets a distinct index, the starts themselves are immutable.
+    uint32_t index = atomic_fetch_add_explicit(&scheduler_p->cursor, 1, memory_order_relaxed);
+    return (index < scheduler_p->noOfStarts) ? index : SCHEDULER_EXHAUSTED;
+}
+
+Cords SCHEDULER_getStart(const StartScheduler *const scheduler_p, uint32_t index) {
+    SCHEDULER_internal_nullCheck(scheduler_p, "FATAL ERROR: StartScheduler is uninitialized!\n");
+    if (index >= scheduler_p->noOfStarts) {
+        fprintf(stderr, "ERROR: Start index %u is out of bounds for this StartScheduler!\n",
+                index);
+        exit(EXIT_FAILURE);
+    }
+    return scheduler_p->starts[index];
+}
+
+uint32_t SCHEDULER_getNoOfStarts(const StartScheduler *const scheduler_p) {
+    SCHEDULER_internal_nullCheck(scheduler_p, "FATAL ERROR: StartScheduler is uninitialized!\n");
+    return scheduler_p->noOfStarts;
+}
+
+void SCHEDULER_reset(StartScheduler *const scheduler_p) {
+    SCHEDULER_internal_nullCheck(scheduler_p, "FATAL ERROR: StartScheduler is uninitialized!\n");
+    atomic_store_explicit(&scheduler_p->cursor, 0, memory_order_relaxed);
+}
+
+/* > Local Function Definitions **********************************************/
+
+static void SCHEDULER_internal_shuffle(StartScheduler *const scheduler_p,
+                                       RandomGenerator *const generator_p) {
+    for (uint32_t index = scheduler_p->noOfStarts; index > 1; index--) {
+        uint32_t swapIndex = UTILITY_nextBoundedRandom(generator_p, index);
+        Cords temp = scheduler_p->starts[index - 1];
+        scheduler_p->starts[index - 1] = scheduler_p->starts[swapIndex];
+        scheduler_p->starts[swapIndex] = temp;
+    }
+}
+
+static void SCHEDULER_internal_sortByDegree(StartScheduler *const scheduler_p,
+                                            const WorldMatrix *const matrix_p) {
+    if (scheduler_p->noOfStarts == 0) {
+        return;
+    }
+    uint32_t bucketStarts[FOUR_DIRECTIONS + 2] = {0};
+    for (uint32_t index = 0; index < scheduler_p->noOfStarts; index++) {
+        Cords start = scheduler_p->starts[index];
+        uint8_t degree = (uint8_t)__builtin_popcount(
+            MATRIXWORLD_unchecked_getUnblockedNeighborMask(matrix_p, start.row, start.col));
+        bucketStarts[degree + 1]++;
+    }
+    for (uint8_t degree = 1; degree <= FOUR_DIRECTIONS + 1; degree++) {
+        bucketStarts[degree] += bucketStarts[degree - 1];
+    }
+
+    Cords *sorted_p = scheduler_p->starts + scheduler_p->capacity;
+    for (uint32_t index = 0; index < scheduler_p->noOfStarts; index++) {
+        Cords start = scheduler_p->starts[index];
+        uint8_t degree = (uint8_t)__builtin_popcount(
+            MATRIXWORLD_unchecked_getUnblockedNeighborMask(matrix_p, start.row, start.col));
+        sorted_p[bucketStarts[degree]++] = start;
+    }
+    memcpy(scheduler_p->starts, sorted_p, sizeof(Cords) * scheduler_p->noOfStarts);
+}
+
+static void SCHEDULER_internal_nullCheck(const StartScheduler *const scheduler_p,
+                                         const char *restrict message) {
+    if (scheduler_p == NULL) {
+        fprintf(stderr, "%s", message);
+        exit(EXIT_FAILURE);
+    }
+}
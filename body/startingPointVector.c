@@ -48,15 +48,19 @@ struct StartingPointVector {
  */
 static int STPOINT_internal_compareCords(const void *aPoint, const void *bPoint);
 
+/**
+ * @brief Gets the capacity of a vector for a matrix, exits on a NULL matrix.
+ * @param matrix_p[in] Pointer to the WorldMatrix.
+ * @param caller[in]   Name of the calling constructor, for the error message.
+ * @return The number of cells of the matrix.
+ */
+static size_t STPOINT_internal_getCapacity(const WorldMatrix *const matrix_p,
+                                           const char *restrict caller);
+
 /* > Global Function Definitions *********************************************/
 
 StartingPointVector *STPOINT_createVector(const WorldMatrix *const matrix_p) {
-    if (matrix_p == NULL) {
-        fprintf(stderr, "FATAL ERROR: WorldMatrix supplied to STPOINT_createVector is NULL!\n");
-        exit(EXIT_FAILURE);
-    }
-
-    const size_t capacity = MATRIXWORLD_getSize(matrix_p);
+    const size_t capacity = STPOINT_internal_getCapacity(matrix_p, "STPOINT_createVector");
     if (capacity == 0) {
         fprintf(stderr, "ERROR: Cannot create StartingPointVector with zero capacity.\n");
         return NULL;
@@ -74,6 +78,22 @@ StartingPointVector *STPOINT_createVector(const WorldMatrix *const matrix_p) {
     return vector_p;
 }
 
+StartingPointVector *STPOINT_createVectorInArena(const WorldMatrix *const matrix_p,
+                                                 Arena *const arena_p) {
+    const size_t capacity = STPOINT_internal_getCapacity(matrix_p, "STPOINT_createVectorInArena");
+    if (capacity == 0) {
+        fprintf(stderr, "ERROR: Cannot create StartingPointVector with zero capacity.\n");
+        return NULL;
+    }
+
+    StartingPointVector *vector_p =
+        ARENA_allocate(arena_p, sizeof(StartingPointVector) + sizeof(Cords) * capacity);
+    *(uint32_t *)&vector_p->capacity = capacity;
+    vector_p->currentSize = 0;
+
+    return vector_p;
+}
+
 void STPOINT_destroyVector(StartingPointVector **const vector_pp) {
     if (vector_pp != NULL && *vector_pp != NULL) {
         free(*vector_pp);
@@ -171,6 +191,15 @@ bool STPOINT_containsPoint(const StartingPointVector *const vector_p, Cords poin
 
 /* > Local Function Definitions **********************************************/
 
+static size_t STPOINT_internal_getCapacity(const WorldMatrix *const matrix_p,
+                                           const char *restrict caller) {
+    if (matrix_p == NULL) {
+        fprintf(stderr, "FATAL ERROR: WorldMatrix supplied to %s is NULL!\n", caller);
+        exit(EXIT_FAILURE);
+    }
+    return MATRIXWORLD_getSize(matrix_p);
+}
+
 static int STPOINT_internal_compareCords(const void *aPoint, const void *bPoint) {
     const Cords *cordA = (const Cords *)aPoint;
     const Cords *cordB = (const Cords *)bPoint;
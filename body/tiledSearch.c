@@ -0,0 +1,708 @@
+/* > Description ****************************************************************/
+/**
+ * @file tiledSearch.c
+ * @brief This is the file for the tiled search. The caller picks the portals
+ *        of every tile, forks one worker per tile and joins the segments the
+ *        workers send back. A segment is the shortest route between the
+ *        portals of its tile, found with a breadth-first search, which is
+ *        then lengthened by square detours: a step a -> b of the segment
+ *        becomes a -> a' -> b' -> b when a' and b' are free neighbors of a and
+ *        b on the same side. Every detour keeps the segment contiguous and
+ *        both of its ends in place.
+ */
+
+/* > Includes ****************************************************************/
+#define MATRIXWORLD_UNCHECKED_API
+#define PATH_UNCHECKED_API
+#define VISITED_UNCHECKED_API
+#include "tiledSearch.h"
+#include "matrixWorld.h"
+#include "path.h"
+#include "pathOutput.h"
+#include "visitedSet.h"
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/* > Defines *****************************************************************/
+#define TILEDSEARCH_NO_CELL UINT32_MAX
+#define TILEDSEARCH_NO_PORTAL UINT16_MAX
+#define TILEDSEARCH_READ_CHUNK 65536U
+
+/* > Type Declarations *******************************************************/
+
+/**
+ * @brief The task of one tile, what a worker needs to build its segment.
+ */
+typedef struct {
+    uint16_t firstRow; ///< The first row of the tile in the matrix.
+    uint16_t firstCol; ///< The first column of the tile in the matrix.
+    uint16_t noOfRows; ///< The number of rows of the tile.
+    uint16_t noOfCols; ///< The number of columns of the tile.
+    Cords entry;       ///< The first cell of the segment, UINT16_MAX for any.
+    Cords exit;        ///< The last cell of the segment, UINT16_MAX for any.
+    uint32_t maxCells; ///< The segment is cut to this number of cells.
+} TileTask_t;
+
+/**
+ * @brief Cell states of the tile a segment is built in.
+ */
+typedef enum {
+    TILEDSEARCH_CELL_FREE = 0,
+    TILEDSEARCH_CELL_BLOCKED,
+    TILEDSEARCH_CELL_ON_SEGMENT
+} TileCellState_t;
+
+/**
+ * @brief A running worker, the process and the caller's end of its socket.
+ */
+typedef struct {
+    pid_t pid;       ///< The worker process, -1 when the segment was built in process.
+    int socketFd;    ///< The caller's end of the socket, -1 when none.
+    Path *segment_p; ///< The segment built in process.
+} TileWorker_t;
+
+/* > Global Constant Definitions *********************************************/
+
+/* > Global Variable Definitions *********************************************/
+
+/* > Local Constant Definitions **********************************************/
+
+/* > Local Variable Definitions **********************************************/
+
+/* > Local Function Declarations *********************************************/
+
+/**
+ * @brief Splits the matrix into tiles in serpentine order and picks the
+ *        portals on every border two consecutive tiles share.
+ * @param matrix_p[in]   Pointer to the WorldMatrix.
+ * @param options_p[in]  Pointer to the options.
+ * @param pathLength[in] The length of the path, the cells wanted of every tile.
+ * @param tasks_p[out]   The tasks, one per tile, in the order of the path.
+ * @return false if a shared border has no pair of free cells.
+ */
+static bool TILEDSEARCH_internal_planTiles(const WorldMatrix *const matrix_p,
+                                           const TILEDSEARCH_Options *const options_p,
+                                           uint32_t pathLength, TileTask_t *const tasks_p);
+
+/**
+ * @brief Picks the portal between two consecutive tiles, the pair of free
+ *        neighboring cells closest to the middle of their shared border.
+ *
+ * The exit of the first tile differs from its entry whenever possible, so
+ * the segment of that tile has room to grow.
+ *
+ * @param matrix_p[in]  Pointer to the WorldMatrix.
+ * @param from_p[in,out] The first tile, its exit is set.
+ * @param to_p[in,out]   The second tile, its entry is set.
+ * @return false if the border has no pair of free cells.
+ */
+static bool TILEDSEARCH_internal_pickPortal(const WorldMatrix *const matrix_p,
+                                            TileTask_t *const from_p, TileTask_t *const to_p);
+
+/**
+ * @brief Builds the segment of a tile.
+ * @param matrix_p[in] Pointer to the WorldMatrix.
+ * @param task_p[in]   The task of the tile.
+ * @return The segment, or NULL if the portals are not connected inside the tile.
+ */
+static Path *TILEDSEARCH_internal_buildSegment(const WorldMatrix *const matrix_p,
+                                               const TileTask_t *const task_p);
+
+/**
+ * @brief Lengthens a segment by square detours.
+ * @param task_p[in]      The task of the tile.
+ * @param state_p[in,out] The cell states of the tile.
+ * @param next_p[in,out]  The cell after every cell of the segment.
+ * @param stack_p[in,out] Room for twice the cells of the tile, holding the
+ *                        cells whose step to the next cell is still to be tried.
+ * @param noOfStacked[in] The number of cells on the stack.
+ * @param length[in]      The number of cells of the segment.
+ * @return The number of cells of the lengthened segment.
+ */
+static uint32_t TILEDSEARCH_internal_addDetours(const TileTask_t *const task_p,
+                                                uint8_t *const state_p, uint32_t *const next_p,
+                                                uint32_t *const stack_p, uint32_t noOfStacked,
+                                                uint32_t length);
+
+/**
+ * @brief Starts the worker of a tile, a forked process when possible.
+ *
+ * The segment is built in process when the options ask for it or the socket
+ * or the process can not be created.
+ *
+ * @param matrix_p[in]  Pointer to the WorldMatrix.
+ * @param task_p[in]    The task of the tile.
+ * @param useProcess[in] Whether to fork a worker process.
+ * @param workers_p[in] The workers started so far, their sockets are closed
+ *                      in the new process.
+ * @param noOfWorkers[in] The number of workers started so far.
+ * @param worker_p[out] The new worker.
+ */
+static void TILEDSEARCH_internal_startWorker(const WorldMatrix *const matrix_p,
+                                             const TileTask_t *const task_p, bool useProcess,
+                                             const TileWorker_t *const workers_p,
+                                             size_t noOfWorkers, TileWorker_t *const worker_p);
+
+/**
+ * @brief Waits for the segment of a worker and ends the worker.
+ * @param matrix_p[in]     Pointer to the WorldMatrix.
+ * @param task_p[in]       The task of the tile.
+ * @param worker_p[in,out] The worker.
+ * @return The segment, or NULL if the worker sent none.
+ */
+static Path *TILEDSEARCH_internal_finishWorker(const WorldMatrix *const matrix_p,
+                                               const TileTask_t *const task_p,
+                                               TileWorker_t *const worker_p);
+
+/**
+ * @brief Checks a segment before it is joined, a worker on another host may
+ *        have answered with any cells.
+ * @param matrix_p[in]     Pointer to the WorldMatrix.
+ * @param task_p[in]       The task of the tile.
+ * @param segment_p[in]    The segment.
+ * @param joined_p[in,out] The cells of the segments joined so far, the cells of
+ *                         the segment are added.
+ * @return false if a cell is outside of the tile, blocked or repeated.
+ */
+static bool TILEDSEARCH_internal_isValidSegment(const WorldMatrix *const matrix_p,
+                                                const TileTask_t *const task_p,
+                                                const Path *const segment_p,
+                                                VisitedSet *const joined_p);
+
+/**
+ * @brief Encodes a task into TILEDSEARCH_TASK_SIZE little endian bytes.
+ * @param task_p[in]  The task.
+ * @param bytes_p[out] The bytes.
+ */
+static void TILEDSEARCH_internal_encodeTask(const TileTask_t *const task_p, uint8_t *bytes_p);
+
+/**
+ * @brief Decodes and validates a task against the matrix.
+ * @param bytes_p[in]  The TILEDSEARCH_TASK_SIZE bytes.
+ * @param matrix_p[in] Pointer to the WorldMatrix.
+ * @param task_p[out]  The task.
+ * @return false if the tile or a portal is outside of the matrix.
+ */
+static bool TILEDSEARCH_internal_decodeTask(const uint8_t *bytes_p,
+                                            const WorldMatrix *const matrix_p,
+                                            TileTask_t *const task_p);
+
+/**
+ * @brief Writes every byte to a socket, retrying short and interrupted writes.
+ * @param socketFd[in] The socket.
+ * @param data_p[in]   The bytes.
+ * @param size[in]     The number of bytes.
+ * @return false if the socket failed.
+ */
+static bool TILEDSEARCH_internal_sendAll(int socketFd, const uint8_t *data_p, size_t size);
+
+/**
+ * @brief Reads from a socket until the peer closes it or size bytes are read.
+ * @param socketFd[in] The socket.
+ * @param data_p[out]  Room for size bytes.
+ * @param size[in]     The number of bytes to read at most.
+ * @return The number of bytes read.
+ */
+static size_t TILEDSEARCH_internal_receive(int socketFd, uint8_t *data_p, size_t size);
+
+/* > Global Function Definitions *********************************************/
+
+TILEDSEARCH_Options TILEDSEARCH_getDefaultOptions(void) {
+    return (TILEDSEARCH_Options){.noOfTileRows = 2, .noOfTileCols = 2, .useProcesses = true};
+}
+
+Path *TILEDSEARCH_findPath(const WorldMatrix *const matrix_p, uint32_t pathLength,
+                           const TILEDSEARCH_Options *options_p) {
+    if (matrix_p == NULL) {
+        fprintf(stderr, "FATAL ERROR: WorldMatrix supplied to TILEDSEARCH_findPath is NULL!\n");
+        exit(EXIT_FAILURE);
+    }
+    const TILEDSEARCH_Options options =
+        (options_p == NULL) ? TILEDSEARCH_getDefaultOptions() : *options_p;
+    const size_t noOfTiles = (size_t)options.noOfTileRows * options.noOfTileCols;
+    if (noOfTiles == 0 || noOfTiles > TILEDSEARCH_MAX_NO_OF_TILES ||
+        options.noOfTileRows > MATRIXWORLD_unchecked_getRowSize(matrix_p) ||
+        options.noOfTileCols > MATRIXWORLD_unchecked_getColSize(matrix_p)) {
+        fprintf(stderr,
+                "FATAL ERROR: TILEDSEARCH_findPath needs between 1 and %u tiles of at least "
+                "one cell!\n",
+                TILEDSEARCH_MAX_NO_OF_TILES);
+        exit(EXIT_FAILURE);
+    }
+    if (pathLength == 0 || pathLength > MATRIXWORLD_unchecked_getNoOfUnblockedCells(matrix_p)) {
+        return NULL;
+    }
+
+    TileTask_t *tasks_p = malloc(noOfTiles * sizeof(TileTask_t));
+    TileWorker_t *workers_p = malloc(noOfTiles * sizeof(TileWorker_t));
+    if (tasks_p == NULL || workers_p == NULL) {
+        fprintf(stderr, "FATAL ERROR: Tiled search could not be initialized. No memory!\n");
+        exit(EXIT_FAILURE);
+    }
+    Path *path_p = NULL;
+    if (TILEDSEARCH_internal_planTiles(matrix_p, &options, pathLength, tasks_p)) {
+        // Every worker runs before the first segment is waited for
+        for (size_t tile = 0; tile < noOfTiles; tile++) {
+            TILEDSEARCH_internal_startWorker(matrix_p, &tasks_p[tile], options.useProcesses,
+                                             workers_p, tile, &workers_p[tile]);
+        }
+        path_p = PATH_initializePath(pathLength, matrix_p);
+        // The tiles do not overlap, so one set catches a repeat in any segment
+        VisitedSet *joined_p = VISITED_createSet(matrix_p);
+        bool isJoined = true;
+        for (size_t tile = 0; tile < noOfTiles; tile++) {
+            Path *segment_p = TILEDSEARCH_internal_finishWorker(matrix_p, &tasks_p[tile],
+                                                                &workers_p[tile]);
+            if (!isJoined || PATH_unchecked_getLength(path_p) == pathLength) {
+                PATH_freePath(&segment_p);
+                continue;
+            }
+            isJoined = segment_p != NULL && TILEDSEARCH_internal_isValidSegment(
+                                                    matrix_p, &tasks_p[tile], segment_p, joined_p);
+            for (size_t cell = 0; isJoined && cell < PATH_unchecked_getLength(segment_p) &&
+                                  PATH_unchecked_getLength(path_p) < pathLength;
+                 cell++) {
+                PATH_unchecked_addCoordinates(path_p, segment_p->pathArray[cell].row,
+                                              segment_p->pathArray[cell].col);
+            }
+            PATH_freePath(&segment_p);
+        }
+        VISITED_destroySet(&joined_p);
+        // Every segment is valid on its own, the portals must still line up
+        if (!isJoined || PATH_unchecked_getLength(path_p) < pathLength ||
+            !PATH_isContiguous(path_p)) {
+            PATH_freePath(&path_p);
+        }
+    }
+    free(workers_p);
+    free(tasks_p);
+    return path_p;
+}
+
+bool TILEDSEARCH_serveTile(int socketFd, const WorldMatrix *const matrix_p) {
+    if (matrix_p == NULL) {
+        fprintf(stderr, "FATAL ERROR: WorldMatrix supplied to TILEDSEARCH_serveTile is NULL!\n");
+        exit(EXIT_FAILURE);
+    }
+    uint8_t bytes[TILEDSEARCH_TASK_SIZE];
+    TileTask_t task;
+    if (TILEDSEARCH_internal_receive(socketFd, bytes, sizeof(bytes)) != sizeof(bytes) ||
+        !TILEDSEARCH_internal_decodeTask(bytes, matrix_p, &task)) {
+        close(socketFd);
+        return false;
+    }
+    Path *segment_p = TILEDSEARCH_internal_buildSegment(matrix_p, &task);
+    if (segment_p == NULL) {
+        close(socketFd);
+        return true;
+    }
+    FILE *stream_p = fdopen(socketFd, "wb");
+    if (stream_p == NULL) {
+        close(socketFd);
+        PATH_freePath(&segment_p);
+        return false;
+    }
+    bool isSent = OUTPUT_writePath(segment_p, stream_p, OUTPUT_FORMAT_BINARY);
+    isSent = (fclose(stream_p) == 0) && isSent;
+    PATH_freePath(&segment_p);
+    return isSent;
+}
+
+/* > Local Function Definitions **********************************************/
+
+static bool TILEDSEARCH_internal_planTiles(const WorldMatrix *const matrix_p,
+                                           const TILEDSEARCH_Options *const options_p,
+                                           uint32_t pathLength, TileTask_t *const tasks_p) {
+    const uint32_t rows = MATRIXWORLD_unchecked_getRowSize(matrix_p);
+    const uint32_t cols = MATRIXWORLD_unchecked_getColSize(matrix_p);
+    size_t tile = 0;
+    for (uint32_t tileRow = 0; tileRow < options_p->noOfTileRows; tileRow++) {
+        for (uint32_t step = 0; step < options_p->noOfTileCols; step++) {
+            // Every other row of tiles is visited from right to left
+            const uint32_t tileCol =
+                (tileRow % 2 == 0) ? step : options_p->noOfTileCols - 1U - step;
+            const uint32_t firstRow = (rows * tileRow) / options_p->noOfTileRows;
+            const uint32_t firstCol = (cols * tileCol) / options_p->noOfTileCols;
+            tasks_p[tile] = (TileTask_t){
+                .firstRow = (uint16_t)firstRow,
+                .firstCol = (uint16_t)firstCol,
+                .noOfRows = (uint16_t)(((rows * (tileRow + 1)) / options_p->noOfTileRows) - firstRow),
+                .noOfCols = (uint16_t)(((cols * (tileCol + 1)) / options_p->noOfTileCols) - firstCol),
+                .entry = {.row = TILEDSEARCH_NO_PORTAL, .col = TILEDSEARCH_NO_PORTAL},
+                .exit = {.row = TILEDSEARCH_NO_PORTAL, .col = TILEDSEARCH_NO_PORTAL},
+                .maxCells = pathLength};
+            if (tile > 0 &&
+                !TILEDSEARCH_internal_pickPortal(matrix_p, &tasks_p[tile - 1], &tasks_p[tile])) {
+                return false;
+            }
+            tile++;
+        }
+    }
+    return true;
+}
+
+static bool TILEDSEARCH_internal_pickPortal(const WorldMatrix *const matrix_p,
+                                            TileTask_t *const from_p, TileTask_t *const to_p) {
+    // Tiles of one row share a column border, the last tiles of two rows a row border
+    const bool isColumnBorder = from_p->firstRow == to_p->firstRow;
+    const uint32_t borderLength = isColumnBorder ? from_p->noOfRows : from_p->noOfCols;
+    Cords fromCell = {.row = from_p->firstRow, .col = from_p->firstCol};
+    Cords toCell = {.row = to_p->firstRow, .col = to_p->firstCol};
+    if (isColumnBorder && to_p->firstCol > from_p->firstCol) {
+        fromCell.col = (uint16_t)(from_p->firstCol + from_p->noOfCols - 1U);
+    } else if (isColumnBorder) {
+        toCell.col = (uint16_t)(to_p->firstCol + to_p->noOfCols - 1U);
+    } else {
+        fromCell.row = (uint16_t)(from_p->firstRow + from_p->noOfRows - 1U);
+    }
+
+    for (int pass = 0; pass < 2; pass++) {
+        // From the middle of the border outwards: 0, -1, +1, -2, +2, ...
+        for (uint32_t attempt = 0; attempt < 2 * borderLength; attempt++) {
+            const int64_t offset = (attempt % 2 == 0) ? (int64_t)(attempt / 2)
+                                                      : -(int64_t)((attempt + 1) / 2);
+            const int64_t position = (int64_t)(borderLength / 2) + offset;
+            if (position < 0 || position >= (int64_t)borderLength) {
+                continue;
+            }
+            Cords from = fromCell;
+            Cords to = toCell;
+            if (isColumnBorder) {
+                from.row = (uint16_t)(from.row + position);
+                to.row = from.row;
+            } else {
+                from.col = (uint16_t)(from.col + position);
+                to.col = from.col;
+            }
+            const bool isEntry = from.row == from_p->entry.row && from.col == from_p->entry.col;
+            if ((pass == 0 && isEntry) || MATRIXWORLD_unchecked_isBlocked(matrix_p, from.row, from.col) ||
+                MATRIXWORLD_unchecked_isBlocked(matrix_p, to.row, to.col)) {
+                continue;
+            }
+            from_p->exit = from;
+            to_p->entry = to;
+            return true;
+        }
+    }
+    return false;
+}
+
+static Path *TILEDSEARCH_internal_buildSegment(const WorldMatrix *const matrix_p,
+                                               const TileTask_t *const task_p) {
+    const uint32_t cols = task_p->noOfCols;
+    const uint32_t noOfCells = (uint32_t)task_p->noOfRows * cols;
+    uint8_t *state_p = malloc(noOfCells);
+    uint32_t *parent_p = malloc(noOfCells * sizeof(uint32_t));
+    uint32_t *next_p = malloc(noOfCells * sizeof(uint32_t));
+    uint32_t *queue_p = malloc(2 * (size_t)noOfCells * sizeof(uint32_t));
+    if (state_p == NULL || parent_p == NULL || next_p == NULL || queue_p == NULL) {
+        fprintf(stderr, "FATAL ERROR: Tile segment could not be initialized. No memory!\n");
+        exit(EXIT_FAILURE);
+    }
+    uint32_t firstFree = TILEDSEARCH_NO_CELL;
+    for (uint32_t cell = 0; cell < noOfCells; cell++) {
+        const bool isBlocked = MATRIXWORLD_unchecked_isBlocked(
+            matrix_p, (uint16_t)(task_p->firstRow + cell / cols),
+            (uint16_t)(task_p->firstCol + cell % cols));
+        state_p[cell] = isBlocked ? TILEDSEARCH_CELL_BLOCKED : TILEDSEARCH_CELL_FREE;
+        parent_p[cell] = TILEDSEARCH_NO_CELL;
+        firstFree = (firstFree == TILEDSEARCH_NO_CELL && !isBlocked) ? cell : firstFree;
+    }
+    const bool hasEntry = task_p->entry.row != TILEDSEARCH_NO_PORTAL;
+    const bool hasExit = task_p->exit.row != TILEDSEARCH_NO_PORTAL;
+    const uint32_t entry = hasEntry ? ((uint32_t)(task_p->entry.row - task_p->firstRow) * cols) +
+                                          (uint32_t)(task_p->entry.col - task_p->firstCol)
+                                    : firstFree;
+    const uint32_t exit = hasExit ? ((uint32_t)(task_p->exit.row - task_p->firstRow) * cols) +
+                                        (uint32_t)(task_p->exit.col - task_p->firstCol)
+                                  : TILEDSEARCH_NO_CELL;
+    Path *segment_p = NULL;
+    // The route is searched from the exit, so following the parents from the
+    // entry walks it in the order of the path. Without an exit it is searched
+    // from the entry to the farthest cell and reversed at the end.
+    const uint32_t source = hasExit ? exit : entry;
+    if (source != TILEDSEARCH_NO_CELL && state_p[source] == TILEDSEARCH_CELL_FREE &&
+        (!hasEntry || state_p[entry] == TILEDSEARCH_CELL_FREE)) {
+        uint32_t head = 0;
+        uint32_t tail = 0;
+        queue_p[tail++] = source;
+        parent_p[source] = source;
+        uint32_t farthest = source;
+        while (head < tail) {
+            const uint32_t cell = queue_p[head++];
+            farthest = cell;
+            const uint32_t row = cell / cols;
+            const uint32_t col = cell % cols;
+            for (uint8_t direction = 0; direction < FOUR_DIRECTIONS; direction++) {
+                const int64_t nextRow = (int64_t)row + directions[direction].row;
+                const int64_t nextCol = (int64_t)col + directions[direction].col;
+                if (nextRow < 0 || nextRow >= task_p->noOfRows || nextCol < 0 ||
+                    nextCol >= (int64_t)cols) {
+                    continue;
+                }
+                const uint32_t neighbor = ((uint32_t)nextRow * cols) + (uint32_t)nextCol;
+                if (state_p[neighbor] == TILEDSEARCH_CELL_FREE &&
+                    parent_p[neighbor] == TILEDSEARCH_NO_CELL) {
+                    parent_p[neighbor] = cell;
+                    queue_p[tail++] = neighbor;
+                }
+            }
+        }
+        const uint32_t target = (hasExit && hasEntry) ? entry : farthest;
+        if (parent_p[target] != TILEDSEARCH_NO_CELL) {
+            uint32_t length = 0;
+            uint32_t noOfStacked = 0;
+            for (uint32_t cell = target;; cell = parent_p[cell]) {
+                state_p[cell] = TILEDSEARCH_CELL_ON_SEGMENT;
+                length++;
+                if (cell == source) {
+                    next_p[cell] = TILEDSEARCH_NO_CELL;
+                    break;
+                }
+                next_p[cell] = parent_p[cell];
+                queue_p[noOfStacked++] = cell;
+            }
+            length = TILEDSEARCH_internal_addDetours(task_p, state_p, next_p, queue_p,
+                                                     noOfStacked, length);
+
+            // The parents are no longer needed and hold the cells in order
+            uint32_t noOfOrdered = 0;
+            for (uint32_t cell = target; cell != TILEDSEARCH_NO_CELL; cell = next_p[cell]) {
+                parent_p[noOfOrdered++] = cell;
+            }
+            const uint32_t noOfKept = (length < task_p->maxCells) ? length : task_p->maxCells;
+            segment_p = PATH_initializePath(noOfKept, matrix_p);
+            for (uint32_t index = 0; index < noOfKept; index++) {
+                const uint32_t cell = hasExit ? parent_p[index] : parent_p[length - 1 - index];
+                PATH_unchecked_addCoordinates(segment_p, (uint16_t)(task_p->firstRow + cell / cols),
+                                              (uint16_t)(task_p->firstCol + cell % cols));
+            }
+        }
+    }
+    free(queue_p);
+    free(next_p);
+    free(parent_p);
+    free(state_p);
+    return segment_p;
+}
+
+static uint32_t TILEDSEARCH_internal_addDetours(const TileTask_t *const task_p,
+                                                uint8_t *const state_p, uint32_t *const next_p,
+                                                uint32_t *const stack_p, uint32_t noOfStacked,
+                                                uint32_t length) {
+    const uint32_t rows = task_p->noOfRows;
+    const uint32_t cols = task_p->noOfCols;
+    // Every detour takes one cell off the stack and puts three on it, and
+    // uses two free cells, so the stack never exceeds twice the tile
+    while (noOfStacked > 0 && length < task_p->maxCells) {
+        const uint32_t from = stack_p[--noOfStacked];
+        const uint32_t to = next_p[from];
+        const uint32_t fromRow = from / cols;
+        const uint32_t toRow = to / cols;
+        for (int32_t side = -1; side <= 1; side += 2) {
+            uint32_t sideFrom;
+            uint32_t sideTo;
+            if (fromRow == toRow) {
+                const int64_t sideRow = (int64_t)fromRow + side;
+                if (sideRow < 0 || sideRow >= (int64_t)rows) {
+                    continue;
+                }
+                sideFrom = (uint32_t)((int64_t)from + ((int64_t)side * cols));
+                sideTo = (uint32_t)((int64_t)to + ((int64_t)side * cols));
+            } else {
+                const int64_t sideCol = (int64_t)(from % cols) + side;
+                if (sideCol < 0 || sideCol >= (int64_t)cols) {
+                    continue;
+                }
+                sideFrom = (uint32_t)((int64_t)from + side);
+                sideTo = (uint32_t)((int64_t)to + side);
+            }
+            if (state_p[sideFrom] != TILEDSEARCH_CELL_FREE ||
+                state_p[sideTo] != TILEDSEARCH_CELL_FREE) {
+                continue;
+            }
+            state_p[sideFrom] = TILEDSEARCH_CELL_ON_SEGMENT;
+            state_p[sideTo] = TILEDSEARCH_CELL_ON_SEGMENT;
+            next_p[from] = sideFrom;
+            next_p[sideFrom] = sideTo;
+            next_p[sideTo] = to;
+            stack_p[noOfStacked++] = sideTo;
+            stack_p[noOfStacked++] = sideFrom;
+            stack_p[noOfStacked++] = from;
+            length += 2;
+            break;
+        }
+    }
+    return length;
+}
+
+static void TILEDSEARCH_internal_startWorker(const WorldMatrix *const matrix_p,
+                                             const TileTask_t *const task_p, bool useProcess,
+                                             const TileWorker_t *const workers_p,
+                                             size_t noOfWorkers, TileWorker_t *const worker_p) {
+    *worker_p = (TileWorker_t){.pid = -1, .socketFd = -1, .segment_p = NULL};
+    int sockets[2];
+    if (useProcess && socketpair(AF_UNIX, SOCK_STREAM, 0, sockets) == 0) {
+        const pid_t pid = fork();
+        if (pid == 0) {
+            close(sockets[0]);
+            for (size_t worker = 0; worker < noOfWorkers; worker++) {
+                if (workers_p[worker].socketFd >= 0) {
+                    close(workers_p[worker].socketFd);
+                }
+            }
+            const bool isServed = TILEDSEARCH_serveTile(sockets[1], matrix_p);
+            _exit(isServed ? EXIT_SUCCESS : EXIT_FAILURE);
+        }
+        close(sockets[1]);
+        uint8_t bytes[TILEDSEARCH_TASK_SIZE];
+        TILEDSEARCH_internal_encodeTask(task_p, bytes);
+        if (pid > 0 && TILEDSEARCH_internal_sendAll(sockets[0], bytes, sizeof(bytes))) {
+            worker_p->pid = pid;
+            worker_p->socketFd = sockets[0];
+            return;
+        }
+        close(sockets[0]);
+        if (pid > 0) {
+            waitpid(pid, NULL, 0);
+        }
+    }
+    worker_p->segment_p = TILEDSEARCH_internal_buildSegment(matrix_p, task_p);
+}
+
+static Path *TILEDSEARCH_internal_finishWorker(const WorldMatrix *const matrix_p,
+                                               const TileTask_t *const task_p,
+                                               TileWorker_t *const worker_p) {
+    if (worker_p->socketFd < 0) {
+        return worker_p->segment_p;
+    }
+    const uint32_t maxCells = (uint32_t)task_p->noOfRows * task_p->noOfCols;
+    const uint32_t noOfCells = (maxCells < task_p->maxCells) ? maxCells : task_p->maxCells;
+    // One byte more than the largest answer, so a longer one is rejected
+    const size_t maxSize = OUTPUT_PATH_HEADER_SIZE + (((size_t)noOfCells + 3) / 4) + 1;
+    uint8_t *data_p = malloc(maxSize);
+    if (data_p == NULL) {
+        fprintf(stderr, "FATAL ERROR: Tile segment could not be received. No memory!\n");
+        exit(EXIT_FAILURE);
+    }
+    const size_t size = TILEDSEARCH_internal_receive(worker_p->socketFd, data_p, maxSize);
+    close(worker_p->socketFd);
+    waitpid(worker_p->pid, NULL, 0);
+
+    Path *segment_p = NULL;
+    if (size > 0) {
+        segment_p = PATH_initializePath(noOfCells, matrix_p);
+        if (!OUTPUT_decodeBinaryPath(data_p, size, segment_p) ||
+            PATH_unchecked_getLength(segment_p) == 0) {
+            PATH_freePath(&segment_p);
+        }
+    }
+    free(data_p);
+    return segment_p;
+}
+
+static bool TILEDSEARCH_internal_isValidSegment(const WorldMatrix *const matrix_p,
+                                                const TileTask_t *const task_p,
+                                                const Path *const segment_p,
+                                                VisitedSet *const joined_p) {
+    for (size_t cell = 0; cell < PATH_unchecked_getLength(segment_p); cell++) {
+        const uint16_t row = segment_p->pathArray[cell].row;
+        const uint16_t col = segment_p->pathArray[cell].col;
+        if (row < task_p->firstRow || row - task_p->firstRow >= task_p->noOfRows ||
+            col < task_p->firstCol || col - task_p->firstCol >= task_p->noOfCols ||
+            MATRIXWORLD_unchecked_isBlocked(matrix_p, row, col) ||
+            VISITED_unchecked_isMarked(joined_p, row, col)) {
+            return false;
+        }
+        VISITED_unchecked_markCell(joined_p, row, col);
+    }
+    return true;
+}
+
+static void TILEDSEARCH_internal_encodeTask(const TileTask_t *const task_p, uint8_t *bytes_p) {
+    const uint16_t values[8] = {task_p->firstRow,  task_p->firstCol,  task_p->noOfRows,
+                                task_p->noOfCols,  task_p->entry.row, task_p->entry.col,
+                                task_p->exit.row,  task_p->exit.col};
+    for (size_t index = 0; index < 8; index++) {
+        bytes_p[2 * index] = (uint8_t)(values[index] & 0xFFU);
+        bytes_p[(2 * index) + 1] = (uint8_t)(values[index] >> 8);
+    }
+    for (size_t byte = 0; byte < 4; byte++) {
+        bytes_p[16 + byte] = (uint8_t)((task_p->maxCells >> (8 * byte)) & 0xFFU);
+    }
+}
+
+static bool TILEDSEARCH_internal_decodeTask(const uint8_t *bytes_p,
+                                            const WorldMatrix *const matrix_p,
+                                            TileTask_t *const task_p) {
+    uint16_t values[8];
+    for (size_t index = 0; index < 8; index++) {
+        values[index] = (uint16_t)(bytes_p[2 * index] | (bytes_p[(2 * index) + 1] << 8));
+    }
+    uint32_t maxCells = 0;
+    for (size_t byte = 0; byte < 4; byte++) {
+        maxCells |= (uint32_t)bytes_p[16 + byte] << (8 * byte);
+    }
+    *task_p = (TileTask_t){.firstRow = values[0],
+                           .firstCol = values[1],
+                           .noOfRows = values[2],
+                           .noOfCols = values[3],
+                           .entry = {.row = values[4], .col = values[5]},
+                           .exit = {.row = values[6], .col = values[7]},
+                           .maxCells = maxCells};
+    const uint32_t endRow = (uint32_t)task_p->firstRow + task_p->noOfRows;
+    const uint32_t endCol = (uint32_t)task_p->firstCol + task_p->noOfCols;
+    if (task_p->noOfRows == 0 || task_p->noOfCols == 0 || maxCells == 0 ||
+        endRow > MATRIXWORLD_unchecked_getRowSize(matrix_p) ||
+        endCol > MATRIXWORLD_unchecked_getColSize(matrix_p)) {
+        return false;
+    }
+    const Cords portals[2] = {task_p->entry, task_p->exit};
+    for (size_t portal = 0; portal < 2; portal++) {
+        const bool isMissing = portals[portal].row == TILEDSEARCH_NO_PORTAL &&
+                               portals[portal].col == TILEDSEARCH_NO_PORTAL;
+        if (!isMissing && (portals[portal].row < task_p->firstRow || portals[portal].row >= endRow ||
+                           portals[portal].col < task_p->firstCol || portals[portal].col >= endCol)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool TILEDSEARCH_internal_sendAll(int socketFd, const uint8_t *data_p, size_t size) {
+    while (size > 0) {
+        // A worker that died must not take the caller down with a SIGPIPE
+        const ssize_t written = send(socketFd, data_p, size, MSG_NOSIGNAL);
+        if (written < 0 && errno == EINTR) {
+            continue;
+        }
+        if (written <= 0) {
+            return false;
+        }
+        data_p += written;
+        size -= (size_t)written;
+    }
+    return true;
+}
+
+static size_t TILEDSEARCH_internal_receive(int socketFd, uint8_t *data_p, size_t size) {
+    size_t noOfRead = 0;
+    while (noOfRead < size) {
+        const size_t chunk =
+            (size - noOfRead < TILEDSEARCH_READ_CHUNK) ? size - noOfRead : TILEDSEARCH_READ_CHUNK;
+        const ssize_t received = read(socketFd, data_p + noOfRead, chunk);
+        if (received < 0 && errno == EINTR) {
+            continue;
+        }
+        if (received <= 0) {
+            break;
+        }
+        noOfRead += (size_t)received;
+    }
+    return noOfRead;
+}
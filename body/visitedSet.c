@@ -0,0 +1,154 @@
+/* > Description ****************************************************************/
+/**
+ * @file visitedSet.c
+ * @brief This is the file for handling the VisitedSet, a dense bitset that
+ *        keeps one bit per cell of the worldMatrix and replaces the sorted
+ *        StartingPointVector in the hot path of the search.
+ */
+
+/* > Includes ****************************************************************/
+#define VISITED_UNCHECKED_API
+#include "visitedSet.h"
+#include "matrixWorld.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* > Defines *****************************************************************/
+
+/* > Type Declarations *******************************************************/
+
+/* > Global Constant Definitions *********************************************/
+
+/* > Global Variable Definitions *********************************************/
+
+/* > Local Constant Definitions **********************************************/
+
+/* > Local Variable Definitions **********************************************/
+
+/* > Local Function Declarations *********************************************/
+
+/**
+ * @brief Internal function to validate the set and the cell, exit on failure.
+ * @param set_p[in] Pointer to the VisitedSet.
+ * @param row[in]   The row to check.
+ * @param col[in]   The column to check.
+ */
+static void VISITED_internal_checkCell(const VisitedSet *const set_p, uint16_t row,
+                                       uint16_t col);
+
+/**
+ * @brief Gets the number of words of a set for a matrix, exits on a NULL matrix.
+ * @param matrix_p[in] Pointer to the WorldMatrix.
+ * @param caller[in]   Name of the calling constructor, for the error message.
+ * @return The number of 64-bit words holding one bit per cell.
+ */
+static size_t VISITED_internal_getNoOfWords(const WorldMatrix *const matrix_p,
+                                            const char *restrict caller);
+
+/**
+ * @brief Initializes an empty set in a block of enough memory.
+ * @param set_p[out]    The block, sized for the words of the matrix.
+ * @param matrix_p[in]  Pointer to the WorldMatrix.
+ * @param noOfWords[in] The number of words of the set.
+ * @return The initialized set.
+ */
+static VisitedSet *VISITED_internal_initializeSet(VisitedSet *const set_p,
+                                                  const WorldMatrix *const matrix_p,
+                                                  size_t noOfWords);
+
+/* > Global Function Definitions *********************************************/
+
+VisitedSet *VISITED_createSet(const WorldMatrix *const matrix_p) {
+    const size_t noOfWords = VISITED_internal_getNoOfWords(matrix_p, "VISITED_createSet");
+
+    VisitedSet *set_p = malloc(sizeof(VisitedSet) + sizeof(uint64_t) * noOfWords);
+    if (set_p == NULL) {
+        fprintf(stderr, "FATAL ERROR: Could not allocate memory for VisitedSet!\n");
+        exit(EXIT_FAILURE);
+    }
+
+    return VISITED_internal_initializeSet(set_p, matrix_p, noOfWords);
+}
+
+VisitedSet *VISITED_createSetInArena(const WorldMatrix *const matrix_p, Arena *const arena_p) {
+    const size_t noOfWords = VISITED_internal_getNoOfWords(matrix_p, "VISITED_createSetInArena");
+
+    VisitedSet *set_p = ARENA_allocate(arena_p, sizeof(VisitedSet) + sizeof(uint64_t) * noOfWords);
+
+    return VISITED_internal_initializeSet(set_p, matrix_p, noOfWords);
+}
+
+void VISITED_destroySet(VisitedSet **const set_pp) {
+    if (set_pp != NULL && *set_pp != NULL) {
+        free(*set_pp);
+        *set_pp = NULL;
+    }
+}
+
+void VISITED_clearSet(VisitedSet *const set_p) {
+    if (set_p != NULL) {
+        memset(set_p->words, 0, sizeof(uint64_t) * set_p->noOfWords);
+    }
+}
+
+void VISITED_markCell(VisitedSet *const set_p, uint16_t row, uint16_t col) {
+    VISITED_internal_checkCell(set_p, row, col);
+    VISITED_unchecked_markCell(set_p, row, col);
+}
+
+void VISITED_unmarkCell(VisitedSet *const set_p, uint16_t row, uint16_t col) {
+    VISITED_internal_checkCell(set_p, row, col);
+    VISITED_unchecked_unmarkCell(set_p, row, col);
+}
+
+bool VISITED_isMarked(const VisitedSet *const set_p, uint16_t row, uint16_t col) {
+    VISITED_internal_checkCell(set_p, row, col);
+    return VISITED_unchecked_isMarked(set_p, row, col);
+}
+
+size_t VISITED_getCapacity(const VisitedSet *const set_p) {
+    if (set_p == NULL) {
+        return 0;
+    }
+    return set_p->noOfCells;
+}
+
+/* > Local Function Definitions **********************************************/
+
+static size_t VISITED_internal_getNoOfWords(const WorldMatrix *const matrix_p,
+                                            const char *restrict caller) {
+    if (matrix_p == NULL) {
+        fprintf(stderr, "FATAL ERROR: WorldMatrix supplied to %s is NULL!\n", caller);
+        exit(EXIT_FAILURE);
+    }
+    return VISITED_unchecked_getNoOfWords(MATRIXWORLD_getRowSize(matrix_p),
+                                          MATRIXWORLD_getColSize(matrix_p));
+}
+
+static VisitedSet *VISITED_internal_initializeSet(VisitedSet *const set_p,
+                                                  const WorldMatrix *const matrix_p,
+                                                  size_t noOfWords) {
+    set_p->rows = MATRIXWORLD_getRowSize(matrix_p);
+    set_p->cols = MATRIXWORLD_getColSize(matrix_p);
+#if defined(MATRIXWORLD_TILED_LAYOUT)
+    set_p->tilesPerRow = (uint16_t)((set_p->cols + VISITED_TILE_SIZE - 1) / VISITED_TILE_SIZE);
+#endif
+    set_p->noOfCells = MATRIXWORLD_getSize(matrix_p);
+    set_p->noOfWords = noOfWords;
+    memset(set_p->words, 0, sizeof(uint64_t) * noOfWords);
+    return set_p;
+}
+
+static void VISITED_internal_checkCell(const VisitedSet *const set_p, uint16_t row,
+                                       uint16_t col) {
+    if (set_p == NULL) {
+        fprintf(stderr, "FATAL ERROR: VisitedSet is uninitialized!\n");
+        exit(EXIT_FAILURE);
+    }
+    if (row >= set_p->rows || col >= set_p->cols) {
+        fprintf(stderr,
+                "ERROR: Cell (%d,%d) is out of bounds for this VisitedSet!\n", row, col);
+        exit(EXIT_FAILURE);
+    }
+}
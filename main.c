@@ -1,9 +1,45 @@
 #include "cli_handling.h"
+#include "batchQueries.h"
 #include "dfsPathFinding.h"
+#include "gridLoader.h"
 #include "matrixWorld.h"
 #include "path.h"
+#include "pathOutput.h"
+#include "tiledSearch.h"
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+
+/** Exit code of a search stopped by --timeout or --nodeBudget. */
+#define EXIT_SEARCH_STOPPED 2
+
+/**
+ * @brief Prints the per-thread statistics of a search.
+ *
+ * @param[in] stats_p The statistics of the search.
+ */
+static void printSearchStats(const DFS_SearchStats *stats_p) {
+  fprintf(stderr, "\n--- Search Statistics ---\n");
+  fprintf(stderr, "%-8s %10s %14s", "thread", "starts", "expanded");
+  if (stats_p->isDetailed) {
+    fprintf(stderr, " %14s %10s %14s", "backtracks", "maxDepth", "lockWait(us)");
+  }
+  fprintf(stderr, "\n");
+  for (uint16_t thrIndex = 0; thrIndex < stats_p->noOfThreads; thrIndex++) {
+    const DFS_ThreadStats *thread_p = &stats_p->threads_p[thrIndex];
+    fprintf(stderr, "%-8u %10u %14llu", thrIndex, thread_p->startsAttempted,
+            (unsigned long long)thread_p->nodesExpanded);
+    if (stats_p->isDetailed) {
+      fprintf(stderr, " %14llu %10u %14.1f", (unsigned long long)thread_p->backtracks,
+              thread_p->maxDepth, (double)thread_p->lockWaitNs / 1000.0);
+    }
+    fprintf(stderr, "%s\n", (thrIndex == stats_p->finderThread) ? "  <- found the path" : "");
+  }
+  if (!stats_p->isDetailed) {
+    fprintf(stderr, "(configure with -DDFS_ENABLE_STATS=ON for backtracks, depth and lock waits)\n");
+  }
+  fprintf(stderr, "-------------------------\n");
+}
 
 int main(int argc, char *argv[]) {
   // 1. Parse Command-Line Arguments
@@ -12,49 +48,204 @@ int main(int argc, char *argv[]) {
     fprintf(stderr, "Error: Failed to parse command-line arguments.\n");
     return EXIT_FAILURE;
   }
-
-  printf("--- Path Finder Initializing ---\n");
-  printf("Matrix Dimensions: %u rows, %u cols\n", params->rows, params->cols);
-  printf("Target Path Length: %u\n", params->pathLength);
-  if (params->blockedCellsCount > 0) {
-    printf("Blocked Cells Provided: %u\n", params->blockedCellsCount);
-  }
-  printf("--------------------------------\n\n");
+  OUTPUT_setQuiet(params->isQuiet);
+  // With --output stdout only carries the path, the report moves to stderr.
+  FILE *report = (params->outputFile != NULL) ? stderr : stdout;
+  bool isReporting = !params->isQuiet;
 
   // 2. Initialize World Matrix
-  WorldMatrix *world =
-      MATRIXWORLD_matrixInitialization(params->rows, params->cols);
+  WorldMatrix *world = NULL;
+  if (params->gridFile != NULL) {
+    world = LOADER_loadGridFile(params->gridFile);
+    if (world != NULL && params->rows != 0 &&
+        (MATRIXWORLD_getRowSize(world) != params->rows ||
+         MATRIXWORLD_getColSize(world) != params->cols)) {
+      fprintf(stderr, "Error: The grid file does not match --rows and --cols.\n");
+      MATRIXWORLD_matrixFree(&world);
+    }
+  } else {
+    world = MATRIXWORLD_matrixInitialization(params->rows, params->cols);
+  }
   if (world == NULL) {
     fprintf(stderr, "Error: Failed to initialize the world matrix.\n");
     CLI_destroyParameters(params);
     return EXIT_FAILURE;
   }
 
+  // The answers of a batch are the only output on stdout.
+  if (params->batchFile == NULL && isReporting) {
+    fprintf(report, "--- Path Finder Initializing ---\n");
+    fprintf(report, "Matrix Dimensions: %u rows, %u cols\n", MATRIXWORLD_getRowSize(world),
+            MATRIXWORLD_getColSize(world));
+    fprintf(report, "Target Path Length: %u\n", params->pathLength);
+    if (params->blockedCellsCount > 0) {
+      fprintf(report, "Blocked Cells Provided: %u\n", params->blockedCellsCount);
+    }
+    if (params->blockedCellsFile != NULL) {
+      fprintf(report, "Blocked Cells File: %s\n", params->blockedCellsFile);
+    }
+    if (params->gridFile != NULL) {
+      fprintf(report, "Grid File: %s\n", params->gridFile);
+    }
+    fprintf(report, "--------------------------------\n\n");
+  }
+
   // 3. Set Blocked Cells
   if (params->blockedCellsCount > 0) {
     MATRIXWORLD_matrixBlanking(world, params->blockedCells,
                                params->blockedCellsCount);
   }
+  uint16_t noOfThreads = 1;
+  if (params->isMultithreading) {
+    noOfThreads = (params->noOfThreads == 0) ? DFS_detectNoOfThreads()
+                                             : params->noOfThreads;
+  }
+  if (params->blockedCellsFile != NULL &&
+      !LOADER_loadBlockedCellsFile(world, params->blockedCellsFile, noOfThreads)) {
+    fprintf(stderr, "Error: Failed to load the blocked cells file.\n");
+    MATRIXWORLD_matrixFree(&world);
+    CLI_destroyParameters(params);
+    return EXIT_FAILURE;
+  }
+
+  if (params->saveGridFile != NULL) {
+    if (!LOADER_saveGridFile(world, params->saveGridFile, params->gridEncoding)) {
+      fprintf(stderr, "Error: Failed to write the grid file.\n");
+      MATRIXWORLD_matrixFree(&world);
+      CLI_destroyParameters(params);
+      return EXIT_FAILURE;
+    }
+    if (isReporting) {
+      fprintf(report, "Grid written to %s\n", params->saveGridFile);
+    }
+    if (params->pathLength == 0 && params->batchFile == NULL) {
+      MATRIXWORLD_matrixFree(&world);
+      CLI_destroyParameters(params);
+      return EXIT_SUCCESS;
+    }
+  }
 
   // 4. Run Pathfinding Algorithm
-  printf("Searching for a path...\n");
-  Path *foundPath = DFS_findPath(world, params->pathLength, params->isMultithreading);
+  DFS_SearchOptions options = DFS_getDefaultOptions();
+  options.isMultithreading = params->isMultithreading;
+  options.ordering = params->ordering;
+  options.engine = params->engine;
+  options.noOfThreads = noOfThreads;
+  options.pinThreads = params->pinThreads;
+  options.useHugePages = params->useHugePages;
+  options.seed = params->seed;
+  options.timeoutMs = params->timeoutMs;
+  options.nodeBudget = params->nodeBudget;
+  options.isComplete = params->isComplete;
+  options.usePortfolio = params->usePortfolio;
+  bool isOutputStdout = params->outputFile == NULL || strcmp(params->outputFile, "-") == 0;
+  FILE *output = isOutputStdout ? stdout : fopen(params->outputFile, "wb");
+  if (output == NULL) {
+    perror("Error opening the output file");
+    MATRIXWORLD_matrixFree(&world);
+    CLI_destroyParameters(params);
+    return EXIT_FAILURE;
+  }
+  if (params->batchFile != NULL) {
+    bool isStdin = strcmp(params->batchFile, "-") == 0;
+    FILE *queries = isStdin ? stdin : fopen(params->batchFile, "r");
+    if (queries == NULL) {
+      perror("Error opening the batch file");
+      if (!isOutputStdout) {
+        fclose(output);
+      }
+      MATRIXWORLD_matrixFree(&world);
+      CLI_destroyParameters(params);
+      return EXIT_FAILURE;
+    }
+    uint32_t noOfRejected = BATCH_runQueries(world, &options, queries, output);
+    if (!isStdin) {
+      fclose(queries);
+    }
+    if (!isOutputStdout) {
+      fclose(output);
+    }
+    MATRIXWORLD_matrixFree(&world);
+    CLI_destroyParameters(params);
+    return (noOfRejected == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+  }
+  if (isReporting) {
+    fprintf(report, "Searching for a path...\n");
+  }
+  Path *foundPath = NULL;
+  DFS_SearchStatus status;
+  if (params->noOfTiles > 0) {
+    TILEDSEARCH_Options tiledOptions = TILEDSEARCH_getDefaultOptions();
+    tiledOptions.noOfTileRows = (params->noOfTiles < MATRIXWORLD_getRowSize(world))
+                                    ? params->noOfTiles : MATRIXWORLD_getRowSize(world);
+    tiledOptions.noOfTileCols = (params->noOfTiles < MATRIXWORLD_getColSize(world))
+                                    ? params->noOfTiles : MATRIXWORLD_getColSize(world);
+    foundPath = TILEDSEARCH_findPath(world, params->pathLength, &tiledOptions);
+    if (foundPath == NULL && isReporting) {
+      // The tiles trade completeness for speed, a failed join proves nothing.
+      fprintf(report, "The tiles could not be joined, searching the whole world...\n");
+    }
+  }
+  if (foundPath != NULL) {
+    status = DFS_STATUS_FOUND;
+  } else if (params->printStats) {
+    DFS_SearchStats stats;
+    status = DFS_findPathBoundedWithStats(world, params->pathLength, &options, &foundPath, &stats);
+    printSearchStats(&stats);
+    DFS_freeSearchStats(&stats);
+  } else {
+    status = DFS_findPathBounded(world, params->pathLength, &options, &foundPath);
+  }
+  bool isStopped = status == DFS_STATUS_TIMED_OUT || status == DFS_STATUS_BUDGET_EXHAUSTED;
+  const char *banner = "\n--- No Path Found From Any Tried Start ---\n";
+  if (status == DFS_STATUS_FOUND) {
+    banner = "\n--- Path Found!---\n";
+  } else if (status == DFS_STATUS_TIMED_OUT) {
+    banner = "\n--- Search Timed Out, Longest Partial Path ---\n";
+  } else if (status == DFS_STATUS_BUDGET_EXHAUSTED) {
+    banner = "\n--- Node Budget Exhausted, Longest Partial Path ---\n";
+  }
 
   // 5. Report Results
-  if (foundPath != NULL) {
-    printf("\n--- Path Found!---\n");
+  bool isWritten = true;
+  if (params->outputFile != NULL) {
+    // Only the path itself goes to the output, an empty one when none is found.
+    if (foundPath != NULL) {
+      isWritten = OUTPUT_writePath(foundPath, output, params->outputFormat);
+    }
+    if (isReporting) {
+      fprintf(report, "%s", banner);
+    }
+  } else if (isReporting) {
+    printf("%s", banner);
+    if (foundPath != NULL) {
+      PATH_printPath(foundPath);
+      printf("--------------------\n");
+    }
+  } else if (foundPath != NULL) {
     PATH_printPath(foundPath);
-    printf("--------------------\n");
-  } else {
-    printf("\n--- No Valid Path Found ---\n");
+  }
+  if (!isOutputStdout) {
+    isWritten = (fclose(output) == 0) && isWritten;
+  }
+  if (!isWritten) {
+    fprintf(stderr, "Error: Failed to write the path.\n");
   }
 
   // 6. Clean Up Resources
-  printf("\nCleaning up resources...\n");
+  if (isReporting) {
+    fprintf(report, "\nCleaning up resources...\n");
+  }
   PATH_freePath(&foundPath);
   MATRIXWORLD_matrixFree(&world);
   CLI_destroyParameters(params);
 
-  printf("Done.\n");
-  return EXIT_SUCCESS;
-}
\ No newline at end of file
+  if (isReporting) {
+    fprintf(report, "Done.\n");
+  }
+  if (!isWritten) {
+    return EXIT_FAILURE;
+  }
+  // A stopped search is told apart from a failed one by its exit code.
+  return isStopped ? EXIT_SEARCH_STOPPED : EXIT_SUCCESS;
+}
@@ -0,0 +1,90 @@
+#include "arena.h"
+#include "utilities.h"
+#include <stdio.h>
+#include <assert.h>
+#include <stdint.h>
+#include <string.h>
+
+void test_create_and_destroy() {
+    printf("Testing: Create and Destroy\n");
+    Arena* arena = ARENA_createArena(1000, false);
+    assert(arena != NULL);
+    // The reservation is rounded up to whole pages
+    assert(ARENA_getCapacity(arena) >= 1000);
+    assert(ARENA_getUsedBytes(arena) == 0);
+    assert(!ARENA_usesHugePages(arena));
+    ARENA_destroyArena(&arena);
+    assert(arena == NULL);
+    printf("Passed: Create and Destroy\n");
+}
+
+void test_blocks_are_cache_line_aligned() {
+    printf("Testing: Blocks are Cache Line Aligned\n");
+    Arena* arena = ARENA_createArena(4096, false);
+    const size_t sizes[] = {1, 63, 64, 65, 200};
+    unsigned char* previous = NULL;
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i) {
+        unsigned char* block = ARENA_allocate(arena, sizes[i]);
+        assert((uintptr_t)block % ARENA_CACHE_LINE_SIZE == 0);
+        // Fresh memory is zero and the blocks do not overlap
+        for (size_t byte = 0; byte < sizes[i]; ++byte) {
+            assert(block[byte] == 0);
+        }
+        memset(block, 0xAB, sizes[i]);
+        assert(previous == NULL || block >= previous + sizes[i - 1]);
+        previous = block;
+    }
+    assert(ARENA_getUsedBytes(arena) == 64 + 64 + 64 + 128 + 256);
+    ARENA_destroyArena(&arena);
+    printf("Passed: Blocks are Cache Line Aligned\n");
+}
+
+void test_rewind_and_reset() {
+    printf("Testing: Rewind and Reset\n");
+    Arena* arena = ARENA_createArena(4096, false);
+    void* first = ARENA_allocate(arena, 100);
+    size_t mark = ARENA_getUsedBytes(arena);
+    void* second = ARENA_allocate(arena, 100);
+
+    // The blocks after the mark are handed out again, the ones before are kept
+    ARENA_rewind(arena, mark);
+    assert(ARENA_getUsedBytes(arena) == mark);
+    void* again = ARENA_allocate(arena, 300);
+    assert(again == second);
+    ARENA_reset(arena);
+    assert(ARENA_getUsedBytes(arena) == 0);
+    assert(ARENA_allocate(arena, 8) == first);
+
+    // The whole capacity can be handed out
+    ARENA_reset(arena);
+    void* whole = ARENA_allocate(arena, ARENA_getCapacity(arena));
+    assert(whole == first);
+    assert(ARENA_getUsedBytes(arena) == ARENA_getCapacity(arena));
+    UNUSED(again);
+    UNUSED(whole);
+    ARENA_destroyArena(&arena);
+    printf("Passed: Rewind and Reset\n");
+}
+
+void test_huge_pages_fall_back() {
+    printf("Testing: Huge Pages Fall Back\n");
+    // Granted or not, the arena is usable and rounded to whole hugepages
+    Arena* arena = ARENA_createArena(3 * 1024 * 1024, true);
+    assert(ARENA_getCapacity(arena) >= 3 * 1024 * 1024);
+    unsigned char* block = ARENA_allocate(arena, 3 * 1024 * 1024);
+    block[0] = 1;
+    block[3 * 1024 * 1024 - 1] = 1;
+    printf("Hugepages granted: %s\n", ARENA_usesHugePages(arena) ? "yes" : "no");
+    ARENA_destroyArena(&arena);
+    printf("Passed: Huge Pages Fall Back\n");
+}
+
+int main(void) {
+    printf("--- Running Arena Tests ---\n");
+    test_create_and_destroy();
+    test_blocks_are_cache_line_aligned();
+    test_rewind_and_reset();
+    test_huge_pages_fall_back();
+    printf("--- All Arena Tests Passed ---\n");
+    return 0;
+}
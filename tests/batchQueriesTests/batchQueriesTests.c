@@ -0,0 +1,143 @@
+#define _GNU_SOURCE // fmemopen, open_memstream
+#include "batchQueries.h"
+#include "dfsPathFinding.h"
+#include "matrixWorld.h"
+#include <stdio.h>
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Runs a query stream and returns the answers, to be freed by the caller.
+ */
+static char* run_queries(WorldMatrix* matrix, const DFS_SearchOptions* options,
+                         const char* queries, uint32_t* noOfRejected) {
+    FILE* input = fmemopen((void*)queries, strlen(queries), "r");
+    assert(input != NULL);
+    char* answers = NULL;
+    size_t answersSize = 0;
+    FILE* output = open_memstream(&answers, &answersSize);
+    assert(output != NULL);
+    *noOfRejected = BATCH_runQueries(matrix, options, input, output);
+    fclose(input);
+    fclose(output);
+    return answers;
+}
+
+/*
+ * Checks a "path N r,c r,c ..." answer: its length, contiguity and that it
+ * avoids the blocked cells of the matrix.
+ */
+static void assert_valid_answer(const WorldMatrix* matrix, const char* answer, uint32_t length) {
+    uint32_t answeredLength = 0;
+    int consumed = 0;
+    int noOfFields = sscanf(answer, "path %u%n", &answeredLength, &consumed);
+    assert(noOfFields == 1 && answeredLength == length);
+    UNUSED(noOfFields);
+    const char* cursor = answer + consumed;
+    uint32_t noOfCells = 0;
+    unsigned previousRow = 0, previousCol = 0, row, col;
+    while (sscanf(cursor, " %u,%u%n", &row, &col, &consumed) == 2) {
+        assert(!MATRIXWORLD_isBlocked(matrix, (uint16_t)row, (uint16_t)col));
+        if (noOfCells > 0) {
+            unsigned distance = (unsigned)abs((int)row - (int)previousRow) +
+                                (unsigned)abs((int)col - (int)previousCol);
+            assert(distance == 1);
+            UNUSED(distance);
+        }
+        previousRow = row;
+        previousCol = col;
+        noOfCells++;
+        cursor += consumed;
+    }
+    assert(noOfCells == length);
+}
+
+void test_find_queries() {
+    printf("Testing: Find Queries\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(6, 6);
+    uint32_t noOfRejected = 0;
+    char* answers = run_queries(matrix, NULL, "# Lengths\nfind 7\n\n  find 1\r\nfind 40\n", &noOfRejected);
+    assert(noOfRejected == 0);
+
+    char* secondLine = strchr(answers, '\n') + 1;
+    char* thirdLine = strchr(secondLine, '\n') + 1;
+    assert_valid_answer(matrix, answers, 7);
+    assert_valid_answer(matrix, secondLine, 1);
+    assert(strcmp(thirdLine, "none 40\n") == 0);
+
+    free(answers);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Find Queries\n");
+}
+
+void test_edits_between_searches() {
+    printf("Testing: Edits Between Searches\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(3, 3);
+    DFS_SearchOptions options = DFS_getDefaultOptions();
+
+    for (int multithreaded = 0; multithreaded <= 1; ++multithreaded) {
+        options.isMultithreading = multithreaded;
+        options.noOfThreads = 2;
+        // Blocking the centre leaves the ring of 8 cells, unblocking restores 9
+        uint32_t noOfRejected = 0;
+        char* answers = run_queries(matrix, &options,
+                                    "block 1 1\nblock 1 1\nfind 9\nfind 8\nunblock 1 1\nfind 9\n",
+                                    &noOfRejected);
+        assert(noOfRejected == 0);
+        assert(strncmp(answers, "none 9\npath 8 ", 14) == 0);
+        assert(strstr(answers, "\npath 9 ") != NULL);
+        assert(!MATRIXWORLD_isBlocked(matrix, 1, 1));
+        assert(MATRIXWORLD_getNoOfUnblockedCells(matrix) == 9);
+        free(answers);
+    }
+
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Edits Between Searches\n");
+}
+
+void test_rejected_queries() {
+    printf("Testing: Rejected Queries\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(4, 4);
+    uint32_t noOfRejected = 0;
+    char* answers = run_queries(matrix, NULL,
+                                "walk 3\nfind\nfind 0\nfind -2\nfind 3 4\nblock 4 0\nunblock 1\nfind 2\n",
+                                &noOfRejected);
+    assert(noOfRejected == 7);
+    // The valid query after the rejected ones is still answered
+    assert_valid_answer(matrix, answers, 2);
+    assert(MATRIXWORLD_getNoOfBlockedCells(matrix) == 0);
+
+    free(answers);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Rejected Queries\n");
+}
+
+void test_stopped_queries() {
+    printf("Testing: Stopped Queries\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(6, 6);
+    DFS_SearchOptions options = DFS_getDefaultOptions();
+    // 30 expansions cannot build a path of 36 cells, but one of 5
+    options.useConstruction = false;
+    options.nodeBudget = 30;
+    uint32_t noOfRejected = 0;
+    char* answers = run_queries(matrix, &options, "find 36\nfind 5\n", &noOfRejected);
+    assert(noOfRejected == 0);
+    assert(strncmp(answers, "timeout 36\n", 11) == 0);
+    assert_valid_answer(matrix, answers + 11, 5);
+
+    free(answers);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Stopped Queries\n");
+}
+
+int main(void) {
+    printf("--- Running BatchQueries Tests ---\n");
+    test_find_queries();
+    test_edits_between_searches();
+    test_rejected_queries();
+    test_stopped_queries();
+    printf("--- All BatchQueries Tests Passed ---\n");
+    return 0;
+}
@@ -12,6 +12,16 @@ void test_unknown_argument();
 void test_blocked_cells_cli();
 void test_blocked_cells_file();
 void test_combined_args();
+void test_ordering_option();
+void test_engine_option();
+void test_threads_option();
+void test_seed_option();
+void test_many_blocked_cells();
+void test_grid_file_options();
+void test_batch_option();
+void test_output_options();
+void test_limit_options();
+void test_tiles_option();
 
 int main(void) {
   printf("--- Running cliHandling Tests ---\n");
@@ -22,6 +32,16 @@ int main(void) {
   test_blocked_cells_cli();
   test_blocked_cells_file();
   test_combined_args();
+  test_ordering_option();
+  test_engine_option();
+  test_threads_option();
+  test_seed_option();
+  test_many_blocked_cells();
+  test_grid_file_options();
+  test_batch_option();
+  test_output_options();
+  test_limit_options();
+  test_tiles_option();
   printf("--- All cliHandling Tests Passed ---\n");
   return 0;
 }
@@ -95,45 +115,317 @@ void test_blocked_cells_cli() {
 void test_blocked_cells_file() {
     printf("Testing: Blocked cells from file\n");
     const char* filename = "test_blocked_cells.txt";
-    FILE* file = fopen(filename, "w");
-    assert(file != NULL);
-    fprintf(file, "# Comment\n1,1\n2,2\n");
-    fclose(file);
 
+    // The file is only recorded, it is loaded straight into the matrix later
     char *argv[] = {"pathFinder", "--rows", "5", "--cols", "5", "--pathLength", "10", "--blockedCellsFile", (char*)filename};
     int argc = sizeof(argv) / sizeof(char *);
     Parameters *params = CLI_parseCliCommands(argc, argv);
     
     assert(params != NULL);
-    assert(params->blockedCellsCount == 2);
-    assert(params->blockedCells[0].row == 1 && params->blockedCells[0].col == 1);
-    assert(params->blockedCells[1].row == 2 && params->blockedCells[1].col == 2);
+    assert(params->blockedCellsCount == 0);
+    assert(params->blockedCellsFile != NULL && strcmp(params->blockedCellsFile, filename) == 0);
     
     CLI_destroyParameters(params);
-    remove(filename);
+
+    char *argv2[] = {"pathFinder", "--rows", "5", "--cols", "5", "--pathLength", "10", "--blockedCellsFile"};
+    params = CLI_parseCliCommands(sizeof(argv2) / sizeof(char *), argv2);
+    assert(params == NULL);
     printf("Passed: Blocked cells from file\n");
 }
 
 void test_combined_args() {
     printf("Testing: Combined CLI and file blocked cells\n");
     const char* filename = "test_blocked_cells_combined.txt";
-    FILE* file = fopen(filename, "w");
-    assert(file != NULL);
-    fprintf(file, "3,3\n4,4\n");
-    fclose(file);
 
     char *argv[] = {"pathFinder", "--rows", "10", "--cols", "10", "--pathLength", "20", "--blockedCells", "{1,1}", "{2,2}", "--blockedCellsFile", (char*)filename};
     int argc = sizeof(argv) / sizeof(char *);
     Parameters *params = CLI_parseCliCommands(argc, argv);
 
     assert(params != NULL);
-    assert(params->blockedCellsCount == 4);
+    assert(params->blockedCellsCount == 2);
     assert(params->blockedCells[0].row == 1 && params->blockedCells[0].col == 1);
     assert(params->blockedCells[1].row == 2 && params->blockedCells[1].col == 2);
-    assert(params->blockedCells[2].row == 3 && params->blockedCells[2].col == 3);
-    assert(params->blockedCells[3].row == 4 && params->blockedCells[3].col == 4);
+    assert(strcmp(params->blockedCellsFile, filename) == 0);
 
     CLI_destroyParameters(params);
-    remove(filename);
     printf("Passed: Combined CLI and file blocked cells\n");
 }
+
+void test_ordering_option() {
+    printf("Testing: Ordering option\n");
+    char *argv1[] = {"pathFinder", "--rows", "5", "--cols", "5", "--pathLength", "10"};
+    Parameters *params = CLI_parseCliCommands(sizeof(argv1) / sizeof(char *), argv1);
+    assert(params != NULL);
+    assert(params->ordering == DFS_ORDERING_RANDOM);
+    CLI_destroyParameters(params);
+
+    char *argv2[] = {"pathFinder", "--rows", "5", "--cols", "5", "--pathLength", "10", "--ordering", "warnsdorff"};
+    params = CLI_parseCliCommands(sizeof(argv2) / sizeof(char *), argv2);
+    assert(params != NULL);
+    assert(params->ordering == DFS_ORDERING_WARNSDORFF);
+    CLI_destroyParameters(params);
+
+    char *argv3[] = {"pathFinder", "--rows", "5", "--cols", "5", "--pathLength", "10", "--ordering", "fixed"};
+    params = CLI_parseCliCommands(sizeof(argv3) / sizeof(char *), argv3);
+    assert(params != NULL);
+    assert(params->ordering == DFS_ORDERING_FIXED);
+    CLI_destroyParameters(params);
+
+    char *argv4[] = {"pathFinder", "--rows", "5", "--cols", "5", "--pathLength", "10", "--ordering", "spiral"};
+    params = CLI_parseCliCommands(sizeof(argv4) / sizeof(char *), argv4);
+    assert(params == NULL);
+
+    char *argv5[] = {"pathFinder", "--rows", "5", "--cols", "5", "--pathLength", "10", "--ordering"};
+    params = CLI_parseCliCommands(sizeof(argv5) / sizeof(char *), argv5);
+    assert(params == NULL);
+    printf("Passed: Ordering option\n");
+}
+
+void test_engine_option() {
+    printf("Testing: Engine option\n");
+    char *argv1[] = {"pathFinder", "--rows", "5", "--cols", "5", "--pathLength", "10"};
+    Parameters *params = CLI_parseCliCommands(sizeof(argv1) / sizeof(char *), argv1);
+    assert(params != NULL);
+    assert(params->engine == DFS_ENGINE_ITERATIVE);
+    CLI_destroyParameters(params);
+
+    char *argv2[] = {"pathFinder", "--rows", "5", "--cols", "5", "--pathLength", "10", "--engine", "bidirectional"};
+    params = CLI_parseCliCommands(sizeof(argv2) / sizeof(char *), argv2);
+    assert(params != NULL);
+    assert(params->engine == DFS_ENGINE_BIDIRECTIONAL);
+    CLI_destroyParameters(params);
+
+    char *argv3[] = {"pathFinder", "--rows", "5", "--cols", "5", "--pathLength", "10", "--engine", "recursive"};
+    params = CLI_parseCliCommands(sizeof(argv3) / sizeof(char *), argv3);
+    assert(params != NULL);
+    assert(params->engine == DFS_ENGINE_RECURSIVE);
+    CLI_destroyParameters(params);
+
+    char *argv4[] = {"pathFinder", "--rows", "5", "--cols", "5", "--pathLength", "10", "--engine", "sideways"};
+    params = CLI_parseCliCommands(sizeof(argv4) / sizeof(char *), argv4);
+    assert(params == NULL);
+
+    char *argv5[] = {"pathFinder", "--rows", "5", "--cols", "5", "--pathLength", "10", "--engine"};
+    params = CLI_parseCliCommands(sizeof(argv5) / sizeof(char *), argv5);
+    assert(params == NULL);
+    printf("Passed: Engine option\n");
+}
+
+void test_threads_option() {
+    printf("Testing: Threads option\n");
+    char *argv1[] = {"pathFinder", "--rows", "5", "--cols", "5", "--pathLength", "10", "--threads", "12", "--pinThreads", "--hugePages"};
+    Parameters *params = CLI_parseCliCommands(sizeof(argv1) / sizeof(char *), argv1);
+    assert(params != NULL);
+    assert(params->isMultithreading);
+    assert(params->noOfThreads == 12);
+    assert(params->pinThreads);
+    assert(params->useHugePages);
+    CLI_destroyParameters(params);
+
+    char *argv2[] = {"pathFinder", "--rows", "5", "--cols", "5", "--pathLength", "10", "--multithreading"};
+    params = CLI_parseCliCommands(sizeof(argv2) / sizeof(char *), argv2);
+    assert(params != NULL);
+    assert(params->noOfThreads == 0);
+    assert(!params->pinThreads);
+    assert(!params->useHugePages);
+    CLI_destroyParameters(params);
+
+    char *argv3[] = {"pathFinder", "--rows", "5", "--cols", "5", "--pathLength", "10", "--threads", "-1"};
+    params = CLI_parseCliCommands(sizeof(argv3) / sizeof(char *), argv3);
+    assert(params == NULL);
+    printf("Passed: Threads option\n");
+}
+
+void test_many_blocked_cells() {
+    printf("Testing: Many blocked cells\n");
+    enum { NO_OF_CELLS = 100 };
+    char cellArgs[NO_OF_CELLS][16];
+    char *argv[7 + 1 + NO_OF_CELLS] = {"pathFinder", "--rows", "100", "--cols", "100", "--pathLength", "10", "--blockedCells"};
+    for (int i = 0; i < NO_OF_CELLS; ++i) {
+        snprintf(cellArgs[i], sizeof(cellArgs[i]), "{%d,%d}", i, 99 - i);
+        argv[8 + i] = cellArgs[i];
+    }
+    Parameters *params = CLI_parseCliCommands(sizeof(argv) / sizeof(char *), argv);
+    assert(params != NULL);
+    assert(params->blockedCellsCount == NO_OF_CELLS);
+    assert(params->blockedCellsCapacity >= NO_OF_CELLS);
+    for (int i = 0; i < NO_OF_CELLS; ++i) {
+        assert(params->blockedCells[i].row == i && params->blockedCells[i].col == 99 - i);
+    }
+    CLI_destroyParameters(params);
+    printf("Passed: Many blocked cells\n");
+}
+
+void test_grid_file_options() {
+    printf("Testing: Grid file options\n");
+    // A grid file replaces --rows and --cols
+    char *argv1[] = {"pathFinder", "--gridFile", "map.grid", "--pathLength", "10"};
+    Parameters *params = CLI_parseCliCommands(sizeof(argv1) / sizeof(char *), argv1);
+    assert(params != NULL);
+    assert(strcmp(params->gridFile, "map.grid") == 0);
+    assert(params->saveGridFile == NULL);
+    assert(params->gridEncoding == LOADER_ENCODING_AUTO);
+    CLI_destroyParameters(params);
+
+    // Conversion only, no path length needed
+    char *argv2[] = {"pathFinder", "--rows", "5", "--cols", "5", "--blockedCellsFile", "map.txt",
+                     "--saveGridFile", "map.grid", "--gridEncoding", "rle"};
+    params = CLI_parseCliCommands(sizeof(argv2) / sizeof(char *), argv2);
+    assert(params != NULL);
+    assert(strcmp(params->saveGridFile, "map.grid") == 0);
+    assert(params->gridEncoding == LOADER_ENCODING_RLE);
+    assert(params->pathLength == 0);
+    CLI_destroyParameters(params);
+
+    char *argv3[] = {"pathFinder", "--gridFile", "map.grid"};
+    params = CLI_parseCliCommands(sizeof(argv3) / sizeof(char *), argv3);
+    assert(params == NULL);
+
+    char *argv4[] = {"pathFinder", "--gridFile", "map.grid", "--pathLength", "10", "--gridEncoding", "zip"};
+    params = CLI_parseCliCommands(sizeof(argv4) / sizeof(char *), argv4);
+    assert(params == NULL);
+    printf("Passed: Grid file options\n");
+}
+
+void test_batch_option() {
+    printf("Testing: Batch option\n");
+    // A batch needs no path length
+    char *argv1[] = {"pathFinder", "--rows", "5", "--cols", "5", "--batch", "-"};
+    Parameters *params = CLI_parseCliCommands(sizeof(argv1) / sizeof(char *), argv1);
+    assert(params != NULL);
+    assert(strcmp(params->batchFile, "-") == 0);
+    assert(params->pathLength == 0);
+    CLI_destroyParameters(params);
+
+    char *argv2[] = {"pathFinder", "--rows", "5", "--cols", "5", "--batch"};
+    params = CLI_parseCliCommands(sizeof(argv2) / sizeof(char *), argv2);
+    assert(params == NULL);
+    printf("Passed: Batch option\n");
+}
+
+void test_seed_option() {
+    printf("Testing: Seed option\n");
+    char *argv1[] = {"pathFinder", "--rows", "5", "--cols", "5", "--pathLength", "10"};
+    Parameters *params = CLI_parseCliCommands(sizeof(argv1) / sizeof(char *), argv1);
+    assert(params != NULL);
+    assert(params->seed == RANDOM_GEN_SEED);
+    CLI_destroyParameters(params);
+
+    char *argv2[] = {"pathFinder", "--rows", "5", "--cols", "5", "--pathLength", "10", "--seed", "18446744073709551615"};
+    params = CLI_parseCliCommands(sizeof(argv2) / sizeof(char *), argv2);
+    assert(params != NULL);
+    assert(params->seed == UINT64_MAX);
+    CLI_destroyParameters(params);
+
+    char *argv3[] = {"pathFinder", "--rows", "5", "--cols", "5", "--pathLength", "10", "--seed", "-3"};
+    params = CLI_parseCliCommands(sizeof(argv3) / sizeof(char *), argv3);
+    assert(params == NULL);
+    printf("Passed: Seed option\n");
+}
+
+void test_output_options() {
+    printf("Testing: Output options\n");
+    char *argv1[] = {"pathFinder", "--rows", "5", "--cols", "5", "--pathLength", "10"};
+    Parameters *params = CLI_parseCliCommands(sizeof(argv1) / sizeof(char *), argv1);
+    assert(params != NULL);
+    assert(params->outputFile == NULL);
+    assert(params->outputFormat == OUTPUT_FORMAT_TEXT);
+    assert(!params->isQuiet);
+    assert(!params->printStats);
+    CLI_destroyParameters(params);
+
+    char *argv2[] = {"pathFinder", "--rows", "5", "--cols", "5", "--pathLength", "10",
+                     "--output", "path.bin", "--format", "binary", "--quiet", "--stats"};
+    params = CLI_parseCliCommands(sizeof(argv2) / sizeof(char *), argv2);
+    assert(params != NULL);
+    assert(strcmp(params->outputFile, "path.bin") == 0);
+    assert(params->outputFormat == OUTPUT_FORMAT_BINARY);
+    assert(params->isQuiet);
+    assert(params->printStats);
+    CLI_destroyParameters(params);
+
+    // A format alone writes the path to stdout
+    char *argv3[] = {"pathFinder", "--rows", "5", "--cols", "5", "--pathLength", "10", "--format", "text"};
+    params = CLI_parseCliCommands(sizeof(argv3) / sizeof(char *), argv3);
+    assert(params != NULL);
+    assert(strcmp(params->outputFile, "-") == 0);
+    CLI_destroyParameters(params);
+
+    char *argv4[] = {"pathFinder", "--rows", "5", "--cols", "5", "--pathLength", "10", "--format", "json"};
+    params = CLI_parseCliCommands(sizeof(argv4) / sizeof(char *), argv4);
+    assert(params == NULL);
+
+    char *argv5[] = {"pathFinder", "--rows", "5", "--cols", "5", "--pathLength", "10", "--output"};
+    params = CLI_parseCliCommands(sizeof(argv5) / sizeof(char *), argv5);
+    assert(params == NULL);
+    printf("Passed: Output options\n");
+}
+
+void test_limit_options() {
+    printf("Testing: Limit options\n");
+    char *argv1[] = {"pathFinder", "--rows", "5", "--cols", "5", "--pathLength", "10"};
+    Parameters *params = CLI_parseCliCommands(sizeof(argv1) / sizeof(char *), argv1);
+    assert(params != NULL);
+    assert(params->timeoutMs == 0);
+    assert(params->nodeBudget == 0);
+    assert(!params->isComplete);
+    CLI_destroyParameters(params);
+
+    char *argv2[] = {"pathFinder", "--rows", "5", "--cols", "5", "--pathLength", "10",
+                     "--timeout", "250", "--nodeBudget", "5000000000", "--complete"};
+    params = CLI_parseCliCommands(sizeof(argv2) / sizeof(char *), argv2);
+    assert(params != NULL);
+    assert(params->timeoutMs == 250);
+    assert(params->nodeBudget == 5000000000ULL);
+    assert(params->isComplete);
+    CLI_destroyParameters(params);
+
+    char *argv3[] = {"pathFinder", "--rows", "5", "--cols", "5", "--pathLength", "10", "--timeout", "-1"};
+    params = CLI_parseCliCommands(sizeof(argv3) / sizeof(char *), argv3);
+    assert(params == NULL);
+
+    char *argv4[] = {"pathFinder", "--rows", "5", "--cols", "5", "--pathLength", "10", "--nodeBudget"};
+    params = CLI_parseCliCommands(sizeof(argv4) / sizeof(char *), argv4);
+    assert(params == NULL);
+    printf("Passed: Limit options\n");
+}
+
+void test_tiles_option() {
+    printf("Testing: Tiles option\n");
+    char *argv1[] = {"pathFinder", "--rows", "5", "--cols", "5", "--pathLength", "10"};
+    Parameters *params = CLI_parseCliCommands(sizeof(argv1) / sizeof(char *), argv1);
+    assert(params != NULL && params->noOfTiles == 0);
+    CLI_destroyParameters(params);
+
+    char *argv2[] = {"pathFinder", "--rows", "5", "--cols", "5", "--pathLength", "10", "--tiles", "4"};
+    params = CLI_parseCliCommands(sizeof(argv2) / sizeof(char *), argv2);
+    assert(params != NULL && params->noOfTiles == 4);
+    CLI_destroyParameters(params);
+
+    char *argv3[] = {"pathFinder", "--rows", "5", "--cols", "5", "--pathLength", "10", "--tiles", "0"};
+    params = CLI_parseCliCommands(sizeof(argv3) / sizeof(char *), argv3);
+    assert(params == NULL);
+
+    char *argv4[] = {"pathFinder", "--rows", "5", "--cols", "5", "--pathLength", "10", "--tiles", "33"};
+    params = CLI_parseCliCommands(sizeof(argv4) / sizeof(char *), argv4);
+    assert(params == NULL);
+
+    // The tiles run without limits, asking for one is rejected
+    char *argv5[] = {"pathFinder", "--rows", "5", "--cols", "5", "--pathLength", "10", "--tiles", "2",
+                     "--timeout", "100"};
+    params = CLI_parseCliCommands(sizeof(argv5) / sizeof(char *), argv5);
+    assert(params == NULL);
+
+    char *argv6[] = {"pathFinder", "--rows", "5", "--cols", "5", "--pathLength", "10", "--tiles", "2",
+                     "--nodeBudget", "1000", "--seed", "7", "--threads", "2"};
+    params = CLI_parseCliCommands(sizeof(argv6) / sizeof(char *), argv6);
+    assert(params == NULL);
+
+    // The seed and the threads are those of the search of a failed join
+    char *argv7[] = {"pathFinder", "--rows", "5", "--cols", "5", "--pathLength", "10", "--tiles", "2",
+                     "--seed", "7", "--threads", "2"};
+    params = CLI_parseCliCommands(sizeof(argv7) / sizeof(char *), argv7);
+    assert(params != NULL && params->seed == 7 && params->noOfThreads == 2);
+    CLI_destroyParameters(params);
+    printf("Passed: Tiles option\n");
+}
@@ -0,0 +1,144 @@
+#define PATH_UNCHECKED_API
+#include "compactPath.h"
+#include "matrixWorld.h"
+#include "path.h"
+#include "utilities.h"
+#include <stdio.h>
+#include <assert.h>
+#include <stdint.h>
+
+/*
+ * Lays a path snaking through the rows of the matrix, with the given length.
+ */
+static Path* create_snake_path(WorldMatrix* matrix, size_t length) {
+    const uint16_t cols = MATRIXWORLD_getColSize(matrix);
+    Path* path = PATH_initializePath(length, matrix);
+    for (size_t step = 0; step < length; ++step) {
+        const uint16_t row = (uint16_t)(step / cols);
+        const uint16_t offset = (uint16_t)(step % cols);
+        PATH_addCoordinates(path, row, (row % 2 == 0) ? offset : (uint16_t)(cols - 1 - offset));
+    }
+    return path;
+}
+
+void test_round_trip() {
+    printf("Testing: Round Trip\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(100, 100);
+    // Crosses a few checkpoints and ends inside a step word
+    Path* path = create_snake_path(matrix, 5000);
+    CompactPath* compact = COMPACTPATH_encodePath(path);
+    assert(compact != NULL && COMPACTPATH_getLength(compact) == 5000);
+    assert(COMPACTPATH_getByteSize(compact) * 15 < PATH_getByteSize(path));
+
+    Path* decoded = PATH_initializePath(5000, matrix);
+    const bool isDecoded = COMPACTPATH_decodePath(compact, decoded);
+    assert(isDecoded && PATH_getLength(decoded) == 5000);
+    for (size_t i = 0; i < 5000; ++i) {
+        assert(decoded->pathArray[i].row == path->pathArray[i].row);
+        assert(decoded->pathArray[i].col == path->pathArray[i].col);
+    }
+    UNUSED(isDecoded);
+
+    PATH_freePath(&decoded);
+    COMPACTPATH_freePath(&compact);
+    assert(compact == NULL);
+    PATH_freePath(&path);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Round Trip\n");
+}
+
+void test_random_access() {
+    printf("Testing: Random Access\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(60, 37);
+    Path* path = create_snake_path(matrix, 1500);
+    CompactPath* compact = COMPACTPATH_encodePath(path);
+    for (size_t i = 0; i < 1500; ++i) {
+        const Cords cell = COMPACTPATH_getCell(compact, i);
+        assert(cell.row == path->pathArray[i].row && cell.col == path->pathArray[i].col);
+        UNUSED(cell);
+    }
+    const Cords outOfRange = COMPACTPATH_getCell(compact, 1500);
+    assert(outOfRange.row == UINT16_MAX && outOfRange.col == UINT16_MAX);
+    UNUSED(outOfRange);
+
+    COMPACTPATH_freePath(&compact);
+    PATH_freePath(&path);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Random Access\n");
+}
+
+void test_iterator() {
+    printf("Testing: Iterator\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(40, 40);
+    Path* path = create_snake_path(matrix, 1100);
+    CompactPath* compact = COMPACTPATH_encodePath(path);
+
+    // Starting in the middle of the path, past the first checkpoint
+    CompactPathIterator iterator;
+    COMPACTPATH_initIterator(&iterator, compact, 1030);
+    Cords cell;
+    size_t index = 1030;
+    while (COMPACTPATH_nextCell(&iterator, &cell)) {
+        assert(cell.row == path->pathArray[index].row && cell.col == path->pathArray[index].col);
+        index++;
+    }
+    assert(index == 1100);
+
+    // Nothing to return once the start is past the end
+    COMPACTPATH_initIterator(&iterator, compact, 1100);
+    const bool hasCell = COMPACTPATH_nextCell(&iterator, &cell);
+    assert(!hasCell);
+    UNUSED(hasCell);
+
+    COMPACTPATH_freePath(&compact);
+    PATH_freePath(&path);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Iterator\n");
+}
+
+void test_invalid_and_short_paths() {
+    printf("Testing: Invalid and Short Paths\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(10, 10);
+    Path* path = PATH_initializePath(10, matrix);
+    CompactPath* compact = COMPACTPATH_encodePath(path);
+    assert(compact != NULL && COMPACTPATH_getLength(compact) == 0);
+    COMPACTPATH_freePath(&compact);
+
+    PATH_addCoordinates(path, 3, 3);
+    compact = COMPACTPATH_encodePath(path);
+    const Cords single = COMPACTPATH_getCell(compact, 0);
+    assert(single.row == 3 && single.col == 3);
+    UNUSED(single);
+    COMPACTPATH_freePath(&compact);
+
+    // A jump between two cells can not be encoded
+    PATH_addCoordinates(path, 3, 5);
+    compact = COMPACTPATH_encodePath(path);
+    assert(compact == NULL);
+
+    // A path too small for the cells is left empty
+    const Cords jump = PATH_popCoordinates(path);
+    UNUSED(jump);
+    PATH_addCoordinates(path, 3, 4);
+    compact = COMPACTPATH_encodePath(path);
+    Path* tooSmall = PATH_initializePath(1, matrix);
+    const bool isDecoded = COMPACTPATH_decodePath(compact, tooSmall);
+    assert(!isDecoded && PATH_isEmpty(tooSmall));
+    UNUSED(isDecoded);
+
+    PATH_freePath(&tooSmall);
+    COMPACTPATH_freePath(&compact);
+    PATH_freePath(&path);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Invalid and Short Paths\n");
+}
+
+int main(void) {
+    printf("--- Running CompactPath Tests ---\n");
+    test_round_trip();
+    test_random_access();
+    test_iterator();
+    test_invalid_and_short_paths();
+    printf("--- All CompactPath Tests Passed ---\n");
+    return 0;
+}
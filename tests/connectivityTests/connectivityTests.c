@@ -0,0 +1,136 @@
+#include "connectivity.h"
+#include "matrixWorld.h"
+#include <stdio.h>
+#include <assert.h>
+
+void test_open_matrix_is_one_component() {
+    printf("Testing: Open Matrix is One Component\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(7, 9);
+    ComponentMap* map = CONNECTIVITY_labelComponents(matrix, 1);
+    assert(map != NULL);
+    assert(CONNECTIVITY_getNoOfComponents(map) == 1);
+    assert(CONNECTIVITY_getLargestComponentSize(map) == 63);
+    assert(CONNECTIVITY_getComponentLabel(map, 0, 0) == 0);
+    assert(CONNECTIVITY_getComponentSize(map, 6, 8) == 63);
+    CONNECTIVITY_freeComponentMap(&map);
+    assert(map == NULL);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Open Matrix is One Component\n");
+}
+
+void test_wall_splits_components() {
+    printf("Testing: Wall Splits Components\n");
+    // A full wall in column 3 leaves a 10x3 and a 10x6 component
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(10, 10);
+    for (uint16_t r = 0; r < 10; ++r) {
+        MATRIXWORLD_setCell(matrix, r, 3, true);
+    }
+    ComponentMap* map = CONNECTIVITY_labelComponents(matrix, 1);
+    assert(CONNECTIVITY_getNoOfComponents(map) == 2);
+    assert(CONNECTIVITY_getLargestComponentSize(map) == 60);
+    assert(CONNECTIVITY_getComponentSize(map, 0, 0) == 30);
+    assert(CONNECTIVITY_getComponentSize(map, 9, 9) == 60);
+    assert(CONNECTIVITY_getComponentSize(map, 5, 3) == 0);
+    assert(CONNECTIVITY_getComponentLabel(map, 5, 3) == CONNECTIVITY_NO_COMPONENT);
+    assert(CONNECTIVITY_getComponentLabel(map, 0, 0) != CONNECTIVITY_getComponentLabel(map, 0, 4));
+    CONNECTIVITY_freeComponentMap(&map);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Wall Splits Components\n");
+}
+
+void test_stripes_are_merged() {
+    printf("Testing: Stripes are Merged\n");
+    // A U-shaped corridor crosses every stripe border twice
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(20, 5);
+    for (uint16_t r = 0; r < 19; ++r) {
+        for (uint16_t c = 1; c < 4; ++c) {
+            MATRIXWORLD_setCell(matrix, r, c, true);
+        }
+    }
+    // An isolated cell in the middle of the blocked area
+    MATRIXWORLD_setCell(matrix, 10, 2, false);
+
+    ComponentMap* single = CONNECTIVITY_labelComponents(matrix, 1);
+    ComponentMap* striped = CONNECTIVITY_labelComponents(matrix, 4);
+    assert(CONNECTIVITY_getNoOfComponents(single) == 2);
+    assert(CONNECTIVITY_getNoOfComponents(striped) == 2);
+    assert(CONNECTIVITY_getLargestComponentSize(striped) == 43);
+    assert(CONNECTIVITY_getComponentSize(striped, 10, 2) == 1);
+    for (uint16_t r = 0; r < 20; ++r) {
+        for (uint16_t c = 0; c < 5; ++c) {
+            assert(CONNECTIVITY_getComponentSize(single, r, c) ==
+                   CONNECTIVITY_getComponentSize(striped, r, c));
+        }
+    }
+    assert(CONNECTIVITY_getComponentLabel(striped, 0, 0) == CONNECTIVITY_getComponentLabel(striped, 0, 4));
+    CONNECTIVITY_freeComponentMap(&single);
+    CONNECTIVITY_freeComponentMap(&striped);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Stripes are Merged\n");
+}
+
+void test_fully_blocked_matrix() {
+    printf("Testing: Fully Blocked Matrix\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(4, 4);
+    for (uint16_t r = 0; r < 4; ++r) {
+        for (uint16_t c = 0; c < 4; ++c) {
+            MATRIXWORLD_setCell(matrix, r, c, true);
+        }
+    }
+    // More threads than rows is allowed
+    ComponentMap* map = CONNECTIVITY_labelComponents(matrix, 8);
+    assert(CONNECTIVITY_getNoOfComponents(map) == 0);
+    assert(CONNECTIVITY_getLargestComponentSize(map) == 0);
+    CONNECTIVITY_freeComponentMap(&map);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Fully Blocked Matrix\n");
+}
+
+void test_relabel_reused_map() {
+    printf("Testing: Relabel Reused Map\n");
+    // A checkerboard holds the most components a matrix can have
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(7, 7);
+    for (uint16_t r = 0; r < 7; ++r) {
+        for (uint16_t c = 0; c < 7; ++c) {
+            MATRIXWORLD_setCell(matrix, r, c, (r + c) % 2 == 1);
+        }
+    }
+    ComponentMap* map = CONNECTIVITY_createComponentMap(matrix);
+    for (uint16_t stripe = 0; stripe < 3; ++stripe) {
+        CONNECTIVITY_labelStripe(map, matrix, stripe, 3);
+    }
+    CONNECTIVITY_finishLabelling(map, 3);
+    assert(CONNECTIVITY_getNoOfComponents(map) == 25);
+    assert(CONNECTIVITY_getLargestComponentSize(map) == 1);
+
+    // Labelling the same map again sees the edited matrix
+    MATRIXWORLD_clearMatrix(matrix);
+    MATRIXWORLD_setCell(matrix, 3, 0, true);
+    MATRIXWORLD_setCell(matrix, 3, 1, true);
+    ComponentMap* reference = CONNECTIVITY_labelComponents(matrix, 2);
+    CONNECTIVITY_labelStripe(map, matrix, 0, 1);
+    CONNECTIVITY_finishLabelling(map, 1);
+    assert(CONNECTIVITY_getNoOfComponents(map) == 1);
+    assert(CONNECTIVITY_getLargestComponentSize(map) == 47);
+    for (uint16_t r = 0; r < 7; ++r) {
+        for (uint16_t c = 0; c < 7; ++c) {
+            assert(CONNECTIVITY_getComponentLabel(map, r, c) ==
+                   CONNECTIVITY_getComponentLabel(reference, r, c));
+        }
+    }
+    CONNECTIVITY_freeComponentMap(&reference);
+    CONNECTIVITY_freeComponentMap(&map);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Relabel Reused Map\n");
+}
+
+int main(void) {
+    printf("--- Running Connectivity Tests ---\n");
+    test_open_matrix_is_one_component();
+    test_wall_splits_components();
+    test_stripes_are_merged();
+    test_fully_blocked_matrix();
+    test_relabel_reused_map();
+    printf("--- All Connectivity Tests Passed ---\n");
+    return 0;
+}
@@ -1,9 +1,13 @@
+#define PATH_UNCHECKED_API
 #include "dfsPathFinding.h"
 #include "matrixWorld.h"
 #include "path.h"
+#include "utilities.h"
+#include "visitedSet.h"
 #include <stdio.h>
 #include <assert.h>
 #include <stdint.h>
+#include <stdlib.h>
 
 void test_finds_valid_path_in_open_matrix() {
     printf("Testing: Find Valid Path in Open Matrix\n");
@@ -65,12 +69,823 @@ void test_finds_valid_path_in_open_matrix_multithreaded() {
     printf("Passed: Find Valid Path in Open Matrix (Multithreaded)\n");
 }
 
+void test_recursive_engine() {
+    printf("Testing: Recursive Engine\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(10, 10);
+    DFS_SearchOptions options = DFS_getDefaultOptions();
+    options.useConstruction = false;
+    options.engine = DFS_ENGINE_RECURSIVE;
+
+    Path* path = DFS_findPathWithOptions(matrix, 12, &options);
+    assert(path != NULL);
+    assert(PATH_getLength(path) == 12);
+    assert(PATH_isContiguous(path));
+
+    PATH_freePath(&path);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Recursive Engine\n");
+}
+
+void test_iterative_engine_long_path() {
+    printf("Testing: Iterative Engine Long Path\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(300, 300);
+    const uint32_t path_length = 9000;
+    DFS_SearchOptions options = DFS_getDefaultOptions();
+    options.useConstruction = false;
+    assert(options.engine == DFS_ENGINE_ITERATIVE);
+
+    Path* path = DFS_findPathWithOptions(matrix, path_length, &options);
+    assert(path != NULL);
+    assert(PATH_getLength(path) == path_length);
+    assert(PATH_isContiguous(path));
+
+    PATH_freePath(&path);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Iterative Engine Long Path\n");
+}
+
+void test_bidirectional_engine() {
+    printf("Testing: Bidirectional Engine\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(300, 300);
+    DFS_SearchOptions options = DFS_getDefaultOptions();
+    options.useConstruction = false;
+    options.engine = DFS_ENGINE_BIDIRECTIONAL;
+
+    Path* path = DFS_findPathWithOptions(matrix, 9000, &options);
+    assert(path != NULL);
+    assert(PATH_getLength(path) == 9000);
+    assert(PATH_isContiguous(path));
+    PATH_freePath(&path);
+    MATRIXWORLD_matrixFree(&matrix);
+
+    // About 20% of the cells are blocked, the path grows in front of its
+    // start once its back is boxed in
+    WorldMatrix* cluttered = MATRIXWORLD_matrixInitialization(100, 100);
+    RandomGenerator generator;
+    UTILITY_seedGenerator(&generator, 7);
+    for (uint16_t r = 0; r < 100; ++r) {
+        for (uint16_t c = 0; c < 100; ++c) {
+            if (UTILITY_nextBoundedRandom(&generator, 100) < 20) {
+                MATRIXWORLD_setCell(cluttered, r, c, true);
+            }
+        }
+    }
+    path = DFS_findPathWithOptions(cluttered, 2000, &options);
+    assert(path != NULL);
+    assert(PATH_getLength(path) == 2000 && PATH_isContiguous(path));
+    VisitedSet* seen = VISITED_createSet(cluttered);
+    for (size_t i = 0; i < PATH_getLength(path); ++i) {
+        Cords cell = path->pathArray[i];
+        assert(!MATRIXWORLD_isBlocked(cluttered, cell.row, cell.col));
+        assert(!VISITED_isMarked(seen, cell.row, cell.col));
+        VISITED_markCell(seen, cell.row, cell.col);
+        UNUSED(cell);
+    }
+    VISITED_destroySet(&seen);
+    PATH_freePath(&path);
+
+    // Both ends of a single start are searched to the end
+    WorldMatrix* grid = MATRIXWORLD_matrixInitialization(4, 4);
+    options.isComplete = true;
+    path = DFS_findPathWithOptions(grid, 16, &options);
+    assert(path != NULL && PATH_getLength(path) == 16 && PATH_isContiguous(path));
+    PATH_freePath(&path);
+
+    MATRIXWORLD_matrixFree(&grid);
+    MATRIXWORLD_matrixFree(&cluttered);
+    printf("Passed: Bidirectional Engine\n");
+}
+
+void test_component_pruning() {
+    printf("Testing: Component Pruning\n");
+    // A wall in column 4 leaves a 12x4 and a 12x7 component
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(12, 12);
+    for (uint16_t r = 0; r < 12; ++r) {
+        MATRIXWORLD_setCell(matrix, r, 4, true);
+    }
+    DFS_SearchOptions options = DFS_getDefaultOptions();
+    options.useConstruction = false;
+    assert(options.useComponentPruning);
+
+    // Enough free cells in total, but no component holds them
+    Path* path = DFS_findPathWithOptions(matrix, 90, &options);
+    assert(path == NULL);
+
+    // Only the larger component can hold this path
+    path = DFS_findPathWithOptions(matrix, 60, &options);
+    assert(path != NULL);
+    assert(PATH_getLength(path) == 60);
+    assert(PATH_isContiguous(path));
+    while (!PATH_isEmpty(path)) {
+        Cords cell = PATH_popCoordinates(path);
+        assert(cell.col > 4);
+        UNUSED(cell);
+    }
+    PATH_freePath(&path);
+
+    options.isMultithreading = true;
+    path = DFS_findPathWithOptions(matrix, 60, &options);
+    assert(path != NULL);
+    assert(PATH_isContiguous(path));
+    PATH_freePath(&path);
+
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Component Pruning\n");
+}
+
+void test_reachability_pruning() {
+    printf("Testing: Reachability Pruning\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(9, 9);
+    DFS_SearchOptions options = DFS_getDefaultOptions();
+    options.useConstruction = false;
+    options.useReachabilityPruning = true;
+
+    Path* path = DFS_findPathWithOptions(matrix, 60, &options);
+    assert(path != NULL);
+    assert(PATH_getLength(path) == 60);
+    assert(PATH_isContiguous(path));
+    PATH_freePath(&path);
+
+    options.isMultithreading = true;
+    path = DFS_findPathWithOptions(matrix, 60, &options);
+    assert(path != NULL);
+    assert(PATH_isContiguous(path));
+    PATH_freePath(&path);
+
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Reachability Pruning\n");
+}
+
+void test_warnsdorff_ordering() {
+    printf("Testing: Warnsdorff Ordering\n");
+    // Every fifth cell of every third row is blocked
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(30, 30);
+    for (uint16_t r = 1; r < 30; r += 3) {
+        for (uint16_t c = (r % 5); c < 30; c += 5) {
+            MATRIXWORLD_setCell(matrix, r, c, true);
+        }
+    }
+    DFS_SearchOptions options = DFS_getDefaultOptions();
+    options.useConstruction = false;
+    options.ordering = DFS_ORDERING_WARNSDORFF;
+
+    Path* path = DFS_findPathWithOptions(matrix, 700, &options);
+    assert(path != NULL);
+    assert(PATH_getLength(path) == 700);
+    assert(PATH_isContiguous(path));
+    PATH_freePath(&path);
+
+    options.ordering = DFS_ORDERING_FIXED;
+    path = DFS_findPathWithOptions(matrix, 40, &options);
+    assert(path != NULL);
+    assert(PATH_isContiguous(path));
+    PATH_freePath(&path);
+
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Warnsdorff Ordering\n");
+}
+
+void test_low_degree_starts() {
+    printf("Testing: Low Degree Starts\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(12, 12);
+    DFS_SearchOptions options = DFS_getDefaultOptions();
+    options.useConstruction = false;
+    options.startOrder = SCHEDULER_ORDER_LOW_DEGREE;
+    options.seed = 1234;
+
+    Path* path = DFS_findPathWithOptions(matrix, 40, &options);
+    assert(path != NULL);
+    assert(PATH_getLength(path) == 40);
+    assert(PATH_isContiguous(path));
+    PATH_freePath(&path);
+
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Low Degree Starts\n");
+}
+
+void test_thread_count_options() {
+    printf("Testing: Thread Count Options\n");
+    assert(DFS_detectNoOfThreads() >= 1);
+
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(20, 20);
+    DFS_SearchOptions options = DFS_getDefaultOptions();
+    options.useConstruction = false;
+    assert(options.noOfThreads == 0);
+    options.isMultithreading = true;
+
+    const uint16_t threadCounts[] = {0, 1, 3, 17};
+    for (size_t i = 0; i < sizeof(threadCounts) / sizeof(threadCounts[0]); ++i) {
+        options.noOfThreads = threadCounts[i];
+        options.pinThreads = (i % 2) == 1;
+        Path* path = DFS_findPathWithOptions(matrix, 50, &options);
+        assert(path != NULL);
+        assert(PATH_getLength(path) == 50);
+        assert(PATH_isContiguous(path));
+        PATH_freePath(&path);
+    }
+
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Thread Count Options\n");
+}
+
+void test_seed_is_reproducible() {
+    printf("Testing: Seed is Reproducible\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(15, 15);
+    DFS_SearchOptions options = DFS_getDefaultOptions();
+    options.useConstruction = false;
+    options.seed = 2024;
+
+    Path* first = DFS_findPathWithOptions(matrix, 60, &options);
+    Path* second = DFS_findPathWithOptions(matrix, 60, &options);
+    assert(first != NULL && second != NULL);
+    while (!PATH_isEmpty(first)) {
+        Cords a = PATH_popCoordinates(first);
+        Cords b = PATH_popCoordinates(second);
+        assert(a.row == b.row && a.col == b.col);
+        UNUSED(a);
+        UNUSED(b);
+    }
+    PATH_freePath(&first);
+    PATH_freePath(&second);
+
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Seed is Reproducible\n");
+}
+
+void test_search_context_reuse() {
+    printf("Testing: Search Context Reuse\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(12, 12);
+    DFS_SearchOptions options = DFS_getDefaultOptions();
+    options.useConstruction = false;
+
+    for (int multithreaded = 0; multithreaded <= 1; ++multithreaded) {
+        options.isMultithreading = multithreaded;
+        options.noOfThreads = 3;
+        DFS_SearchContext* context = DFS_createSearchContext(matrix, &options);
+        assert(context != NULL);
+
+        // Growing and shrinking lengths reuse the same workers
+        const uint32_t lengths[] = {10, 40, 5, 60, 1};
+        for (size_t i = 0; i < sizeof(lengths) / sizeof(lengths[0]); ++i) {
+            Path* path = DFS_searchWithContext(context, lengths[i]);
+            assert(path != NULL);
+            assert(PATH_getLength(path) == lengths[i]);
+            assert(PATH_isContiguous(path));
+            PATH_freePath(&path);
+        }
+
+        // Edits between searches are seen by the next search
+        for (uint16_t r = 0; r < 12; ++r) {
+            MATRIXWORLD_setCell(matrix, r, 6, true);
+        }
+        Path* path = DFS_searchWithContext(context, 80);
+        assert(path == NULL);
+        path = DFS_searchWithContext(context, 50);
+        assert(path != NULL);
+        while (!PATH_isEmpty(path)) {
+            Cords cell = PATH_popCoordinates(path);
+            assert(!MATRIXWORLD_isBlocked(matrix, cell.row, cell.col));
+            UNUSED(cell);
+        }
+        PATH_freePath(&path);
+        MATRIXWORLD_clearMatrix(matrix);
+
+        // A context search matches the one-shot search with the same options
+        Path* fromContext = DFS_searchWithContext(context, 30);
+        options.noOfThreads = 3;
+        Path* oneShot = DFS_findPathWithOptions(matrix, 30, &options);
+        assert(fromContext != NULL && oneShot != NULL);
+        if (!multithreaded) {
+            while (!PATH_isEmpty(fromContext)) {
+                Cords a = PATH_popCoordinates(fromContext);
+                Cords b = PATH_popCoordinates(oneShot);
+                assert(a.row == b.row && a.col == b.col);
+                UNUSED(a);
+                UNUSED(b);
+            }
+        }
+        PATH_freePath(&fromContext);
+        PATH_freePath(&oneShot);
+
+        DFS_destroySearchContext(&context);
+        assert(context == NULL);
+    }
+
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Search Context Reuse\n");
+}
+
+void test_search_report() {
+    printf("Testing: Search Report\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(10, 10);
+    DFS_SearchOptions options = DFS_getDefaultOptions();
+    options.useConstruction = false;
+    DFS_SearchReport report;
+
+    const DFS_Engine engines[] = {DFS_ENGINE_ITERATIVE, DFS_ENGINE_RECURSIVE,
+                                  DFS_ENGINE_BIDIRECTIONAL};
+    for (size_t i = 0; i < sizeof(engines) / sizeof(engines[0]); ++i) {
+        options.engine = engines[i];
+        Path* path = DFS_findPathWithReport(matrix, 20, &options, &report);
+        assert(path != NULL);
+        // Every cell of the found path has been added at least once
+        assert(report.startsAttempted >= 1);
+        assert(report.nodesExpanded >= 20);
+        PATH_freePath(&path);
+    }
+
+    // A search that never starts reports no work
+    Path* path = DFS_findPathWithReport(matrix, 101, &options, &report);
+    assert(path == NULL);
+    assert(report.startsAttempted == 0 && report.nodesExpanded == 0);
+
+    // The report of a context covers its last search only
+    options.isMultithreading = true;
+    options.noOfThreads = 2;
+    DFS_SearchContext* context = DFS_createSearchContext(matrix, &options);
+    DFS_getSearchReport(context, &report);
+    assert(report.startsAttempted == 0);
+    path = DFS_searchWithContext(context, 30);
+    assert(path != NULL);
+    DFS_getSearchReport(context, &report);
+    assert(report.startsAttempted >= 1 && report.nodesExpanded >= 30);
+    PATH_freePath(&path);
+    path = DFS_searchWithContext(context, 200);
+    assert(path == NULL);
+    DFS_getSearchReport(context, &report);
+    assert(report.startsAttempted == 0);
+
+    DFS_destroySearchContext(&context);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Search Report\n");
+}
+
+void test_search_stats() {
+    printf("Testing: Search Stats\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(10, 10);
+    DFS_SearchOptions options = DFS_getDefaultOptions();
+    options.useConstruction = false;
+    DFS_SearchStats stats;
+
+    for (int multithreaded = 0; multithreaded <= 1; ++multithreaded) {
+        options.isMultithreading = multithreaded;
+        options.noOfThreads = 3;
+        Path* path = DFS_findPathWithStats(matrix, 25, &options, &stats);
+        assert(path != NULL);
+        assert(stats.noOfThreads == (multithreaded ? 3 : 1));
+        assert(stats.finderThread >= 0 && stats.finderThread < stats.noOfThreads);
+        const DFS_ThreadStats* finder = &stats.threads_p[stats.finderThread];
+        assert(finder->startsAttempted >= 1 && finder->nodesExpanded >= 25);
+#ifdef DFS_ENABLE_STATS
+        assert(stats.isDetailed);
+        assert(finder->maxDepth == 25);
+        // Every removed cell has been added before
+        assert(finder->backtracks < finder->nodesExpanded);
+#else
+        assert(!stats.isDetailed);
+        assert(finder->maxDepth == 0 && finder->backtracks == 0 && finder->lockWaitNs == 0);
+#endif
+        UNUSED(finder);
+        DFS_freeSearchStats(&stats);
+        assert(stats.threads_p == NULL);
+        PATH_freePath(&path);
+    }
+
+    // No thread finds an impossible path
+    Path* path = DFS_findPathWithStats(matrix, 101, &options, &stats);
+    assert(path == NULL);
+    assert(stats.finderThread == -1);
+    assert(stats.threads_p[0].startsAttempted == 0);
+    DFS_freeSearchStats(&stats);
+
+    // A stopped search reports its statistics together with its partial path
+    options.isMultithreading = false;
+    options.nodeBudget = 50;
+    path = NULL;
+    DFS_SearchStatus status = DFS_findPathBoundedWithStats(matrix, 100, &options, &path, &stats);
+    assert(status == DFS_STATUS_BUDGET_EXHAUSTED && stats.status == status);
+    assert(path != NULL && PATH_getLength(path) > 0 && PATH_getLength(path) < 100);
+    assert(stats.threads_p[0].nodesExpanded >= 50);
+    UNUSED(status);
+    DFS_freeSearchStats(&stats);
+    PATH_freePath(&path);
+
+    // A refused search has neither a path nor expansions
+    status = DFS_findPathBoundedWithStats(matrix, 101, &options, &path, &stats);
+    assert(status == DFS_STATUS_NOT_FOUND && stats.status == status);
+    assert(path == NULL && stats.threads_p[0].nodesExpanded == 0);
+    DFS_freeSearchStats(&stats);
+
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Search Stats\n");
+}
+
+void test_node_budget() {
+    printf("Testing: Node Budget\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(10, 10);
+    DFS_SearchOptions options = DFS_getDefaultOptions();
+    options.useConstruction = false;
+    options.nodeBudget = 50;
+
+    // A path of 100 cells needs more than 50 expansions
+    const DFS_Engine engines[] = {DFS_ENGINE_ITERATIVE, DFS_ENGINE_RECURSIVE,
+                                  DFS_ENGINE_BIDIRECTIONAL};
+    for (size_t i = 0; i < sizeof(engines) / sizeof(engines[0]); ++i) {
+        options.engine = engines[i];
+        Path* path = NULL;
+        DFS_SearchStatus status = DFS_findPathBounded(matrix, 100, &options, &path);
+        assert(status == DFS_STATUS_BUDGET_EXHAUSTED);
+        assert(path != NULL);
+        assert(PATH_getLength(path) >= 1 && PATH_getLength(path) < 100);
+        assert(PATH_isContiguous(path));
+        UNUSED(status);
+        PATH_freePath(&path);
+    }
+
+    // The budget is shared by all threads, and a stopped search is no result
+    options.engine = DFS_ENGINE_ITERATIVE;
+    options.isMultithreading = true;
+    options.noOfThreads = 3;
+    options.nodeBudget = 1000;
+    DFS_SearchContext* context = DFS_createSearchContext(matrix, &options);
+    Path* answer = PATH_initializePath(100, matrix);
+    bool isFound = DFS_searchIntoPath(context, 100, answer);
+    assert(!isFound);
+    assert(PATH_getLength(answer) == 0);
+    UNUSED(isFound);
+    DFS_SearchReport report;
+    DFS_getSearchReport(context, &report);
+    assert(report.status == DFS_STATUS_BUDGET_EXHAUSTED);
+    assert(report.nodesExpanded >= 1000 && report.nodesExpanded < 1000 + 3 * 256);
+
+    // A budget large enough lets the search finish
+    DFS_SearchStatus status = DFS_searchBounded(context, 20, answer);
+    assert(status == DFS_STATUS_FOUND);
+    assert(PATH_getLength(answer) == 20 && PATH_isContiguous(answer));
+    UNUSED(status);
+
+    PATH_freePath(&answer);
+    DFS_destroySearchContext(&context);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Node Budget\n");
+}
+
+void test_timeout() {
+    printf("Testing: Timeout\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(200, 200);
+    DFS_SearchOptions options = DFS_getDefaultOptions();
+    options.useConstruction = false;
+    options.timeoutMs = 1;
+
+    for (int multithreaded = 0; multithreaded <= 1; ++multithreaded) {
+        options.isMultithreading = multithreaded;
+        options.noOfThreads = 2;
+        // Covering every cell of the map takes far longer than a millisecond
+        Path* path = NULL;
+        DFS_SearchStatus status = DFS_findPathBounded(matrix, 200 * 200, &options, &path);
+        assert(status == DFS_STATUS_TIMED_OUT);
+        assert(path != NULL && PATH_isContiguous(path));
+        UNUSED(status);
+        PATH_freePath(&path);
+    }
+
+    // Without limits the same options find a short path
+    options.timeoutMs = 0;
+    Path* path = NULL;
+    DFS_SearchStatus status = DFS_findPathBounded(matrix, 50, &options, &path);
+    assert(status == DFS_STATUS_FOUND);
+    assert(path != NULL && PATH_getLength(path) == 50);
+    UNUSED(status);
+    PATH_freePath(&path);
+
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Timeout\n");
+}
+
+void test_complete_search_from_start() {
+    printf("Testing: Complete Search From Start\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(5, 5);
+    DFS_SearchOptions options = DFS_getDefaultOptions();
+
+    // Covering the whole grid needs many failed branches to be undone
+    const DFS_Engine engines[] = {DFS_ENGINE_ITERATIVE, DFS_ENGINE_RECURSIVE,
+                                  DFS_ENGINE_BIDIRECTIONAL};
+    for (size_t i = 0; i < sizeof(engines) / sizeof(engines[0]); ++i) {
+        options.engine = engines[i];
+        Path* path = DFS_findPathFromStart(matrix, 25, (Cords){.row = 0, .col = 0}, &options);
+        assert(path != NULL);
+        assert(PATH_getLength(path) == 25 && PATH_isContiguous(path));
+        assert(path->pathArray[0].row == 0 && path->pathArray[0].col == 0);
+        PATH_freePath(&path);
+    }
+
+    // A path over all 25 cells must start on one of the 13 cells of the
+    // majority colour, the exhaustive search proves there is none from (0,1)
+    options.engine = DFS_ENGINE_ITERATIVE;
+    Path* path = DFS_findPathFromStart(matrix, 25, (Cords){.row = 0, .col = 1}, &options);
+    assert(path == NULL);
+
+    // Blocked and out of bounds starts have no path
+    MATRIXWORLD_setCell(matrix, 2, 2, true);
+    path = DFS_findPathFromStart(matrix, 3, (Cords){.row = 2, .col = 2}, &options);
+    assert(path == NULL);
+    path = DFS_findPathFromStart(matrix, 3, (Cords){.row = 5, .col = 0}, &options);
+    assert(path == NULL);
+
+    // The ring around the blocked centre is covered from every start
+    MATRIXWORLD_setCell(matrix, 1, 1, true);
+    MATRIXWORLD_setCell(matrix, 1, 2, true);
+    MATRIXWORLD_setCell(matrix, 1, 3, true);
+    MATRIXWORLD_setCell(matrix, 2, 1, true);
+    MATRIXWORLD_setCell(matrix, 2, 3, true);
+    MATRIXWORLD_setCell(matrix, 3, 1, true);
+    MATRIXWORLD_setCell(matrix, 3, 2, true);
+    MATRIXWORLD_setCell(matrix, 3, 3, true);
+    options.isComplete = true;
+    options.isMultithreading = true;
+    options.noOfThreads = 2;
+    path = DFS_findPathWithOptions(matrix, 16, &options);
+    assert(path != NULL && PATH_getLength(path) == 16 && PATH_isContiguous(path));
+    PATH_freePath(&path);
+
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Complete Search From Start\n");
+}
+
+void test_extend_path() {
+    printf("Testing: Extend Path\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(10, 10);
+    DFS_SearchOptions options = DFS_getDefaultOptions();
+    Path* prefix = PATH_initializePath(10, matrix);
+    for (uint16_t c = 0; c < 10; ++c) {
+        PATH_addCoordinates(prefix, 0, c);
+    }
+
+    // Every engine keeps the prefix in front of the grown cells
+    const DFS_Engine engines[] = {DFS_ENGINE_ITERATIVE, DFS_ENGINE_RECURSIVE,
+                                  DFS_ENGINE_BIDIRECTIONAL};
+    for (size_t i = 0; i < sizeof(engines) / sizeof(engines[0]); ++i) {
+        options.engine = engines[i];
+        Path* path = DFS_extendPath(matrix, 60, prefix, &options);
+        assert(path != NULL);
+        assert(PATH_getLength(path) == 60 && PATH_isContiguous(path));
+        for (uint16_t c = 0; c < 10; ++c) {
+            assert(path->pathArray[c].row == 0 && path->pathArray[c].col == c);
+        }
+        PATH_freePath(&path);
+    }
+
+    // A long prefix is cut, an invalid one has no extension
+    Path* path = DFS_extendPath(matrix, 4, prefix, &options);
+    assert(path != NULL && PATH_getLength(path) == 4 && path->pathArray[3].col == 3);
+    PATH_freePath(&path);
+    MATRIXWORLD_setCell(matrix, 0, 5, true);
+    path = DFS_extendPath(matrix, 20, prefix, &options);
+    assert(path == NULL);
+    MATRIXWORLD_setCell(matrix, 0, 5, false);
+
+    // The last cell of the prefix sits in a corner the blocked column closes
+    MATRIXWORLD_setCell(matrix, 1, 8, true);
+    MATRIXWORLD_setCell(matrix, 1, 9, true);
+    path = DFS_extendPath(matrix, 11, prefix, &options);
+    assert(path == NULL);
+
+    // With a context, a limit hands out the prefix and the partial extension
+    MATRIXWORLD_setCell(matrix, 1, 8, false);
+    MATRIXWORLD_setCell(matrix, 1, 9, false);
+    options.engine = DFS_ENGINE_ITERATIVE;
+    options.nodeBudget = 20;
+    DFS_SearchContext* context = DFS_createSearchContext(matrix, &options);
+    Path* answer = PATH_initializePath(75, matrix);
+    DFS_SearchStatus status = DFS_extendBounded(context, prefix, 75, answer);
+    assert(status == DFS_STATUS_BUDGET_EXHAUSTED);
+    assert(PATH_getLength(answer) > 10 && PATH_getLength(answer) < 75);
+    assert(PATH_isContiguous(answer) && answer->pathArray[9].col == 9);
+    UNUSED(status);
+
+    PATH_freePath(&answer);
+    DFS_destroySearchContext(&context);
+    PATH_freePath(&prefix);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Extend Path\n");
+}
+
+void test_portfolio_search() {
+    printf("Testing: Portfolio Search\n");
+    // Every fifth cell of every third row is blocked
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(30, 30);
+    for (uint16_t r = 1; r < 30; r += 3) {
+        for (uint16_t c = (r % 5); c < 30; c += 5) {
+            MATRIXWORLD_setCell(matrix, r, c, true);
+        }
+    }
+    DFS_SearchOptions options = DFS_getDefaultOptions();
+    options.useConstruction = false;
+    assert(!options.usePortfolio);
+    options.usePortfolio = true;
+    options.isMultithreading = true;
+    // Every strategy of the table and the first worker
+    options.noOfThreads = 5;
+
+    const DFS_Engine engines[] = {DFS_ENGINE_ITERATIVE, DFS_ENGINE_RECURSIVE,
+                                  DFS_ENGINE_BIDIRECTIONAL};
+    for (size_t i = 0; i < sizeof(engines) / sizeof(engines[0]); ++i) {
+        options.engine = engines[i];
+        Path* path = DFS_findPathWithOptions(matrix, 600, &options);
+        assert(path != NULL);
+        assert(PATH_getLength(path) == 600 && PATH_isContiguous(path));
+        PATH_freePath(&path);
+    }
+
+    // Without the components to rule it out, the restarting workers stop
+    // once the claiming ones have tried every start
+    options.engine = DFS_ENGINE_ITERATIVE;
+    options.useComponentPruning = false;
+    for (uint16_t r = 0; r < 30; ++r) {
+        MATRIXWORLD_setCell(matrix, r, 15, true);
+    }
+    Path* path = DFS_findPathWithOptions(matrix, 500, &options);
+    assert(path == NULL);
+
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Portfolio Search\n");
+}
+
+/*
+ * Runs a bounded search with a context, so the report and a partial path
+ * are available as well.
+ */
+static DFS_SearchStatus search_with_report(WorldMatrix* matrix, uint32_t length,
+                                           const DFS_SearchOptions* options, Path* answer,
+                                           DFS_SearchReport* report) {
+    DFS_SearchContext* context = DFS_createSearchContext(matrix, options);
+    DFS_SearchStatus status = DFS_searchBounded(context, length, answer);
+    DFS_getSearchReport(context, report);
+    DFS_destroySearchContext(&context);
+    return status;
+}
+
+void test_kernels_match_generic_loop() {
+    printf("Testing: Kernels Match Generic Loop\n");
+    // A narrow and a wide matrix, every fifth cell of every third row blocked
+    const uint16_t widths[] = {30, 100};
+    const DFS_Ordering orderings[] = {DFS_ORDERING_RANDOM, DFS_ORDERING_FIXED,
+                                      DFS_ORDERING_WARNSDORFF};
+    for (size_t w = 0; w < sizeof(widths) / sizeof(widths[0]); ++w) {
+        WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(24, widths[w]);
+        for (uint16_t r = 1; r < 24; r += 3) {
+            for (uint16_t c = (r % 5); c < widths[w]; c += 5) {
+                MATRIXWORLD_setCell(matrix, r, c, true);
+            }
+        }
+        const uint32_t length = (uint32_t)(MATRIXWORLD_getNoOfUnblockedCells(matrix) * 3 / 4);
+        for (size_t o = 0; o < sizeof(orderings) / sizeof(orderings[0]); ++o) {
+            for (int pruning = 0; pruning < 2; ++pruning) {
+                DFS_SearchOptions options = DFS_getDefaultOptions();
+                options.useConstruction = false;
+                options.ordering = orderings[o];
+                options.useReachabilityPruning = pruning != 0;
+                // Cuts the slow searches, the partial paths have to match too
+                options.nodeBudget = 50000;
+                assert(options.useKernels);
+
+                Path* kernelPath = PATH_initializePath(length, matrix);
+                Path* genericPath = PATH_initializePath(length, matrix);
+                DFS_SearchReport kernelReport;
+                DFS_SearchReport genericReport;
+                DFS_SearchStatus kernelStatus =
+                    search_with_report(matrix, length, &options, kernelPath, &kernelReport);
+                options.useKernels = false;
+                DFS_SearchStatus genericStatus =
+                    search_with_report(matrix, length, &options, genericPath, &genericReport);
+
+                assert(kernelStatus == genericStatus);
+                assert(kernelReport.nodesExpanded == genericReport.nodesExpanded);
+                assert(kernelReport.startsAttempted == genericReport.startsAttempted);
+                assert(PATH_getLength(kernelPath) == PATH_getLength(genericPath));
+                assert(PATH_getLength(kernelPath) > 0 && PATH_isContiguous(kernelPath));
+                for (size_t i = 0; i < PATH_getLength(kernelPath); ++i) {
+                    assert(kernelPath->pathArray[i].row == genericPath->pathArray[i].row);
+                    assert(kernelPath->pathArray[i].col == genericPath->pathArray[i].col);
+                }
+                UNUSED(kernelStatus);
+                UNUSED(genericStatus);
+                PATH_freePath(&genericPath);
+                PATH_freePath(&kernelPath);
+            }
+        }
+        MATRIXWORLD_matrixFree(&matrix);
+    }
+    printf("Passed: Kernels Match Generic Loop\n");
+}
+
+/*
+ * Checks that a path only takes steps of the eight neighborhood over
+ * distinct unblocked cells.
+ */
+static bool is_eight_neighborhood_path(const WorldMatrix* matrix, const Path* path) {
+    for (size_t i = 0; i < PATH_getLength(path); ++i) {
+        const Cords cell = path->pathArray[i];
+        if (MATRIXWORLD_isBlocked(matrix, cell.row, cell.col)) {
+            return false;
+        }
+        for (size_t j = 0; j < i; ++j) {
+            if (path->pathArray[j].row == cell.row && path->pathArray[j].col == cell.col) {
+                return false;
+            }
+        }
+        if (i > 0) {
+            const int rowStep = abs((int)cell.row - path->pathArray[i - 1].row);
+            const int colStep = abs((int)cell.col - path->pathArray[i - 1].col);
+            if (rowStep > 1 || colStep > 1 || rowStep + colStep == 0) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+void test_eight_neighborhood() {
+    printf("Testing: Eight Neighborhood\n");
+    // Checkerboards, the free cells only touch at their corners
+    const uint16_t widths[] = {10, 70};
+    const DFS_Ordering orderings[] = {DFS_ORDERING_RANDOM, DFS_ORDERING_FIXED,
+                                      DFS_ORDERING_WARNSDORFF};
+    for (size_t w = 0; w < sizeof(widths) / sizeof(widths[0]); ++w) {
+        WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(10, widths[w]);
+        for (uint16_t r = 0; r < 10; ++r) {
+            for (uint16_t c = 0; c < widths[w]; ++c) {
+                MATRIXWORLD_setCell(matrix, r, c, (r + c) % 2 != 0);
+            }
+        }
+        DFS_SearchOptions options = DFS_getDefaultOptions();
+        Path* path = DFS_findPathWithOptions(matrix, 40, &options);
+        assert(path == NULL);
+
+        options.neighborhood = DFS_NEIGHBORHOOD_EIGHT;
+        for (size_t o = 0; o < sizeof(orderings) / sizeof(orderings[0]); ++o) {
+            options.ordering = orderings[o];
+            options.useReachabilityPruning = o == 2;
+            path = DFS_findPathWithOptions(matrix, 40, &options);
+            assert(path != NULL && PATH_getLength(path) == 40);
+            assert(is_eight_neighborhood_path(matrix, path));
+            PATH_freePath(&path);
+        }
+
+        // Every engine runs on the kernels, and so do the threads
+        options.engine = DFS_ENGINE_BIDIRECTIONAL;
+        options.isMultithreading = true;
+        options.noOfThreads = 3;
+        path = DFS_findPathWithOptions(matrix, 45, &options);
+        assert(path != NULL && is_eight_neighborhood_path(matrix, path));
+        PATH_freePath(&path);
+
+        // A diagonal prefix is grown, and a start is searched to the end
+        options.isMultithreading = false;
+        Path* prefix = PATH_initializePath(3, matrix);
+        PATH_addCoordinates(prefix, 0, 0);
+        PATH_addCoordinates(prefix, 1, 1);
+        PATH_addCoordinates(prefix, 2, 2);
+        path = DFS_extendPath(matrix, 30, prefix, &options);
+        assert(path != NULL && PATH_getLength(path) == 30);
+        assert(is_eight_neighborhood_path(matrix, path) && path->pathArray[2].col == 2);
+        PATH_freePath(&path);
+        path = DFS_findPathFromStart(matrix, 30, (Cords){.row = 9, .col = 1}, &options);
+        assert(path != NULL && is_eight_neighborhood_path(matrix, path));
+        assert(path->pathArray[0].row == 9 && path->pathArray[0].col == 1);
+        PATH_freePath(&path);
+
+        PATH_freePath(&prefix);
+        MATRIXWORLD_matrixFree(&matrix);
+    }
+    printf("Passed: Eight Neighborhood\n");
+}
+
 int main(void) {
     printf("--- Running DfsPathFinding Tests ---\n");
     test_finds_valid_path_in_open_matrix();
     test_returns_null_for_impossible_length();
     test_returns_null_for_fully_blocked_matrix();
     test_finds_valid_path_in_open_matrix_multithreaded();
+    test_recursive_engine();
+    test_iterative_engine_long_path();
+    test_bidirectional_engine();
+    test_component_pruning();
+    test_reachability_pruning();
+    test_warnsdorff_ordering();
+    test_low_degree_starts();
+    test_thread_count_options();
+    test_seed_is_reproducible();
+    test_search_context_reuse();
+    test_search_report();
+    test_search_stats();
+    test_node_budget();
+    test_timeout();
+    test_complete_search_from_start();
+    test_portfolio_search();
+    test_extend_path();
+    test_kernels_match_generic_loop();
+    test_eight_neighborhood();
     printf("--- All DfsPathFinding Tests Passed ---\n");
     return 0;
 }
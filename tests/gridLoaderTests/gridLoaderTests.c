@@ -0,0 +1,258 @@
+#include "gridLoader.h"
+#include "matrixWorld.h"
+#include <stdio.h>
+#include <assert.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+
+static void write_file(const char* filename, const char* content) {
+    FILE* file = fopen(filename, "w");
+    assert(file != NULL);
+    fputs(content, file);
+    fclose(file);
+}
+
+void test_load_simple_file() {
+    printf("Testing: Load Simple File\n");
+    const char* filename = "test_loader_simple.txt";
+    write_file(filename, "# Comment\n1,1\n\n2, 3\r\n  4 ,0\n");
+
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(5, 5);
+    bool isLoaded = LOADER_loadBlockedCellsFile(matrix, filename, 1);
+    assert(isLoaded);
+    assert(MATRIXWORLD_isBlocked(matrix, 1, 1));
+    assert(MATRIXWORLD_isBlocked(matrix, 2, 3));
+    assert(MATRIXWORLD_isBlocked(matrix, 4, 0));
+    assert(MATRIXWORLD_getNoOfBlockedCells(matrix) == 3);
+    assert(MATRIXWORLD_getNoOfUnblockedCells(matrix) == 22);
+
+    MATRIXWORLD_matrixFree(&matrix);
+    remove(filename);
+    printf("Passed: Load Simple File\n");
+}
+
+void test_malformed_and_duplicate_lines() {
+    printf("Testing: Malformed And Duplicate Lines\n");
+    const char* filename = "test_loader_malformed.txt";
+    // No trailing newline on the last line
+    write_file(filename, "abc\n1;1\n70000,1\n2,2\n2,2\n,3\n3,");
+
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(4, 4);
+    bool isLoaded = LOADER_loadBlockedCellsFile(matrix, filename, 1);
+    assert(isLoaded);
+    assert(MATRIXWORLD_isBlocked(matrix, 2, 2));
+    assert(MATRIXWORLD_getNoOfBlockedCells(matrix) == 1);
+
+    MATRIXWORLD_matrixFree(&matrix);
+    remove(filename);
+    printf("Passed: Malformed And Duplicate Lines\n");
+}
+
+void test_out_of_bounds_and_missing_file() {
+    printf("Testing: Out Of Bounds And Missing File\n");
+    const char* filename = "test_loader_bounds.txt";
+    write_file(filename, "1,1\n5,0\n");
+
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(5, 5);
+    bool isLoaded = LOADER_loadBlockedCellsFile(matrix, filename, 1);
+    assert(!isLoaded);
+    isLoaded = LOADER_loadBlockedCellsFile(matrix, "does_not_exist.txt", 1);
+    assert(!isLoaded);
+
+    // An empty file blocks nothing
+    write_file(filename, "");
+    MATRIXWORLD_clearMatrix(matrix);
+    isLoaded = LOADER_loadBlockedCellsFile(matrix, filename, 4);
+    assert(isLoaded);
+    assert(MATRIXWORLD_getNoOfBlockedCells(matrix) == 0);
+
+    MATRIXWORLD_matrixFree(&matrix);
+    remove(filename);
+    printf("Passed: Out Of Bounds And Missing File\n");
+}
+
+void test_chunked_load_matches_single_thread() {
+    printf("Testing: Chunked Load Matches Single Thread\n");
+    const char* filename = "test_loader_chunks.txt";
+    FILE* file = fopen(filename, "w");
+    assert(file != NULL);
+    fprintf(file, "# Every third cell of a 100x130 grid\n");
+    for (uint32_t cell = 0; cell < 100 * 130; cell += 3) {
+        fprintf(file, "%u,%u\n", cell / 130, cell % 130);
+    }
+    fclose(file);
+
+    WorldMatrix* reference = MATRIXWORLD_matrixInitialization(100, 130);
+    bool isLoaded = LOADER_loadBlockedCellsFile(reference, filename, 1);
+    assert(isLoaded);
+    assert(MATRIXWORLD_getNoOfBlockedCells(reference) == 4334);
+
+    // Odd thread counts cut lines at arbitrary offsets
+    const uint16_t threadCounts[] = {2, 3, 7, 16};
+    for (size_t test = 0; test < sizeof(threadCounts) / sizeof(threadCounts[0]); test++) {
+        WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(100, 130);
+        isLoaded = LOADER_loadBlockedCellsFile(matrix, filename, threadCounts[test]);
+        assert(isLoaded);
+        assert(MATRIXWORLD_getNoOfBlockedCells(matrix) == MATRIXWORLD_getNoOfBlockedCells(reference));
+        for (uint16_t row = 0; row < 100; row++) {
+            for (uint16_t word = 0; word < 3; word++) {
+                assert(MATRIXWORLD_getRowWord(matrix, row, word) ==
+                       MATRIXWORLD_getRowWord(reference, row, word));
+            }
+        }
+        MATRIXWORLD_matrixFree(&matrix);
+    }
+
+    MATRIXWORLD_matrixFree(&reference);
+    remove(filename);
+    printf("Passed: Chunked Load Matches Single Thread\n");
+}
+
+static WorldMatrix* make_pattern_matrix(uint16_t rows, uint16_t cols) {
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(rows, cols);
+    for (uint16_t row = 0; row < rows; row++) {
+        for (uint16_t col = 0; col < cols; col++) {
+            // Runs of varying length, some of them crossing word boundaries
+            if ((col + row) % 11 < (row % 5) || col == cols - 1) {
+                MATRIXWORLD_setCell(matrix, row, col, true);
+            }
+        }
+    }
+    return matrix;
+}
+
+static void assert_same_cells(WorldMatrix* expected, WorldMatrix* actual) {
+    assert(MATRIXWORLD_getRowSize(expected) == MATRIXWORLD_getRowSize(actual));
+    assert(MATRIXWORLD_getColSize(expected) == MATRIXWORLD_getColSize(actual));
+    assert(MATRIXWORLD_getNoOfBlockedCells(expected) == MATRIXWORLD_getNoOfBlockedCells(actual));
+    for (uint16_t row = 0; row < MATRIXWORLD_getRowSize(expected); row++) {
+        for (uint16_t word = 0; word < MATRIXWORLD_getWordsPerRow(expected); word++) {
+            assert(MATRIXWORLD_getRowWord(expected, row, word) == MATRIXWORLD_getRowWord(actual, row, word));
+        }
+    }
+}
+
+void test_grid_file_round_trip() {
+    printf("Testing: Grid File Round Trip\n");
+    const char* filename = "test_loader_round_trip.grid";
+    WorldMatrix* matrix = make_pattern_matrix(37, 150);
+
+    const LOADER_GridEncoding encodings[] = {LOADER_ENCODING_BITMAP, LOADER_ENCODING_RLE, LOADER_ENCODING_AUTO};
+    for (size_t test = 0; test < sizeof(encodings) / sizeof(encodings[0]); test++) {
+        bool isSaved = LOADER_saveGridFile(matrix, filename, encodings[test]);
+        assert(isSaved);
+        WorldMatrix* loaded = LOADER_loadGridFile(filename);
+        assert(loaded != NULL);
+        assert_same_cells(matrix, loaded);
+        MATRIXWORLD_matrixFree(&loaded);
+    }
+
+    MATRIXWORLD_matrixFree(&matrix);
+    remove(filename);
+    printf("Passed: Grid File Round Trip\n");
+}
+
+void test_grid_file_encoding_sizes() {
+    printf("Testing: Grid File Encoding Sizes\n");
+    const char* filename = "test_loader_sizes.grid";
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(100, 200);
+    MATRIXWORLD_setCell(matrix, 50, 3, true);
+
+    // A sparse map is written as runs: a header, 100 counters and one run
+    bool isSaved = LOADER_saveGridFile(matrix, filename, LOADER_ENCODING_AUTO);
+    assert(isSaved);
+    FILE* file = fopen(filename, "rb");
+    assert(file != NULL);
+    fseek(file, 0, SEEK_END);
+    assert(ftell(file) == LOADER_GRID_HEADER_SIZE + 100 * 2 + 4);
+    fclose(file);
+
+    // The bitmap holds four words per row
+    isSaved = LOADER_saveGridFile(matrix, filename, LOADER_ENCODING_BITMAP);
+    assert(isSaved);
+    file = fopen(filename, "rb");
+    assert(file != NULL);
+    fseek(file, 0, SEEK_END);
+    assert(ftell(file) == LOADER_GRID_HEADER_SIZE + 100 * 4 * 8);
+    fclose(file);
+
+    WorldMatrix* loaded = LOADER_loadGridFile(filename);
+    assert(loaded != NULL);
+    assert(MATRIXWORLD_isBlocked(loaded, 50, 3));
+    assert(MATRIXWORLD_getNoOfBlockedCells(loaded) == 1);
+
+    MATRIXWORLD_matrixFree(&loaded);
+    MATRIXWORLD_matrixFree(&matrix);
+    remove(filename);
+    printf("Passed: Grid File Encoding Sizes\n");
+}
+
+void test_text_to_grid_conversion() {
+    printf("Testing: Text To Grid Conversion\n");
+    const char* textFile = "test_loader_convert.txt";
+    const char* gridFile = "test_loader_convert.grid";
+    write_file(textFile, "0,0\n3,64\n3,65\n9,69\n");
+
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(10, 70);
+    bool isLoaded = LOADER_loadBlockedCellsFile(matrix, textFile, 2);
+    assert(isLoaded);
+    bool isSaved = LOADER_saveGridFile(matrix, gridFile, LOADER_ENCODING_RLE);
+    assert(isSaved);
+    WorldMatrix* loaded = LOADER_loadGridFile(gridFile);
+    assert(loaded != NULL);
+    assert_same_cells(matrix, loaded);
+    assert(MATRIXWORLD_getNoOfBlockedCells(loaded) == 4);
+
+    MATRIXWORLD_matrixFree(&loaded);
+    MATRIXWORLD_matrixFree(&matrix);
+    remove(textFile);
+    remove(gridFile);
+    printf("Passed: Text To Grid Conversion\n");
+}
+
+void test_malformed_grid_files() {
+    printf("Testing: Malformed Grid Files\n");
+    const char* filename = "test_loader_malformed.grid";
+
+    // Not a grid file at all
+    write_file(filename, "1,1\n2,2\n");
+    assert(LOADER_loadGridFile(filename) == NULL);
+    assert(LOADER_loadGridFile("does_not_exist.grid") == NULL);
+
+    // A run leaving the row: 1x4 grid with a run of 3 cells from column 2
+    const uint8_t badRun[] = {'P', 'F', 'G', 'R', 1, 1, 0, 0, 1, 0, 4, 0, 0, 0, 0, 0,
+                              1, 0, 2, 0, 3, 0};
+    FILE* file = fopen(filename, "wb");
+    assert(file != NULL);
+    fwrite(badRun, sizeof(badRun), 1, file);
+    fclose(file);
+    assert(LOADER_loadGridFile(filename) == NULL);
+
+    // A truncated bitmap
+    WorldMatrix* matrix = make_pattern_matrix(4, 100);
+    bool isSaved = LOADER_saveGridFile(matrix, filename, LOADER_ENCODING_BITMAP);
+    assert(isSaved);
+    int status = truncate(filename, LOADER_GRID_HEADER_SIZE + 8);
+    assert(status == 0);
+    UNUSED(status);
+    assert(LOADER_loadGridFile(filename) == NULL);
+
+    MATRIXWORLD_matrixFree(&matrix);
+    remove(filename);
+    printf("Passed: Malformed Grid Files\n");
+}
+
+int main(void) {
+    printf("--- Running GridLoader Tests ---\n");
+    test_load_simple_file();
+    test_malformed_and_duplicate_lines();
+    test_out_of_bounds_and_missing_file();
+    test_chunked_load_matches_single_thread();
+    test_grid_file_round_trip();
+    test_grid_file_encoding_sizes();
+    test_text_to_grid_conversion();
+    test_malformed_grid_files();
+    printf("--- All GridLoader Tests Passed ---\n");
+    return 0;
+}
@@ -1,7 +1,10 @@
+#define MATRIXWORLD_UNCHECKED_API
 #include "matrixWorld.h"
 #include <stdio.h>
+#include <string.h>
 #include <assert.h>
 #include <stdlib.h>
+#include <stdint.h>
 
 void test_initialization_and_sizes() {
     printf("Testing: Initialization and Sizes\n");
@@ -51,6 +54,13 @@ void test_blanking() {
     assert(MATRIXWORLD_isBlocked(matrix, 0, 0));
     assert(MATRIXWORLD_isBlocked(matrix, 1, 1));
     assert(MATRIXWORLD_isBlocked(matrix, 2, 2));
+    assert(MATRIXWORLD_getNoOfUnblockedCells(matrix) == 13);
+
+    // Duplicates and already blocked cells are only counted once
+    Cords moreCoords[] = {{2,2}, {3,3}, {3,3}};
+    MATRIXWORLD_matrixBlanking(matrix, moreCoords, 3);
+    assert(MATRIXWORLD_getNoOfBlockedCells(matrix) == 4);
+    assert(MATRIXWORLD_getNoOfUnblockedCells(matrix) == 12);
     MATRIXWORLD_matrixFree(&matrix);
     printf("Passed: Blanking\n");
 }
@@ -68,14 +78,179 @@ void test_neighbors() {
     printf("Passed: Neighbors Count\n");
 }
 
+void test_neighbor_mask() {
+    printf("Testing: Neighbor Mask\n");
+    // 130 columns span three words per row, the last one partially padded
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(3, 130);
+    assert(MATRIXWORLD_getWordsPerRow(matrix) == 3);
+
+    // Corner cells only see neighbors inside the matrix (right, left, down, up)
+    assert(MATRIXWORLD_getUnblockedNeighborMask(matrix, 0, 0) == 0x5);
+    assert(MATRIXWORLD_getUnblockedNeighborMask(matrix, 2, 129) == 0xA);
+    assert(MATRIXWORLD_getUnblockedNeighborMask(matrix, 1, 64) == 0xF);
+
+    // Neighbors across word boundaries
+    MATRIXWORLD_setCell(matrix, 1, 63, true);
+    MATRIXWORLD_setCell(matrix, 1, 128, true);
+    assert(MATRIXWORLD_getUnblockedNeighborMask(matrix, 1, 64) == 0xD);
+    assert(MATRIXWORLD_getUnblockedNeighborMask(matrix, 1, 127) == 0xE);
+    MATRIXWORLD_setCell(matrix, 0, 64, true);
+    assert(MATRIXWORLD_getUnblockedNeighborMask(matrix, 1, 64) == 0x5);
+    assert(MATRIXWORLD_countUnblockedNeighbors(matrix, 1, 64) == 2);
+
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Neighbor Mask\n");
+}
+
+void test_row_word() {
+    printf("Testing: Row Word\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(2, 70);
+    // Padding bits of the last word read as blocked
+    assert(MATRIXWORLD_getRowWord(matrix, 0, 0) == 0);
+    assert(MATRIXWORLD_getRowWord(matrix, 0, 1) == ~UINT64_C(0x3F));
+
+    MATRIXWORLD_setCell(matrix, 1, 3, true);
+    MATRIXWORLD_setCell(matrix, 1, 65, true);
+    assert(MATRIXWORLD_getRowWord(matrix, 1, 0) == (UINT64_C(1) << 3));
+    assert(MATRIXWORLD_getRowWord(matrix, 1, 1) == (~UINT64_C(0x3F) | (UINT64_C(1) << 1)));
+
+    // Clearing keeps the padding intact
+    MATRIXWORLD_clearMatrix(matrix);
+    assert(MATRIXWORLD_getRowWord(matrix, 1, 1) == ~UINT64_C(0x3F));
+    assert(MATRIXWORLD_getNoOfUnblockedCells(matrix) == 140);
+
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Row Word\n");
+}
+
+void test_block_row_word() {
+    printf("Testing: Block Row Word\n");
+    // 17 rows and 70 columns leave partial tiles and words at both borders
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(17, 70);
+    MATRIXWORLD_unchecked_blockRowWord(matrix, 9, 0, (UINT64_C(1) << 7) | (UINT64_C(1) << 8));
+    MATRIXWORLD_unchecked_blockRowWord(matrix, 16, 1, UINT64_C(1) << 5);
+    MATRIXWORLD_recountCells(matrix);
+    assert(MATRIXWORLD_getNoOfBlockedCells(matrix) == 3);
+    assert(MATRIXWORLD_isBlocked(matrix, 9, 7) && MATRIXWORLD_isBlocked(matrix, 9, 8));
+    assert(MATRIXWORLD_isBlocked(matrix, 16, 69));
+    assert(MATRIXWORLD_getRowWord(matrix, 16, 1) == (~UINT64_C(0x3F) | (UINT64_C(1) << 5)));
+    assert(MATRIXWORLD_getRowWord(matrix, 8, 0) == 0);
+
+    // Neighbors across the borders of the 8x8 tiles
+    assert(MATRIXWORLD_getUnblockedNeighborMask(matrix, 8, 7) == 0xB);
+    assert(MATRIXWORLD_getUnblockedNeighborMask(matrix, 9, 6) == 0xE);
+    assert(MATRIXWORLD_getUnblockedNeighborMask(matrix, 10, 8) == 0x7);
+    assert(MATRIXWORLD_getUnblockedNeighborMask(matrix, 16, 68) == 0xA);
+
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Block Row Word\n");
+}
+
+void test_recount_cells() {
+    printf("Testing: Recount Cells\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(3, 70);
+    // Write bits behind the counters' back, like the parallel loader does
+    *MATRIXWORLD_unchecked_cellWord(matrix, 0, 2) |= UINT64_C(1) << MATRIXWORLD_unchecked_cellBit(0, 2);
+    *MATRIXWORLD_unchecked_cellWord(matrix, 2, 66) |= UINT64_C(1) << MATRIXWORLD_unchecked_cellBit(2, 66);
+    *MATRIXWORLD_unchecked_cellWord(matrix, 2, 69) |= UINT64_C(1) << MATRIXWORLD_unchecked_cellBit(2, 69);
+    assert(MATRIXWORLD_getNoOfUnblockedCells(matrix) == 210);
+
+    MATRIXWORLD_recountCells(matrix);
+    assert(MATRIXWORLD_getNoOfBlockedCells(matrix) == 3);
+    assert(MATRIXWORLD_getNoOfUnblockedCells(matrix) == 207);
+    assert(MATRIXWORLD_isBlocked(matrix, 2, 69));
+
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Recount Cells\n");
+}
+
+void test_fingerprint() {
+    printf("Testing: Fingerprint\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(4, 70);
+    WorldMatrix* same = MATRIXWORLD_matrixInitialization(4, 70);
+    WorldMatrix* wider = MATRIXWORLD_matrixInitialization(4, 71);
+    const uint64_t empty = MATRIXWORLD_getFingerprint(matrix);
+    assert(empty == MATRIXWORLD_getFingerprint(same));
+    assert(empty != MATRIXWORLD_getFingerprint(wider));
+
+    // The update can be applied before or after the change
+    uint64_t updated = MATRIXWORLD_updateFingerprint(empty, matrix, 3, 66);
+    MATRIXWORLD_setCell(matrix, 3, 66, true);
+    assert(updated != empty);
+    assert(updated == MATRIXWORLD_getFingerprint(matrix));
+    MATRIXWORLD_setCell(same, 3, 66, true);
+    assert(updated == MATRIXWORLD_getFingerprint(same));
+    updated = MATRIXWORLD_updateFingerprint(updated, matrix, 0, 1);
+    MATRIXWORLD_setCell(matrix, 0, 1, true);
+    assert(updated == MATRIXWORLD_getFingerprint(matrix));
+
+    // Swapping the blocked cells of two rows changes the fingerprint
+    MATRIXWORLD_setCell(same, 3, 66, false);
+    MATRIXWORLD_setCell(same, 0, 66, true);
+    MATRIXWORLD_setCell(same, 3, 1, true);
+    assert(MATRIXWORLD_getFingerprint(same) != MATRIXWORLD_getFingerprint(matrix));
+
+    // Undoing the changes gives the first fingerprint back
+    MATRIXWORLD_setCell(matrix, 0, 1, false);
+    updated = MATRIXWORLD_updateFingerprint(updated, matrix, 0, 1);
+    updated = MATRIXWORLD_updateFingerprint(updated, matrix, 3, 66);
+    assert(updated == empty);
+    UNUSED(empty);
+    UNUSED(updated);
+
+    MATRIXWORLD_matrixFree(&wider);
+    MATRIXWORLD_matrixFree(&same);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Fingerprint\n");
+}
+
+void test_large_world() {
+    printf("Testing: Large World\n");
+    // 10^8 cells, far beyond what 16-bit counts can hold
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(10000, 10000);
+    assert(MATRIXWORLD_getSize(matrix) == UINT32_C(100000000));
+    assert(MATRIXWORLD_getNoOfUnblockedCells(matrix) == UINT32_C(100000000));
+
+    // Blocks every tenth row, 10^7 cells in a single blanking
+    const size_t noOfCoords = (size_t)1000 * 10000;
+    Cords* coords = malloc(noOfCoords * sizeof(Cords));
+    assert(coords != NULL);
+    for (size_t index = 0; index < noOfCoords; index++) {
+        coords[index] = (Cords){.row = (uint16_t)((index / 10000) * 10),
+                                .col = (uint16_t)(index % 10000)};
+    }
+    MATRIXWORLD_matrixBlanking(matrix, coords, noOfCoords);
+    assert(MATRIXWORLD_getNoOfBlockedCells(matrix) == UINT32_C(10000000));
+    assert(MATRIXWORLD_getNoOfUnblockedCells(matrix) == UINT32_C(90000000));
+    assert(MATRIXWORLD_isBlocked(matrix, 9990, 9999));
+    assert(!MATRIXWORLD_isBlocked(matrix, 9999, 9999));
+
+    // Blanking the same cells again leaves the counters untouched
+    MATRIXWORLD_matrixBlanking(matrix, coords, noOfCoords);
+    MATRIXWORLD_recountCells(matrix);
+    assert(MATRIXWORLD_getNoOfBlockedCells(matrix) == UINT32_C(10000000));
+    free(coords);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Large World\n");
+}
 
-int main(void) {
+int main(int argc, char* argv[]) {
+    // The 10^8 cell world runs on its own, see BUILD_STRESS_TESTS
+    if (argc > 1 && strcmp(argv[1], "--stress") == 0) {
+        test_large_world();
+        return 0;
+    }
     printf("--- Running MatrixWorld Tests ---\n");
     test_initialization_and_sizes();
     test_set_and_get_cell();
     test_clear_matrix();
     test_blanking();
     test_neighbors();
+    test_neighbor_mask();
+    test_row_word();
+    test_block_row_word();
+    test_recount_cells();
+    test_fingerprint();
     printf("--- All MatrixWorld Tests Passed ---\n");
     return 0;
 }
@@ -0,0 +1,276 @@
+#define PATH_UNCHECKED_API
+#include "pathCache.h"
+#include "dfsPathFinding.h"
+#include "matrixWorld.h"
+#include "path.h"
+#include "utilities.h"
+#include <stdio.h>
+#include <assert.h>
+#include <stdint.h>
+
+/*
+ * Stores the first cells of row 0 as the cached path of a matrix.
+ */
+static void store_row_path(PathCache* cache, WorldMatrix* matrix, uint16_t length) {
+    Path* path = PATH_initializePath(length, matrix);
+    for (uint16_t c = 0; c < length; ++c) {
+        PATH_addCoordinates(path, 0, c);
+    }
+    PATHCACHE_storePath(cache, matrix, MATRIXWORLD_getFingerprint(matrix), DFS_NEIGHBORHOOD_FOUR,
+                        path);
+    PATH_freePath(&path);
+}
+
+void test_shorter_queries_are_prefixes() {
+    printf("Testing: Shorter Queries Are Prefixes\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(20, 20);
+    MATRIXWORLD_setCell(matrix, 5, 5, true);
+    PathCache* cache = PATHCACHE_createCache();
+    DFS_SearchOptions options = DFS_getDefaultOptions();
+    options.useConstruction = false;
+
+    Path* longest = PATHCACHE_findPath(cache, matrix, 150, &options);
+    assert(longest != NULL && PATH_getLength(longest) == 150);
+    Path* shorter = PATHCACHE_findPath(cache, matrix, 40, &options);
+    assert(shorter != NULL && PATH_getLength(shorter) == 40);
+    for (size_t i = 0; i < 40; ++i) {
+        assert(shorter->pathArray[i].row == longest->pathArray[i].row);
+        assert(shorter->pathArray[i].col == longest->pathArray[i].col);
+    }
+
+    const uint64_t fingerprint = MATRIXWORLD_getFingerprint(matrix);
+    const Cords* prefix =
+        PATHCACHE_getPrefix(cache, matrix, fingerprint, DFS_NEIGHBORHOOD_FOUR, 150);
+    assert(prefix != NULL && prefix[149].row == longest->pathArray[149].row);
+    assert(PATHCACHE_getPrefix(cache, matrix, fingerprint, DFS_NEIGHBORHOOD_FOUR, 151) == NULL);
+    UNUSED(prefix);
+
+    // Another world does not see the path
+    WorldMatrix* other = MATRIXWORLD_matrixInitialization(20, 20);
+    assert(PATHCACHE_getPrefix(cache, other, MATRIXWORLD_getFingerprint(other),
+                               DFS_NEIGHBORHOOD_FOUR, 10) == NULL);
+    Path* tooLong = PATHCACHE_findPath(cache, other, 500, &options);
+    assert(tooLong == NULL);
+    UNUSED(tooLong);
+    UNUSED(fingerprint);
+
+    MATRIXWORLD_matrixFree(&other);
+    PATH_freePath(&shorter);
+    PATH_freePath(&longest);
+    PATHCACHE_destroyCache(&cache);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Shorter Queries Are Prefixes\n");
+}
+
+void test_longer_queries_grow_the_cached_path() {
+    printf("Testing: Longer Queries Grow The Cached Path\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(12, 12);
+    PathCache* cache = PATHCACHE_createCache();
+    DFS_SearchOptions options = DFS_getDefaultOptions();
+    options.useConstruction = false;
+    store_row_path(cache, matrix, 8);
+
+    Path* path = PATHCACHE_findPath(cache, matrix, 70, &options);
+    assert(path != NULL && PATH_getLength(path) == 70 && PATH_isContiguous(path));
+    for (uint16_t c = 0; c < 8; ++c) {
+        assert(path->pathArray[c].row == 0 && path->pathArray[c].col == c);
+    }
+    PATH_freePath(&path);
+
+    // The last cell is boxed in, the path grows at its first cell instead
+    PathCache* boxed = PATHCACHE_createCache();
+    MATRIXWORLD_setCell(matrix, 0, 8, true);
+    MATRIXWORLD_setCell(matrix, 1, 7, true);
+    store_row_path(boxed, matrix, 8);
+    path = PATHCACHE_findPath(boxed, matrix, 40, &options);
+    assert(path != NULL && PATH_getLength(path) == 40 && PATH_isContiguous(path));
+    assert(path->pathArray[0].row == 0 && path->pathArray[0].col == 7);
+    PATH_freePath(&path);
+
+    PATHCACHE_destroyCache(&boxed);
+    PATHCACHE_destroyCache(&cache);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Longer Queries Grow The Cached Path\n");
+}
+
+void test_cell_changes() {
+    printf("Testing: Cell Changes\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(10, 10);
+    PathCache* cache = PATHCACHE_createCache();
+    store_row_path(cache, matrix, 10);
+    uint64_t fingerprint = MATRIXWORLD_getFingerprint(matrix);
+
+    // A cell off the path keeps it whole
+    MATRIXWORLD_setCell(matrix, 4, 4, true);
+    fingerprint = PATHCACHE_noteCellChange(cache, matrix, fingerprint, 4, 4);
+    assert(fingerprint == MATRIXWORLD_getFingerprint(matrix));
+    assert(PATHCACHE_getPrefix(cache, matrix, fingerprint, DFS_NEIGHBORHOOD_FOUR, 10) != NULL);
+
+    // A cell on it leaves the longer part, here the 6 cells behind it
+    MATRIXWORLD_setCell(matrix, 0, 3, true);
+    fingerprint = PATHCACHE_noteCellChange(cache, matrix, fingerprint, 0, 3);
+    assert(PATHCACHE_getPrefix(cache, matrix, fingerprint, DFS_NEIGHBORHOOD_FOUR, 7) == NULL);
+    const Cords* prefix = PATHCACHE_getPrefix(cache, matrix, fingerprint, DFS_NEIGHBORHOOD_FOUR, 6);
+    assert(prefix != NULL && prefix[0].col == 4 && prefix[5].col == 9);
+
+    // And then the 4 cells in front of the next one
+    MATRIXWORLD_setCell(matrix, 0, 8, true);
+    fingerprint = PATHCACHE_noteCellChange(cache, matrix, fingerprint, 0, 8);
+    prefix = PATHCACHE_getPrefix(cache, matrix, fingerprint, DFS_NEIGHBORHOOD_FOUR, 4);
+    assert(prefix != NULL && prefix[0].col == 4 && prefix[3].col == 7);
+    assert(PATHCACHE_getPrefix(cache, matrix, fingerprint, DFS_NEIGHBORHOOD_FOUR, 5) == NULL);
+    UNUSED(prefix);
+
+    // Unblocking keeps the path, the old fingerprint no longer finds it
+    const uint64_t blocked = fingerprint;
+    MATRIXWORLD_setCell(matrix, 4, 4, false);
+    fingerprint = PATHCACHE_noteCellChange(cache, matrix, fingerprint, 4, 4);
+    assert(PATHCACHE_getPrefix(cache, matrix, fingerprint, DFS_NEIGHBORHOOD_FOUR, 4) != NULL);
+    assert(PATHCACHE_getPrefix(cache, matrix, blocked, DFS_NEIGHBORHOOD_FOUR, 1) == NULL);
+    UNUSED(blocked);
+
+    PATHCACHE_destroyCache(&cache);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Cell Changes\n");
+}
+
+void test_least_recently_used_world_is_evicted() {
+    printf("Testing: Least Recently Used World Is Evicted\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(10, 10);
+    PathCache* cache = PATHCACHE_createCache();
+    uint64_t fingerprints[PATHCACHE_NO_OF_ENTRIES + 1];
+    // Every world blocks one more cell of the last row
+    for (uint16_t world = 0; world <= PATHCACHE_NO_OF_ENTRIES; ++world) {
+        MATRIXWORLD_setCell(matrix, 9, world, true);
+        fingerprints[world] = MATRIXWORLD_getFingerprint(matrix);
+        store_row_path(cache, matrix, 5);
+        if (world == 1) {
+            // The first world is used again and outlives the second one
+            assert(PATHCACHE_getPrefix(cache, matrix, fingerprints[0], DFS_NEIGHBORHOOD_FOUR,
+                                       5) != NULL);
+        }
+    }
+    assert(PATHCACHE_getPrefix(cache, matrix, fingerprints[0], DFS_NEIGHBORHOOD_FOUR, 5) != NULL);
+    assert(PATHCACHE_getPrefix(cache, matrix, fingerprints[1], DFS_NEIGHBORHOOD_FOUR, 5) == NULL);
+    assert(PATHCACHE_getPrefix(cache, matrix, fingerprints[PATHCACHE_NO_OF_ENTRIES],
+                               DFS_NEIGHBORHOOD_FOUR, 5) != NULL);
+    UNUSED(fingerprints);
+
+    PATHCACHE_destroyCache(&cache);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Least Recently Used World Is Evicted\n");
+}
+
+void test_query_limits_cover_every_search() {
+    printf("Testing: Query Limits Cover Every Search\n");
+    // A 4x5 room holding the cached path and a comb whose longest path is
+    // 22 cells, every search of a 30-cell query fails
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(12, 12);
+    for (uint16_t r = 0; r < 12; ++r) {
+        for (uint16_t c = 0; c < 12; ++c) {
+            const bool isRoom = r < 4 && c < 5;
+            const bool isComb = r == 6 || (r > 6 && c % 2 == 0);
+            if (!isRoom && !isComb) {
+                MATRIXWORLD_setCell(matrix, r, c, true);
+            }
+        }
+    }
+    PathCache* cache = PATHCACHE_createCache();
+    store_row_path(cache, matrix, 2);
+    const uint64_t fingerprint = MATRIXWORLD_getFingerprint(matrix);
+    DFS_SearchOptions options = DFS_getDefaultOptions();
+    options.useConstruction = false;
+    options.isMultithreading = false;
+    Path* result = PATH_initializePath(30, matrix);
+
+    // The cells the two extensions of the cached path expand without limits
+    DFS_SearchContext* context = DFS_createSearchContext(matrix, &options);
+    Path* cached = PATH_initializePath(2, matrix);
+    PATH_addCoordinates(cached, 0, 0);
+    PATH_addCoordinates(cached, 0, 1);
+    DFS_SearchReport report;
+    DFS_SearchStatus status = DFS_extendBounded(context, cached, 30, result);
+    DFS_getSearchReport(context, &report);
+    uint64_t extensionNodes = report.nodesExpanded;
+    PATH_clearPath(cached);
+    PATH_addCoordinates(cached, 0, 1);
+    PATH_addCoordinates(cached, 0, 0);
+    status = DFS_extendBounded(context, cached, 30, result);
+    DFS_getSearchReport(context, &report);
+    extensionNodes += report.nodesExpanded;
+    assert(status == DFS_STATUS_NOT_FOUND && extensionNodes > 500);
+    DFS_destroySearchContext(&context);
+
+    // The search from scratch only gets what the extensions left of the budget
+    options.nodeBudget = extensionNodes + 500;
+    context = DFS_createSearchContext(matrix, &options);
+    status = PATHCACHE_searchBounded(cache, context, matrix, fingerprint, 30, result);
+    DFS_getSearchReport(context, &report);
+    // It stops at the first check past the 500 cells, checks come every 256
+    assert(status == DFS_STATUS_BUDGET_EXHAUSTED);
+    assert(report.nodesExpanded >= 500 && report.nodesExpanded <= 500 + 256);
+    UNUSED(status);
+
+    DFS_destroySearchContext(&context);
+    PATH_freePath(&cached);
+    PATH_freePath(&result);
+    PATHCACHE_destroyCache(&cache);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Query Limits Cover Every Search\n");
+}
+
+void test_neighborhoods_are_kept_apart() {
+    printf("Testing: Neighborhoods Are Kept Apart\n");
+    // The free cells of a checkerboard only touch diagonally
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(6, 6);
+    for (uint16_t r = 0; r < 6; ++r) {
+        for (uint16_t c = 0; c < 6; ++c) {
+            if ((r + c) % 2 == 1) {
+                MATRIXWORLD_setCell(matrix, r, c, true);
+            }
+        }
+    }
+    const uint64_t fingerprint = MATRIXWORLD_getFingerprint(matrix);
+    PathCache* cache = PATHCACHE_createCache();
+    DFS_SearchOptions options = DFS_getDefaultOptions();
+    options.neighborhood = DFS_NEIGHBORHOOD_EIGHT;
+
+    Path* diagonal = PATHCACHE_findPath(cache, matrix, 6, &options);
+    assert(diagonal != NULL);
+    assert(PATHCACHE_getPrefix(cache, matrix, fingerprint, DFS_NEIGHBORHOOD_EIGHT, 6) != NULL);
+    // The diagonal path does not serve the four neighborhood
+    assert(PATHCACHE_getPrefix(cache, matrix, fingerprint, DFS_NEIGHBORHOOD_FOUR, 4) == NULL);
+    options.neighborhood = DFS_NEIGHBORHOOD_FOUR;
+    Path* straight = PATHCACHE_findPath(cache, matrix, 4, &options);
+    assert(straight == NULL);
+    PATH_freePath(&diagonal);
+
+    // A path of the four neighborhood serves the eight neighborhood as well
+    MATRIXWORLD_clearMatrix(matrix);
+    const uint64_t cleared = MATRIXWORLD_getFingerprint(matrix);
+    store_row_path(cache, matrix, 6);
+    const Cords* prefix = PATHCACHE_getPrefix(cache, matrix, cleared, DFS_NEIGHBORHOOD_EIGHT, 6);
+    assert(prefix != NULL && prefix[5].row == 0 && prefix[5].col == 5);
+    options.neighborhood = DFS_NEIGHBORHOOD_EIGHT;
+    Path* grown = PATHCACHE_findPath(cache, matrix, 4, &options);
+    assert(grown != NULL && grown->pathArray[3].row == 0 && grown->pathArray[3].col == 3);
+    UNUSED(prefix);
+    UNUSED(straight);
+
+    PATH_freePath(&grown);
+    PATHCACHE_destroyCache(&cache);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Neighborhoods Are Kept Apart\n");
+}
+
+int main(void) {
+    printf("--- Running PathCache Tests ---\n");
+    test_shorter_queries_are_prefixes();
+    test_longer_queries_grow_the_cached_path();
+    test_cell_changes();
+    test_least_recently_used_world_is_evicted();
+    test_query_limits_cover_every_search();
+    test_neighborhoods_are_kept_apart();
+    printf("--- All PathCache Tests Passed ---\n");
+    return 0;
+}
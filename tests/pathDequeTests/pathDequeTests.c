@@ -0,0 +1,178 @@
+#define PATH_UNCHECKED_API
+#define PATHDEQUE_UNCHECKED_API
+#include "pathDeque.h"
+#include "arena.h"
+#include "matrixWorld.h"
+#include "path.h"
+#include "utilities.h"
+#include <stdio.h>
+#include <assert.h>
+#include <stdint.h>
+
+void test_initialization_and_length() {
+    printf("Testing: PathDeque Initialization and Length\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(10, 10);
+    PathDeque* deque = PATHDEQUE_initializeDeque(12, matrix);
+    assert(deque != NULL);
+    assert(PATHDEQUE_getLength(deque) == 0);
+    assert(PATHDEQUE_isEmpty(deque));
+    PATHDEQUE_freeDeque(&deque);
+    assert(deque == NULL);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: PathDeque Initialization and Length\n");
+}
+
+void test_push_and_pop_at_both_ends() {
+    printf("Testing: Push and Pop at Both Ends\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(10, 10);
+    PathDeque* deque = PATHDEQUE_initializeDeque(12, matrix);
+    PATHDEQUE_pushBack(deque, 1, 1);
+    PATHDEQUE_pushBack(deque, 1, 2);
+    PATHDEQUE_pushFront(deque, 1, 0);
+    assert(PATHDEQUE_getLength(deque) == 3);
+
+    Cords front = PATHDEQUE_getFront(deque);
+    Cords back = PATHDEQUE_getBack(deque);
+    assert(front.row == 1 && front.col == 0);
+    assert(back.row == 1 && back.col == 2);
+    Cords middle = PATHDEQUE_getAt(deque, 1);
+    assert(middle.row == 1 && middle.col == 1);
+
+    Cords popped = PATHDEQUE_popFront(deque);
+    assert(popped.row == 1 && popped.col == 0);
+    popped = PATHDEQUE_popBack(deque);
+    assert(popped.row == 1 && popped.col == 2);
+    assert(PATHDEQUE_getLength(deque) == 1);
+
+    PATHDEQUE_clearDeque(deque);
+    assert(PATHDEQUE_isEmpty(deque));
+    UNUSED(front);
+    UNUSED(back);
+    UNUSED(middle);
+    UNUSED(popped);
+
+    PATHDEQUE_freeDeque(&deque);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Push and Pop at Both Ends\n");
+}
+
+void test_wraparound_and_copy_to_path() {
+    printf("Testing: Wraparound and Copy to Path\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(10, 10);
+    PathDeque* deque = PATHDEQUE_initializeDeque(5, matrix);
+    // The front wraps to the end of the buffer, the back stays at its start
+    PATHDEQUE_pushBack(deque, 0, 2);
+    PATHDEQUE_pushBack(deque, 0, 3);
+    PATHDEQUE_pushFront(deque, 0, 1);
+    PATHDEQUE_pushFront(deque, 0, 0);
+    PATHDEQUE_pushBack(deque, 1, 3);
+    for (size_t i = 0; i < 4; ++i) {
+        Cords cell = PATHDEQUE_getAt(deque, i);
+        assert(cell.row == 0 && cell.col == i);
+        UNUSED(cell);
+    }
+
+    Path* path = PATH_initializePath(5, matrix);
+    PATHDEQUE_copyToPath(deque, path);
+    assert(PATH_getLength(path) == 5);
+    assert(PATH_isContiguous(path));
+    assert(path->pathArray[0].col == 0 && path->pathArray[4].row == 1);
+
+    // Shrinking from the back and growing at the front again
+    UNUSED(PATHDEQUE_popBack(deque));
+    UNUSED(PATHDEQUE_popBack(deque));
+    UNUSED(PATHDEQUE_popBack(deque));
+    PATHDEQUE_pushFront(deque, 1, 0);
+    PATHDEQUE_pushFront(deque, 2, 0);
+    PATHDEQUE_copyToPath(deque, path);
+    assert(PATH_getLength(path) == 4);
+    assert(PATH_isContiguous(path));
+    assert(path->pathArray[0].row == 2 && path->pathArray[3].col == 1);
+
+    PATH_freePath(&path);
+    PATHDEQUE_freeDeque(&deque);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Wraparound and Copy to Path\n");
+}
+
+void test_empty_deque() {
+    printf("Testing: Empty PathDeque\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(10, 10);
+    PathDeque* deque = PATHDEQUE_initializeDeque(3, matrix);
+
+    Cords empty = PATHDEQUE_popFront(deque);
+    assert(empty.row == UINT16_MAX && empty.col == UINT16_MAX);
+    empty = PATHDEQUE_popBack(deque);
+    assert(empty.row == UINT16_MAX && empty.col == UINT16_MAX);
+    empty = PATHDEQUE_getFront(deque);
+    assert(empty.row == UINT16_MAX);
+    PATHDEQUE_pushBack(deque, 4, 4);
+    empty = PATHDEQUE_getAt(deque, 1);
+    assert(empty.row == UINT16_MAX && empty.col == UINT16_MAX);
+    assert(PATHDEQUE_getLength(deque) == 1);
+    UNUSED(empty);
+
+    PATHDEQUE_freeDeque(&deque);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Empty PathDeque\n");
+}
+
+void test_unchecked_accessors() {
+    printf("Testing: Unchecked Accessors\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(10, 10);
+    PathDeque* deque = PATHDEQUE_initializeDeque(4, matrix);
+
+    PATHDEQUE_unchecked_pushFront(deque, 5, 5);
+    PATHDEQUE_unchecked_pushFront(deque, 5, 4);
+    PATHDEQUE_unchecked_pushBack(deque, 5, 6);
+    assert(PATHDEQUE_unchecked_getLength(deque) == PATHDEQUE_getLength(deque));
+    Cords front = PATHDEQUE_unchecked_getFront(deque);
+    Cords back = PATHDEQUE_unchecked_getBack(deque);
+    assert(front.col == 4 && back.col == 6);
+    Cords popped = PATHDEQUE_unchecked_popFront(deque);
+    assert(popped.col == 4);
+    popped = PATHDEQUE_unchecked_popBack(deque);
+    assert(popped.col == 6);
+    assert(PATHDEQUE_unchecked_getAt(deque, 0).col == 5);
+    PATHDEQUE_unchecked_clearDeque(deque);
+    assert(PATHDEQUE_isEmpty(deque));
+    UNUSED(front);
+    UNUSED(back);
+    UNUSED(popped);
+
+    PATHDEQUE_freeDeque(&deque);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Unchecked Accessors\n");
+}
+
+void test_initialization_in_arena() {
+    printf("Testing: PathDeque Initialization in Arena\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(10, 10);
+    Arena* arena = ARENA_createArena(4096, false);
+    PathDeque* deque = PATHDEQUE_initializeDequeInArena(20, matrix, arena);
+    assert(deque != NULL && PATHDEQUE_isEmpty(deque));
+    PATHDEQUE_pushFront(deque, 3, 3);
+    PATHDEQUE_pushFront(deque, 3, 2);
+    assert(PATHDEQUE_getLength(deque) == 2);
+
+    // The deque goes with the arena, the next one reuses its memory
+    ARENA_reset(arena);
+    PathDeque* reused = PATHDEQUE_initializeDequeInArena(20, matrix, arena);
+    assert(reused == deque && PATHDEQUE_isEmpty(reused));
+    UNUSED(reused);
+    ARENA_destroyArena(&arena);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: PathDeque Initialization in Arena\n");
+}
+
+int main(void) {
+    printf("--- Running PathDeque Tests ---\n");
+    test_initialization_and_length();
+    test_push_and_pop_at_both_ends();
+    test_wraparound_and_copy_to_path();
+    test_empty_deque();
+    test_unchecked_accessors();
+    test_initialization_in_arena();
+    printf("--- All PathDeque Tests Passed ---\n");
+    return 0;
+}
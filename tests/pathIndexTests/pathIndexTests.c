@@ -0,0 +1,145 @@
+#define PATH_UNCHECKED_API
+#include "pathIndex.h"
+#include "matrixWorld.h"
+#include "path.h"
+#include "utilities.h"
+#include <stdio.h>
+#include <assert.h>
+#include <stdint.h>
+
+/*
+ * Cell of a path snaking through the rows of a matrix with the given columns.
+ */
+static Cords snake_cell(size_t step, uint16_t cols) {
+    const uint16_t row = (uint16_t)(step / cols);
+    const uint16_t offset = (uint16_t)(step % cols);
+    return (Cords){.row = row, .col = (row % 2 == 0) ? offset : (uint16_t)(cols - 1 - offset)};
+}
+
+void test_index_existing_cells() {
+    printf("Testing: Index Existing Cells\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(10, 10);
+    Path* path = PATH_initializePath(20, matrix);
+    for (uint16_t c = 0; c < 10; ++c) {
+        PATH_addCoordinates(path, 2, c);
+    }
+
+    PathIndex* index = PATHINDEX_createIndex(path, matrix);
+    assert(PATHINDEX_getNoOfSteps(index) == 10);
+    for (uint16_t c = 0; c < 10; ++c) {
+        assert(PATHINDEX_getStep(index, 2, c) == c);
+    }
+    assert(!PATHINDEX_containsCoordinates(index, 3, 3));
+    assert(PATHINDEX_getStep(index, 2, 10) == PATHINDEX_NOT_ON_PATH);
+    assert(PATHINDEX_getStep(index, UINT16_MAX, UINT16_MAX) == PATHINDEX_NOT_ON_PATH);
+
+    PATHINDEX_destroyIndex(&index);
+    assert(index == NULL);
+    PATH_freePath(&path);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Index Existing Cells\n");
+}
+
+void test_add_and_pop() {
+    printf("Testing: Add and Pop\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(10, 10);
+    Path* path = PATH_initializePath(20, matrix);
+    PathIndex* index = PATHINDEX_createIndex(path, matrix);
+
+    PATHINDEX_addCoordinates(index, path, 0, 0);
+    PATHINDEX_addCoordinates(index, path, 0, 1);
+    PATHINDEX_addCoordinates(index, path, 1, 1);
+    assert(PATH_getLength(path) == 3 && PATHINDEX_getStep(index, 1, 1) == 2);
+
+    // A repeated cell keeps its first step, also once the repeat is popped
+    PATHINDEX_addCoordinates(index, path, 0, 1);
+    assert(PATHINDEX_getStep(index, 0, 1) == 1);
+    Cords popped = PATHINDEX_popCoordinates(index, path);
+    assert(popped.row == 0 && popped.col == 1);
+    assert(PATHINDEX_getStep(index, 0, 1) == 1);
+
+    popped = PATHINDEX_popCoordinates(index, path);
+    assert(popped.row == 1 && popped.col == 1);
+    assert(!PATHINDEX_containsCoordinates(index, 1, 1));
+    assert(PATHINDEX_getNoOfSteps(index) == 2 && PATH_getLength(path) == 2);
+    UNUSED(popped);
+
+    PATHINDEX_destroyIndex(&index);
+    PATH_freePath(&path);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Add and Pop\n");
+}
+
+void test_in_sync_with_linear_scan() {
+    printf("Testing: In Sync With Linear Scan\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(50, 50);
+    Path* path = PATH_initializePath(1800, matrix);
+    PathIndex* index = PATHINDEX_createIndex(path, matrix);
+    RandomGenerator generator;
+    UTILITY_seedGenerator(&generator, RANDOM_GEN_SEED);
+
+    // Grows and shrinks the path like a backtracking search does
+    for (int round = 0; round < 200; ++round) {
+        const uint32_t noOfPops = UTILITY_nextBoundedRandom(&generator, 8);
+        for (uint32_t pop = 0; pop < noOfPops && !PATH_isEmpty(path); ++pop) {
+            Cords popped = PATHINDEX_popCoordinates(index, path);
+            UNUSED(popped);
+        }
+        const uint32_t noOfAdds = UTILITY_nextBoundedRandom(&generator, 16);
+        for (uint32_t add = 0; add < noOfAdds && PATH_getLength(path) < 1800; ++add) {
+            const Cords cell = snake_cell(PATH_getLength(path), 50);
+            PATHINDEX_addCoordinates(index, path, cell.row, cell.col);
+        }
+    }
+    assert(PATHINDEX_getNoOfSteps(index) == PATH_getLength(path));
+    for (uint16_t row = 0; row < 50; ++row) {
+        for (uint16_t col = 0; col < 50; ++col) {
+            const Cords cell = {.row = row, .col = col};
+            const size_t step = PATHINDEX_getStep(index, row, col);
+            const bool isOnPath = !PATH_isEmpty(path) && PATH_containsCoordinates(path, &cell);
+            assert(isOnPath == (step != PATHINDEX_NOT_ON_PATH));
+            assert(!isOnPath || (path->pathArray[step].row == row && path->pathArray[step].col == col));
+            UNUSED(step);
+            UNUSED(isOnPath);
+        }
+    }
+
+    PATHINDEX_destroyIndex(&index);
+    PATH_freePath(&path);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: In Sync With Linear Scan\n");
+}
+
+void test_rebuild_index() {
+    printf("Testing: Rebuild Index\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(10, 10);
+    Path* path = PATH_initializePath(20, matrix);
+    PathIndex* index = PATHINDEX_createIndex(path, matrix);
+    assert(PATHINDEX_getNoOfSteps(index) == 0);
+
+    // Cells added behind the back of the index only show up after a rebuild
+    PATH_addCoordinates(path, 4, 4);
+    PATH_addCoordinates(path, 4, 5);
+    assert(!PATHINDEX_containsCoordinates(index, 4, 5));
+    PATHINDEX_rebuildIndex(index, path);
+    assert(PATHINDEX_getStep(index, 4, 5) == 1 && PATHINDEX_getNoOfSteps(index) == 2);
+
+    PATH_clearPath(path);
+    PATHINDEX_rebuildIndex(index, path);
+    assert(!PATHINDEX_containsCoordinates(index, 4, 4));
+
+    PATHINDEX_destroyIndex(&index);
+    PATH_freePath(&path);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Rebuild Index\n");
+}
+
+int main(void) {
+    printf("--- Running PathIndex Tests ---\n");
+    test_index_existing_cells();
+    test_add_and_pop();
+    test_in_sync_with_linear_scan();
+    test_rebuild_index();
+    printf("--- All PathIndex Tests Passed ---\n");
+    return 0;
+}
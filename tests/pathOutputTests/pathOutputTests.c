@@ -0,0 +1,208 @@
+#define _GNU_SOURCE // fmemopen, open_memstream
+#define PATH_UNCHECKED_API
+#include "pathOutput.h"
+#include "matrixWorld.h"
+#include "path.h"
+#include <stdio.h>
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Writes a path to a memory stream and returns the bytes, to be freed by the caller.
+ */
+static char* write_path(const Path* path, OUTPUT_Format format, size_t* size) {
+    char* bytes = NULL;
+    FILE* output = open_memstream(&bytes, size);
+    assert(output != NULL);
+    bool isWritten = OUTPUT_writePath(path, output, format);
+    assert(isWritten);
+    UNUSED(isWritten);
+    fclose(output);
+    return bytes;
+}
+
+/*
+ * A boustrophedon walk over the first noOfCells cells of the matrix.
+ */
+static Path* make_snake_path(WorldMatrix* matrix, size_t noOfCells) {
+    uint16_t cols = MATRIXWORLD_getColSize(matrix);
+    Path* path = PATH_initializePath(noOfCells, matrix);
+    for (size_t cell = 0; cell < noOfCells; cell++) {
+        uint16_t row = (uint16_t)(cell / cols);
+        uint16_t col = (uint16_t)(cell % cols);
+        PATH_addCoordinates(path, row, (row % 2 == 0) ? col : (uint16_t)(cols - 1 - col));
+    }
+    return path;
+}
+
+void test_uint_formatting() {
+    printf("Testing: Uint Formatting\n");
+    char* text = NULL;
+    size_t size = 0;
+    FILE* output = open_memstream(&text, &size);
+    assert(output != NULL);
+    OutputWriter* writer = malloc(sizeof(OutputWriter));
+    OUTPUT_initWriter(writer, output);
+    const uint64_t values[] = {0, 7, 10, 99, 100, 1234567, UINT64_MAX};
+    for (size_t index = 0; index < sizeof(values) / sizeof(values[0]); index++) {
+        OUTPUT_writeUint(writer, values[index]);
+        OUTPUT_writeChar(writer, ' ');
+    }
+    bool isFlushed = OUTPUT_flushWriter(writer);
+    assert(isFlushed);
+    UNUSED(isFlushed);
+    fclose(output);
+    assert(strcmp(text, "0 7 10 99 100 1234567 18446744073709551615 ") == 0);
+
+    free(writer);
+    free(text);
+    printf("Passed: Uint Formatting\n");
+}
+
+void test_text_format() {
+    printf("Testing: Text Format\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(4, 4);
+    Path* path = make_snake_path(matrix, 6);
+    size_t size = 0;
+    char* text = write_path(path, OUTPUT_FORMAT_TEXT, &size);
+    assert(strcmp(text, "0,0\n0,1\n0,2\n0,3\n1,3\n1,2\n") == 0);
+    assert(size == strlen(text));
+
+    free(text);
+    PATH_freePath(&path);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Text Format\n");
+}
+
+void test_large_text_output() {
+    printf("Testing: Large Text Output\n");
+    // Several buffers worth of lines, the last one only partly filled
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(200, 200);
+    Path* path = make_snake_path(matrix, 29000);
+    size_t size = 0;
+    char* text = write_path(path, OUTPUT_FORMAT_TEXT, &size);
+    assert(size > 2 * OUTPUT_BUFFER_SIZE);
+
+    const char* line = text;
+    for (size_t index = 0; index < PATH_getLength(path); index++) {
+        unsigned row, col;
+        int consumed = 0;
+        int noOfFields = sscanf(line, "%u,%u\n%n", &row, &col, &consumed);
+        assert(noOfFields == 2);
+        assert(row == path->pathArray[index].row && col == path->pathArray[index].col);
+        UNUSED(noOfFields);
+        line += consumed;
+    }
+    assert(*line == '\0');
+
+    free(text);
+    PATH_freePath(&path);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Large Text Output\n");
+}
+
+void test_binary_round_trip() {
+    printf("Testing: Binary Round Trip\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(30, 30);
+    // Every length modulo 4 leaves a different number of steps in the last byte
+    const size_t lengths[] = {1, 2, 4, 5, 8, 9, 600};
+    for (size_t test = 0; test < sizeof(lengths) / sizeof(lengths[0]); test++) {
+        Path* path = make_snake_path(matrix, lengths[test]);
+        size_t size = 0;
+        char* bytes = write_path(path, OUTPUT_FORMAT_BINARY, &size);
+        assert(size == OUTPUT_PATH_HEADER_SIZE + (lengths[test] - 1 + 3) / 4);
+        assert(memcmp(bytes, "PFPT", 4) == 0);
+
+        Path* decoded = PATH_initializePath(lengths[test], matrix);
+        bool isDecoded = OUTPUT_decodeBinaryPath((const uint8_t*)bytes, size, decoded);
+        assert(isDecoded);
+        UNUSED(isDecoded);
+        assert(PATH_getLength(decoded) == lengths[test]);
+        assert(memcmp(decoded->pathArray, path->pathArray, lengths[test] * sizeof(Cords)) == 0);
+
+        free(bytes);
+        PATH_freePath(&decoded);
+        PATH_freePath(&path);
+    }
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Binary Round Trip\n");
+}
+
+void test_binary_rejections() {
+    printf("Testing: Binary Rejections\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(5, 5);
+
+    // A jump can not be written as a step
+    Path* path = PATH_initializePath(3, matrix);
+    PATH_addCoordinates(path, 0, 0);
+    PATH_addCoordinates(path, 0, 1);
+    PATH_addCoordinates(path, 2, 1);
+    char* bytes = NULL;
+    size_t size = 0;
+    FILE* output = open_memstream(&bytes, &size);
+    assert(output != NULL);
+    bool isWritten = OUTPUT_writePath(path, output, OUTPUT_FORMAT_BINARY);
+    assert(!isWritten);
+    UNUSED(isWritten);
+    fclose(output);
+    free(bytes);
+    PATH_freePath(&path);
+
+    // Truncated data, a wrong magic and a walk off the grid
+    path = make_snake_path(matrix, 5);
+    bytes = write_path(path, OUTPUT_FORMAT_BINARY, &size);
+    Path* decoded = PATH_initializePath(5, matrix);
+    bool isDecoded = OUTPUT_decodeBinaryPath((const uint8_t*)bytes, size - 1, decoded);
+    assert(!isDecoded);
+    bytes[0] = 'X';
+    isDecoded = OUTPUT_decodeBinaryPath((const uint8_t*)bytes, size, decoded);
+    assert(!isDecoded);
+    const uint8_t offGrid[] = {'P', 'F', 'P', 'T', 1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 3};
+    isDecoded = OUTPUT_decodeBinaryPath(offGrid, sizeof(offGrid), decoded);
+    assert(!isDecoded);
+    assert(PATH_isEmpty(decoded));
+
+    // More cells than the path holds
+    Path* shortPath = PATH_initializePath(2, matrix);
+    bytes[0] = 'P';
+    isDecoded = OUTPUT_decodeBinaryPath((const uint8_t*)bytes, size, shortPath);
+    assert(!isDecoded);
+    UNUSED(isDecoded);
+
+    free(bytes);
+    PATH_freePath(&shortPath);
+    PATH_freePath(&decoded);
+    PATH_freePath(&path);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Binary Rejections\n");
+}
+
+void test_quiet_diagnostics() {
+    printf("Testing: Quiet Diagnostics\n");
+    assert(!OUTPUT_isQuiet());
+    OUTPUT_setQuiet(true);
+    assert(OUTPUT_isQuiet());
+    // Silenced: clearing an empty matrix is reported as ABNORMAL
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(4, 4);
+    MATRIXWORLD_clearMatrix(matrix);
+    MATRIXWORLD_setCell(matrix, 1, 1, false);
+    OUTPUT_setQuiet(false);
+    assert(!OUTPUT_isQuiet());
+
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Quiet Diagnostics\n");
+}
+
+int main(void) {
+    printf("--- Running PathOutput Tests ---\n");
+    test_uint_formatting();
+    test_text_format();
+    test_large_text_output();
+    test_binary_round_trip();
+    test_binary_rejections();
+    test_quiet_diagnostics();
+    printf("--- All PathOutput Tests Passed ---\n");
+    return 0;
+}
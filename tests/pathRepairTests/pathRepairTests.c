@@ -0,0 +1,221 @@
+#define PATH_UNCHECKED_API
+#include "pathRepair.h"
+#include "dfsPathFinding.h"
+#include "matrixWorld.h"
+#include "path.h"
+#include "utilities.h"
+#include <stdio.h>
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+/*
+ * Checks that a path is contiguous and only crosses unblocked cells.
+ */
+static void assert_valid_path(const WorldMatrix* matrix, const Path* path) {
+    assert(PATH_isContiguous(path));
+    for (size_t i = 0; i < PATH_getLength(path); ++i) {
+        assert(!MATRIXWORLD_isBlocked(matrix, path->pathArray[i].row, path->pathArray[i].col));
+    }
+}
+
+/*
+ * Checks that every step of a path moves to one of the eight neighbors of its
+ * cell, and that the path visits no cell twice and no blocked cell.
+ */
+static void assert_valid_eight_path(const WorldMatrix* matrix, const Path* path) {
+    for (size_t i = 0; i < PATH_getLength(path); ++i) {
+        const Cords cell = path->pathArray[i];
+        assert(!MATRIXWORLD_isBlocked(matrix, cell.row, cell.col));
+        for (size_t j = 0; j < i; ++j) {
+            assert(path->pathArray[j].row != cell.row || path->pathArray[j].col != cell.col);
+        }
+        if (i > 0) {
+            const Cords previous = path->pathArray[i - 1];
+            assert(abs(previous.row - cell.row) <= 1 && abs(previous.col - cell.col) <= 1);
+        }
+    }
+}
+
+/*
+ * Blocks every cell of a 4x10 matrix but the ring around its middle row
+ * pair, and lays a path of the given length along the ring from (0, 6).
+ */
+static Path* create_ring_path(WorldMatrix* matrix, uint16_t length) {
+    for (uint16_t c = 0; c < 10; ++c) {
+        MATRIXWORLD_setCell(matrix, 3, c, true);
+        if (c != 0 && c != 9) {
+            MATRIXWORLD_setCell(matrix, 1, c, true);
+        }
+    }
+    Cords ring[22];
+    size_t n = 0;
+    for (uint16_t c = 0; c < 10; ++c) ring[n++] = (Cords){.row = 0, .col = c};
+    ring[n++] = (Cords){.row = 1, .col = 9};
+    for (uint16_t c = 10; c-- > 0;) ring[n++] = (Cords){.row = 2, .col = c};
+    ring[n++] = (Cords){.row = 1, .col = 0};
+
+    Path* path = PATH_initializePath(length, matrix);
+    for (size_t i = 0; i < length; ++i) {
+        Cords cell = ring[(6 + i) % 22];
+        PATH_addCoordinates(path, cell.row, cell.col);
+    }
+    return path;
+}
+
+void test_untouched_path_stays_intact() {
+    printf("Testing: Untouched Path Stays Intact\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(10, 10);
+    Path* path = PATH_initializePath(10, matrix);
+    for (uint16_t c = 0; c < 10; ++c) {
+        PATH_addCoordinates(path, 2, c);
+    }
+
+    MATRIXWORLD_setCell(matrix, 5, 5, true);
+    PATHREPAIR_Outcome outcome = PATHREPAIR_repairPath(matrix, path, 5, 5, NULL);
+    assert(outcome == PATHREPAIR_INTACT);
+    MATRIXWORLD_setCell(matrix, 5, 5, false);
+    outcome = PATHREPAIR_repairPath(matrix, path, 5, 5, NULL);
+    assert(outcome == PATHREPAIR_INTACT);
+    assert(PATH_getLength(path) == 10 && path->pathArray[9].col == 9);
+    UNUSED(outcome);
+
+    PATH_freePath(&path);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Untouched Path Stays Intact\n");
+}
+
+void test_detour_around_blocked_cell() {
+    printf("Testing: Detour Around Blocked Cell\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(10, 10);
+    Path* path = PATH_initializePath(10, matrix);
+    for (uint16_t c = 0; c < 10; ++c) {
+        PATH_addCoordinates(path, 2, c);
+    }
+
+    MATRIXWORLD_setCell(matrix, 2, 5, true);
+    PATHREPAIR_Outcome outcome = PATHREPAIR_repairPath(matrix, path, 2, 5, NULL);
+    assert(outcome == PATHREPAIR_DETOUR);
+    assert(PATH_getLength(path) == 10);
+    assert_valid_path(matrix, path);
+    // The cells in front of the blocked one stay, the detour takes 3 cells
+    for (uint16_t c = 0; c < 5; ++c) {
+        assert(path->pathArray[c].row == 2 && path->pathArray[c].col == c);
+    }
+    assert(path->pathArray[8].row == 2 && path->pathArray[8].col == 6);
+    UNUSED(outcome);
+
+    PATH_freePath(&path);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Detour Around Blocked Cell\n");
+}
+
+void test_boxed_in_part_is_extended() {
+    printf("Testing: Boxed In Part Is Extended\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(10, 10);
+    MATRIXWORLD_setCell(matrix, 1, 4, true);
+    MATRIXWORLD_setCell(matrix, 1, 5, true);
+    Path* path = PATH_initializePath(10, matrix);
+    for (uint16_t c = 0; c < 10; ++c) {
+        PATH_addCoordinates(path, 0, c);
+    }
+
+    // (0, 4) has no free neighbor, the part behind the cell grows instead
+    DFS_SearchContext* context = DFS_createSearchContext(matrix, NULL);
+    MATRIXWORLD_setCell(matrix, 0, 5, true);
+    PATHREPAIR_Outcome outcome = PATHREPAIR_repairBounded(context, matrix, path, 0, 5);
+    assert(outcome == PATHREPAIR_EXTENDED);
+    assert(PATH_getLength(path) == 10);
+    assert_valid_path(matrix, path);
+    assert(path->pathArray[0].row == 0 && path->pathArray[0].col == 9);
+    UNUSED(outcome);
+
+    DFS_destroySearchContext(&context);
+    PATH_freePath(&path);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Boxed In Part Is Extended\n");
+}
+
+void test_search_from_scratch() {
+    printf("Testing: Search From Scratch\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(4, 10);
+    Path* path = create_ring_path(matrix, 21);
+    assert_valid_path(matrix, path);
+
+    // Both parts end next to the cell, only the whole ring still holds 21 cells
+    MATRIXWORLD_setCell(matrix, 2, 5, true);
+    PATHREPAIR_Outcome outcome = PATHREPAIR_repairPath(matrix, path, 2, 5, NULL);
+    assert(outcome == PATHREPAIR_RESEARCHED);
+    assert(PATH_getLength(path) == 21);
+    assert_valid_path(matrix, path);
+    UNUSED(outcome);
+
+    PATH_freePath(&path);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Search From Scratch\n");
+}
+
+void test_repair_fails_without_room() {
+    printf("Testing: Repair Fails Without Room\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(4, 10);
+    Path* path = create_ring_path(matrix, 22);
+    assert_valid_path(matrix, path);
+
+    MATRIXWORLD_setCell(matrix, 0, 2, true);
+    PATHREPAIR_Outcome outcome = PATHREPAIR_repairPath(matrix, path, 0, 2, NULL);
+    assert(outcome == PATHREPAIR_FAILED);
+    assert(PATH_getLength(path) == 0);
+    UNUSED(outcome);
+
+    PATH_freePath(&path);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Repair Fails Without Room\n");
+}
+
+void test_eight_neighborhood_detour() {
+    printf("Testing: Eight Neighborhood Detour\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(5, 5);
+    DFS_SearchOptions options = DFS_getDefaultOptions();
+    options.neighborhood = DFS_NEIGHBORHOOD_EIGHT;
+    Path* path = PATH_initializePath(3, matrix);
+    PATH_addCoordinates(path, 0, 0);
+    PATH_addCoordinates(path, 1, 1);
+    PATH_addCoordinates(path, 0, 1);
+
+    // The neighbors of the blocked cell are next to each other, the detour
+    // still takes its place with a cell
+    MATRIXWORLD_setCell(matrix, 1, 1, true);
+    PATHREPAIR_Outcome outcome = PATHREPAIR_repairPath(matrix, path, 1, 1, &options);
+    assert(outcome == PATHREPAIR_DETOUR);
+    assert(PATH_getLength(path) == 3);
+    assert(path->pathArray[1].row == 1 && path->pathArray[1].col == 0);
+    assert_valid_eight_path(matrix, path);
+
+    // Without a cell next to both neighbors the part in front is grown
+    PATH_clearPath(path);
+    PATH_addCoordinates(path, 0, 0);
+    PATH_addCoordinates(path, 1, 0);
+    PATH_addCoordinates(path, 0, 1);
+    MATRIXWORLD_setCell(matrix, 1, 0, true);
+    outcome = PATHREPAIR_repairPath(matrix, path, 1, 0, &options);
+    assert(outcome == PATHREPAIR_EXTENDED);
+    assert(PATH_getLength(path) == 3);
+    assert_valid_eight_path(matrix, path);
+    UNUSED(outcome);
+
+    PATH_freePath(&path);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Eight Neighborhood Detour\n");
+}
+
+int main(void) {
+    printf("--- Running PathRepair Tests ---\n");
+    test_untouched_path_stays_intact();
+    test_detour_around_blocked_cell();
+    test_boxed_in_part_is_extended();
+    test_search_from_scratch();
+    test_repair_fails_without_room();
+    test_eight_neighborhood_detour();
+    printf("--- All PathRepair Tests Passed ---\n");
+    return 0;
+}
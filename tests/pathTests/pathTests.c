@@ -1,7 +1,10 @@
+#define PATH_UNCHECKED_API
+#define MATRIXWORLD_UNCHECKED_API
 #include "path.h"
 #include "matrixWorld.h"
 #include "utilities.h"
 #include <stdio.h>
+#include <string.h>
 #include <assert.h>
 #include <stdint.h>
 
@@ -124,13 +127,88 @@ void test_contains_coordinates() {
     printf("Passed: Path Contains Coordinates\n");
 }
 
-int main(void) {
+void test_unchecked_accessors() {
+    printf("Testing: Unchecked Accessors\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(10, 10);
+    Path* path = PATH_initializePath(12, matrix);
+
+    PATH_unchecked_addCoordinates(path, 4, 4);
+    PATH_unchecked_addCoordinates(path, 4, 5);
+    assert(PATH_unchecked_getLength(path) == PATH_getLength(path));
+    Cords last = PATH_unchecked_getLastCoordinates(path);
+    assert(last.row == 4 && last.col == 5);
+    Cords popped = PATH_unchecked_popCoordinates(path);
+    assert(popped.row == 4 && popped.col == 5);
+    assert(PATH_getLength(path) == 1);
+
+    MATRIXWORLD_setCell(matrix, 3, 7, true);
+    assert(MATRIXWORLD_getRowSize(matrix) == MATRIXWORLD_unchecked_getRowSize(matrix));
+    assert(MATRIXWORLD_getColSize(matrix) == MATRIXWORLD_unchecked_getColSize(matrix));
+    assert(MATRIXWORLD_unchecked_isBlocked(matrix, 3, 7));
+    assert(!MATRIXWORLD_unchecked_isBlocked(matrix, 7, 3));
+
+    PATH_freePath(&path);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Unchecked Accessors\n");
+}
+
+void test_initialization_in_arena() {
+    printf("Testing: Path Initialization in Arena\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(10, 10);
+    Arena* arena = ARENA_createArena(4096, false);
+    Path* first = PATH_initializePathInArena(12, matrix, arena);
+    Path* second = PATH_initializePathInArena(30, matrix, arena);
+    assert(first != NULL && second != NULL);
+    assert(PATH_isEmpty(first) && PATH_isEmpty(second));
+    PATH_addCoordinates(first, 1, 1);
+    PATH_addCoordinates(second, 2, 2);
+    PATH_addCoordinates(second, 2, 3);
+    assert(PATH_getLength(first) == 1);
+    assert(PATH_isContiguous(second));
+
+    // Both paths go with the arena, the next path reuses their memory
+    ARENA_reset(arena);
+    Path* reused = PATH_initializePathInArena(12, matrix, arena);
+    assert(reused == first && PATH_isEmpty(reused));
+    ARENA_destroyArena(&arena);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Path Initialization in Arena\n");
+}
+
+void test_large_world() {
+    printf("Testing: Path in Large World\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(10000, 10000);
+    // Snakes through the first 20 rows, 200000 cells
+    const size_t pathSize = (size_t)20 * 10000;
+    Path* path = PATH_initializePath(pathSize, matrix);
+    for (uint16_t row = 0; row < 20; ++row) {
+        for (uint16_t step = 0; step < 10000; ++step) {
+            uint16_t col = (row % 2 == 0) ? step : (uint16_t)(9999 - step);
+            PATH_addCoordinates(path, row, col);
+        }
+    }
+    assert(PATH_getLength(path) == pathSize);
+    assert(PATH_isContiguous(path));
+    assert(path->pathArray[pathSize - 1].row == 19 && path->pathArray[pathSize - 1].col == 0);
+    PATH_freePath(&path);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Path in Large World\n");
+}
+
+int main(int argc, char* argv[]) {
+    // The 10^8 cell world runs on its own, see BUILD_STRESS_TESTS
+    if (argc > 1 && strcmp(argv[1], "--stress") == 0) {
+        test_large_world();
+        return 0;
+    }
     printf("--- Running Path Tests ---\n");
     test_initialization_and_length();
     test_add_and_get_length();
     test_get_pop_and_clear();
     test_is_contiguous();
     test_contains_coordinates();
+    test_unchecked_accessors();
+    test_initialization_in_arena();
     printf("--- All Path Tests Passed ---\n");
     return 0;
 }
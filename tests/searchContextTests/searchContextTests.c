@@ -0,0 +1,198 @@
+#define PATH_UNCHECKED_API
+#include "dfsPathFinding.h"
+#include "matrixWorld.h"
+#include "path.h"
+#include <stdio.h>
+#include <assert.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+/*
+ * The test binary is linked with --wrap for the allocator, so every allocation
+ * of the library linked into it is counted here while enabled, whichever
+ * allocator serves it.
+ */
+extern void* __real_malloc(size_t size);
+extern void* __real_calloc(size_t count, size_t size);
+extern void* __real_realloc(void* pointer, size_t size);
+extern void* __real_aligned_alloc(size_t alignment, size_t size);
+
+static atomic_bool isCounting = false;
+static atomic_uint noOfAllocations = 0;
+
+void* __wrap_malloc(size_t size) {
+    if (atomic_load(&isCounting)) {
+        atomic_fetch_add(&noOfAllocations, 1);
+    }
+    return __real_malloc(size);
+}
+
+void* __wrap_calloc(size_t count, size_t size) {
+    if (atomic_load(&isCounting)) {
+        atomic_fetch_add(&noOfAllocations, 1);
+    }
+    return __real_calloc(count, size);
+}
+
+void* __wrap_realloc(void* pointer, size_t size) {
+    if (atomic_load(&isCounting)) {
+        atomic_fetch_add(&noOfAllocations, 1);
+    }
+    return __real_realloc(pointer, size);
+}
+
+void* __wrap_aligned_alloc(size_t alignment, size_t size) {
+    if (atomic_load(&isCounting)) {
+        atomic_fetch_add(&noOfAllocations, 1);
+    }
+    return __real_aligned_alloc(alignment, size);
+}
+
+static void start_counting(void) {
+    atomic_store(&noOfAllocations, 0);
+    atomic_store(&isCounting, true);
+}
+
+static unsigned stop_counting(void) {
+    atomic_store(&isCounting, false);
+    return atomic_load(&noOfAllocations);
+}
+
+/*
+ * Checks that a path has the requested length, is contiguous and avoids the
+ * blocked cells of the matrix.
+ */
+static void assert_valid_path(const WorldMatrix* matrix, const Path* path, uint32_t length) {
+    assert(PATH_getLength(path) == length);
+    assert(PATH_isContiguous(path));
+    for (size_t i = 0; i < PATH_getLength(path); ++i) {
+        assert(!MATRIXWORLD_isBlocked(matrix, path->pathArray[i].row, path->pathArray[i].col));
+    }
+    UNUSED(matrix);
+    UNUSED(length);
+}
+
+void test_repeated_searches_do_not_allocate() {
+    printf("Testing: Repeated Searches Do Not Allocate\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(20, 20);
+    DFS_SearchOptions options = DFS_getDefaultOptions();
+    options.useConstruction = false;
+    options.useReachabilityPruning = true;
+    options.startOrder = SCHEDULER_ORDER_LOW_DEGREE;
+
+    for (int multithreaded = 0; multithreaded <= 1; ++multithreaded) {
+        options.isMultithreading = multithreaded;
+        options.noOfThreads = 3;
+        DFS_SearchContext* context = DFS_createSearchContext(matrix, &options);
+        Path* result = PATH_initializePath(200, matrix);
+        // The first search sizes the buffers of every worker
+        bool isFound = DFS_searchIntoPath(context, 200, result);
+        assert(isFound);
+
+        start_counting();
+        const uint32_t lengths[] = {50, 200, 1, 120, 200, 7};
+        for (size_t i = 0; i < sizeof(lengths) / sizeof(lengths[0]); ++i) {
+            isFound = DFS_searchIntoPath(context, lengths[i], result);
+            assert(isFound);
+            assert_valid_path(matrix, result, lengths[i]);
+        }
+        // A wall between searches, the map and the starts are rebuilt in place
+        for (uint16_t r = 0; r < 20; ++r) {
+            MATRIXWORLD_setCell(matrix, r, 10, true);
+        }
+        isFound = DFS_searchIntoPath(context, 199, result);
+        assert(!isFound && PATH_isEmpty(result));
+        isFound = DFS_searchIntoPath(context, 150, result);
+        assert(isFound);
+        assert_valid_path(matrix, result, 150);
+        unsigned noOfCounted = stop_counting();
+        assert(noOfCounted == 0);
+        UNUSED(noOfCounted);
+
+        MATRIXWORLD_clearMatrix(matrix);
+        PATH_freePath(&result);
+        DFS_destroySearchContext(&context);
+    }
+
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Repeated Searches Do Not Allocate\n");
+}
+
+void test_rebind_same_size_matrix() {
+    printf("Testing: Rebind Same Size Matrix\n");
+    WorldMatrix* first = MATRIXWORLD_matrixInitialization(10, 15);
+    WorldMatrix* second = MATRIXWORLD_matrixInitialization(10, 15);
+    // Only the first two rows of the second matrix are free
+    for (uint16_t r = 2; r < 10; ++r) {
+        for (uint16_t c = 0; c < 15; ++c) {
+            MATRIXWORLD_setCell(second, r, c, true);
+        }
+    }
+    DFS_SearchOptions options = DFS_getDefaultOptions();
+
+    for (int multithreaded = 0; multithreaded <= 1; ++multithreaded) {
+        options.isMultithreading = multithreaded;
+        options.noOfThreads = 2;
+        DFS_SearchContext* context = DFS_createSearchContext(first, &options);
+        Path* result = PATH_initializePath(60, first);
+        bool isFound = DFS_searchIntoPath(context, 60, result);
+        assert(isFound);
+        assert_valid_path(first, result, 60);
+
+        start_counting();
+        DFS_setSearchContextMatrix(context, second);
+        isFound = DFS_searchIntoPath(context, 60, result);
+        assert(!isFound);
+        isFound = DFS_searchIntoPath(context, 20, result);
+        assert(isFound);
+        assert_valid_path(second, result, 20);
+        DFS_setSearchContextMatrix(context, first);
+        isFound = DFS_searchIntoPath(context, 60, result);
+        assert(isFound);
+        unsigned noOfCounted = stop_counting();
+        assert(noOfCounted == 0);
+        UNUSED(noOfCounted);
+
+        PATH_freePath(&result);
+        DFS_destroySearchContext(&context);
+    }
+
+    MATRIXWORLD_matrixFree(&first);
+    MATRIXWORLD_matrixFree(&second);
+    printf("Passed: Rebind Same Size Matrix\n");
+}
+
+void test_search_into_path_matches_search_with_context() {
+    printf("Testing: Search Into Path Matches Search With Context\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(9, 9);
+    MATRIXWORLD_setCell(matrix, 4, 4, true);
+    DFS_SearchContext* context = DFS_createSearchContext(matrix, NULL);
+
+    // A result path larger than the request is filled up to the request only
+    Path* result = PATH_initializePath(60, matrix);
+    bool isFound = DFS_searchIntoPath(context, 40, result);
+    assert(isFound);
+    Path* allocated = DFS_searchWithContext(context, 40);
+    assert(allocated != NULL);
+    assert(PATH_getLength(result) == PATH_getLength(allocated));
+    for (size_t i = 0; i < PATH_getLength(result); ++i) {
+        assert(result->pathArray[i].row == allocated->pathArray[i].row);
+        assert(result->pathArray[i].col == allocated->pathArray[i].col);
+    }
+
+    PATH_freePath(&allocated);
+    PATH_freePath(&result);
+    DFS_destroySearchContext(&context);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Search Into Path Matches Search With Context\n");
+}
+
+int main(void) {
+    printf("--- Running SearchContext Tests ---\n");
+    test_repeated_searches_do_not_allocate();
+    test_rebind_same_size_matrix();
+    test_search_into_path_matches_search_with_context();
+    printf("--- All SearchContext Tests Passed ---\n");
+    return 0;
+}
@@ -0,0 +1,192 @@
+#define PATH_UNCHECKED_API
+#include "snakePath.h"
+#include "matrixWorld.h"
+#include "path.h"
+#include "utilities.h"
+#include "visitedSet.h"
+#include <stdio.h>
+#include <assert.h>
+#include <stdint.h>
+
+/*
+ * Checks that a path is contiguous, only holds unblocked cells and never
+ * visits a cell twice.
+ */
+static void assert_valid_path(const WorldMatrix* matrix, const Path* path, uint32_t length) {
+    assert(PATH_getLength(path) == length);
+    assert(PATH_isContiguous(path));
+    VisitedSet* seen = VISITED_createSet(matrix);
+    for (size_t i = 0; i < PATH_getLength(path); ++i) {
+        Cords cell = path->pathArray[i];
+        assert(!MATRIXWORLD_isBlocked(matrix, cell.row, cell.col));
+        assert(!VISITED_isMarked(seen, cell.row, cell.col));
+        VISITED_markCell(seen, cell.row, cell.col);
+        UNUSED(cell);
+    }
+    VISITED_destroySet(&seen);
+    UNUSED(matrix);
+    UNUSED(length);
+}
+
+void test_empty_matrix_snake() {
+    printf("Testing: Empty Matrix Snake\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(7, 5);
+    VisitedSet* scratch = VISITED_createSet(matrix);
+    Path* path = PATH_initializePath(35, matrix);
+
+    bool isBuilt = SNAKE_buildPath(matrix, 35, scratch, path);
+    assert(isBuilt);
+    assert_valid_path(matrix, path, 35);
+    // The second row runs back from its last column
+    assert(path->pathArray[4].row == 0 && path->pathArray[4].col == 4);
+    assert(path->pathArray[5].row == 1 && path->pathArray[5].col == 4);
+    assert(path->pathArray[9].row == 1 && path->pathArray[9].col == 0);
+
+    isBuilt = SNAKE_buildPath(matrix, 12, scratch, path);
+    assert(isBuilt);
+    assert_valid_path(matrix, path, 12);
+
+    // A single column is a straight line
+    WorldMatrix* column = MATRIXWORLD_matrixInitialization(9, 1);
+    isBuilt = SNAKE_buildPath(column, 9, scratch, path);
+    assert(isBuilt);
+    assert_valid_path(column, path, 9);
+    UNUSED(isBuilt);
+
+    MATRIXWORLD_matrixFree(&column);
+    PATH_freePath(&path);
+    VISITED_destroySet(&scratch);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Empty Matrix Snake\n");
+}
+
+void test_detours_around_blocked_cells() {
+    printf("Testing: Detours Around Blocked Cells\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(6, 30);
+    // A full column of the first band, a single cell of the second and a
+    // blocked cell where the walk turns into the third band
+    MATRIXWORLD_setCell(matrix, 0, 7, true);
+    MATRIXWORLD_setCell(matrix, 1, 7, true);
+    MATRIXWORLD_setCell(matrix, 2, 11, true);
+    MATRIXWORLD_setCell(matrix, 4, 0, true);
+    VisitedSet* scratch = VISITED_createSet(matrix);
+    Path* path = PATH_initializePath(100, matrix);
+
+    bool isBuilt = SNAKE_buildPath(matrix, 100, scratch, path);
+    assert(isBuilt);
+    assert_valid_path(matrix, path, 100);
+    UNUSED(isBuilt);
+
+    PATH_freePath(&path);
+    VISITED_destroySet(&scratch);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Detours Around Blocked Cells\n");
+}
+
+void test_sparse_random_matrix() {
+    printf("Testing: Sparse Random Matrix\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(200, 150);
+    RandomGenerator generator;
+    UTILITY_seedGenerator(&generator, 99);
+    // About 3% of the cells are blocked
+    for (uint16_t r = 0; r < 200; ++r) {
+        for (uint16_t c = 0; c < 150; ++c) {
+            if (UTILITY_nextBoundedRandom(&generator, 100) < 3) {
+                MATRIXWORLD_setCell(matrix, r, c, true);
+            }
+        }
+    }
+    VisitedSet* scratch = VISITED_createSet(matrix);
+    Path* path = PATH_initializePath(20000, matrix);
+
+    bool isBuilt = SNAKE_buildPath(matrix, 20000, scratch, path);
+    assert(isBuilt);
+    assert_valid_path(matrix, path, 20000);
+    UNUSED(isBuilt);
+
+    PATH_freePath(&path);
+    VISITED_destroySet(&scratch);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Sparse Random Matrix\n");
+}
+
+void test_randomized_sparse_matrices() {
+    printf("Testing: Randomized Sparse Matrices\n");
+    // Every built path is checked, a builder that gives up is fine
+    uint32_t noOfBuilt = 0;
+    for (uint64_t seed = 1; seed <= 400; ++seed) {
+        RandomGenerator generator;
+        UTILITY_seedGenerator(&generator, seed);
+        const uint16_t rows = (uint16_t)(20 + UTILITY_nextBoundedRandom(&generator, 180));
+        const uint16_t cols = (uint16_t)(20 + UTILITY_nextBoundedRandom(&generator, 180));
+        const uint32_t blockedPercent = 1 + UTILITY_nextBoundedRandom(&generator, 10);
+        WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(rows, cols);
+        for (uint16_t r = 0; r < rows; ++r) {
+            for (uint16_t c = 0; c < cols; ++c) {
+                if (UTILITY_nextBoundedRandom(&generator, 100) < blockedPercent) {
+                    MATRIXWORLD_setCell(matrix, r, c, true);
+                }
+            }
+        }
+        const uint32_t length = (uint32_t)((uint64_t)rows * cols *
+                                           (30 + UTILITY_nextBoundedRandom(&generator, 45)) / 100);
+        VisitedSet* scratch = VISITED_createSet(matrix);
+        Path* path = PATH_initializePath(length, matrix);
+        if (SNAKE_buildPath(matrix, length, scratch, path)) {
+            assert_valid_path(matrix, path, length);
+            noOfBuilt++;
+        } else {
+            assert(PATH_getLength(path) == 0);
+        }
+        PATH_freePath(&path);
+        VISITED_destroySet(&scratch);
+        MATRIXWORLD_matrixFree(&matrix);
+    }
+    // Most of them are sparse enough to be built
+    assert(noOfBuilt > 200);
+    UNUSED(noOfBuilt);
+    printf("Passed: Randomized Sparse Matrices\n");
+}
+
+void test_gives_up_without_a_path() {
+    printf("Testing: Gives Up Without A Path\n");
+    // A full wall under the first band leaves it only 100 cells
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(20, 50);
+    for (uint16_t c = 0; c < 50; ++c) {
+        MATRIXWORLD_setCell(matrix, 2, c, true);
+    }
+    VisitedSet* scratch = VISITED_createSet(matrix);
+    Path* path = PATH_initializePath(500, matrix);
+
+    bool isBuilt = SNAKE_buildPath(matrix, 500, scratch, path);
+    assert(!isBuilt);
+    assert(PATH_getLength(path) == 0);
+
+    // Too dense to walk around
+    WorldMatrix* dense = MATRIXWORLD_matrixInitialization(10, 10);
+    for (uint16_t r = 0; r < 10; r += 3) {
+        for (uint16_t c = 1; c < 10; c += 3) {
+            MATRIXWORLD_setCell(dense, r, c, true);
+        }
+    }
+    isBuilt = SNAKE_buildPath(dense, 20, scratch, path);
+    assert(!isBuilt);
+    UNUSED(isBuilt);
+
+    MATRIXWORLD_matrixFree(&dense);
+    PATH_freePath(&path);
+    VISITED_destroySet(&scratch);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Gives Up Without A Path\n");
+}
+
+int main(void) {
+    printf("--- Running SnakePath Tests ---\n");
+    test_empty_matrix_snake();
+    test_detours_around_blocked_cells();
+    test_sparse_random_matrix();
+    test_randomized_sparse_matrices();
+    test_gives_up_without_a_path();
+    printf("--- All SnakePath Tests Passed ---\n");
+    return 0;
+}
@@ -0,0 +1,180 @@
+#include "startScheduler.h"
+#include "connectivity.h"
+#include "matrixWorld.h"
+#include "visitedSet.h"
+#include <stdio.h>
+#include <assert.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+void test_covers_every_unblocked_cell_once() {
+    printf("Testing: Covers Every Unblocked Cell Once\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(9, 13);
+    MATRIXWORLD_setCell(matrix, 0, 0, true);
+    MATRIXWORLD_setCell(matrix, 4, 7, true);
+    MATRIXWORLD_setCell(matrix, 8, 12, true);
+    StartScheduler* scheduler = SCHEDULER_createScheduler(matrix, NULL, 0, SCHEDULER_ORDER_SHUFFLED, 7);
+    assert(scheduler != NULL);
+    assert(SCHEDULER_getNoOfStarts(scheduler) == 114);
+
+    VisitedSet* seen = VISITED_createSet(matrix);
+    uint32_t noOfClaims = 0;
+    for (uint32_t index = SCHEDULER_claimNext(scheduler); index != SCHEDULER_EXHAUSTED;
+         index = SCHEDULER_claimNext(scheduler)) {
+        Cords start = SCHEDULER_getStart(scheduler, index);
+        assert(!MATRIXWORLD_isBlocked(matrix, start.row, start.col));
+        assert(!VISITED_isMarked(seen, start.row, start.col));
+        VISITED_markCell(seen, start.row, start.col);
+        noOfClaims++;
+    }
+    assert(noOfClaims == 114);
+    assert(SCHEDULER_claimNext(scheduler) == SCHEDULER_EXHAUSTED);
+
+    SCHEDULER_reset(scheduler);
+    assert(SCHEDULER_claimNext(scheduler) == 0);
+
+    VISITED_destroySet(&seen);
+    SCHEDULER_destroyScheduler(&scheduler);
+    assert(scheduler == NULL);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Covers Every Unblocked Cell Once\n");
+}
+
+void test_seed_is_reproducible() {
+    printf("Testing: Seed is Reproducible\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(10, 10);
+    StartScheduler* first = SCHEDULER_createScheduler(matrix, NULL, 0, SCHEDULER_ORDER_SHUFFLED, 42);
+    StartScheduler* second = SCHEDULER_createScheduler(matrix, NULL, 0, SCHEDULER_ORDER_SHUFFLED, 42);
+    StartScheduler* other = SCHEDULER_createScheduler(matrix, NULL, 0, SCHEDULER_ORDER_SHUFFLED, 43);
+    bool differs = false;
+    for (uint32_t index = 0; index < 100; ++index) {
+        Cords a = SCHEDULER_getStart(first, index);
+        Cords b = SCHEDULER_getStart(second, index);
+        Cords c = SCHEDULER_getStart(other, index);
+        assert(a.row == b.row && a.col == b.col);
+        differs = differs || a.row != c.row || a.col != c.col;
+    }
+    assert(differs);
+    SCHEDULER_destroyScheduler(&first);
+    SCHEDULER_destroyScheduler(&second);
+    SCHEDULER_destroyScheduler(&other);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Seed is Reproducible\n");
+}
+
+void test_low_degree_first() {
+    printf("Testing: Low Degree First\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(6, 6);
+    StartScheduler* scheduler = SCHEDULER_createScheduler(matrix, NULL, 0, SCHEDULER_ORDER_LOW_DEGREE, 1);
+    // The four corners have two neighbors, every other cell has more
+    uint16_t previousDegree = 0;
+    for (uint32_t index = 0; index < SCHEDULER_getNoOfStarts(scheduler); ++index) {
+        Cords start = SCHEDULER_getStart(scheduler, index);
+        uint16_t degree = MATRIXWORLD_countUnblockedNeighbors(matrix, start.row, start.col);
+        assert(degree >= previousDegree);
+        if (index < 4) {
+            assert(degree == 2);
+        }
+        previousDegree = degree;
+    }
+    SCHEDULER_destroyScheduler(&scheduler);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Low Degree First\n");
+}
+
+void test_component_filter() {
+    printf("Testing: Component Filter\n");
+    // A wall in column 2 leaves a 5x2 and a 5x5 component
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(5, 8);
+    for (uint16_t r = 0; r < 5; ++r) {
+        MATRIXWORLD_setCell(matrix, r, 2, true);
+    }
+    ComponentMap* map = CONNECTIVITY_labelComponents(matrix, 1);
+    StartScheduler* scheduler = SCHEDULER_createScheduler(matrix, map, 11, SCHEDULER_ORDER_SHUFFLED, 3);
+    assert(SCHEDULER_getNoOfStarts(scheduler) == 25);
+    for (uint32_t index = 0; index < 25; ++index) {
+        assert(SCHEDULER_getStart(scheduler, index).col > 2);
+    }
+    SCHEDULER_destroyScheduler(&scheduler);
+    CONNECTIVITY_freeComponentMap(&map);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Component Filter\n");
+}
+
+void test_refill_matches_create() {
+    printf("Testing: Refill Matches Create\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(8, 8);
+    StartScheduler* reused = SCHEDULER_createEmptyScheduler(64);
+    assert(SCHEDULER_getNoOfStarts(reused) == 0);
+    assert(SCHEDULER_claimNext(reused) == SCHEDULER_EXHAUSTED);
+
+    for (uint16_t r = 0; r < 4; ++r) {
+        MATRIXWORLD_setCell(matrix, r, r, true);
+        const SchedulerOrder order = (r % 2 == 0) ? SCHEDULER_ORDER_SHUFFLED : SCHEDULER_ORDER_LOW_DEGREE;
+        StartScheduler* created = SCHEDULER_createScheduler(matrix, NULL, 0, order, 9);
+        // Refilling rewinds the claims of the previous round
+        SCHEDULER_refillScheduler(reused, matrix, NULL, 0, order, 9);
+        assert(SCHEDULER_getNoOfStarts(reused) == 63U - r);
+        assert(SCHEDULER_getNoOfStarts(reused) == SCHEDULER_getNoOfStarts(created));
+        for (uint32_t index = 0; index < SCHEDULER_getNoOfStarts(created); ++index) {
+            Cords a = SCHEDULER_getStart(created, index);
+            Cords b = SCHEDULER_getStart(reused, index);
+            assert(a.row == b.row && a.col == b.col);
+            assert(SCHEDULER_claimNext(reused) == index);
+        }
+        SCHEDULER_destroyScheduler(&created);
+    }
+    SCHEDULER_destroyScheduler(&reused);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Refill Matches Create\n");
+}
+
+#define NO_OF_CLAIMERS 4
+
+typedef struct {
+    StartScheduler* scheduler;
+    _Atomic uint32_t* claimCounts;
+} ClaimerArgs;
+
+static void* claimAll(void* args) {
+    ClaimerArgs* claimerArgs = (ClaimerArgs*)args;
+    for (uint32_t index = SCHEDULER_claimNext(claimerArgs->scheduler); index != SCHEDULER_EXHAUSTED;
+         index = SCHEDULER_claimNext(claimerArgs->scheduler)) {
+        atomic_fetch_add(&claimerArgs->claimCounts[index], 1);
+    }
+    return NULL;
+}
+
+void test_concurrent_claims() {
+    printf("Testing: Concurrent Claims\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(100, 100);
+    StartScheduler* scheduler = SCHEDULER_createScheduler(matrix, NULL, 0, SCHEDULER_ORDER_SHUFFLED, 5);
+    static _Atomic uint32_t claimCounts[10000];
+    ClaimerArgs args = {.scheduler = scheduler, .claimCounts = claimCounts};
+
+    pthread_t threads[NO_OF_CLAIMERS];
+    for (int i = 0; i < NO_OF_CLAIMERS; ++i) {
+        pthread_create(&threads[i], NULL, claimAll, &args);
+    }
+    for (int i = 0; i < NO_OF_CLAIMERS; ++i) {
+        pthread_join(threads[i], NULL);
+    }
+    for (uint32_t index = 0; index < 10000; ++index) {
+        assert(atomic_load(&claimCounts[index]) == 1);
+    }
+    SCHEDULER_destroyScheduler(&scheduler);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Concurrent Claims\n");
+}
+
+int main(void) {
+    printf("--- Running StartScheduler Tests ---\n");
+    test_covers_every_unblocked_cell_once();
+    test_seed_is_reproducible();
+    test_low_degree_first();
+    test_component_filter();
+    test_refill_matches_create();
+    test_concurrent_claims();
+    printf("--- All StartScheduler Tests Passed ---\n");
+    return 0;
+}
@@ -1,6 +1,7 @@
 #include "startingPointVector.h"
 #include "matrixWorld.h"
 #include <stdio.h>
+#include <string.h>
 #include <assert.h>
 
 void test_create_and_destroy() {
@@ -153,7 +154,48 @@ void test_clear_vector() {
     printf("Passed: Clear Vector\n");
 }
 
-int main(void) {
+void test_create_in_arena() {
+    printf("Testing: Create in Arena\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(10, 10);
+    Arena* arena = ARENA_createArena(4096, false);
+    StartingPointVector* vec = STPOINT_createVectorInArena(matrix, arena);
+    assert(vec != NULL);
+    STPOINT_addPoint(vec, (Cords){3, 4});
+    STPOINT_addPoint(vec, (Cords){1, 2});
+    assert(STPOINT_getSize(vec) == 2);
+    assert(STPOINT_containsPoint(vec, (Cords){3, 4}));
+    ARENA_destroyArena(&arena);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Create in Arena\n");
+}
+
+void test_large_world() {
+    printf("Testing: Large World\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(10000, 10000);
+    StartingPointVector* vec = STPOINT_createVector(matrix);
+    // More points than a 16-bit count holds, added in order
+    for (uint16_t row = 0; row < 10; ++row) {
+        for (uint16_t col = 0; col < 10000; ++col) {
+            STPOINT_addPoint(vec, (Cords){row, col});
+        }
+    }
+    assert(STPOINT_getSize(vec) == 100000);
+    assert(STPOINT_containsPoint(vec, (Cords){9, 9999}));
+    assert(!STPOINT_containsPoint(vec, (Cords){10, 0}));
+    STPOINT_removePoint(vec, (Cords){0, 0});
+    assert(STPOINT_getSize(vec) == 99999);
+    assert(STPOINT_containsPoint(vec, (Cords){5, 5000}));
+    STPOINT_destroyVector(&vec);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Large World\n");
+}
+
+int main(int argc, char* argv[]) {
+    // The 10^8 cell world runs on its own, see BUILD_STRESS_TESTS
+    if (argc > 1 && strcmp(argv[1], "--stress") == 0) {
+        test_large_world();
+        return 0;
+    }
     printf("--- Running StartingPointVector Tests ---\n");
     test_create_and_destroy();
     test_add_and_contains();
@@ -161,6 +203,7 @@ int main(void) {
     test_add_sorted();
     test_remove_point();
     test_clear_vector();
+    test_create_in_arena();
     printf("--- All StartingPointVector Tests Passed ---\n");
     return 0;
 }
@@ -0,0 +1,181 @@
+#define PATH_UNCHECKED_API
+#include "tiledSearch.h"
+#include "matrixWorld.h"
+#include "path.h"
+#include "pathOutput.h"
+#include "utilities.h"
+#include <stdio.h>
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+/*
+ * Checks that a path is contiguous, only crosses unblocked cells and never
+ * visits a cell twice.
+ */
+static bool is_valid_path(const WorldMatrix* matrix, const Path* path) {
+    const uint16_t cols = MATRIXWORLD_getColSize(matrix);
+    bool* isVisited = calloc(MATRIXWORLD_getSize(matrix), sizeof(bool));
+    bool isValid = PATH_isContiguous(path);
+    for (size_t i = 0; isValid && i < PATH_getLength(path); ++i) {
+        const Cords cell = path->pathArray[i];
+        const size_t index = ((size_t)cell.row * cols) + cell.col;
+        isValid = !MATRIXWORLD_isBlocked(matrix, cell.row, cell.col) && !isVisited[index];
+        isVisited[index] = true;
+    }
+    free(isVisited);
+    return isValid;
+}
+
+/*
+ * Stores a 16-bit value of a task in little endian order.
+ */
+static void store_uint16(uint8_t* bytes, uint16_t value) {
+    bytes[0] = (uint8_t)(value & 0xFFU);
+    bytes[1] = (uint8_t)(value >> 8);
+}
+
+void test_empty_world() {
+    printf("Testing: Empty World\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(40, 40);
+    TILEDSEARCH_Options options = TILEDSEARCH_getDefaultOptions();
+    Path* path = TILEDSEARCH_findPath(matrix, 1200, &options);
+    assert(path != NULL && PATH_getLength(path) == 1200);
+    assert(is_valid_path(matrix, path));
+
+    // The worker processes build the same segments as the calling process
+    options.useProcesses = false;
+    Path* local = TILEDSEARCH_findPath(matrix, 1200, &options);
+    assert(local != NULL);
+    for (size_t i = 0; i < 1200; ++i) {
+        assert(local->pathArray[i].row == path->pathArray[i].row);
+        assert(local->pathArray[i].col == path->pathArray[i].col);
+    }
+
+    PATH_freePath(&local);
+    PATH_freePath(&path);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Empty World\n");
+}
+
+void test_world_with_obstacles() {
+    printf("Testing: World With Obstacles\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(45, 45);
+    for (uint16_t r = 0; r < 45; ++r) {
+        for (uint16_t c = 0; c < 45; ++c) {
+            if ((r * 7 + c * 3) % 11 == 0) {
+                MATRIXWORLD_setCell(matrix, r, c, true);
+            }
+        }
+    }
+    TILEDSEARCH_Options options = TILEDSEARCH_getDefaultOptions();
+    options.noOfTileRows = 3;
+    options.noOfTileCols = 3;
+    Path* path = TILEDSEARCH_findPath(matrix, 600, &options);
+    assert(path != NULL && PATH_getLength(path) == 600);
+    assert(is_valid_path(matrix, path));
+
+    // A single tile is a plain search without portals
+    options.noOfTileRows = 1;
+    options.noOfTileCols = 1;
+    Path* single = TILEDSEARCH_findPath(matrix, 600, &options);
+    assert(single != NULL && is_valid_path(matrix, single));
+
+    PATH_freePath(&single);
+    PATH_freePath(&path);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: World With Obstacles\n");
+}
+
+void test_unjoinable_tiles() {
+    printf("Testing: Unjoinable Tiles\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(20, 30);
+    TILEDSEARCH_Options options = TILEDSEARCH_getDefaultOptions();
+    options.noOfTileRows = 1;
+    options.noOfTileCols = 3;
+
+    // The first column of the middle tile closes the first shared border
+    for (uint16_t r = 0; r < 20; ++r) {
+        MATRIXWORLD_setCell(matrix, r, 10, true);
+    }
+    Path* path = TILEDSEARCH_findPath(matrix, 100, &options);
+    assert(path == NULL);
+
+    // A wall through the middle tile parts its entry from its exit, which
+    // only matters once the first tile can not hold the path on its own
+    for (uint16_t r = 0; r < 20; ++r) {
+        MATRIXWORLD_setCell(matrix, r, 10, false);
+        MATRIXWORLD_setCell(matrix, r, 15, true);
+    }
+    path = TILEDSEARCH_findPath(matrix, 300, &options);
+    assert(path == NULL);
+
+    // And a path longer than the world
+    MATRIXWORLD_clearMatrix(matrix);
+    path = TILEDSEARCH_findPath(matrix, 601, &options);
+    assert(path == NULL);
+
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Unjoinable Tiles\n");
+}
+
+void test_serve_tile() {
+    printf("Testing: Serve Tile\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(10, 10);
+    int sockets[2];
+    int isPaired = socketpair(AF_UNIX, SOCK_STREAM, 0, sockets);
+    assert(isPaired == 0);
+    UNUSED(isPaired);
+
+    // The 4x4 tile at (2, 2), from its top left to its top right cell
+    uint8_t task[TILEDSEARCH_TASK_SIZE] = {0};
+    const uint16_t values[8] = {2, 2, 4, 4, 2, 2, 2, 5};
+    for (size_t i = 0; i < 8; ++i) {
+        store_uint16(&task[2 * i], values[i]);
+    }
+    task[16] = 16;
+    ssize_t written = write(sockets[0], task, sizeof(task));
+    assert(written == (ssize_t)sizeof(task));
+    bool isServed = TILEDSEARCH_serveTile(sockets[1], matrix);
+    assert(isServed);
+
+    uint8_t reply[64];
+    ssize_t size = read(sockets[0], reply, sizeof(reply));
+    close(sockets[0]);
+    Path* segment = PATH_initializePath(16, matrix);
+    bool isDecoded = size > 0 && OUTPUT_decodeBinaryPath(reply, (size_t)size, segment);
+    assert(isDecoded && PATH_getLength(segment) == 16 && is_valid_path(matrix, segment));
+    assert(segment->pathArray[0].row == 2 && segment->pathArray[0].col == 2);
+    assert(segment->pathArray[15].row == 2 && segment->pathArray[15].col == 5);
+
+    // A tile outside of the matrix is rejected without an answer
+    isPaired = socketpair(AF_UNIX, SOCK_STREAM, 0, sockets);
+    assert(isPaired == 0);
+    store_uint16(&task[4], 9);
+    written = write(sockets[0], task, sizeof(task));
+    assert(written == (ssize_t)sizeof(task));
+    isServed = TILEDSEARCH_serveTile(sockets[1], matrix);
+    assert(!isServed);
+    size = read(sockets[0], reply, sizeof(reply));
+    assert(size == 0);
+    close(sockets[0]);
+    UNUSED(written);
+    UNUSED(isServed);
+    UNUSED(isDecoded);
+
+    PATH_freePath(&segment);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Serve Tile\n");
+}
+
+int main(void) {
+    printf("--- Running TiledSearch Tests ---\n");
+    test_empty_world();
+    test_world_with_obstacles();
+    test_unjoinable_tiles();
+    test_serve_tile();
+    printf("--- All TiledSearch Tests Passed ---\n");
+    return 0;
+}
@@ -0,0 +1,113 @@
+#include "visitedSet.h"
+#include "matrixWorld.h"
+#include <stdio.h>
+#include <assert.h>
+
+void test_create_and_destroy() {
+    printf("Testing: Create and Destroy\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(10, 20);
+    VisitedSet* set = VISITED_createSet(matrix);
+    assert(set != NULL);
+    assert(VISITED_getCapacity(set) == 200);
+    VISITED_destroySet(&set);
+    assert(set == NULL);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Create and Destroy\n");
+}
+
+void test_mark_and_unmark() {
+    printf("Testing: Mark and Unmark\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(10, 10);
+    VisitedSet* set = VISITED_createSet(matrix);
+
+    assert(!VISITED_isMarked(set, 1, 1));
+    VISITED_markCell(set, 1, 1);
+    VISITED_markCell(set, 9, 9);
+    assert(VISITED_isMarked(set, 1, 1));
+    assert(VISITED_isMarked(set, 9, 9));
+    assert(!VISITED_isMarked(set, 1, 2));
+    assert(!VISITED_isMarked(set, 2, 1));
+
+    // Marking twice is harmless
+    VISITED_markCell(set, 1, 1);
+    assert(VISITED_isMarked(set, 1, 1));
+
+    VISITED_unmarkCell(set, 1, 1);
+    assert(!VISITED_isMarked(set, 1, 1));
+    assert(VISITED_isMarked(set, 9, 9));
+
+    VISITED_destroySet(&set);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Mark and Unmark\n");
+}
+
+void test_word_boundaries() {
+    printf("Testing: Word Boundaries\n");
+    // 13 x 11 = 143 cells, spans three 64-bit words with a partial last word
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(13, 11);
+    VisitedSet* set = VISITED_createSet(matrix);
+
+    // Cells 63, 64 and 142 in the row * cols + col mapping
+    VISITED_markCell(set, 5, 8);
+    VISITED_markCell(set, 5, 9);
+    VISITED_markCell(set, 12, 10);
+    assert(VISITED_isMarked(set, 5, 8));
+    assert(VISITED_isMarked(set, 5, 9));
+    assert(VISITED_isMarked(set, 12, 10));
+    assert(!VISITED_isMarked(set, 5, 7));
+    assert(!VISITED_isMarked(set, 5, 10));
+
+    VISITED_destroySet(&set);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Word Boundaries\n");
+}
+
+void test_clear_set() {
+    printf("Testing: Clear Set\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(10, 10);
+    VisitedSet* set = VISITED_createSet(matrix);
+
+    for (uint16_t r = 0; r < 10; ++r) {
+        VISITED_markCell(set, r, r);
+    }
+    VISITED_clearSet(set);
+    for (uint16_t r = 0; r < 10; ++r) {
+        assert(!VISITED_isMarked(set, r, r));
+    }
+
+    // Clearing an empty set and a NULL set is harmless
+    VISITED_clearSet(set);
+    VISITED_clearSet(NULL);
+
+    VISITED_destroySet(&set);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Clear Set\n");
+}
+
+void test_create_in_arena() {
+    printf("Testing: Create in Arena\n");
+    WorldMatrix* matrix = MATRIXWORLD_matrixInitialization(10, 20);
+    Arena* arena = ARENA_createArena(4096, false);
+    VisitedSet* set = VISITED_createSetInArena(matrix, arena);
+    assert(VISITED_getCapacity(set) == 200);
+    VISITED_markCell(set, 9, 19);
+
+    // A set carved again over the old one starts empty
+    ARENA_reset(arena);
+    set = VISITED_createSetInArena(matrix, arena);
+    assert(!VISITED_isMarked(set, 9, 19));
+    ARENA_destroyArena(&arena);
+    MATRIXWORLD_matrixFree(&matrix);
+    printf("Passed: Create in Arena\n");
+}
+
+int main(void) {
+    printf("--- Running VisitedSet Tests ---\n");
+    test_create_and_destroy();
+    test_mark_and_unmark();
+    test_word_boundaries();
+    test_clear_set();
+    test_create_in_arena();
+    printf("--- All VisitedSet Tests Passed ---\n");
+    return 0;
+}
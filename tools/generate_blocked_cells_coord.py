@@ -8,10 +8,12 @@
 
 This script generates blocked cell coordinate files for different matrix sizes
 and runs pathfinding tests to validate algorithm performance on large matrices.
-Supports reproducible testing with fixed random seed.
+Every map is also written as a binary grid file (see gridLoader.h) which the
+CLI loads with --gridFile. Supports reproducible testing with fixed random seed.
 """
 
 import os
+import struct
 import sys
 import numpy as np
 import subprocess
@@ -22,6 +24,14 @@ import time
 matrix_sizes = {"small": (100, 100), "medium": (200, 200), "large": (500, 500)}
 np.random.seed(42)  # The "Answer to everything" for reproducible test results
 file_paths = {size: f"blocked_cells_{size}.txt" for size in matrix_sizes.keys()}
+grid_file_paths = {size: f"blocked_cells_{size}.grid" for size in matrix_sizes.keys()}
+
+# Binary grid file layout, all fields little-endian
+GRID_MAGIC = b"PFGR"
+GRID_VERSION = 1
+GRID_ENCODING_BITMAP = 0
+GRID_ENCODING_RLE = 1
+CELLS_PER_WORD = 64
 
 class Spinner:
     """
@@ -78,6 +88,49 @@ class Spinner:
                 self._thread.join()
             self._is_running = False
 
+def write_grid_file(filename, rows, cols, blocked_coordinates, encoding="auto"):
+    """
+    Writes blocked cells as a binary grid file.
+
+    The 16 byte header holds the magic, the version, the encoding, rows and
+    cols. A bitmap payload stores every row as 64-bit words with one bit per
+    cell, an RLE payload stores per row the number of blocked runs followed by
+    (start column, length) pairs.
+
+    Args:
+        filename: Path of the grid file to write
+        rows, cols: Size of the matrix
+        blocked_coordinates: Iterable of (row, col) tuples
+        encoding: "bitmap", "rle" or "auto" for the smaller of the two
+    """
+    words_per_row = (cols + CELLS_PER_WORD - 1) // CELLS_PER_WORD
+    cells = np.zeros((rows, words_per_row * CELLS_PER_WORD), dtype=np.uint8)
+    cells[:, cols:] = 1  # Padding bits past the last column read as blocked
+    for row, col in blocked_coordinates:
+        cells[row, col] = 1
+
+    rle_payload = bytearray()
+    for row in range(rows):
+        edges = np.diff(np.concatenate(([0], cells[row, :cols], [0])).astype(np.int8))
+        starts = np.flatnonzero(edges == 1)
+        ends = np.flatnonzero(edges == -1)
+        rle_payload += struct.pack("<H", len(starts))
+        for start, end in zip(starts, ends):
+            rle_payload += struct.pack("<HH", start, end - start)
+
+    bitmap_size = rows * words_per_row * 8
+    if encoding == "auto":
+        encoding = "rle" if len(rle_payload) < bitmap_size else "bitmap"
+
+    with open(filename, 'wb') as file:
+        encoding_flag = GRID_ENCODING_RLE if encoding == "rle" else GRID_ENCODING_BITMAP
+        file.write(struct.pack("<4sBBHHHI", GRID_MAGIC, GRID_VERSION, encoding_flag, 0, rows, cols, 0))
+        if encoding == "rle":
+            file.write(rle_payload)
+        else:
+            # Little bit order per byte gives the little-endian word layout of the matrix
+            file.write(np.packbits(cells, axis=1, bitorder='little').tobytes())
+
 def generate_blocked_cells_coord():
     """
     Generates blocked cell coordinate files for different matrix sizes.
@@ -98,7 +151,7 @@ def generate_blocked_cells_coord():
     """
     for size, (rows, cols) in matrix_sizes.items():
         filename = f"blocked_cells_{size}.txt"
-        if os.path.exists(filename):
+        if os.path.exists(filename) and os.path.exists(grid_file_paths[size]):
             print(f"File {filename} already exists. Skipping generation.")
             continue
             
@@ -123,8 +176,10 @@ def generate_blocked_cells_coord():
             # Write coordinates to file
             for row, col in sorted(blocked_coordinates):
                 file.write(f"{row},{col}\n")
-                
-        print(f"Generated {filename} with {len(blocked_coordinates)} unique blocked cell coordinates.")
+
+        write_grid_file(grid_file_paths[size], rows, cols, blocked_coordinates)
+        print(f"Generated {filename} and {grid_file_paths[size]} with {len(blocked_coordinates)} "
+              "unique blocked cell coordinates.")
 
 def run_cli_with_blocked_cells(file_paths_dict, spinner):
     """
@@ -135,7 +190,7 @@ def run_cli_with_blocked_cells(file_paths_dict, spinner):
     for performance analysis and validation.
     
     Args:
-        file_paths_dict: Dictionary mapping size names to blocked cells file paths
+        file_paths_dict: Dictionary mapping size names to binary grid file paths
         
     Test parameters:
     - Path length: 10% of total matrix cells
@@ -194,15 +249,12 @@ def run_cli_with_blocked_cells(file_paths_dict, spinner):
         
         # Set path length to 10% of total cells (reasonable for testing)
         path_length = int((rows * cols) * 0.008)
-        blocked_cells_file = file_paths_dict[size]
         
-        # Execute pathfinding with blocked cells file
+        # Execute pathfinding with the binary grid file, it loads without parsing
         cmd = [
             path_finder_path,
-            "--rows", str(rows),
-            "--cols", str(cols), 
+            "--gridFile", file_paths_dict[size],
             "--pathLength", str(path_length),
-            "--blockedCellsFile", blocked_cells_file,
         ]
 
         if multithreading_choice in ['y', 'yes']:
@@ -233,4 +285,4 @@ if __name__ == "__main__":
     generate_blocked_cells_coord()
     print("\n=== Running Pathfinding Tests ===")
     spinner = Spinner()
-    run_cli_with_blocked_cells(file_paths, spinner)
\ No newline at end of file
+    run_cli_with_blocked_cells(grid_file_paths, spinner)
\ No newline at end of file